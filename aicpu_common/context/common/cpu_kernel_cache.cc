@@ -536,10 +536,9 @@ std::shared_ptr<CpuKernelContext> CpuKernelCache::GetCpuKernelContext(
         }
     }
 
-    std::string str_data(nodedef, nodedef_len);
     nodedef_proto = CpuKernelUtils::CreateNodeDef();
     KERNEL_CHECK_NULLPTR(nodedef_proto, std::shared_ptr<CpuKernelContext>(nullptr), "Create node def failed.")
-    if (!nodedef_proto->ParseFromString(str_data)) {
+    if (!nodedef_proto->ParseFromArray(nodedef, nodedef_len)) {
         return std::shared_ptr<CpuKernelContext>(nullptr);
     }
 
@@ -720,11 +719,10 @@ std::shared_ptr<CpuKernelContext> CpuKernelCache::GetCpuKernelContextWithBlock(
             return cache->context;
         }
     }
-    std::string str_data(nodedef, nodedef_len);
     nodedef_proto = CpuKernelUtils::CreateNodeDef();
     KERNEL_CHECK_NULLPTR(
         nodedef_proto, std::shared_ptr<CpuKernelContext>(nullptr), "Create node def with block info failed.")
-    if (!nodedef_proto->ParseFromString(str_data)) {
+    if (!nodedef_proto->ParseFromArray(nodedef, nodedef_len)) {
         return std::shared_ptr<CpuKernelContext>(nullptr);
     }
 
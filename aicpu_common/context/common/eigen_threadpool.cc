@@ -9,50 +9,27 @@
  */
 #include "eigen_threadpool.h"
 
-#include <sys/sysinfo.h>
+#include <algorithm>
 
-#include "mmpa/mmpa_api.h"
+#include "eigen_threadpool_manager.h"
 #include "log.h"
 
 namespace {
-const uint32_t kTaskSize = 40000;
-const uint32_t kMaxOverShardingFactor = 4;
-const uint32_t kDecimalScaleNum = 10;
-const uint32_t kTotalCostFactor = 210000;
-constexpr int32_t kMaxCoreNum = 48;
-constexpr uint32_t kMaxTaskSize = kTaskSize * kMaxOverShardingFactor;
+const int64_t kMaxOverShardingFactor = 4;
 } // namespace
 
 namespace aicpu {
 std::mutex EigenThreadPool::mutex_;
 bool EigenThreadPool::init_flag_(false);
 int32_t EigenThreadPool::core_num_(0);
-std::unique_ptr<Eigen::ThreadPool> EigenThreadPool::eigen_threadpool_(nullptr);
-std::unique_ptr<Eigen::ThreadPoolDevice> EigenThreadPool::threadpool_device_(nullptr);
 
 EigenThreadPool* EigenThreadPool::GetInstance()
 {
     if (!init_flag_) {
         std::lock_guard<std::mutex> lock(mutex_);
         if (!init_flag_) {
-            const char* value = nullptr;
-            MM_SYS_GET_ENV(MM_ENV_MAX_COMPILE_CORE_NUMBER, value);
-            core_num_ = -1;
-            if ((value != nullptr) && (value[0U] != '\0')) {
-                try {
-                    core_num_ = std::strtol(&(value[0U]), nullptr, kDecimalScaleNum); // 10 is for 10进制
-                } catch (...) {
-                    KERNEL_LOG_ERROR("eigen thread get core num:%d failed.", core_num_);
-                    return nullptr;
-                }
-            }
-
-            if (core_num_ <= 0 || core_num_ > kMaxCoreNum) {
-                core_num_ = std::min(std::max(1, get_nprocs()), kMaxCoreNum);
-            }
-
-            eigen_threadpool_.reset(new Eigen::ThreadPool(core_num_));
-            threadpool_device_.reset(new Eigen::ThreadPoolDevice(eigen_threadpool_.get(), core_num_));
+            core_num_ = static_cast<int32_t>(
+                EigenThreadPoolManager::GetInstance()->GetCoreLimit(ThreadPoolPriority::NORMAL));
             init_flag_ = true;
             KERNEL_LOG_EVENT("Eigen thread pool init success, core number[%d]", core_num_);
         }
@@ -80,26 +57,17 @@ void EigenThreadPool::ParallelFor(int64_t total, int64_t per_unit_size, const Sh
         return;
     }
 
-    double per_unit_cost = 1.0;
-    if (per_unit_size >= total) {
-        // use the current thread to process the task
-        per_unit_cost = 1.0 * kTaskSize / total;
-    } else if ((per_unit_size) <= (total / core_num_)) {
-        // run tasks with the maximum number of threads, maximum =
-        // kMaxOverShardingFactor * core_num_
-        per_unit_cost = (1.0 * kMaxTaskSize * core_num_ / total) > (1.0 * kTotalCostFactor / total) ?
-                            (1.0 * kMaxTaskSize * core_num_ / total) :
-                            (1.0 * kTotalCostFactor / total);
-    } else {
-        // the task is fragmented based on the number of data slices.
-        per_unit_cost = 1.0 * kMaxTaskSize / per_unit_size;
-    }
+    // the parallelism shrinks while higher priority work holds the shared cpus
+    EigenThreadPoolLease lease(ThreadPoolPriority::NORMAL);
+    int64_t core_num = static_cast<int64_t>(lease.GetWorkerNum());
+    // at most kMaxOverShardingFactor blocks per granted worker, a task not larger than per_unit_size
+    // runs in the current thread
+    int64_t max_block_num = core_num * kMaxOverShardingFactor;
+    int64_t block_size = std::max(per_unit_size, (total + max_block_num - 1) / max_block_num);
 
-    KERNEL_LOG_INFO("Eigen threadpool parallel for, per_unit_cost[%.6f]", per_unit_cost);
+    KERNEL_LOG_INFO("Eigen threadpool parallel for, block_size[%ld], core_num[%ld]", block_size, core_num);
 
-    threadpool_device_->parallelFor(
-        total, Eigen::TensorOpCost(0, 0, per_unit_cost),
-        [&work](Eigen::Index first, Eigen::Index last) { work(first, last); });
+    lease.ParallelFor(total, block_size, work);
     KERNEL_LOG_INFO("Eigen threadpool parallel for success");
 }
 
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "eigen_threadpool_manager.h"
+
+#include <sched.h>
+#include <sys/sysinfo.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include "log.h"
+#include "mmpa/mmpa_api.h"
+
+namespace {
+const uint32_t kDecimalScaleNum = 10;
+constexpr int64_t kMaxCoreNum = 48;
+constexpr int64_t kHalfCoresNum = 2;
+constexpr int64_t kPerformanceMulitCoresNum = 48;
+constexpr int64_t kPerformanceMulitCoresNumForLargeCores = 72;
+const char* const kCgroupV2CpuMax = "/sys/fs/cgroup/cpu.max";
+const char* const kCgroupV1CpuDirs[] = {"/sys/fs/cgroup/cpu", "/sys/fs/cgroup/cpu,cpuacct"};
+constexpr uint64_t kStatsLogInterval = 1024U;
+const char* const kPriorityNames[] = {"embedding", "normal"};
+static_assert(sizeof(kPriorityNames) / sizeof(kPriorityNames[0]) == aicpu::ThreadPoolGrantPolicy::kPriorityNum,
+              "every priority class needs a name");
+
+int64_t GetEnvCoreNum(const char* value)
+{
+    if ((value == nullptr) || (value[0U] == '\0')) {
+        return -1;
+    }
+    return std::strtol(&(value[0U]), nullptr, kDecimalScaleNum);
+}
+
+uint32_t GetAffinityCpuNum()
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+        int32_t cpu_num = CPU_COUNT(&cpu_set);
+        if (cpu_num > 0) {
+            return static_cast<uint32_t>(cpu_num);
+        }
+    }
+    return static_cast<uint32_t>(std::max(1, get_nprocs()));
+}
+
+/*
+ * Get cpu number limited by cgroup cpu quota
+ * @return cpu number, 0 means no quota
+ */
+uint32_t GetCgroupCpuNum()
+{
+    std::ifstream cpu_max(kCgroupV2CpuMax);
+    if (cpu_max.is_open()) {
+        return aicpu::ParseCgroupV2CpuMax(cpu_max);
+    }
+
+    for (const char* dir : kCgroupV1CpuDirs) {
+        std::ifstream quota_file(std::string(dir) + "/cpu.cfs_quota_us");
+        std::ifstream period_file(std::string(dir) + "/cpu.cfs_period_us");
+        if (quota_file.is_open() && period_file.is_open()) {
+            return aicpu::ParseCgroupV1CpuQuota(quota_file, period_file);
+        }
+    }
+    return 0U;
+}
+
+uint32_t GetNormalCoreLimit(uint32_t cpu_num)
+{
+    const char* value = nullptr;
+    MM_SYS_GET_ENV(MM_ENV_MAX_COMPILE_CORE_NUMBER, value);
+    int64_t core_num = GetEnvCoreNum(value);
+    if ((core_num <= 0) || (core_num > kMaxCoreNum)) {
+        core_num = std::min(static_cast<int64_t>(cpu_num), kMaxCoreNum);
+    }
+    return static_cast<uint32_t>(core_num);
+}
+
+uint32_t GetEmbeddingCoreLimit(uint32_t cpu_num)
+{
+    int64_t core_num = std::min(static_cast<int64_t>(cpu_num) / kHalfCoresNum, kPerformanceMulitCoresNumForLargeCores);
+    const char* value = nullptr;
+    MM_SYS_GET_ENV(MM_ENV_EMBEDDING_MAX_THREAD_CORE_NUMBER, value);
+    int64_t env_core_num = GetEnvCoreNum(value);
+    if (env_core_num != -1) {
+        core_num = env_core_num;
+    }
+    if ((core_num <= 0) || (core_num > static_cast<int64_t>(cpu_num))) {
+        // obtains the number of CPU cores that can be used by embedding users
+        core_num = std::min(static_cast<int64_t>(cpu_num), kPerformanceMulitCoresNum);
+    }
+    return static_cast<uint32_t>(core_num);
+}
+} // namespace
+
+namespace aicpu {
+EigenThreadPoolManager* EigenThreadPoolManager::GetInstance()
+{
+    static EigenThreadPoolManager instance;
+    return &instance;
+}
+
+EigenThreadPoolManager::EigenThreadPoolManager()
+{
+    uint32_t cpu_num = GetAvailableCpuNum();
+    policy_.SetCoreLimit(ThreadPoolPriority::EMBEDDING, GetEmbeddingCoreLimit(cpu_num));
+    policy_.SetCoreLimit(ThreadPoolPriority::NORMAL, GetNormalCoreLimit(cpu_num));
+    eigen_threadpool_.reset(new Eigen::ThreadPool(static_cast<int>(policy_.GetPoolSize())));
+    KERNEL_LOG_EVENT(
+        "Eigen thread pool manager init success, cpu num[%u], cpu budget[%u], normal limit[%u], embedding limit[%u]",
+        cpu_num, policy_.GetPoolSize(), GetCoreLimit(ThreadPoolPriority::NORMAL),
+        GetCoreLimit(ThreadPoolPriority::EMBEDDING));
+}
+
+uint32_t EigenThreadPoolManager::GetAvailableCpuNum()
+{
+    uint32_t cpu_num = GetAffinityCpuNum();
+    uint32_t quota_cpu_num = GetCgroupCpuNum();
+    if ((quota_cpu_num > 0U) && (quota_cpu_num < cpu_num)) {
+        KERNEL_LOG_INFO("Cpu num is limited by cgroup quota from [%u] to [%u]", cpu_num, quota_cpu_num);
+        cpu_num = quota_cpu_num;
+    }
+    return cpu_num;
+}
+
+uint32_t EigenThreadPoolManager::Acquire(ThreadPoolPriority priority) { return policy_.Acquire(priority); }
+
+void EigenThreadPoolManager::Release(ThreadPoolPriority priority, uint32_t workers, uint64_t elapsed_us)
+{
+    if ((policy_.Release(priority, workers, elapsed_us) % kStatsLogInterval) != 0U) {
+        return;
+    }
+    ThreadPoolStats stats = GetStats(priority);
+    KERNEL_LOG_INFO(
+        "Eigen thread pool %s stats: pool size[%u], core limit[%u], active workers[%u], queue depth[%u], "
+        "peak queue depth[%u], task count[%lu], grow count[%lu], shrink count[%lu], utilization[%.3f]",
+        kPriorityNames[static_cast<size_t>(priority)], stats.pool_size, stats.core_limit, stats.active_workers,
+        stats.queue_depth, stats.peak_queue_depth, stats.task_count, stats.grow_count, stats.shrink_count,
+        stats.utilization);
+}
+
+Eigen::ThreadPool* EigenThreadPoolManager::GetThreadPool() const { return eigen_threadpool_.get(); }
+
+uint32_t EigenThreadPoolManager::GetCoreLimit(ThreadPoolPriority priority) const
+{
+    return policy_.GetCoreLimit(priority);
+}
+
+ThreadPoolStats EigenThreadPoolManager::GetStats(ThreadPoolPriority priority) const
+{
+    return policy_.GetStats(priority);
+}
+
+EigenThreadPoolLease::EigenThreadPoolLease(ThreadPoolPriority priority)
+    : priority_(priority),
+      workers_(EigenThreadPoolManager::GetInstance()->Acquire(priority)),
+      start_time_(std::chrono::steady_clock::now())
+{}
+
+EigenThreadPoolLease::~EigenThreadPoolLease()
+{
+    uint64_t elapsed_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time_).count());
+    EigenThreadPoolManager::GetInstance()->Release(priority_, workers_, elapsed_us);
+}
+
+void EigenThreadPoolLease::ParallelFor(int64_t total, int64_t block_size,
+                                       const std::function<void(int64_t, int64_t)>& work) const
+{
+    Eigen::ThreadPool* pool = EigenThreadPoolManager::GetInstance()->GetThreadPool();
+    ParallelForBlocks(
+        total, block_size, workers_, [pool](std::function<void()> fn) { pool->Schedule(std::move(fn)); }, work);
+}
+} // namespace aicpu
@@ -18,6 +18,11 @@ AttrValue::AttrValue(AttrValueImpl* impl) : impl_(impl) {}
  */
 std::string AttrValue::GetString() const { return impl_->GetString(); }
 
+/*
+ * get string value of attr without copy.
+ */
+const std::string& AttrValue::GetStringRef() const { return impl_->GetStringRef(); }
+
 /*
  * get string list size of attr.
  */
@@ -28,6 +33,11 @@ int32_t AttrValue::ListStringSize() const { return impl_->ListStringSize(); }
  */
 std::vector<std::string> AttrValue::GetListString() const { return impl_->GetListString(); }
 
+/*
+ * get string value of attr string list index without copy.
+ */
+const std::string& AttrValue::GetListStringRef(int32_t index) const { return impl_->GetListStringRef(index); }
+
 /*
  * set string list value to attr.
  */
@@ -53,11 +63,26 @@ int64_t AttrValue::GetInt() const { return impl_->GetInt(); }
  */
 std::vector<int64_t> AttrValue::GetListInt() const { return impl_->GetListInt(); }
 
+/*
+ * get int list value of attr without copy.
+ */
+ListView<int64_t> AttrValue::GetListIntView() const { return impl_->GetListIntView(); }
+
 /*
  * get int list list value of attr.
  */
 std::vector<std::vector<int64_t>> AttrValue::GetListListInt() const { return impl_->GetListListInt(); }
 
+/*
+ * get int list list size of attr.
+ */
+int32_t AttrValue::ListListIntSize() const { return impl_->ListListIntSize(); }
+
+/*
+ * get int list value of attr int list list index without copy.
+ */
+ListView<int64_t> AttrValue::GetListListIntView(int32_t index) const { return impl_->GetListListIntView(index); }
+
 /*
  * attr add int value to list.
  */
@@ -93,6 +118,11 @@ float AttrValue::GetFloat() const { return impl_->GetFloat(); }
  */
 std::vector<float> AttrValue::GetListFloat() const { return impl_->GetListFloat(); }
 
+/*
+ * get float list value of attr without copy.
+ */
+ListView<float> AttrValue::GetListFloatView() const { return impl_->GetListFloatView(); }
+
 /*
  * attr add float value to list.
  */
@@ -20,12 +20,17 @@ namespace aicpu {
  */
 std::string AttrValueImpl::GetString() const { return attr_value_->s(); }
 
+/*
+ * get string value of attr without copy.
+ */
+const std::string& AttrValueImpl::GetStringRef() const { return attr_value_->s(); }
+
 /*
  * get string list size of attr.
  */
 int32_t AttrValueImpl::ListStringSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.s_size();
 }
 
@@ -35,13 +40,28 @@ int32_t AttrValueImpl::ListStringSize() const
 std::vector<std::string> AttrValueImpl::GetListString() const
 {
     std::vector<std::string> ret;
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     for (int32_t i = 0; i < array.s_size(); i++) {
         ret.emplace_back(array.s(i));
     }
     return ret;
 }
 
+/*
+ * get string value of attr string list index without copy.
+ */
+const std::string& AttrValueImpl::GetListStringRef(int32_t index) const
+{
+    const auto& array = attr_value_->array();
+    if ((index < 0) || (index >= array.s_size())) {
+        KERNEL_LOG_ERROR("String list index[%d] must be not less than 0 and less than list size[%d]", index,
+                         array.s_size());
+        static const std::string empty_str;
+        return empty_str;
+    }
+    return array.s(index);
+}
+
 /*
  * set string list value to attr.
  */
@@ -80,13 +100,22 @@ int64_t AttrValueImpl::GetInt() const { return attr_value_->i(); }
 std::vector<int64_t> AttrValueImpl::GetListInt() const
 {
     std::vector<int64_t> ret;
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     for (int32_t i = 0; i < array.i_size(); i++) {
         ret.emplace_back(array.i(i));
     }
     return ret;
 }
 
+/*
+ * get int list value of attr without copy.
+ */
+ListView<int64_t> AttrValueImpl::GetListIntView() const
+{
+    const auto& array = attr_value_->array();
+    return ListView<int64_t>(array.i().data(), array.i_size());
+}
+
 /*
  * attr add int value to list.
  */
@@ -102,7 +131,7 @@ void AttrValueImpl::AddListInt(int64_t i)
  */
 int32_t AttrValueImpl::ListIntSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.i_size();
 }
 
@@ -128,7 +157,7 @@ void AttrValueImpl::SetListInt(const std::vector<int64_t>& list)
  */
 std::vector<std::vector<int64_t>> AttrValueImpl::GetListListInt() const
 {
-    auto array = attr_value_->list_list_int();
+    const auto& array = attr_value_->list_list_int();
     std::vector<std::vector<int64_t>> ret;
     for (auto idx = 0; idx < array.list_list_i_size(); ++idx) {
         std::vector<int64_t> vec;
@@ -140,6 +169,26 @@ std::vector<std::vector<int64_t>> AttrValueImpl::GetListListInt() const
     return ret;
 }
 
+/*
+ * get int list list size of attr.
+ */
+int32_t AttrValueImpl::ListListIntSize() const { return attr_value_->list_list_int().list_list_i_size(); }
+
+/*
+ * get int list value of attr int list list index without copy.
+ */
+ListView<int64_t> AttrValueImpl::GetListListIntView(int32_t index) const
+{
+    const auto& array = attr_value_->list_list_int();
+    if ((index < 0) || (index >= array.list_list_i_size())) {
+        KERNEL_LOG_ERROR("Int list list index[%d] must be not less than 0 and less than list size[%d]", index,
+                         array.list_list_i_size());
+        return ListView<int64_t>();
+    }
+    const auto& list_i = array.list_list_i(index).list_i();
+    return ListView<int64_t>(list_i.data(), list_i.size());
+}
+
 /*
  * set int list list value to attr.
  */
@@ -166,13 +215,22 @@ float AttrValueImpl::GetFloat() const { return attr_value_->f(); }
 std::vector<float> AttrValueImpl::GetListFloat() const
 {
     std::vector<float> ret;
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     for (int32_t i = 0; i < array.f_size(); i++) {
         ret.emplace_back(array.f(i));
     }
     return ret;
 }
 
+/*
+ * get float list value of attr without copy.
+ */
+ListView<float> AttrValueImpl::GetListFloatView() const
+{
+    const auto& array = attr_value_->array();
+    return ListView<float>(array.f().data(), array.f_size());
+}
+
 /*
  * attr add float value to list.
  */
@@ -193,7 +251,7 @@ void AttrValueImpl::SetFloat(float f) { attr_value_->set_f(f); }
  */
 int32_t AttrValueImpl::ListFloatSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.f_size();
 }
 
@@ -220,7 +278,7 @@ bool AttrValueImpl::GetBool() const { return attr_value_->b(); }
 std::vector<bool> AttrValueImpl::GetListBool() const
 {
     std::vector<bool> ret;
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     for (int32_t i = 0; i < array.b_size(); i++) {
         ret.push_back(array.b(i));
     }
@@ -242,7 +300,7 @@ void AttrValueImpl::AddListBool(bool b)
  */
 int32_t AttrValueImpl::ListBoolSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.b_size();
 }
 
@@ -274,7 +332,7 @@ DataType AttrValueImpl::GetDataType() const { return static_cast<DataType>(attr_
 std::vector<DataType> AttrValueImpl::GetListDataType() const
 {
     std::vector<DataType> ret;
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     for (int32_t i = 0; i < array.type_size(); i++) {
         ret.emplace_back(static_cast<DataType>(array.type(i)));
     }
@@ -296,7 +354,7 @@ void AttrValueImpl::AddListDataType(DataType type)
  */
 int32_t AttrValueImpl::ListDataTypeSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.type_size();
 }
 
@@ -451,7 +509,7 @@ std::vector<TensorShape> AttrValueImpl::GetListTensorShape() const
  */
 int32_t AttrValueImpl::ListTensorShapeSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.shape_size();
 }
 
@@ -586,7 +644,7 @@ std::vector<Tensor> AttrValueImpl::GetListTensor() const
  */
 int32_t AttrValueImpl::ListTensorSize() const
 {
-    auto array = attr_value_->array();
+    const auto& array = attr_value_->array();
     return array.tensor_size();
 }
 
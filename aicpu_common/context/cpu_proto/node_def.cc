@@ -18,6 +18,11 @@ NodeDef::NodeDef(NodeDefImpl* impl) : impl_(impl) {}
  */
 bool NodeDef::ParseFromString(const std::string& str) { return impl_->ParseFromString(str); }
 
+/*
+ * parse parameter from buffer.
+ */
+bool NodeDef::ParseFromArray(const void* data, uint32_t size) { return impl_->ParseFromArray(data, size); }
+
 /*
  * serialize string to node def.
  */
@@ -9,6 +9,8 @@
  */
 #include "node_def_impl.h"
 
+#include <limits>
+
 #include "attr_value_impl.h"
 #include "cpu_kernel_utils.h"
 #include "log.h"
@@ -29,6 +31,23 @@ bool NodeDefImpl::ParseFromString(const std::string& str)
     return true;
 }
 
+/*
+ * parse parameter from buffer.
+ */
+bool NodeDefImpl::ParseFromArray(const void* data, uint32_t size)
+{
+    if (size > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+        KERNEL_LOG_ERROR("ParseFromArray failed, size[%u] exceeds the limit of protobuf", size);
+        return false;
+    }
+    if (!nodedef_->ParseFromArray(data, static_cast<int32_t>(size))) {
+        KERNEL_LOG_ERROR("ParseFromArray failed, size[%u]", size);
+        return false;
+    }
+
+    return true;
+}
+
 /*
  * serialize string to node def.
  */
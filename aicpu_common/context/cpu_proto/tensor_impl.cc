@@ -21,6 +21,11 @@ namespace aicpu {
  */
 std::shared_ptr<TensorShape> TensorImpl::GetTensorShape() const
 {
+    std::lock_guard<std::mutex> lock(shape_mutex_);
+    if (shape_ != nullptr) {
+        return shape_;
+    }
+
     aicpuops::TensorShape* tensor_shape = tensor_->mutable_tensor_shape();
     if (tensor_shape == nullptr) {
         KERNEL_LOG_ERROR("Protobuf mutable tensor shape is null.");
@@ -37,6 +42,8 @@ std::shared_ptr<TensorShape> TensorImpl::GetTensorShape() const
     if (aicpu_shape == nullptr) {
         delete impl;
     }
+    // the shape wraps the tensor shape proto owned by tensor_, which lives as long as this tensor
+    shape_ = aicpu_shape;
     return aicpu_shape;
 }
 
@@ -94,6 +101,11 @@ void TensorImpl::SetDataSize(uint64_t size) { tensor_->set_data_size(size); }
  */
 std::string TensorImpl::GetName() const { return tensor_->name(); }
 
+/*
+ * get name of tensor without copy.
+ */
+const std::string& TensorImpl::GetNameRef() const { return tensor_->name(); }
+
 /*
  * set name of tensor.
  */
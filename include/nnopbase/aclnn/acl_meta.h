@@ -117,6 +117,31 @@ ACL_FUNC_VISIBILITY aclnnStatus aclGetRawTensorAddr(const aclTensor* tensor, voi
  */
 ACL_FUNC_VISIBILITY aclnnStatus aclDumpOpTensors(const char* opType, const char* opName, aclTensor** tensors,
                                                  size_t inputTensorNum, size_t outputTensorNum, aclrtStream stream);
+/**
+ * @ingroup AscendCL
+ * @brief Pre-warm the kernels of a prewarm list on background threads, in the context of the calling thread
+ * @param [in] prewarmListPath: Json file listing op types with tensor descriptors, shape buckets and attrs
+ * @retval 0: the list is parsed and queued, other value: failure
+ * @since Created on 2026/10/19
+ */
+ACL_FUNC_VISIBILITY aclnnStatus aclnnPrewarmKernels(const char* prewarmListPath);
+/**
+ * @ingroup AscendCL
+ * @brief Get the progress of the pre-warm tasks queued so far
+ * @param [out] totalNum: Number of tasks queued
+ * @param [out] doneNum: Number of tasks finished successfully
+ * @param [out] failedNum: Number of tasks finished with an error
+ * @retval 0: success, other value: failure
+ * @since Created on 2026/10/19
+ */
+ACL_FUNC_VISIBILITY aclnnStatus aclnnGetPrewarmProgress(uint64_t* totalNum, uint64_t* doneNum, uint64_t* failedNum);
+/**
+ * @ingroup AscendCL
+ * @brief Block until every pre-warm task queued so far has finished
+ * @retval 0: success, other value: failure
+ * @since Created on 2026/10/19
+ */
+ACL_FUNC_VISIBILITY aclnnStatus aclnnWaitPrewarm();
 
 #ifdef __cplusplus
 }
@@ -11,6 +11,7 @@
 #ifndef OP_API_COMMON_INC_OPDEV_AICPU_AICPU_EXT_INFO_H_
 #define OP_API_COMMON_INC_OPDEV_AICPU_AICPU_EXT_INFO_H_
 
+#include <memory>
 #include "aicpu_utils.h"
 #include "aicpu_engine_struct.h"
 #include "exe_graph/runtime/shape.h"
@@ -25,6 +26,20 @@ using AicpuShapeAndType = aicpu::FWKAdapter::ShapeAndType;
 using AicpuExtInfo = aicpu::FWKAdapter::ExtInfo;
 using AicpuSessionInfo = SessionInfo;
 
+constexpr size_t kInvalidExtInfoOffset = SIZE_MAX;
+
+class ShapeFuture;
+
+// Ext info image shared by all tasks with the same op type, io num, shape type and kernel kind.
+// Only the ShapeAndType slots and the kernel id differ between tasks, so their offsets are kept
+// and a task patches them in place instead of assembling and re-parsing the whole buffer.
+struct AicpuExtInfoLayout {
+    std::string image;
+    size_t inputShapeOffset = kInvalidExtInfoOffset;
+    size_t outputShapeOffset = kInvalidExtInfoOffset;
+    size_t sessionInfoOffset = kInvalidExtInfoOffset;
+};
+
 class AicpuExtInfoHandler {
 public:
     AicpuExtInfoHandler(const std::string& nodeName, const uint32_t inputNum, const uint32_t outputNum,
@@ -41,6 +56,10 @@ public:
 
     aclnnStatus Parse(const std::string& extInfo, uint8_t* hostAddr);
 
+    aclnnStatus GetExtInfoLayout(const bool isTf, std::shared_ptr<const AicpuExtInfoLayout>& layout) const;
+    aclnnStatus ApplyExtInfoLayout(const AicpuExtInfoLayout& layout, const FVector<const aclTensor*>& inputs,
+                                   const FVector<aclTensor*>& outputs, const bool isTf, uint8_t* hostAddr);
+
     aclnnStatus UpdateInputShape(const uint32_t inputIndex, const gert::Shape& inputShape);
     aclnnStatus UpdateOutputShape(const uint32_t outputIndex, const gert::Shape& outputShape);
 
@@ -52,6 +71,8 @@ public:
                                        uint64_t& deviceCacheOffset);
     static uint64_t GenerateKernelId();
     aclnnStatus UpdateOutputShapeFromExtInfo(const FVector<aclTensor*>& outputs, aclrtStream stream);
+    // Enqueue the output shape copy and attach a shape future to outputs instead of synchronizing the stream.
+    aclnnStatus DeferOutputShapeFromExtInfo(const FVector<aclTensor*>& outputs, aclrtStream stream);
     aclnnStatus UpdateInputAndOutputShape(const FVector<const aclTensor*>& inputs, const FVector<aclTensor*>& outputs,
                                           aclrtStream stream, const aclOpExecutor* executor,
                                           const uint64_t deviceExtMemSize, uint64_t& deviceCacheOffset);
@@ -74,6 +95,10 @@ private:
                                    const aicpu::FWKAdapter::FWKTaskExtInfoType type, std::string& taskExtInfo,
                                    bool isTf = false) const;
     aclnnStatus AppendSessionInfo(std::string& taskExtInfo) const;
+    aclnnStatus BuildExtInfoLayout(const bool isTf, AicpuExtInfoLayout& layout) const;
+    aclnnStatus FillShapeAndType(const FVector<const aclTensor*>& tensors,
+                                 const aicpu::FWKAdapter::FWKTaskExtInfoType type, AicpuShapeAndType* slots,
+                                 bool isTf) const;
 
     static aclnnStatus UpdateShape(const gert::Shape& shape, AicpuShapeAndType* const shapeAndType);
 
@@ -98,6 +123,10 @@ private:
     std::vector<AicpuShapeAndType> outputShape_;
     size_t outputShapeOffset_ = 0U;
     size_t outputShapeLen_ = 0U;
+    size_t sessionInfoOffset_ = kInvalidExtInfoOffset;
+    // pinned staging of the deferred output shape copy, shared with the future that reads it
+    std::shared_ptr<void> hostOutputShape_;
+    std::shared_ptr<ShapeFuture> pendingShape_;
     void* workspace_ = nullptr;
     ;
 };
@@ -11,6 +11,7 @@
 #ifndef OP_API_COMMON_INC_OPDEV_COMMON_TYPES_H_
 #define OP_API_COMMON_INC_OPDEV_COMMON_TYPES_H_
 
+#include <atomic>
 #include <map>
 #include <securec.h>
 #include <unordered_set>
@@ -203,6 +204,17 @@ public:
     bool IsEmpty() const;
 
     ge::AscendString ToString() const;
+
+    /**
+     * Get the fingerprint of the fields the op cache keys are built from, computed on first use and recomputed
+     * after a setter changed the shapes, strides, offset, formats or data type.
+     */
+    uint64_t GetSignature() const;
+    /**
+     * Drop the cached fingerprint, needed after writing the shapes without a setter, e.g. through GetTensor().
+     */
+    void InvalidateSignature() const;
+
     void SetFromWorkspace(bool from_workspace) const;
     bool IsFromWorkspace() const;
 
@@ -263,7 +275,7 @@ private:
     op::Shape viewShape_{0};
     op::Format viewFormat_;
     bool isView_{false};
-    uint8_t reserved_field_[8]{0};
+    mutable std::atomic<uint64_t> signature_{0U};
 };
 
 struct aclTensorList : public op::Object {
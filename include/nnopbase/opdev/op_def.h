@@ -45,10 +45,17 @@ enum class OpExecMode : uint32_t {
     OP_EXEC_MODE_RESERVED = 0xFFFFFFFF
 };
 
+/**
+ * Op type name <-> id dictionary. Ids are never removed, so ToOpType, ToString and ToStringRef do not lock, and the
+ * string returned by ToStringRef stays valid for the lifetime of the process. Add is serialized with the other
+ * writers. opTypeName_ and opTypeName2Id_ are kept for binaries built against former versions, they are only
+ * appended to by Add.
+ */
 struct OpTypeDict {
     static aclnnStatus Add(uint32_t& id, const char* opName);
     static uint32_t ToOpType(const std::string& opName);
     static const ge::AscendString ToString(uint32_t opType);
+    static const ge::AscendString& ToStringRef(uint32_t opType);
     static size_t GetAllOpTypeSize();
     static std::vector<ge::AscendString>& opTypeName_;
     static std::unordered_map<std::string, uint32_t>& opTypeName2Id_;
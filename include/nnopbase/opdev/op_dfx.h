@@ -15,6 +15,7 @@
 #include <string_view>
 #include <vector>
 #include <tuple>
+#include <type_traits>
 #include <map>
 
 #include "graph/ascend_string.h"
@@ -74,6 +75,13 @@ struct OpProfilingSwitch {
 
 extern OpProfilingSwitch opProfilingSwitch;
 
+struct OpTraceSwitch {
+    OpTraceSwitch();
+    bool recordFlag;
+};
+
+extern OpTraceSwitch opTraceSwitch;
+
 struct OpLogInfo {
     OpLogInfo() { Init(); }
     OpLogInfo(const OpLogInfo& rhs)
@@ -184,6 +192,56 @@ static void AddOutputTensorsToThreadLocalCtx(const std::tuple<Args...>& t)
         t);
 }
 
+void BeginL2Trace(const char* funcName);
+void EndL2Trace(const char* funcName);
+void AddTensorToTrace(const aclTensor* const t, bool isOutput);
+void AddTensorToTrace(const aclTensorList* const t, bool isOutput);
+void AddArrayToTrace(const aclIntArray* const array, bool isOutput);
+void AddArrayToTrace(const aclFloatArray* const array, bool isOutput);
+void AddArrayToTrace(const aclBoolArray* const array, bool isOutput);
+void AddScalarToTrace(const aclScalar* const scalar, bool isOutput);
+void AddIntToTrace(int64_t value, bool isOutput);
+void AddFloatToTrace(double value, bool isOutput);
+void AddBoolToTrace(bool value, bool isOutput);
+void AddStringToTrace(const char* value, bool isOutput);
+void AddUnknownToTrace(bool isOutput);
+
+template <typename T>
+static void AddArgToTrace(const T& arg, bool isOutput)
+{
+    using BaseT = std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>;
+    if constexpr (std::is_pointer_v<std::decay_t<T>> &&
+                  (std::is_same_v<BaseT, aclTensor> || std::is_same_v<BaseT, aclTensorList>)) {
+        AddTensorToTrace(arg, isOutput);
+    } else if constexpr (std::is_pointer_v<std::decay_t<T>> &&
+                         (std::is_same_v<BaseT, aclIntArray> || std::is_same_v<BaseT, aclFloatArray> ||
+                          std::is_same_v<BaseT, aclBoolArray>)) {
+        AddArrayToTrace(arg, isOutput);
+    } else if constexpr (std::is_pointer_v<std::decay_t<T>> && std::is_same_v<BaseT, aclScalar>) {
+        AddScalarToTrace(arg, isOutput);
+    } else if constexpr (std::is_pointer_v<std::decay_t<T>> && std::is_same_v<BaseT, char>) {
+        AddStringToTrace(arg, isOutput);
+    } else if constexpr (std::is_same_v<std::decay_t<T>, bool>) {
+        AddBoolToTrace(arg, isOutput);
+    } else if constexpr (std::is_integral_v<std::decay_t<T>> || std::is_enum_v<std::decay_t<T>>) {
+        AddIntToTrace(static_cast<int64_t>(arg), isOutput);
+    } else if constexpr (std::is_floating_point_v<std::decay_t<T>>) {
+        AddFloatToTrace(static_cast<double>(arg), isOutput);
+    } else {
+        AddUnknownToTrace(isOutput);
+    }
+}
+
+template <typename T>
+static void AddArgsToTrace([[maybe_unused]] const T& t, [[maybe_unused]] bool isOutput)
+{}
+
+template <typename... Args>
+static void AddArgsToTrace(const std::tuple<Args...>& t, bool isOutput)
+{
+    std::apply([isOutput](const auto&... args) { (AddArgToTrace(args, isOutput), ...); }, t);
+}
+
 enum OpLevel { LevelZero, LevelOne, LevelTwo };
 enum DfxProfilingType { DfxProfilingDefault, DfxProfilingInferShape, DFXProfilingTiling, DfxProfilingKernelLaunch };
 
@@ -217,6 +275,11 @@ public:
             AddInputTensorsToThreadLocalCtx(in);
             AddOutputTensorsToThreadLocalCtx(out);
         }
+        if (op::internal::opTraceSwitch.recordFlag) {
+            BeginL2Trace(funcName);
+            AddArgsToTrace(in, false);
+            AddArgsToTrace(out, true);
+        }
     }
 
     // L2_DFX PHASE_TWO
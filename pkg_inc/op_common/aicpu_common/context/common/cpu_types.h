@@ -11,6 +11,7 @@
 #ifndef CPU_KERNEL_TYPES_H
 #define CPU_KERNEL_TYPES_H
 
+#include <cstdint>
 #include <map>
 
 namespace aicpu {
@@ -145,5 +146,27 @@ enum Format {
 };
 
 enum DeviceType { HOST, DEVICE };
+
+/*
+ * read only view of a contiguous list owned by node def, no copy is made.
+ * the view is invalid once the list is modified or the node def is released.
+ */
+template <typename T>
+class ListView {
+public:
+    ListView() = default;
+    ListView(const T* data, int32_t size) : data_(data), size_(size) {}
+
+    const T* Data() const { return data_; }
+    int32_t Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    const T& operator[](int32_t index) const { return data_[index]; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+private:
+    const T* data_ = nullptr;
+    int32_t size_ = 0;
+};
 } // namespace aicpu
 #endif // CPU_KERNEL_TYPES_H
@@ -40,8 +40,6 @@ private:
     static std::mutex mutex_; // protect init_flag_
     static bool init_flag_;   // true means initialized
     static int32_t core_num_; // the number of CPU cores that can be used by users
-    static std::unique_ptr<Eigen::ThreadPool> eigen_threadpool_;
-    static std::unique_ptr<Eigen::ThreadPoolDevice> threadpool_device_;
 };
 }; // namespace aicpu
 #endif // AICPU_CONTEXT_COMMON_EIGEN_THREAD_POOL_EMBEDDING_H
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef AICPU_CONTEXT_COMMON_EIGEN_THREAD_POOL_MANAGER_H
+#define AICPU_CONTEXT_COMMON_EIGEN_THREAD_POOL_MANAGER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "thread_pool_policy.h"
+
+namespace aicpu {
+/*
+ * EigenThreadPoolManager owns the one Eigen thread pool shared by EigenThreadPool and EigenThreadPoolEmbedding.
+ * The pool is sized to the cpus this process may run on (affinity mask and cgroup cpu quota), and every
+ * ParallelFor is granted a parallelism according to its priority class and the workers already held by other
+ * calls. The grant bounds the blocks a call runs at once, and a caller runs its own blocks when the helpers it
+ * scheduled are queued behind other work, so embedding never waits for host kernel shards.
+ */
+class EigenThreadPoolManager {
+public:
+    static EigenThreadPoolManager* GetInstance();
+
+    /*
+     * Acquire workers for one ParallelFor, must be paired with Release
+     * @param priority: priority class of the caller
+     * @return granted parallelism, at least 1
+     */
+    uint32_t Acquire(ThreadPoolPriority priority);
+
+    /*
+     * Release workers acquired by Acquire
+     * @param priority: priority class of the caller
+     * @param workers: parallelism returned by Acquire
+     * @param elapsed_us: execution time of the ParallelFor
+     */
+    void Release(ThreadPoolPriority priority, uint32_t workers, uint64_t elapsed_us);
+
+    /*
+     * Get the Eigen thread pool shared by all priority classes
+     * @return thread pool
+     */
+    Eigen::ThreadPool* GetThreadPool() const;
+
+    /*
+     * Get max parallelism of the priority class
+     * @return max parallelism
+     */
+    uint32_t GetCoreLimit(ThreadPoolPriority priority) const;
+
+    /*
+     * Get utilization and queue depth statistics of the priority class
+     * @return statistics
+     */
+    ThreadPoolStats GetStats(ThreadPoolPriority priority) const;
+
+    /*
+     * Get the number of cpus this process may run on, limited by
+     * sched affinity and cgroup cpu quota
+     * @return cpu number, at least 1
+     */
+    static uint32_t GetAvailableCpuNum();
+
+private:
+    EigenThreadPoolManager();
+    ~EigenThreadPoolManager() = default;
+
+    EigenThreadPoolManager(const EigenThreadPoolManager&) = delete;
+    EigenThreadPoolManager(EigenThreadPoolManager&&) = delete;
+    EigenThreadPoolManager& operator=(const EigenThreadPoolManager&) = delete;
+    EigenThreadPoolManager& operator=(EigenThreadPoolManager&&) = delete;
+
+    ThreadPoolGrantPolicy policy_;
+    std::unique_ptr<Eigen::ThreadPool> eigen_threadpool_;
+};
+
+/*
+ * Workers leased from EigenThreadPoolManager for the lifetime of the object.
+ */
+class EigenThreadPoolLease {
+public:
+    explicit EigenThreadPoolLease(ThreadPoolPriority priority);
+    ~EigenThreadPoolLease();
+
+    uint32_t GetWorkerNum() const { return workers_; }
+
+    /*
+     * Run work over [0, total) in blocks of block_size, at most GetWorkerNum() blocks at once
+     */
+    void ParallelFor(int64_t total, int64_t block_size, const std::function<void(int64_t, int64_t)>& work) const;
+
+    EigenThreadPoolLease(const EigenThreadPoolLease&) = delete;
+    EigenThreadPoolLease(EigenThreadPoolLease&&) = delete;
+    EigenThreadPoolLease& operator=(const EigenThreadPoolLease&) = delete;
+    EigenThreadPoolLease& operator=(EigenThreadPoolLease&&) = delete;
+
+private:
+    ThreadPoolPriority priority_;
+    uint32_t workers_;
+    std::chrono::steady_clock::time_point start_time_;
+};
+}; // namespace aicpu
+#endif // AICPU_CONTEXT_COMMON_EIGEN_THREAD_POOL_MANAGER_H
@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef AICPU_CONTEXT_COMMON_THREAD_POOL_POLICY_H
+#define AICPU_CONTEXT_COMMON_THREAD_POOL_POLICY_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace aicpu {
+/*
+ * Priority class of the thread pool users, smaller value means higher priority.
+ * A higher priority class is not limited by the workers held by lower classes.
+ */
+enum class ThreadPoolPriority : uint32_t {
+    EMBEDDING = 0, // embedding kernels, latency sensitive
+    NORMAL,        // host cpu kernels
+    PRIORITY_END
+};
+
+struct ThreadPoolStats {
+    uint32_t pool_size = 0U;        // cpu budget shared by all priority classes
+    uint32_t core_limit = 0U;       // max parallelism of the priority class
+    uint32_t active_workers = 0U;   // parallelism granted to the latest ParallelFor
+    uint32_t queue_depth = 0U;      // ParallelFor calls in flight
+    uint32_t peak_queue_depth = 0U; // max ParallelFor calls in flight
+    uint64_t task_count = 0U;       // ParallelFor calls finished
+    uint64_t grow_count = 0U;       // times the granted parallelism grows
+    uint64_t shrink_count = 0U;     // times the granted parallelism shrinks
+    double utilization = 0.0;       // busy worker time / (elapsed time * pool_size)
+};
+
+/*
+ * Convert a cfs quota to a cpu number, rounded up: a quota of 1.5 cpus still needs 2 workers to consume it
+ * @return cpu number, 0 means no quota
+ */
+inline uint32_t QuotaToCpuNum(int64_t quota, int64_t period)
+{
+    if ((quota <= 0) || (period <= 0)) {
+        return 0U;
+    }
+    return static_cast<uint32_t>((quota + period - 1) / period);
+}
+
+/*
+ * Parse cgroup v2 cpu.max: "<quota> <period>" or "max <period>"
+ * @return cpu number, 0 means no quota
+ */
+inline uint32_t ParseCgroupV2CpuMax(std::istream& cpu_max)
+{
+    std::string quota;
+    int64_t period = 0;
+    if (!(cpu_max >> quota >> period) || (quota == "max")) {
+        return 0U;
+    }
+    char* end = nullptr;
+    const int64_t quota_us = std::strtoll(quota.c_str(), &end, 10);
+    if ((end == quota.c_str()) || (*end != '\0')) {
+        return 0U;
+    }
+    return QuotaToCpuNum(quota_us, period);
+}
+
+/*
+ * Parse cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us, the quota is -1 when not limited
+ * @return cpu number, 0 means no quota or the files can not be parsed
+ */
+inline uint32_t ParseCgroupV1CpuQuota(std::istream& quota_file, std::istream& period_file)
+{
+    int64_t quota = -1;
+    int64_t period = 0;
+    if (!(quota_file >> quota) || !(period_file >> period)) {
+        return 0U;
+    }
+    return QuotaToCpuNum(quota, period);
+}
+
+/*
+ * ThreadPoolGrantPolicy decides the parallelism of every ParallelFor, ParallelForBlocks enforces it. All priority classes share one cpu budget:
+ * a call is granted the cpus left idle by its own class and the higher ones, capped by the limit of its class.
+ * Lower classes shrink while higher ones are busy and grow back when they finish.
+ */
+class ThreadPoolGrantPolicy {
+public:
+    static constexpr size_t kPriorityNum = static_cast<size_t>(ThreadPoolPriority::PRIORITY_END);
+
+    ThreadPoolGrantPolicy() : start_time_(std::chrono::steady_clock::now()) {}
+
+    /*
+     * Set max parallelism of the priority class, the cpu budget follows the largest class limit
+     */
+    void SetCoreLimit(ThreadPoolPriority priority, uint32_t core_limit)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        states_[static_cast<size_t>(priority)].core_limit = std::max(1U, core_limit);
+        pool_size_ = 0U;
+        for (const auto& state : states_) {
+            pool_size_ = std::max(pool_size_, state.core_limit);
+        }
+    }
+
+    uint32_t GetCoreLimit(ThreadPoolPriority priority) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return states_[static_cast<size_t>(priority)].core_limit;
+    }
+
+    uint32_t GetPoolSize() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pool_size_;
+    }
+
+    /*
+     * Grant the parallelism of one ParallelFor, must be paired with Release
+     * @return granted parallelism, at least 1
+     */
+    uint32_t Acquire(ThreadPoolPriority priority)
+    {
+        const size_t index = static_cast<size_t>(priority);
+        std::lock_guard<std::mutex> lock(mutex_);
+        // workers held by lower priority classes are not deducted, they yield to higher ones
+        uint32_t busy_workers = 0U;
+        for (size_t i = 0U; i <= index; i++) {
+            busy_workers += states_[i].busy_workers;
+        }
+        PriorityState& state = states_[index];
+        const uint32_t idle_workers = (busy_workers < pool_size_) ? (pool_size_ - busy_workers) : 0U;
+        const uint32_t granted = std::max(1U, std::min(idle_workers, state.core_limit));
+        if ((state.last_granted != 0U) && (granted > state.last_granted)) {
+            state.grow_count++;
+        } else if (granted < state.last_granted) {
+            state.shrink_count++;
+        }
+        state.last_granted = granted;
+        state.busy_workers += granted;
+        state.queue_depth++;
+        state.peak_queue_depth = std::max(state.peak_queue_depth, state.queue_depth);
+        return granted;
+    }
+
+    /*
+     * Release the parallelism granted by Acquire
+     * @return ParallelFor calls finished by the priority class
+     */
+    uint64_t Release(ThreadPoolPriority priority, uint32_t workers, uint64_t elapsed_us)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        PriorityState& state = states_[static_cast<size_t>(priority)];
+        state.busy_workers = (state.busy_workers > workers) ? (state.busy_workers - workers) : 0U;
+        state.queue_depth = (state.queue_depth > 0U) ? (state.queue_depth - 1U) : 0U;
+        state.task_count++;
+        state.busy_worker_us += elapsed_us * workers;
+        return state.task_count;
+    }
+
+    ThreadPoolStats GetStats(ThreadPoolPriority priority) const
+    {
+        const uint64_t elapsed_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time_)
+                .count());
+        std::lock_guard<std::mutex> lock(mutex_);
+        const PriorityState& state = states_[static_cast<size_t>(priority)];
+        ThreadPoolStats stats;
+        stats.pool_size = pool_size_;
+        stats.core_limit = state.core_limit;
+        stats.active_workers = state.last_granted;
+        stats.queue_depth = state.queue_depth;
+        stats.peak_queue_depth = state.peak_queue_depth;
+        stats.task_count = state.task_count;
+        stats.grow_count = state.grow_count;
+        stats.shrink_count = state.shrink_count;
+        if ((elapsed_us > 0U) && (pool_size_ > 0U)) {
+            stats.utilization = static_cast<double>(state.busy_worker_us) / elapsed_us / pool_size_;
+        }
+        return stats;
+    }
+
+private:
+    struct PriorityState {
+        uint32_t core_limit = 1U;
+        uint32_t busy_workers = 0U;
+        uint32_t last_granted = 0U;
+        uint32_t queue_depth = 0U;
+        uint32_t peak_queue_depth = 0U;
+        uint64_t task_count = 0U;
+        uint64_t grow_count = 0U;
+        uint64_t shrink_count = 0U;
+        uint64_t busy_worker_us = 0U;
+    };
+
+    mutable std::mutex mutex_; // protect states_ and pool_size_
+    PriorityState states_[kPriorityNum];
+    uint32_t pool_size_ = 1U;
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+/*
+ * Run work over [0, total) in blocks of block_size, with at most max_workers blocks running at once. The caller
+ * and up to max_workers - 1 helpers passed to schedule claim blocks from a shared counter. A helper that starts
+ * after all blocks are claimed returns at once, so the caller never waits for helpers queued behind other work,
+ * and work is not touched once the call returns.
+ * @param schedule: runs a std::function<void()> on another thread
+ */
+template <typename Schedule>
+void ParallelForBlocks(int64_t total, int64_t block_size, uint32_t max_workers, Schedule&& schedule,
+                       const std::function<void(int64_t, int64_t)>& work)
+{
+    if ((total <= 0) || (block_size <= 0)) {
+        return;
+    }
+    struct BlockState {
+        std::atomic<int64_t> next_block{0};
+        std::atomic<int64_t> done_block{0};
+        int64_t block_num = 0;
+        int64_t total = 0;
+        int64_t block_size = 0;
+        const std::function<void(int64_t, int64_t)>* work = nullptr;
+        std::mutex mutex;
+        std::condition_variable done_cond;
+    };
+    auto state = std::make_shared<BlockState>();
+    state->total = total;
+    state->block_size = block_size;
+    state->block_num = (total + block_size - 1) / block_size;
+    state->work = &work;
+    auto run_blocks = [state]() {
+        for (int64_t block = state->next_block.fetch_add(1); block < state->block_num;
+             block = state->next_block.fetch_add(1)) {
+            const int64_t first = block * state->block_size;
+            (*state->work)(first, std::min(state->total, first + state->block_size));
+            if (state->done_block.fetch_add(1) + 1 == state->block_num) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->done_cond.notify_all();
+            }
+        }
+    };
+    const int64_t helper_num = std::min(static_cast<int64_t>(std::max(1U, max_workers)) - 1, state->block_num - 1);
+    for (int64_t i = 0; i < helper_num; i++) {
+        schedule(std::function<void()>(run_blocks));
+    }
+    run_blocks();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done_cond.wait(lock, [&state]() { return state->done_block.load() == state->block_num; });
+}
+}; // namespace aicpu
+#endif // AICPU_CONTEXT_COMMON_THREAD_POOL_POLICY_H
@@ -36,12 +36,25 @@ public:
      */
     std::string GetString() const;
 
+    /*
+     * get string value of attr without copy.
+     * @return const string&: string value of attr, valid until attr is modified
+     */
+    const std::string& GetStringRef() const;
+
     /*
      * get string list value of attr.
      * @return vector<std::string>: string list value of attr
      */
     std::vector<std::string> GetListString() const;
 
+    /*
+     * get string value of attr string list index without copy.
+     * @param index: index of string list, must be less than ListStringSize()
+     * @return const string&: string value of attr string list index
+     */
+    const std::string& GetListStringRef(int32_t index) const;
+
     /*
      * attr add string value to list.
      * @param string: string value need to add to list
@@ -78,6 +91,12 @@ public:
      */
     std::vector<int64_t> GetListInt() const;
 
+    /*
+     * get int list value of attr without copy.
+     * @return ListView<int64_t>: int list value of attr, valid until attr is modified
+     */
+    ListView<int64_t> GetListIntView() const;
+
     /*
      * attr add int value to list.
      * @param i: int value need to add to list
@@ -108,6 +127,19 @@ public:
      */
     std::vector<std::vector<int64_t>> GetListListInt() const;
 
+    /*
+     * get int list list size of attr.
+     * @return int32_t: int list list size of attr
+     */
+    int32_t ListListIntSize() const;
+
+    /*
+     * get int list value of attr int list list index without copy.
+     * @param index: index of int list list, must be less than ListListIntSize()
+     * @return ListView<int64_t>: int list value of attr int list list index
+     */
+    ListView<int64_t> GetListListIntView(int32_t index) const;
+
     /*
      * set int list list value to attr.
      * @param vector<vector<int64_t>>: int list list value need to set to attr
@@ -126,6 +158,12 @@ public:
      */
     std::vector<float> GetListFloat() const;
 
+    /*
+     * get float list value of attr without copy.
+     * @return ListView<float>: float list value of attr, valid until attr is modified
+     */
+    ListView<float> GetListFloatView() const;
+
     /*
      * attr add float value to list.
      * @param f: float value need to add to list
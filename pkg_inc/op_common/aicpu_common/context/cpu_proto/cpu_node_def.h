@@ -33,6 +33,8 @@ public:
 
     bool ParseFromString(const std::string& str);
 
+    bool ParseFromArray(const void* data, uint32_t size);
+
     bool SerializeToString(std::string& str) const;
 
     void SetOpType(const std::string& op);
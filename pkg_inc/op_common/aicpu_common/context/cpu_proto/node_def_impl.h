@@ -41,6 +41,12 @@ public:
      */
     bool ParseFromString(const std::string& str);
 
+    /*
+     * parse parameter from buffer without copying it to a string.
+     * @return bool: true->success, false->failed
+     */
+    bool ParseFromArray(const void* data, uint32_t size);
+
     /*
      * serialize string to node def.
      * @return bool: true->success, false->failed
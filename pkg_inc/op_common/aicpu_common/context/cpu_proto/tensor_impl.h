@@ -11,6 +11,7 @@
 #define AICPU_CONTEXT_CPU_PROTO_TENSOR_IMPL_H
 #include <functional>
 #include <memory>
+#include <mutex>
 
 #include "cpu_tensor_shape.h"
 #include "proto/cpu_tensor.pb.h"
@@ -40,7 +41,8 @@ public:
     bool SetTensorShape(const TensorShape* shape);
 
     /*
-     * get tensor shape value of tensor.
+     * get tensor shape value of tensor, the shape object is created at the first call
+     * and shared by the later calls.
      * @return std::shared_ptr<TensorShape>: tensor shape value of tensor
      */
     std::shared_ptr<TensorShape> GetTensorShape() const;
@@ -87,6 +89,12 @@ public:
      */
     std::string GetName() const;
 
+    /*
+     * get name of tensor without copy.
+     * @return const std::string&: tensor name, valid until name is modified
+     */
+    const std::string& GetNameRef() const;
+
     /*
      * set name of tensor.
      * @param name: tensor name
@@ -112,6 +120,8 @@ public:
 
 private:
     std::shared_ptr<aicpuops::Tensor> tensor_{nullptr};
+    mutable std::mutex shape_mutex_; // protect shape_
+    mutable std::shared_ptr<TensorShape> shape_{nullptr};
 };
 } // namespace aicpu
 #endif // AICPU_CONTEXT_CPU_PROTO_TENSOR_IMPL_H
@@ -18,6 +18,7 @@
 #include <vector>
 #include "broadcast_base_struct.h"
 #include "op_common/log/log.h"
+#include "op_common/atvoss/tuner/tiling_tuner.h"
 #include "exe_graph/runtime/tiling_context.h"
 #include "tiling/platform/platform_ascendc.h"
 #include "op_common/op_host/util/platform_util.h"
@@ -85,6 +86,7 @@ struct BroadcastComputeParams {
  * - outShape 输出shape大小
  * - ubSize ub空间大小
  * - computeMap 不同数据类型对应的compute参数
+ * - autoTuner 离线调优使用的tuner，非空时调优结果写入TilingTuneTable::Instance()
  */
 struct BroadcastTilingParams {
     int64_t coreNum;
@@ -95,6 +97,7 @@ struct BroadcastTilingParams {
     bool preferMultiCore = false;
     bool inputAllContiguous = true;
     std::map<uint64_t, BroadcastComputeParams> computeMap;
+    const TilingAutoTuner* autoTuner = nullptr;
 };
 
 /**
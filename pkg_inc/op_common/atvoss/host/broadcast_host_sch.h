@@ -0,0 +1,499 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file broadcast_host_sch.h
+ * \brief BroadcastSch的host实现，在CPU上按相同的DAG、BroadcastBaseTilingData及buffer分配执行
+ */
+#ifndef BROADCAST_HOST_SCH_H_
+#define BROADCAST_HOST_SCH_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "atvoss/util/dag.h"
+#include "atvoss/broadcast/broadcast_base_struct.h"
+#include "elewise_host_sch.h"
+#include "host_vec.h"
+
+namespace Ops {
+namespace Base {
+
+/**
+ * 在host上执行Broadcast DAG，对应BroadcastNddmaSch的切分方式。
+ * - 核间按blockFormer/blockTail切分ub循环，ub内按ubSplitAxis、ubFormer/ubTail切分，各个核依次执行；
+ * - CopyIn按inputStrides搬入整块，CopyInBrc按inputBrcStrides(广播轴stride为0)直接搬成输出shape，
+ *   Brc节点按inputVecBrcDims将ub内的块扩展为输出shape；
+ * - 节点的buffer按照DAG的GetBufferIds<true, true>分配；NPU上广播输入在ub循环间的复用不做，每次重新计算；
+ * - Var按顺序从tiling的scalarData中读取，也可以通过SetVar覆盖；
+ * - 按FunList中的节点统计调用次数、元素个数、搬运字节数及耗时。
+ * 不支持ReduceOp节点。
+ */
+template <class BrcDag>
+class BroadcastHostSch {
+public:
+    explicit BroadcastHostSch(const BroadcastBaseTilingData<BrcDag>* baseTilingData) : tilingData(baseTilingData) {}
+
+    /**
+     * 初始化BroadcastHostSch对象
+     * @param args 输入输出的host地址，需要匹配DAG图中PlaceHolder的顺序[In0, In1..., Out0, Out1...]
+     */
+    template <class... Args>
+    void Init(Args... args)
+    {
+        static_assert(inputNums + outputNums == sizeof...(Args),
+                      "BroadcastHostSch.Init args num should match DAG holders.");
+        uint8_t* addrs[] = {reinterpret_cast<uint8_t*>(args)...};
+        for (int i = 0; i < inputNums; i++) {
+            inGm[i] = addrs[i];
+        }
+        for (int i = 0; i < outputNums; i++) {
+            outGm[i] = addrs[inputNums + i];
+        }
+        SetScalar<0>(0);
+        blockLen = static_cast<uint64_t>(tilingData->elemNum) * BrcDag::MaxDtypeBytes;
+        tensorPool.assign(blockLen * bufferNum, 0);
+    }
+
+    template <typename U, int index>
+    void SetVar(U value)
+    {
+        static_assert(index < BrcDag::Vars::Size, "The index exceeds the number of Vars defined in DAG.");
+        scalars.template Set<index>(value);
+    }
+
+    /**
+     * 依次执行tiling中的每个核
+     */
+    void Process()
+    {
+        for (int64_t blockIdx = 0; blockIdx < tilingData->blockNum; blockIdx++) {
+            ProcessBlock(blockIdx);
+        }
+    }
+
+    void ProcessBlock(int64_t blockIdx)
+    {
+        const int64_t splitAxis = tilingData->ubSplitAxis;
+        int64_t ubLoopNum = blockIdx == tilingData->blockNum - 1 ? tilingData->blockTail : tilingData->blockFormer;
+        int64_t axesIndices[BROADCAST_MAX_DIMS_NUM] = {0};
+        // 与BroadcastGetAxesIndices一致：ub切分轴之前的各轴下标，切分轴上为第几个ub块
+        int64_t prodIdx = tilingData->blockFormer * blockIdx;
+        int64_t totalProduct = tilingData->dimProductBeforeUbInner;
+        for (int64_t idx = 0; idx < splitAxis; idx++) {
+            totalProduct = totalProduct / tilingData->outputDims[idx];
+            axesIndices[idx] = prodIdx / totalProduct;
+            prodIdx = prodIdx - axesIndices[idx] * totalProduct;
+        }
+        axesIndices[splitAxis] = prodIdx;
+
+        for (int64_t ubLoopIdx = 0; ubLoopIdx < ubLoopNum; ubLoopIdx++) {
+            if (ubLoopIdx != 0) {
+                UpdateAxesIndices(axesIndices);
+            }
+            bool isUbTail = axesIndices[splitAxis] == tilingData->ubOuter - 1;
+            int64_t ubSplitSize = isUbTail ? tilingData->ubTail : tilingData->ubFormer;
+            Run<0>(ubSplitSize, axesIndices, isUbTail, static_cast<int32_t>(ubLoopIdx & 1));
+        }
+    }
+
+    void EnableProfiling(bool enable)
+    {
+        profiling = enable;
+    }
+
+    void ResetStat()
+    {
+        nodeStats.fill(HostStageStat());
+    }
+
+    // FunList中第pos个节点的统计
+    const HostStageStat& GetNodeStat(uint32_t pos) const
+    {
+        return nodeStats[pos];
+    }
+
+    HostStageStat GetStageStat(HostStage stage) const
+    {
+        HostStageStat stat;
+        for (uint32_t i = 0; i < funNums; i++) {
+            if (nodeStages[i] == stage) {
+                stat.Add(nodeStats[i]);
+            }
+        }
+        return stat;
+    }
+
+    // 节点所属阶段，CopyInBrc计入搬入
+    template <class Op>
+    constexpr static HostStage GetStage()
+    {
+        using Func = typename Op::Fun;
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value ||
+                      __aux::IsSameTemplateType<Func, Vec::CopyInBrc>::Value) {
+            return HostStage::COPY_IN;
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            return HostStage::COPY_OUT;
+        } else {
+            return HostStage::COMPUTE;
+        }
+    }
+
+protected:
+    // 与BroadcastUpdateAxesIndices一致，切分轴上前进一个ub块并向前进位
+    void UpdateAxesIndices(int64_t (&axesIndices)[BROADCAST_MAX_DIMS_NUM])
+    {
+        const int64_t splitAxis = tilingData->ubSplitAxis;
+        axesIndices[splitAxis]++;
+        if (axesIndices[splitAxis] == tilingData->ubOuter && splitAxis > 0) {
+            axesIndices[splitAxis] = 0;
+            axesIndices[splitAxis - 1]++;
+        }
+        for (int64_t idx = splitAxis - 1; idx > 0; idx--) {
+            if (axesIndices[idx] == tilingData->outputDims[idx]) {
+                axesIndices[idx] = 0;
+                axesIndices[idx - 1]++;
+            }
+        }
+    }
+
+    // ub块起始位置在GM上的元素偏移
+    int64_t GetGmOffset(const int64_t (&axesIndices)[BROADCAST_MAX_DIMS_NUM], const int64_t* strides) const
+    {
+        const int64_t splitAxis = tilingData->ubSplitAxis;
+        int64_t gmOffset = 0;
+        for (int64_t idx = 0; idx < splitAxis; idx++) {
+            gmOffset += axesIndices[idx] * strides[idx];
+        }
+        return gmOffset + axesIndices[splitAxis] * strides[splitAxis] * tilingData->ubFormer;
+    }
+
+    /**
+     * 按stride把src搬成连续的dims块，stride为0的轴即为广播轴
+     * @param rank dims/strides的维度，第0维为ub切分轴
+     */
+    template <typename T>
+    static void GatherTile(T* dst, const T* src, const int64_t* dims, const int64_t* strides, int64_t rank)
+    {
+        const int64_t inner = dims[rank - 1];
+        const int64_t innerStride = strides[rank - 1];
+        int64_t outer = 1;
+        for (int64_t i = 0; i < rank - 1; i++) {
+            outer *= dims[i];
+        }
+        int64_t indices[BROADCAST_MAX_DIMS_NUM] = {0};
+        int64_t srcOffset = 0;
+        for (int64_t o = 0; o < outer; o++) {
+            if (innerStride == 1) {
+                std::memcpy(dst, src + srcOffset, inner * sizeof(T));
+            } else {
+                for (int64_t j = 0; j < inner; j++) {
+                    dst[j] = src[srcOffset + j * innerStride];
+                }
+            }
+            dst += inner;
+            for (int64_t i = rank - 2; i >= 0; i--) {
+                srcOffset += strides[i];
+                if (++indices[i] < dims[i]) {
+                    break;
+                }
+                srcOffset -= strides[i] * dims[i];
+                indices[i] = 0;
+            }
+        }
+    }
+
+    // ub块的shape：[ubSplitSize, outputDims[ubSplitAxis + 1]...]
+    int64_t GetTileDims(int64_t ubSplitSize, int64_t (&dims)[BROADCAST_MAX_DIMS_NUM]) const
+    {
+        const int64_t splitAxis = tilingData->ubSplitAxis;
+        const int64_t rank = tilingData->shapeLen - splitAxis;
+        dims[0] = ubSplitSize;
+        for (int64_t i = 1; i < rank; i++) {
+            dims[i] = tilingData->outputDims[splitAxis + i];
+        }
+        return rank;
+    }
+
+    template <typename T>
+    T* GetBuffer(int32_t bufId)
+    {
+        return reinterpret_cast<T*>(tensorPool.data() + bufId * blockLen);
+    }
+
+    template <typename Op, int pos>
+    void CopyIn(const int64_t (&axesIndices)[BROADCAST_MAX_DIMS_NUM], bool isUbTail, int32_t pingPong)
+    {
+        static_assert(Op::InHolders::Size == 1, "CopyIn input inHolders num should be 1.");
+        using InputOp = typename Op::InHolders::template At<0>;
+        using TensorType = typename Op::template FunInArgType<0>;
+        if constexpr (Op::IsScalarOp) {
+            opScalars.template Set<pos>(GetScalar<TensorType, InputOp>());
+            return;
+        }
+        static_assert(std::is_same<typename InputOp::DType, TensorType>::value,
+                      "CopyIn data type is inconsistent with in holder data type.");
+        int64_t inputLength = tilingData->inputDims[InputOp::Pos][isUbTail ? 1 : 0];
+        int64_t gmOffset = GetGmOffset(axesIndices, tilingData->inputStrides[InputOp::Pos]);
+        uint64_t bytes = inputLength * sizeof(TensorType);
+        std::memcpy(GetBuffer<TensorType>(GetBufId<pos>(pingPong)),
+                    inGm[InputOp::Pos] + gmOffset * sizeof(TensorType), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    template <typename Op, int pos>
+    void CopyInBrc(int64_t ubSplitSize, const int64_t (&axesIndices)[BROADCAST_MAX_DIMS_NUM], int32_t pingPong)
+    {
+        static_assert(Op::InHolders::Size == 1, "CopyInBrc input inHolders num should be 1.");
+        using InputOp = typename Op::InHolders::template At<0>;
+        using TensorType = typename Op::template FunInArgType<0>;
+        static_assert(std::is_same<typename InputOp::DType, TensorType>::value,
+                      "CopyInBrc data type is inconsistent with in holder data type.");
+        constexpr int copyBrcIdx = BrcDag::CopyBrcNodes::template GetIndex<Op>();
+        const int64_t* brcStrides = tilingData->inputBrcStrides[copyBrcIdx];
+        int64_t dims[BROADCAST_MAX_DIMS_NUM] = {0};
+        int64_t rank = GetTileDims(ubSplitSize, dims);
+        const TensorType* src = reinterpret_cast<const TensorType*>(inGm[InputOp::Pos]) +
+                                GetGmOffset(axesIndices, brcStrides);
+        GatherTile(GetBuffer<TensorType>(GetBufId<pos>(pingPong)), src, dims, brcStrides + tilingData->ubSplitAxis,
+                   rank);
+        int64_t tileLength = ubSplitSize * tilingData->outputStrides[tilingData->ubSplitAxis];
+        nodeStats[pos].bytes += tileLength * sizeof(TensorType);
+    }
+
+    // Brc节点：ub内的块从inputVecBrcDims的shape扩展为输出shape
+    template <typename Op, int pos>
+    void VecBroadcast(int64_t ubSplitSize, int32_t pingPong)
+    {
+        static_assert(Op::Args::Size == 1, "Broadcast input args should be 1.");
+        using InputOp = typename Op::Args::template At<0>;
+        using InputType = typename Op::template FunInArgType<0>;
+        using OutputType = typename Op::template FunRetArgType<0>;
+        static_assert(std::is_same<InputType, OutputType>::value,
+                      "Broadcast inputType  is inconsistent with outputType.");
+        constexpr int vecBrcIdx = BrcDag::VecBrcNodes::template GetIndex<Op>();
+        const int64_t splitAxis = tilingData->ubSplitAxis;
+        const int64_t* srcShape = tilingData->inputVecBrcDims[vecBrcIdx] + splitAxis;
+        int64_t dims[BROADCAST_MAX_DIMS_NUM] = {0};
+        int64_t rank = GetTileDims(ubSplitSize, dims);
+        // src在ub内连续存放，广播轴的stride置0
+        int64_t strides[BROADCAST_MAX_DIMS_NUM] = {0};
+        int64_t stride = 1;
+        for (int64_t i = rank - 1; i >= 0; i--) {
+            int64_t srcDim = (i == 0 && srcShape[0] != 1) ? ubSplitSize : srcShape[i];
+            strides[i] = srcDim == 1 ? 0 : stride;
+            stride *= srcDim;
+        }
+        GatherTile(GetBuffer<OutputType>(GetBufId<pos>(pingPong)),
+                   GetBuffer<InputType>(GetBufId<GetFunOutputPos<InputOp>()>(pingPong)), dims, strides, rank);
+    }
+
+    template <typename Op, int pos>
+    void CopyOut(uint64_t offset, uint64_t tileLength, int32_t pingPong)
+    {
+        static_assert(Op::Args::Size == 2, "Input args should be 2");
+        using input = typename Op::Args::template At<1>;
+        using output = typename Op::Args::template At<0>;
+        using inputType = typename Op::template FunInArgType<0>;
+        static_assert(Placeholder::IsOutHolder<output>::Value, "output args should be out holder");
+        static_assert(output::Pos < outputNums, "output Pos is not less than output number.");
+        if constexpr (std::is_same<typename output::DType, uint1_t>::value) {
+            static_assert(std::is_same<inputType, uint8_t>::value,
+                          "CopyOut data type is inconsistent with out holder data type.");
+            offset = offset / BYTE_LENGTH;
+            tileLength = tileLength / BYTE_LENGTH;
+        } else {
+            static_assert(std::is_same<typename output::DType, inputType>::value,
+                          "CopyOut data type is inconsistent with Op data type.");
+        }
+        uint64_t bytes = tileLength * sizeof(inputType);
+        std::memcpy(outGm[output::Pos] + offset * sizeof(inputType),
+                    GetBuffer<inputType>(GetBufId<GetFunOutputPos<input>()>(pingPong)), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    template <class Op, int start = 0>
+    constexpr static int GetFunOutputPos()
+    {
+        if constexpr (std::is_same<typename BrcDag::FunList::template At<start>, Op>::value) {
+            return start;
+        } else if constexpr (start + 1 < BrcDag::FunList::Size) {
+            return GetFunOutputPos<Op, start + 1>();
+        }
+        static_assert(start + 1 < BrcDag::FunList::Size, "The required output in FunList is not found.");
+        return -1;
+    }
+
+    template <int pos>
+    static int32_t GetBufId(int32_t pingPong)
+    {
+        if constexpr (bufferIds[0][pos] == bufferIds[1][pos]) {
+            return bufferIds[0][pos];
+        } else {
+            return pingPong == 0 ? bufferIds[0][pos] : bufferIds[1][pos];
+        }
+    }
+
+    // 与BroadcastBaseSch::SetScalar一致，Var按顺序紧密存放在scalarData中
+    template <int idx = 0>
+    void SetScalar(int offset)
+    {
+        if constexpr (idx < BrcDag::VarSize) {
+            using VarPlaceHolder = typename BrcDag::Vars::template At<idx>;
+            using DType = typename VarPlaceHolder::DType;
+            DType value;
+            std::memcpy(&value, tilingData->scalarData + offset, sizeof(DType));
+            scalars.template Set<idx>(value);
+            SetScalar<idx + 1>(offset + sizeof(DType));
+        }
+    }
+
+    template <typename ScalarType, typename scalarValue>
+    ScalarType GetScalar()
+    {
+        if constexpr (Placeholder::IsVar<scalarValue>::Value) {
+            return scalars.template Get<scalarValue::Pos>();
+        } else if constexpr (Placeholder::IsInHolder<scalarValue>::Value) {
+            ScalarType scalar;
+            std::memcpy(&scalar, inGm[scalarValue::Pos], sizeof(ScalarType));
+            return scalar;
+        } else {
+            static_assert(Placeholder::IsConstValue<scalarValue>::Value,
+                          "The input parameter type is not FunBind, Var, Const or Holder.");
+            return static_cast<ScalarType>(scalarValue::value);
+        }
+    }
+
+    template <typename Op, int argPos>
+    auto ConvertArgs(int32_t pingPong)
+    {
+        using InputOp = typename Op::InArgs::template At<argPos>;
+        using TensorType = typename Op::template FunInArgType<argPos>;
+        if constexpr (__aux::TypeIsFunBind<InputOp>::Value) {
+            if constexpr (InputOp::IsScalarOp) {
+                TensorType scalar = opScalars.template Get<GetFunOutputPos<InputOp>()>();
+                return scalar;
+            } else {
+                return static_cast<const TensorType*>(
+                    GetBuffer<TensorType>(GetBufId<GetFunOutputPos<InputOp>()>(pingPong)));
+            }
+        } else {
+            return GetScalar<TensorType, InputOp>();
+        }
+    }
+
+    template <typename Op, size_t... I>
+    auto MakeArgs(int32_t pingPong, std::index_sequence<I...>)
+    {
+        return std::make_tuple(ConvertArgs<Op, I>(pingPong)...);
+    }
+
+    template <class Op, int pos>
+    void RunNormalOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        static_assert(!Vec::IsReduceOp<typename Op::Fun>::Value, "BroadcastHostSch does not support reduce nodes.");
+        OutputType* outTensor = GetBuffer<OutputType>(GetBufId<pos>(pingPong));
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [outTensor, tileLength](auto... inputs) {
+                Host::HostFun<typename Op::Fun>::Call(outTensor, inputs..., static_cast<uint32_t>(tileLength));
+            },
+            inputArgs);
+    }
+
+    template <class Op, int pos>
+    void RunScalarOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        OutputType outScalar;
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [&outScalar, tileLength](auto... inputs) {
+                typename Op::Fun(outScalar, inputs..., static_cast<int>(tileLength));
+            },
+            inputArgs);
+        opScalars.template Set<pos>(outScalar);
+    }
+
+    template <int pos = 0>
+    void Run(int64_t ubSplitSize, const int64_t (&axesIndices)[BROADCAST_MAX_DIMS_NUM], bool isUbTail,
+             int32_t pingPong)
+    {
+        using Op = typename BrcDag::FunList::template At<pos>;
+        using Func = typename Op::Fun;
+        std::chrono::steady_clock::time_point start;
+        if (profiling) {
+            start = std::chrono::steady_clock::now();
+        }
+        uint64_t tileLength = ubSplitSize * tilingData->outputStrides[tilingData->ubSplitAxis];
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            CopyIn<Op, pos>(axesIndices, isUbTail, pingPong);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyInBrc>::Value) {
+            CopyInBrc<Op, pos>(ubSplitSize, axesIndices, pingPong);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            CopyOut<Op, pos>(GetGmOffset(axesIndices, tilingData->outputStrides), tileLength, pingPong);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::Brc>::Value) {
+            VecBroadcast<Op, pos>(ubSplitSize, pingPong);
+        } else if constexpr (Op::IsScalarOp) {
+            RunScalarOp<Op, pos>(tileLength, pingPong);
+        } else {
+            RunNormalOp<Op, pos>(tileLength, pingPong);
+        }
+        HostStageStat& stat = nodeStats[pos];
+        stat.calls++;
+        stat.elements += tileLength;
+        if (profiling) {
+            stat.nanoseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                          std::chrono::steady_clock::now() - start)
+                                                          .count());
+        }
+
+        if constexpr (pos + 1 < BrcDag::FunList::Size) {
+            Run<pos + 1>(ubSplitSize, axesIndices, isUbTail, pingPong);
+        }
+    }
+
+    template <size_t... I>
+    constexpr static std::array<HostStage, sizeof...(I)> MakeNodeStages(std::index_sequence<I...>)
+    {
+        return {GetStage<typename BrcDag::FunList::template At<I>>()...};
+    }
+
+private:
+    constexpr static uint64_t BYTE_LENGTH = 8;
+    constexpr static int inputNums = BrcDag::InputSize;
+    constexpr static int outputNums = BrcDag::OutputSize;
+    constexpr static uint32_t funNums = BrcDag::FunList::Size;
+    constexpr static uint32_t bufferNum = BrcDag::template GetBufferNum<true, true>();
+    constexpr static auto bufferIds = BrcDag::template GetBufferIds<true, true>();
+    constexpr static std::array<HostStage, funNums> nodeStages = MakeNodeStages(std::make_index_sequence<funNums>{});
+
+    uint8_t* inGm[inputNums > 0 ? inputNums : 1] = {};
+    uint8_t* outGm[outputNums > 0 ? outputNums : 1] = {};
+    std::vector<uint8_t> tensorPool;
+    uint64_t blockLen = 0;
+    bool profiling = false;
+    std::array<HostStageStat, funNums> nodeStats{};
+
+    const BroadcastBaseTilingData<BrcDag>* tilingData;
+    typename BrcDag::VarType scalars;
+    typename BrcDag::ScalarOpType opScalars;
+};
+
+} // namespace Base
+} // namespace Ops
+
+#endif // BROADCAST_HOST_SCH_H_
@@ -0,0 +1,493 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dag_analyzer.h
+ * \brief host侧DAG buffer分析：存活buffer峰值、逐节点buffer时间线、单次ub可处理的元素个数及计算序搜索
+ */
+#ifndef DAG_ANALYZER_H_
+#define DAG_ANALYZER_H_
+
+#include <cxxabi.h>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "atvoss/util/dag.h"
+
+namespace Ops {
+namespace Base {
+
+// 与ElewiseTiling中ub切分的对齐粒度一致
+constexpr static int64_t DAG_ANALYZER_REPEAT_BYTES = 256;
+// 按bit记录存活节点
+constexpr static uint32_t DAG_ANALYZER_MAX_NODE = 64;
+constexpr static uint64_t DAG_ANALYZER_DEFAULT_SEARCH_STEPS = 1000000;
+
+struct DagNodeDesc {
+    std::string name;
+    uint32_t outDtypeBytes = 0;
+    uint32_t tempSize = 0;
+    bool isCopyIn = false;
+    bool isCopyInBrc = false;
+    bool isCopyOut = false;
+    bool isScalarOp = false;
+    bool connectToCopyOut = false;
+    // 作为入参的节点在FunList中的位置，inFuns包含Scalar节点，nonScalarInFuns不包含
+    std::vector<uint32_t> inFuns;
+    std::vector<uint32_t> nonScalarInFuns;
+};
+
+struct DagBufferStep {
+    uint32_t node = 0;
+    // 执行当前节点时存活的节点(FunList中的位置)
+    std::vector<uint32_t> aliveNodes;
+    uint32_t aliveNode = 0;
+    uint32_t tempCalcNode = 0;
+    uint32_t aliveNodeForNddma = 0;
+    uint32_t tempCalcNodeForNddma = 0;
+    // GetBufferIds分配的buffer，只有按编译期DAGSch分析时填写
+    int32_t pingBufferId = -1;
+    int32_t pongBufferId = -1;
+};
+
+struct DagBufferReport {
+    // 计算序，值为节点在原DAG FunList中的位置
+    std::vector<uint32_t> order;
+    std::vector<DagBufferStep> timeline;
+    uint32_t maxAliveNode = 0;
+    uint32_t tempCalcNode = 0;
+    uint32_t maxAliveNodeForNddma = 0;
+    uint32_t tempCalcNodeForNddma = 0;
+    uint32_t maxDtypeBytes = 0;
+    uint32_t minDtypeBytes = 0;
+    uint32_t bufferNumLevel[3] = {0, 0, 0};
+    MemLevel bufLevel = MemLevel::LEVEL_0;
+    uint32_t bufferNum = 0;
+
+    /**
+     * 与ElewiseTiling一致，计算ub上单次可处理的元素个数
+     * @param ubSize ub大小(字节)
+     * @param extraSize 算子额外占用的ub大小
+     * @param extraBufferNum 算子额外申请的buffer个数
+     */
+    int64_t GetMaxElemNum(int64_t ubSize, int64_t extraSize = 0, int64_t extraBufferNum = 0) const
+    {
+        int64_t bufferDivisor = (static_cast<int64_t>(bufferNum) + extraBufferNum) * maxDtypeBytes;
+        if (bufferDivisor <= 0 || minDtypeBytes == 0 || ubSize <= extraSize) {
+            return 0;
+        }
+        int64_t maxElemNum = (ubSize - extraSize) / bufferDivisor;
+        int64_t alignFactor = DAG_ANALYZER_REPEAT_BYTES / minDtypeBytes;
+        return maxElemNum / alignFactor * alignFactor;
+    }
+};
+
+/**
+ * DAG的buffer分析。
+ * 节点存活、buffer个数及MemLevel的计算方式与DAGSch(use_nddma=true, cache_brc=false)一致，
+ * 可以在不重新编译的情况下评估任意合法计算序。ReduceOp的前后子图分别计算buffer，这里只按整图统计。
+ */
+class DagAnalyzer {
+public:
+    template <class OpDag>
+    static DagAnalyzer Create()
+    {
+        using FunList = typename OpDag::FunList;
+        static_assert(FunList::Size <= DAG_ANALYZER_MAX_NODE, "DagAnalyzer supports at most 64 nodes.");
+        DagAnalyzer analyzer;
+        analyzer.nodes_ = MakeNodes<FunList, typename OpDag::OutList>(std::make_index_sequence<FunList::Size>{});
+        analyzer.inputSizeWoScalar_ = OpDag::InputSizeWoScalar;
+        analyzer.outputNum_ = OpDag::OutList::Size;
+        analyzer.memLevel_ = OpDag::MemOpt::memoryLevel;
+        analyzer.Init();
+        return analyzer;
+    }
+
+    const std::vector<DagNodeDesc>& GetNodes() const
+    {
+        return nodes_;
+    }
+
+    // 节点需排在所有输入节点之后
+    bool IsLegalOrder(const std::vector<uint32_t>& order) const
+    {
+        if (order.size() != nodes_.size()) {
+            return false;
+        }
+        uint64_t scheduled = 0;
+        for (auto node : order) {
+            if (node >= nodes_.size() || (scheduled & Bit(node)) != 0 || (inFunMask_[node] & ~scheduled) != 0) {
+                return false;
+            }
+            scheduled |= Bit(node);
+        }
+        return true;
+    }
+
+    // 按DAG FunList的顺序分析
+    DagBufferReport Analyze() const
+    {
+        return Analyze(DefaultOrder(), memLevel_);
+    }
+
+    DagBufferReport Analyze(const std::vector<uint32_t>& order) const
+    {
+        return Analyze(order, memLevel_);
+    }
+
+    /**
+     * 按指定计算序及MemLevel分析，计算序不合法时返回的报告order为空
+     */
+    DagBufferReport Analyze(const std::vector<uint32_t>& order, MemLevel memLevel) const
+    {
+        DagBufferReport report;
+        if (!IsLegalOrder(order)) {
+            return report;
+        }
+        report.order = order;
+        report.minDtypeBytes = __aux::MAX_DTYPE_BYTES;
+        State state = InitState();
+        for (auto node : order) {
+            DagBufferStep step = Step(state, node);
+            report.maxAliveNode = __aux::Max<uint32_t>(report.maxAliveNode, step.aliveNode);
+            report.tempCalcNode = __aux::Max<uint32_t>(report.tempCalcNode, step.tempCalcNode);
+            report.maxAliveNodeForNddma = __aux::Max<uint32_t>(report.maxAliveNodeForNddma, step.aliveNodeForNddma);
+            report.tempCalcNodeForNddma = __aux::Max<uint32_t>(report.tempCalcNodeForNddma, step.tempCalcNodeForNddma);
+            report.maxDtypeBytes = __aux::Max<uint32_t>(report.maxDtypeBytes, nodes_[node].outDtypeBytes);
+            if (nodes_[node].outDtypeBytes < report.minDtypeBytes) {
+                report.minDtypeBytes = nodes_[node].outDtypeBytes;
+            }
+            report.timeline.push_back(std::move(step));
+        }
+        FillBufferNum(report, memLevel);
+        return report;
+    }
+
+    /**
+     * 搜索存活buffer峰值最低的合法计算序，峰值相同时取buffer个数少的，再相同时保留靠前搜索到的(与原顺序更接近)。
+     * @param maxSteps 搜索的最大步数，超过后返回当前最优结果
+     */
+    DagBufferReport SearchComputeOrder(uint64_t maxSteps = DAG_ANALYZER_DEFAULT_SEARCH_STEPS) const
+    {
+        SearchContext ctx;
+        ctx.maxSteps = maxSteps;
+        ctx.best = Analyze();
+        std::vector<uint32_t> prefix;
+        prefix.reserve(nodes_.size());
+        Search(ctx, InitState(), 0, 0, prefix);
+        return ctx.best;
+    }
+
+    std::string ToString(const DagBufferReport& report) const
+    {
+        std::ostringstream oss;
+        oss << "BufLevel: " << static_cast<int>(report.bufLevel) << ", BufferNum: " << report.bufferNum
+            << " (L0: " << report.bufferNumLevel[0] << ", L1: " << report.bufferNumLevel[1]
+            << ", L2: " << report.bufferNumLevel[2] << "), MaxAliveNode: " << report.maxAliveNodeForNddma
+            << ", TempCalcNode: " << report.tempCalcNodeForNddma << ", DtypeBytes: [" << report.minDtypeBytes << ", "
+            << report.maxDtypeBytes << "]\n";
+        for (const auto& step : report.timeline) {
+            oss << "  [" << step.node << "] " << nodes_[step.node].name << " alive: " << step.aliveNodeForNddma
+                << " {";
+            for (size_t i = 0; i < step.aliveNodes.size(); i++) {
+                oss << (i == 0 ? "" : ", ") << step.aliveNodes[i];
+            }
+            oss << "}";
+            if (step.pingBufferId >= 0 || step.pongBufferId >= 0) {
+                oss << " buf: " << step.pingBufferId << "/" << step.pongBufferId;
+            }
+            oss << "\n";
+        }
+        return oss.str();
+    }
+
+private:
+    struct State {
+        uint64_t alive = 0;
+        std::vector<uint32_t> users;
+    };
+
+    struct SearchContext {
+        uint64_t maxSteps = 0;
+        uint64_t steps = 0;
+        DagBufferReport best;
+    };
+
+    static uint64_t Bit(uint32_t node)
+    {
+        return static_cast<uint64_t>(1) << node;
+    }
+
+    static uint32_t PopCount(uint64_t mask)
+    {
+        return static_cast<uint32_t>(__builtin_popcountll(mask));
+    }
+
+    template <class T>
+    static std::string GetName()
+    {
+        int status = -1;
+        char* name = abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status);
+        std::string result = (status == 0 && name != nullptr) ? name : typeid(T).name();
+        std::free(name);
+        return result;
+    }
+
+    template <class FunList, class Es, size_t... I>
+    static std::vector<uint32_t> GetPositions(std::index_sequence<I...>)
+    {
+        return {static_cast<uint32_t>(FunList::template GetIndex<typename Es::template At<I>>())...};
+    }
+
+    template <class FunList, class OutList, class Node>
+    static DagNodeDesc MakeNode()
+    {
+        using Func = typename Node::Fun;
+        DagNodeDesc desc;
+        desc.name = GetName<Func>();
+        desc.outDtypeBytes = static_cast<uint32_t>(sizeof(typename Node::OutDataType));
+        desc.tempSize = static_cast<uint32_t>(Func::TempSize);
+        desc.isCopyIn = Vec::IsCopyInOp<Func>::Value;
+        desc.isCopyInBrc = Vec::IsCopyInBrcOp<Func>::Value;
+        desc.isCopyOut = Vec::IsCopyOutOp<Func>::Value;
+        desc.isScalarOp = Node::IsScalarOp;
+        desc.connectToCopyOut = __aux::CheckIsInput<OutList, 0, Node>();
+        desc.inFuns = GetPositions<FunList, typename Node::InFuns>(std::make_index_sequence<Node::InFuns::Size>{});
+        desc.nonScalarInFuns = GetPositions<FunList, typename Node::InNonScalarFuns>(
+            std::make_index_sequence<Node::InNonScalarFuns::Size>{});
+        return desc;
+    }
+
+    template <class FunList, class OutList, size_t... I>
+    static std::vector<DagNodeDesc> MakeNodes(std::index_sequence<I...>)
+    {
+        return {MakeNode<FunList, OutList, typename FunList::template At<I>>()...};
+    }
+
+    void Init()
+    {
+        inFunMask_.assign(nodes_.size(), 0);
+        nonScalarInMask_.assign(nodes_.size(), 0);
+        initUsers_.assign(nodes_.size(), 0);
+        for (uint32_t i = 0; i < nodes_.size(); i++) {
+            const auto& node = nodes_[i];
+            for (auto in : node.inFuns) {
+                inFunMask_[i] |= Bit(in);
+            }
+            for (auto in : node.nonScalarInFuns) {
+                nonScalarInMask_[i] |= Bit(in);
+            }
+            // 同一节点被多次引用时只计一次
+            uint64_t users = inFunMask_[i];
+            for (uint32_t j = 0; j < nodes_.size(); j++) {
+                initUsers_[j] += (users & Bit(j)) != 0 ? 1 : 0;
+            }
+            if (node.isCopyInBrc) {
+                copyInBrcMask_ |= Bit(i);
+            }
+            // 参考FilterTempCalcNode: 直连搬出的节点及CopyIn节点不计入中间计算节点
+            if (!(node.connectToCopyOut || (node.isCopyIn && !node.isCopyInBrc))) {
+                tempCalcMask_ |= Bit(i);
+            }
+            if (!(node.connectToCopyOut || node.isCopyIn)) {
+                tempCalcMaskForNddma_ |= Bit(i);
+            }
+            if (node.isCopyIn && !node.isScalarOp && node.connectToCopyOut) {
+                copyInLinkCopyOutNum_++;
+            }
+        }
+    }
+
+    std::vector<uint32_t> DefaultOrder() const
+    {
+        std::vector<uint32_t> order(nodes_.size());
+        for (uint32_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        return order;
+    }
+
+    State InitState() const
+    {
+        State state;
+        state.users = initUsers_;
+        return state;
+    }
+
+    // 与__aux::MaxAliveNode中单个节点的处理一致
+    DagBufferStep Step(State& state, uint32_t node) const
+    {
+        const auto& desc = nodes_[node];
+        uint64_t alive = state.alive | nonScalarInMask_[node];
+        if (!(desc.isCopyOut || desc.isScalarOp)) {
+            alive |= Bit(node);
+        }
+        uint32_t aliveNum = PopCount(alive);
+        uint32_t funcTmpSize = desc.isCopyInBrc ? 0 : desc.tempSize;
+
+        DagBufferStep step;
+        step.node = node;
+        for (uint32_t i = 0; i < nodes_.size(); i++) {
+            if ((alive & Bit(i)) != 0) {
+                step.aliveNodes.push_back(i);
+            }
+        }
+        step.aliveNode = aliveNum + PopCount(alive & copyInBrcMask_) + funcTmpSize;
+        step.tempCalcNode = PopCount(alive & tempCalcMask_) + funcTmpSize;
+        step.aliveNodeForNddma = aliveNum + (desc.isCopyInBrc ? 0 : desc.tempSize);
+        step.tempCalcNodeForNddma = PopCount(alive & tempCalcMaskForNddma_) + (desc.isCopyInBrc ? 0 : desc.tempSize);
+
+        for (uint32_t i = 0; i < nodes_.size(); i++) {
+            if ((inFunMask_[node] & Bit(i)) != 0) {
+                state.users[i]--;
+            }
+        }
+        for (auto in : desc.nonScalarInFuns) {
+            if (state.users[in] == 0) {
+                alive &= ~Bit(in);
+            }
+        }
+        state.alive = alive;
+        return step;
+    }
+
+    // 与GetCopyInCountBeforeFirstCalcNode一致
+    uint32_t GetCopyInCountBeforeFirstCalcNode(const std::vector<uint32_t>& order) const
+    {
+        uint32_t count = 0;
+        for (auto node : order) {
+            const auto& desc = nodes_[node];
+            if (desc.isScalarOp || desc.isCopyOut) {
+                continue;
+            }
+            if (!desc.isCopyIn) {
+                break;
+            }
+            count++;
+        }
+        return count;
+    }
+
+    // 与DagNodeInfo::GetBufferNumLevelX及DAGSch::ChooseBufferLevelImpl一致
+    void FillBufferNum(DagBufferReport& report, MemLevel memLevel) const
+    {
+        uint32_t maxAlive = report.maxAliveNodeForNddma;
+        uint32_t tempCalc = report.tempCalcNodeForNddma;
+        uint32_t gmCount = GetCopyInCountBeforeFirstCalcNode(report.order);
+        uint32_t firstCopyOutCount = maxAlive > gmCount ? 1 : 0;
+        uint32_t lvl12Mte3Count = outputNum_ - copyInLinkCopyOutNum_;
+        uint32_t lvl1TmpSize = tempCalc > 0 ? (maxAlive > inputSizeWoScalar_ ? maxAlive - inputSizeWoScalar_ : 0) : 0;
+        report.bufferNumLevel[0] = maxAlive + gmCount + firstCopyOutCount;
+        report.bufferNumLevel[1] = lvl1TmpSize + inputSizeWoScalar_ * 2 + lvl12Mte3Count * 2;
+        report.bufferNumLevel[2] = tempCalc + inputSizeWoScalar_ * 2 + lvl12Mte3Count * 2;
+        if (memLevel == MemLevel::LEVEL_0) {
+            if (report.bufferNumLevel[2] <= static_cast<uint32_t>(MAX_BUFFER_NUMBER)) {
+                report.bufLevel = MemLevel::LEVEL_2;
+            } else if (report.bufferNumLevel[1] <= static_cast<uint32_t>(MAX_BUFFER_NUMBER)) {
+                report.bufLevel = MemLevel::LEVEL_1;
+            } else {
+                report.bufLevel = MemLevel::LEVEL_0;
+            }
+        } else {
+            report.bufLevel = memLevel;
+        }
+        report.bufferNum = report.bufferNumLevel[static_cast<int>(report.bufLevel)];
+    }
+
+    bool IsBetter(const DagBufferReport& report, const DagBufferReport& best) const
+    {
+        if (report.maxAliveNodeForNddma != best.maxAliveNodeForNddma) {
+            return report.maxAliveNodeForNddma < best.maxAliveNodeForNddma;
+        }
+        return report.bufferNum < best.bufferNum;
+    }
+
+    // 深度优先枚举拓扑序，前缀的存活峰值已超过当前最优时剪枝
+    void Search(SearchContext& ctx, const State& state, uint64_t scheduled, uint32_t peak,
+                std::vector<uint32_t>& prefix) const
+    {
+        if (ctx.steps >= ctx.maxSteps) {
+            return;
+        }
+        ctx.steps++;
+        if (prefix.size() == nodes_.size()) {
+            DagBufferReport report = Analyze(prefix, memLevel_);
+            if (IsBetter(report, ctx.best)) {
+                ctx.best = std::move(report);
+            }
+            return;
+        }
+        for (uint32_t node = 0; node < nodes_.size(); node++) {
+            if ((scheduled & Bit(node)) != 0 || (inFunMask_[node] & ~scheduled) != 0) {
+                continue;
+            }
+            State next = state;
+            DagBufferStep step = Step(next, node);
+            uint32_t nextPeak = __aux::Max<uint32_t>(peak, step.aliveNodeForNddma);
+            if (nextPeak > ctx.best.maxAliveNodeForNddma) {
+                continue;
+            }
+            prefix.push_back(node);
+            Search(ctx, next, scheduled | Bit(node), nextPeak, prefix);
+            prefix.pop_back();
+        }
+    }
+
+    std::vector<DagNodeDesc> nodes_;
+    std::vector<uint64_t> inFunMask_;
+    std::vector<uint64_t> nonScalarInMask_;
+    std::vector<uint32_t> initUsers_;
+    uint64_t copyInBrcMask_ = 0;
+    uint64_t tempCalcMask_ = 0;
+    uint64_t tempCalcMaskForNddma_ = 0;
+    uint32_t copyInLinkCopyOutNum_ = 0;
+    uint32_t inputSizeWoScalar_ = 0;
+    uint32_t outputNum_ = 0;
+    MemLevel memLevel_ = MemLevel::LEVEL_0;
+};
+
+/**
+ * 按编译期DAGSch分析OpDag，可替换计算序及内存复用策略，buffer个数等取DAGSch的编译期结果，
+ * 时间线上同时给出GetBufferIds分配的ping/pong buffer，节点位置按替换后的计算序给出。
+ * @tparam OpDag 原DAG
+ * @tparam ComputeOrder 替换的计算序，void表示沿用OpDag的计算序
+ * @tparam MemOpt 替换的MemOptCfg，void表示沿用OpDag的配置
+ */
+template <class OpDag, class ComputeOrder = void, class MemOpt = void>
+DagBufferReport AnalyzeDag()
+{
+    using Order = __aux::Condition<__aux::IsSameType<ComputeOrder, void>::Value, typename OpDag::FunList, ComputeOrder>;
+    using MemCfg = __aux::Condition<__aux::IsSameType<MemOpt, void>::Value, typename OpDag::MemOpt, MemOpt>;
+    using Dag = DAGSch<typename OpDag::OutList, Order, MemCfg>;
+    DagBufferReport report = DagAnalyzer::Create<Dag>().Analyze();
+    report.maxAliveNode = Dag::MaxAliveNode;
+    report.tempCalcNode = Dag::TempCalcNode;
+    report.maxAliveNodeForNddma = Dag::MaxAliveNodeForNddma;
+    report.tempCalcNodeForNddma = Dag::TempCalcNodeForNddma;
+    report.maxDtypeBytes = Dag::MaxDtypeBytes;
+    report.minDtypeBytes = Dag::MinDtypeBytes;
+    report.bufLevel = Dag::BufLevel;
+    report.bufferNum = Dag::BufferNum;
+    const int32_t* const* bufferIds = Dag::template GetBufferIds<true, false>();
+    for (auto& step : report.timeline) {
+        step.pingBufferId = bufferIds[0][step.node];
+        step.pongBufferId = bufferIds[1][step.node];
+    }
+    return report;
+}
+
+} // namespace Base
+} // namespace Ops
+
+#endif // DAG_ANALYZER_H_
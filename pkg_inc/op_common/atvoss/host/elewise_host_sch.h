@@ -0,0 +1,399 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elewise_host_sch.h
+ * \brief ElementwiseSch的host实现，在CPU上按相同的DAG、tiling及buffer分配执行
+ */
+#ifndef ELEWISE_HOST_SCH_H_
+#define ELEWISE_HOST_SCH_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "atvoss/util/dag.h"
+#include "atvoss/elewise/elewise_base_struct.h"
+#include "host_vec.h"
+
+namespace Ops {
+namespace Base {
+
+enum class HostStage : uint32_t { COPY_IN = 0, COMPUTE, COPY_OUT, STAGE_NUM };
+
+struct HostStageStat {
+    uint64_t calls = 0;
+    uint64_t elements = 0;
+    uint64_t bytes = 0;
+    uint64_t nanoseconds = 0;
+
+    void Add(const HostStageStat& other)
+    {
+        calls += other.calls;
+        elements += other.elements;
+        bytes += other.bytes;
+        nanoseconds += other.nanoseconds;
+    }
+
+    // 每秒处理的元素个数
+    double ElementsPerSecond() const
+    {
+        return nanoseconds == 0 ? 0.0 : static_cast<double>(elements) * 1e9 / static_cast<double>(nanoseconds);
+    }
+
+    double BytesPerSecond() const
+    {
+        return nanoseconds == 0 ? 0.0 : static_cast<double>(bytes) * 1e9 / static_cast<double>(nanoseconds);
+    }
+};
+
+/**
+ * 在host上执行Elementwise DAG，接口与ElementwiseSch保持一致。
+ * - 核间切分与ub切分按照EleBaseTilingData执行，各个核依次执行；
+ * - 节点的buffer按照DAG的GetBufferIds分配，buffer复用错误会在结果上体现；
+ * - 按FunList中的节点统计调用次数、元素个数、搬运字节数及耗时。
+ * 不支持CopyInBrc/Brc/ReduceOp节点，广播及归约DAG分别使用BroadcastHostSch、ReduceHostSch。
+ */
+template <class ElemDag>
+class ElementwiseHostSch {
+public:
+    explicit ElementwiseHostSch(const EleBaseTilingData* baseTilingData) : tilingData(baseTilingData) {}
+
+    /**
+     * 初始化ElementwiseHostSch对象
+     * @param args 输入输出的host地址，需要匹配DAG图中PlaceHolder的顺序[In0, In1..., Out0, Out1...]
+     */
+    template <class... Args>
+    void Init(Args... args)
+    {
+        static_assert(inputNums + outputNums == sizeof...(Args),
+                      "ElementwiseHostSch.Init args num should match DAG holders.");
+        uint8_t* addrs[] = {reinterpret_cast<uint8_t*>(args)...};
+        for (int i = 0; i < inputNums; i++) {
+            inGm[i] = addrs[i];
+        }
+        for (int i = 0; i < outputNums; i++) {
+            outGm[i] = addrs[inputNums + i];
+        }
+        blockLen = static_cast<uint64_t>(tilingData->ubFormer) * ElemDag::MaxDtypeBytes;
+        tensorPool.assign(blockLen * ElemDag::BufferNum, 0);
+    }
+
+    template <typename U, int index>
+    void SetVar(U value)
+    {
+        static_assert(index < ElemDag::Vars::Size, "The index exceeds the number of Vars defined in DAG.");
+        scalars.template Set<index>(value);
+    }
+
+    /**
+     * 依次执行tiling中的每个核
+     */
+    void Process()
+    {
+        for (int64_t blockIdx = 0; blockIdx < tilingData->blockNum; blockIdx++) {
+            ProcessBlock(blockIdx);
+        }
+    }
+
+    void ProcessBlock(int64_t blockIdx)
+    {
+        bool isTailBlock = blockIdx == tilingData->blockNum - 1;
+        uint64_t loopNum = isTailBlock ? tilingData->ubLoopOfTailBlock : tilingData->ubLoopOfFormerBlock;
+        uint64_t tailNum = isTailBlock ? tilingData->ubTailOfTailBlock : tilingData->ubTailOfFormerBlock;
+        uint64_t offset = tilingData->blockFormer * blockIdx;
+        uint64_t i = 0;
+        for (; i + 1 < loopNum; i++) {
+            Run<0>(offset, tilingData->ubFormer, i & 1);
+            offset += tilingData->ubFormer;
+        }
+        Run<0>(offset, tailNum, i & 1);
+    }
+
+    void EnableProfiling(bool enable)
+    {
+        profiling = enable;
+    }
+
+    void ResetStat()
+    {
+        nodeStats.fill(HostStageStat());
+    }
+
+    // FunList中第pos个节点的统计
+    const HostStageStat& GetNodeStat(uint32_t pos) const
+    {
+        return nodeStats[pos];
+    }
+
+    HostStageStat GetStageStat(HostStage stage) const
+    {
+        HostStageStat stat;
+        for (uint32_t i = 0; i < funNums; i++) {
+            if (nodeStages[i] == stage) {
+                stat.Add(nodeStats[i]);
+            }
+        }
+        return stat;
+    }
+
+    // 节点所属阶段
+    template <class Op>
+    constexpr static HostStage GetStage()
+    {
+        using Func = typename Op::Fun;
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            return HostStage::COPY_IN;
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            return HostStage::COPY_OUT;
+        } else {
+            return HostStage::COMPUTE;
+        }
+    }
+
+protected:
+    template <int target, typename T>
+    struct GetHolderByPos {
+        using Type = void;
+    };
+
+    template <int target, template <typename...> typename Holders, typename Holder>
+    struct GetHolderByPos<target, Holders<Holder>> {
+        using Type = __aux::Condition<target == Holder::Pos, Holder, void>;
+    };
+
+    template <int target, template <typename...> typename Holders, typename Holder, typename... HolderTs>
+    struct GetHolderByPos<target, Holders<Holder, HolderTs...>> {
+        using Type = __aux::Condition<target == Holder::Pos, Holder,
+                                      typename GetHolderByPos<target, Holders<HolderTs...>>::Type>;
+    };
+
+    // 按元素偏移计算GM上的字节偏移，1bit数据偏移需要除以8
+    template <typename DataType>
+    static uint64_t ByteOffset(uint64_t offset)
+    {
+        if constexpr (std::is_same<DataType, uint1_t>::value) {
+            return offset / BYTE_LENGTH;
+        }
+        return offset * sizeof(DataType);
+    }
+
+    template <typename T>
+    T* GetBuffer(uint8_t bufId)
+    {
+        return reinterpret_cast<T*>(tensorPool.data() + bufId * blockLen);
+    }
+
+    template <typename Op, int pos>
+    void CopyIn(uint64_t offset, uint64_t tileLength, int32_t pingPong)
+    {
+        static_assert(Op::InHolders::Size == 1, "CopyIn input inHolders num should be 1.");
+        using InputOp = typename Op::InHolders::template At<0>;
+        using TensorType = typename Op::template FunInArgType<0>;
+        if constexpr (Op::IsScalarOp) {
+            opScalars.template Set<pos>(GetScalar<TensorType, InputOp>());
+            return;
+        }
+        if constexpr (std::is_same<typename InputOp::DType, uint1_t>::value) {
+            static_assert(std::is_same<TensorType, uint8_t>::value,
+                          "CopyIn data type is inconsistent with in holder data type.");
+            tileLength = tileLength / BYTE_LENGTH;
+        } else {
+            static_assert(std::is_same<typename InputOp::DType, TensorType>::value,
+                          "CopyIn data type is inconsistent with in holder data type.");
+        }
+        uint64_t bytes = tileLength * sizeof(TensorType);
+        std::memcpy(GetBuffer<TensorType>(GetBufId<pos>(pingPong)),
+                    inGm[InputOp::Pos] + ByteOffset<typename InputOp::DType>(offset), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    template <typename Op, int pos>
+    void CopyOut(uint64_t offset, uint64_t tileLength, int32_t pingPong)
+    {
+        static_assert(Op::Args::Size == 2, "Input args should be 2");
+        using input = typename Op::Args::template At<1>;
+        using output = typename Op::Args::template At<0>;
+        using inputType = typename Op::template FunInArgType<0>;
+        static_assert(Placeholder::IsOutHolder<output>::Value, "output args should be out holder");
+        static_assert(output::Pos < outputNums, "output Pos is not less than output number.");
+        if constexpr (std::is_same<typename output::DType, uint1_t>::value) {
+            static_assert(std::is_same<inputType, uint8_t>::value,
+                          "CopyOut data type is inconsistent with out holder data type.");
+            tileLength = tileLength / BYTE_LENGTH;
+        } else {
+            static_assert(std::is_same<typename output::DType, inputType>::value,
+                          "CopyOut data type is inconsistent with Op data type.");
+        }
+        uint64_t bytes = tileLength * sizeof(inputType);
+        std::memcpy(outGm[output::Pos] + ByteOffset<typename output::DType>(offset),
+                    GetBuffer<inputType>(GetBufId<GetFunOutputPos<input>()>(pingPong)), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    template <class Op, int start = 0>
+    constexpr static int GetFunOutputPos()
+    {
+        if constexpr (std::is_same<typename ElemDag::FunList::template At<start>, Op>::value) {
+            return start;
+        } else if constexpr (start + 1 < ElemDag::FunList::Size) {
+            return GetFunOutputPos<Op, start + 1>();
+        }
+        static_assert(start + 1 < ElemDag::FunList::Size, "The required output in FunList is not found.");
+        return -1;
+    }
+
+    template <int pos>
+    static uint8_t GetBufId(int32_t pingPong)
+    {
+        if constexpr (bufferIds[0][pos] == bufferIds[1][pos]) {
+            return bufferIds[0][pos];
+        } else {
+            return pingPong == 0 ? bufferIds[0][pos] : bufferIds[1][pos];
+        }
+    }
+
+    template <typename ScalarType, typename scalarValue>
+    ScalarType GetScalar()
+    {
+        if constexpr (Placeholder::IsVar<scalarValue>::Value) {
+            return scalars.template Get<scalarValue::Pos>();
+        } else if constexpr (Placeholder::IsInHolder<scalarValue>::Value) {
+            ScalarType scalar;
+            std::memcpy(&scalar, inGm[scalarValue::Pos], sizeof(ScalarType));
+            return scalar;
+        } else {
+            static_assert(Placeholder::IsConstValue<scalarValue>::Value,
+                          "The input parameter type is not FunBind, Var, Const or Holder.");
+            return static_cast<ScalarType>(scalarValue::value);
+        }
+    }
+
+    template <typename Op, int argPos>
+    auto ConvertArgs(int32_t pingPong)
+    {
+        using InputOp = typename Op::InArgs::template At<argPos>;
+        using TensorType = typename Op::template FunInArgType<argPos>;
+        if constexpr (__aux::TypeIsFunBind<InputOp>::Value) {
+            if constexpr (InputOp::IsScalarOp) {
+                TensorType scalar = opScalars.template Get<GetFunOutputPos<InputOp>()>();
+                return scalar;
+            } else {
+                return static_cast<const TensorType*>(
+                    GetBuffer<TensorType>(GetBufId<GetFunOutputPos<InputOp>()>(pingPong)));
+            }
+        } else {
+            return GetScalar<TensorType, InputOp>();
+        }
+    }
+
+    template <typename Op, size_t... I>
+    auto MakeArgs(int32_t pingPong, std::index_sequence<I...>)
+    {
+        return std::make_tuple(ConvertArgs<Op, I>(pingPong)...);
+    }
+
+    template <class Op, int pos>
+    void RunNormalOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        static_assert(!Vec::IsCopyInBrcOp<typename Op::Fun>::Value && !Vec::IsVecBrcOp<typename Op::Fun>::Value &&
+                          !Vec::IsReduceOp<typename Op::Fun>::Value,
+                      "ElementwiseHostSch does not support broadcast or reduce nodes.");
+        OutputType* outTensor = GetBuffer<OutputType>(GetBufId<pos>(pingPong));
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [outTensor, tileLength](auto... inputs) {
+                Host::HostFun<typename Op::Fun>::Call(outTensor, inputs..., static_cast<uint32_t>(tileLength));
+            },
+            inputArgs);
+    }
+
+    // Scalar节点直接复用Vec::XXX的Scalar构造函数
+    template <class Op, int pos>
+    void RunScalarOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        OutputType outScalar;
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [&outScalar, tileLength](auto... inputs) {
+                typename Op::Fun(outScalar, inputs..., static_cast<int>(tileLength));
+            },
+            inputArgs);
+        opScalars.template Set<pos>(outScalar);
+    }
+
+    template <int pos = 0>
+    void Run(uint64_t offset, uint64_t tileLength, int32_t pingPong)
+    {
+        using Op = typename ElemDag::FunList::template At<pos>;
+        using Func = typename Op::Fun;
+        std::chrono::steady_clock::time_point start;
+        if (profiling) {
+            start = std::chrono::steady_clock::now();
+        }
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            CopyIn<Op, pos>(offset, tileLength, pingPong);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            CopyOut<Op, pos>(offset, tileLength, pingPong);
+        } else if constexpr (Op::IsScalarOp) {
+            RunScalarOp<Op, pos>(tileLength, pingPong);
+        } else {
+            RunNormalOp<Op, pos>(tileLength, pingPong);
+        }
+        HostStageStat& stat = nodeStats[pos];
+        stat.calls++;
+        stat.elements += tileLength;
+        if (profiling) {
+            stat.nanoseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                          std::chrono::steady_clock::now() - start)
+                                                          .count());
+        }
+
+        if constexpr (pos + 1 < ElemDag::FunList::Size) {
+            Run<pos + 1>(offset, tileLength, pingPong);
+        }
+    }
+
+    template <size_t... I>
+    constexpr static std::array<HostStage, sizeof...(I)> MakeNodeStages(std::index_sequence<I...>)
+    {
+        return {GetStage<typename ElemDag::FunList::template At<I>>()...};
+    }
+
+private:
+    constexpr static uint64_t BYTE_LENGTH = 8;
+    constexpr static int inputNums = ElemDag::InputSize;
+    constexpr static int outputNums = ElemDag::OutputSize;
+    constexpr static uint32_t funNums = ElemDag::FunList::Size;
+    constexpr static auto bufferIds = ElemDag::template GetBufferIds<true, false>();
+    constexpr static std::array<HostStage, funNums> nodeStages = MakeNodeStages(std::make_index_sequence<funNums>{});
+
+    uint8_t* inGm[inputNums > 0 ? inputNums : 1] = {};
+    uint8_t* outGm[outputNums > 0 ? outputNums : 1] = {};
+    std::vector<uint8_t> tensorPool;
+    uint64_t blockLen = 0;
+    bool profiling = false;
+    std::array<HostStageStat, funNums> nodeStats{};
+
+    const EleBaseTilingData* tilingData;
+    typename ElemDag::VarType scalars;
+    typename ElemDag::ScalarOpType opScalars;
+};
+
+} // namespace Base
+} // namespace Ops
+
+#endif // ELEWISE_HOST_SCH_H_
@@ -0,0 +1,662 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file host_vec.h
+ * \brief Host实现的Vec原语，供ElementwiseHostSch在CPU上执行DAG
+ */
+#ifndef HOST_VEC_H_
+#define HOST_VEC_H_
+
+#ifdef __CCE_AICORE__
+#error "host_vec.h is only for host compilation."
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "atvoss/util/vec.h"
+
+namespace Ops {
+namespace Base {
+namespace Host {
+
+// 单条SIMD指令处理的字节数，由编译选项决定(-mavx512f/-mavx2/NEON)，为0时只走标量循环
+#if defined(__AVX512F__)
+constexpr static uint32_t HOST_SIMD_BYTES = 64;
+#elif defined(__AVX2__)
+constexpr static uint32_t HOST_SIMD_BYTES = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+constexpr static uint32_t HOST_SIMD_BYTES = 16;
+#else
+constexpr static uint32_t HOST_SIMD_BYTES = 0;
+#endif
+
+// half/bfloat16_t在host上转成float计算，每次转换的元素个数
+constexpr static uint32_t LOW_PRECISION_CHUNK = 256;
+constexpr static uint32_t BITS_PER_BYTE = 8;
+
+// 与AscendC::RoundMode取值一致
+constexpr static int ROUND_MODE_NONE = 0;
+constexpr static int ROUND_MODE_RINT = 1;
+constexpr static int ROUND_MODE_FLOOR = 2;
+constexpr static int ROUND_MODE_CEIL = 3;
+constexpr static int ROUND_MODE_ROUND = 4;
+constexpr static int ROUND_MODE_TRUNC = 5;
+
+// 与AscendC::CMPMODE取值一致
+constexpr static int CMP_MODE_LT = 0;
+constexpr static int CMP_MODE_GT = 1;
+constexpr static int CMP_MODE_EQ = 2;
+constexpr static int CMP_MODE_LE = 3;
+constexpr static int CMP_MODE_GE = 4;
+constexpr static int CMP_MODE_NE = 5;
+
+inline float HalfToFloat(uint16_t value)
+{
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000U) << 16;
+    uint32_t exponent = (value >> 10) & 0x1FU;
+    uint32_t mantissa = value & 0x3FFU;
+    if (exponent == 0) {
+        float subnormal = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign != 0 ? -subnormal : subnormal;
+    }
+    uint32_t bits = exponent == 0x1FU ? (sign | 0x7F800000U | (mantissa << 13)) :
+                                        (sign | ((exponent + 112U) << 23) | (mantissa << 13));
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline uint16_t FloatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000U);
+    uint32_t absBits = bits & 0x7FFFFFFFU;
+    if (absBits >= 0x7F800000U) {
+        return sign | 0x7C00U | (absBits > 0x7F800000U ? 0x200U : 0U);
+    }
+    // 不小于65520时按RNE舍入到inf
+    if (absBits >= 0x477FF000U) {
+        return sign | 0x7C00U;
+    }
+    // 小于2^-14时结果为half的非规格化数
+    if (absBits < 0x38800000U) {
+        float absValue;
+        std::memcpy(&absValue, &absBits, sizeof(absValue));
+        return sign | static_cast<uint16_t>(std::nearbyint(absValue * 16777216.0f));
+    }
+    uint32_t rounded = absBits + 0xFFFU + ((absBits >> 13) & 1U) - 0x38000000U;
+    return sign | static_cast<uint16_t>(rounded >> 13);
+}
+
+inline float Bf16ToFloat(uint16_t value)
+{
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline uint16_t FloatToBf16(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7FFFFFFFU) > 0x7F800000U) {
+        return static_cast<uint16_t>((bits >> 16) | 0x40U);
+    }
+    return static_cast<uint16_t>((bits + 0x7FFFU + ((bits >> 16) & 1U)) >> 16);
+}
+
+template <class T>
+struct IsLowPrecision {
+    constexpr static bool Value = std::is_same<T, half>::value || std::is_same<T, bfloat16_t>::value;
+};
+
+// host上的计算类型
+template <class T>
+using AccType = typename std::conditional<IsLowPrecision<T>::Value, float, T>::type;
+
+template <class T>
+inline AccType<T> ToAcc(const T& value)
+{
+    if constexpr (std::is_same<T, half>::value) {
+        return HalfToFloat(value.value);
+    } else if constexpr (std::is_same<T, bfloat16_t>::value) {
+        return Bf16ToFloat(value.value);
+    } else {
+        return value;
+    }
+}
+
+template <class T, class U>
+inline T FromAcc(U value)
+{
+    if constexpr (std::is_same<T, half>::value) {
+        return T{FloatToHalf(static_cast<float>(value))};
+    } else if constexpr (std::is_same<T, bfloat16_t>::value) {
+        return T{FloatToBf16(static_cast<float>(value))};
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+template <class T, bool = (HOST_SIMD_BYTES > 0) && std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+struct SimdTraits {
+    constexpr static uint32_t Lanes = 1;
+};
+
+template <class T>
+struct SimdTraits<T, true> {
+    typedef T Type __attribute__((vector_size(HOST_SIMD_BYTES)));
+    constexpr static uint32_t Lanes = HOST_SIMD_BYTES / sizeof(T);
+};
+
+template <class V, class T>
+inline V Load(const T* src)
+{
+    V value;
+    std::memcpy(&value, src, sizeof(V));
+    return value;
+}
+
+template <class T, class F, class... Srcs>
+inline void MapAcc(T* dst, uint32_t count, F& func, const Srcs*... srcs)
+{
+    uint32_t i = 0;
+    if constexpr (SimdTraits<T>::Lanes > 1 && (std::is_same<T, Srcs>::value && ...)) {
+        using V = typename SimdTraits<T>::Type;
+        constexpr uint32_t lanes = SimdTraits<T>::Lanes;
+        for (; i + lanes <= count; i += lanes) {
+            V result = func(Load<V>(srcs + i)...);
+            std::memcpy(dst + i, &result, sizeof(V));
+        }
+    }
+    for (; i < count; i++) {
+        dst[i] = static_cast<T>(func(srcs[i]...));
+    }
+}
+
+template <class T, class F, size_t... I, class... Srcs>
+inline void MapLowPrecision(T* dst, uint32_t count, F& func, std::index_sequence<I...>, const Srcs*... srcs)
+{
+    float in[sizeof...(Srcs) > 0 ? sizeof...(Srcs) : 1][LOW_PRECISION_CHUNK];
+    float out[LOW_PRECISION_CHUNK];
+    for (uint32_t base = 0; base < count; base += LOW_PRECISION_CHUNK) {
+        uint32_t num = count - base < LOW_PRECISION_CHUNK ? count - base : LOW_PRECISION_CHUNK;
+        (
+            [&] {
+                for (uint32_t j = 0; j < num; j++) {
+                    in[I][j] = ToAcc(srcs[base + j]);
+                }
+            }(),
+            ...);
+        MapAcc<float>(out, num, func, static_cast<const float*>(in[I])...);
+        for (uint32_t j = 0; j < num; j++) {
+            dst[base + j] = FromAcc<T>(out[j]);
+        }
+    }
+}
+
+/**
+ * 逐元素执行func，func需同时支持标量和SIMD向量类型的入参(泛型lambda)。
+ * half/bfloat16_t按块转成float计算后再转回。
+ */
+template <class T, class F, class... Srcs>
+inline void Map(T* dst, uint32_t count, F&& func, const Srcs*... srcs)
+{
+    if constexpr (IsLowPrecision<T>::Value) {
+        MapLowPrecision(dst, count, func, std::index_sequence_for<Srcs...>{}, srcs...);
+    } else {
+        MapAcc(dst, count, func, srcs...);
+    }
+}
+
+/**
+ * 逐元素执行只支持标量的func(如std::exp)，交给编译器自动向量化。
+ */
+template <class T, class F, class... Srcs>
+inline void MapScalar(T* dst, uint32_t count, F&& func, const Srcs*... srcs)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = FromAcc<T>(func(ToAcc(srcs[i])...));
+    }
+}
+
+template <class T>
+inline double RoundByMode(double value, int roundMode)
+{
+    if (!std::is_integral<T>::value) {
+        return value;
+    }
+    switch (roundMode) {
+        case ROUND_MODE_FLOOR:
+            return std::floor(value);
+        case ROUND_MODE_CEIL:
+            return std::ceil(value);
+        case ROUND_MODE_ROUND:
+            return std::round(value);
+        case ROUND_MODE_TRUNC:
+            return std::trunc(value);
+        default:
+            return std::nearbyint(value);
+    }
+}
+
+template <class R, class T, int roundMode>
+inline R CastValue(const T& src)
+{
+    if constexpr (std::is_integral<R>::value && !std::is_integral<T>::value) {
+        double value = RoundByMode<R>(static_cast<double>(ToAcc(src)), roundMode);
+        if (std::isnan(value)) {
+            return 0;
+        }
+        if (value <= static_cast<double>(std::numeric_limits<R>::lowest())) {
+            return std::numeric_limits<R>::lowest();
+        }
+        if (value >= static_cast<double>(std::numeric_limits<R>::max())) {
+            return std::numeric_limits<R>::max();
+        }
+        return static_cast<R>(value);
+    } else {
+        return FromAcc<R>(ToAcc(src));
+    }
+}
+
+template <int cmpMode, class T>
+inline bool CompareValue(T lhs, T rhs)
+{
+    switch (cmpMode) {
+        case CMP_MODE_LT:
+            return lhs < rhs;
+        case CMP_MODE_GT:
+            return lhs > rhs;
+        case CMP_MODE_EQ:
+            return lhs == rhs;
+        case CMP_MODE_LE:
+            return lhs <= rhs;
+        case CMP_MODE_GE:
+            return lhs >= rhs;
+        default:
+            return lhs != rhs;
+    }
+}
+
+// Compare的结果与NPU一致，按bit存放，每个字节从低位开始
+template <int cmpMode, class R, class T, class GetRhs>
+inline void CompareBits(R* dst, const T* src0, uint32_t count, GetRhs&& getRhs)
+{
+    uint8_t* mask = reinterpret_cast<uint8_t*>(dst);
+    for (uint32_t i = 0; i < count; i += BITS_PER_BYTE) {
+        uint8_t bits = 0;
+        for (uint32_t j = 0; j < BITS_PER_BYTE && i + j < count; j++) {
+            bool result = CompareValue<cmpMode>(ToAcc(src0[i + j]), ToAcc(getRhs(i + j)));
+            bits |= static_cast<uint8_t>(result ? 1U << j : 0U);
+        }
+        mask[i / BITS_PER_BYTE] = bits;
+    }
+}
+
+template <class U>
+inline bool MaskBit(const U* selMask, uint32_t index)
+{
+    const uint8_t* mask = reinterpret_cast<const uint8_t*>(selMask);
+    return ((mask[index / BITS_PER_BYTE] >> (index % BITS_PER_BYTE)) & 1U) != 0;
+}
+
+/**
+ * Vec::XXX在host上的实现。入参与Vec::XXX的构造函数一一对应，LocalTensor替换为指针，Scalar按值传递。
+ * 自定义的Vec操作需要特化HostFun后才能在ElementwiseHostSch上执行。
+ */
+template <class Func>
+struct HostFun {
+    static_assert(sizeof(Func) == 0, "The Vec function has no host implementation, please specialize HostFun.");
+};
+
+template <class T>
+struct HostFun<Vec::Duplicate<T>> {
+    static void Call(T* dst, T scalar, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = scalar;
+        }
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Copy<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        std::memmove(dst, src, count * sizeof(T));
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Reciprocal<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        Map(dst, count, [](auto x) { return 1 / x; }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Abs<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        Map(dst, count, [](auto x) { return x < decltype(x){} ? -x : x; }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Sqrt<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::sqrt(x); }, src);
+    }
+};
+
+template <class U, class T>
+struct HostFun<Vec::Sqrt0ULP<U, T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::sqrt(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Exp<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::exp(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Log<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::log(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Sin<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::sin(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Cos<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::cos(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::AtanPolyApprox<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::atan(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Erf<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::erf(x); }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Erfc<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return std::erfc(x); }, src);
+    }
+};
+
+template <class T, int roundMode>
+struct HostFun<Vec::Truncate<T, roundMode>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x) { return RoundByMode<int64_t>(x, roundMode); }, src);
+    }
+};
+
+template <class R, class T, int roundMode>
+struct HostFun<Vec::Cast<R, T, roundMode>> {
+    static void Call(R* dst, const T* src, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = CastValue<R, T, roundMode>(src[i]);
+        }
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Not<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        static_assert(std::is_integral<T>::value, "Not only supports integral types.");
+        Map(dst, count, [](auto x) { return ~x; }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Relu<T>> {
+    static void Call(T* dst, const T* src, uint32_t count)
+    {
+        Map(dst, count, [](auto x) { return x > decltype(x){} ? x : decltype(x){}; }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::LeakyRelu<T>> {
+    static void Call(T* dst, const T* src, T scalar, uint32_t count)
+    {
+        AccType<T> slope = ToAcc(scalar);
+        Map(dst, count, [slope](auto x) { return x < decltype(x){} ? x * slope : x; }, src);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Add<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x + y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Sub<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x - y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Mul<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x * y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Div<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x / y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::DivHighPrecision<T>> : public HostFun<Vec::Div<T>> {};
+
+template <class T>
+struct HostFun<Vec::Max<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x > y ? x : y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Min<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x < y ? x : y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::And<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x & y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Or<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y) { return x | y; }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::Fmod<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x, auto y) { return std::fmod(x, y); }, src1, src2);
+    }
+};
+
+template <class T>
+struct HostFun<Vec::FmodHighPrecision<T>> : public HostFun<Vec::Fmod<T>> {};
+
+template <class T>
+struct HostFun<Vec::Power<T>> {
+    static void Call(T* dst, const T* src0, const T* src1, uint32_t count)
+    {
+        MapScalar(dst, count, [](auto x, auto y) { return std::pow(x, y); }, src0, src1);
+    }
+    static void Call(T* dst, const T* src0, T scalar, uint32_t count)
+    {
+        AccType<T> exponent = ToAcc(scalar);
+        MapScalar(dst, count, [exponent](auto x) { return std::pow(x, exponent); }, src0);
+    }
+    static void Call(T* dst, T scalar, const T* src1, uint32_t count)
+    {
+        AccType<T> base = ToAcc(scalar);
+        MapScalar(dst, count, [base](auto y) { return std::pow(base, y); }, src1);
+    }
+};
+
+// Tensor与Scalar的双输入操作，Scalar在前在后两种形式
+#define HOST_TENSOR_SCALAR_FUN(NAME, EXPR_TS, EXPR_ST)                           \
+    template <class T>                                                          \
+    struct HostFun<Vec::NAME<T>> {                                              \
+        static void Call(T* dst, const T* src, T scalar, uint32_t count)        \
+        {                                                                       \
+            AccType<T> s = ToAcc(scalar);                                       \
+            Map(dst, count, [s](auto x) { return EXPR_TS; }, src);              \
+        }                                                                       \
+        static void Call(T* dst, T scalar, const T* src, uint32_t count)        \
+        {                                                                       \
+            AccType<T> s = ToAcc(scalar);                                       \
+            Map(dst, count, [s](auto x) { return EXPR_ST; }, src);              \
+        }                                                                       \
+    }
+
+HOST_TENSOR_SCALAR_FUN(Adds, x + s, x + s);
+HOST_TENSOR_SCALAR_FUN(Subs, x - s, s - x);
+HOST_TENSOR_SCALAR_FUN(Muls, x * s, x * s);
+HOST_TENSOR_SCALAR_FUN(Divs, x / s, s / x);
+HOST_TENSOR_SCALAR_FUN(Maxs, x > s ? x : s, x > s ? x : s);
+HOST_TENSOR_SCALAR_FUN(Mins, x < s ? x : s, x < s ? x : s);
+HOST_TENSOR_SCALAR_FUN(Ands, x & s, x & s);
+HOST_TENSOR_SCALAR_FUN(Ors, x | s, x | s);
+
+#undef HOST_TENSOR_SCALAR_FUN
+
+template <class R, class T, int cmpMode>
+struct HostFun<Vec::Compare<R, T, cmpMode>> {
+    static void Call(R* dst, const T* src0, const T* src1, uint32_t count)
+    {
+        CompareBits<cmpMode>(dst, src0, count, [src1](uint32_t i) { return src1[i]; });
+    }
+    static void Call(R* dst, const T* src0, T scalar, uint32_t count)
+    {
+        CompareBits<cmpMode>(dst, src0, count, [scalar](uint32_t) { return scalar; });
+    }
+};
+
+// selMask对应bit为1时取src0，否则取src1
+template <class U, class T, int selMode>
+struct HostFun<Vec::Select<U, T, selMode>> {
+    static void Call(T* dst, const U* selMask, const T* src0, const T* src1, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = MaskBit(selMask, i) ? src0[i] : src1[i];
+        }
+    }
+    static void Call(T* dst, const U* selMask, const T* src0, T scalar, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = MaskBit(selMask, i) ? src0[i] : scalar;
+        }
+    }
+    static void Call(T* dst, const U* selMask, T scalar, const T* src1, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = MaskBit(selMask, i) ? scalar : src1[i];
+        }
+    }
+};
+
+// dst = src1 + src2 * alpha
+template <class T>
+struct HostFun<Vec::FusedMulAdd<T>> {
+    static void Call(T* dst, const T* src1, const T* src2, const T* alpha, uint32_t count)
+    {
+        Map(dst, count, [](auto x, auto y, auto a) { return x + y * a; }, src1, src2, alpha);
+    }
+};
+
+// dst = src1 + src2 * scalar
+template <class T>
+struct HostFun<Vec::Axpy<T>> {
+    static void Call(T* dst, T scalar, const T* src1, const T* src2, uint32_t count)
+    {
+        Call(dst, src1, src2, scalar, count);
+    }
+    static void Call(T* dst, const T* src1, const T* src2, T scalar, uint32_t count)
+    {
+        AccType<T> s = ToAcc(scalar);
+        Map(dst, count, [s](auto x, auto y) { return x + y * s; }, src1, src2);
+    }
+};
+
+} // namespace Host
+} // namespace Base
+} // namespace Ops
+
+#endif // HOST_VEC_H_
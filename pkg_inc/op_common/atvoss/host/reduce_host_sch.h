@@ -0,0 +1,595 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file reduce_host_sch.h
+ * \brief ReduceSch的host实现，在CPU上按相同的DAG、ReduceOpTilingData及buffer分配执行
+ */
+#ifndef REDUCE_HOST_SCH_H_
+#define REDUCE_HOST_SCH_H_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "atvoss/util/dag.h"
+#include "atvoss/reduce/reduce_operator.h"
+#include "atvoss/reduce/reduce_tiling_data.h"
+#include "elewise_host_sch.h"
+#include "host_vec.h"
+
+namespace Ops {
+namespace Base {
+namespace Host {
+// Reduce节点的host实现：初值及累加方式，在AccType上累加
+template <class Func>
+struct HostReduce {
+    static_assert(sizeof(Func) == 0, "HostReduce is not implemented for this reduce node.");
+};
+
+template <class T>
+struct HostReduce<Vec::ReduceSumOp<T>> {
+    static AccType<T> Init()
+    {
+        return static_cast<AccType<T>>(0);
+    }
+
+    static AccType<T> Apply(AccType<T> lhs, AccType<T> rhs)
+    {
+        return lhs + rhs;
+    }
+};
+
+template <class T>
+struct HostReduce<Vec::ReduceProdOp<T>> {
+    static AccType<T> Init()
+    {
+        return static_cast<AccType<T>>(1);
+    }
+
+    static AccType<T> Apply(AccType<T> lhs, AccType<T> rhs)
+    {
+        return lhs * rhs;
+    }
+};
+
+template <class T>
+struct HostReduce<Vec::ReduceMaxOp<T>> {
+    static AccType<T> Init()
+    {
+        using Acc = AccType<T>;
+        return std::numeric_limits<Acc>::has_infinity ? -std::numeric_limits<Acc>::infinity() :
+                                                        std::numeric_limits<Acc>::lowest();
+    }
+
+    static AccType<T> Apply(AccType<T> lhs, AccType<T> rhs)
+    {
+        return rhs > lhs ? rhs : lhs;
+    }
+};
+
+template <class T>
+struct HostReduce<Vec::ReduceMinOp<T>> {
+    static AccType<T> Init()
+    {
+        using Acc = AccType<T>;
+        return std::numeric_limits<Acc>::has_infinity ? std::numeric_limits<Acc>::infinity() :
+                                                        std::numeric_limits<Acc>::max();
+    }
+
+    static AccType<T> Apply(AccType<T> lhs, AccType<T> rhs)
+    {
+        return rhs < lhs ? rhs : lhs;
+    }
+};
+
+// 与NPU一致，Any/All按Max/Min归约
+template <class T>
+struct HostReduce<Vec::ReduceAnyOp<T>> : public HostReduce<Vec::ReduceMaxOp<T>> {};
+
+template <class T>
+struct HostReduce<Vec::ReduceAllOp<T>> : public HostReduce<Vec::ReduceMinOp<T>> {};
+} // namespace Host
+
+/**
+ * 在host上执行Reduce DAG，DAG划分为Reduce前的节点、ReduceOp节点及Reduce后的节点。
+ * - tiling中shape/stride为合轴后的输入，轴的A/R属性由PatternID决定，输出在A轴上连续；
+ * - 核间按A轴平铺切分为realCoreNum份，各个核依次执行；R轴不跨核切分，groupR>1时与NPU的两阶段归约数学等价；
+ * - Reduce前的节点按[A块, R块]搬入并计算，单块元素个数不超过basicBlock，R块依次累加到ReduceOp的结果上；
+ *   Reduce后的节点在A块上计算，A块元素个数不超过resultBlock；
+ * - 节点的buffer按照DAG的GetReduceBufferIds分配；
+ * - 按FunList中的节点统计调用次数、元素个数、搬运字节数及耗时。
+ * 累加在float/整型上逐个进行，与NPU的二分累加顺序不同，浮点结果存在舍入误差。
+ */
+template <uint32_t PatternID, class OpDag>
+class ReduceHostSch {
+public:
+    using Pattern = typename ReduceOpTmpl::__reducePattern::GetPattern<PatternID>::T;
+    using ReduceOpBind = typename OpDag::FunList::template At<OpDag::ReduceOpPos>;
+    using ReduceFun = typename ReduceOpBind::Fun;
+    using DataType = typename ReduceOpBind::template FunInArgType<0>;
+    using AccType = Host::AccType<DataType>;
+
+    explicit ReduceHostSch(const ReduceOpTilingData* tiling) : tilingData(tiling) {}
+
+    /**
+     * 初始化ReduceHostSch对象
+     * @param args 输入输出的host地址，需要匹配DAG图中PlaceHolder的顺序[In0, In1..., Out0, Out1...]
+     */
+    template <class... Args>
+    void Init(Args... args)
+    {
+        static_assert(OpDag::ReduceOpPos > 0, "ReduceHostSch needs a ReduceOp node in DAG.");
+        static_assert(inputNums + outputNums == sizeof...(Args),
+                      "ReduceHostSch.Init args num should match DAG holders.");
+        uint8_t* addrs[] = {reinterpret_cast<uint8_t*>(args)...};
+        for (int i = 0; i < inputNums; i++) {
+            inGm[i] = addrs[i];
+        }
+        for (int i = 0; i < outputNums; i++) {
+            outGm[i] = addrs[inputNums + i];
+        }
+        aDimNum = 0;
+        rDimNum = 0;
+        aTotal = 1;
+        rTotal = 1;
+        for (int32_t i = 0; i < Pattern::Dim; i++) {
+            if (IsAxisA(i)) {
+                aShape[aDimNum] = tilingData->shape[i];
+                aStride[aDimNum++] = tilingData->stride[i];
+                aTotal *= tilingData->shape[i];
+            } else {
+                rShape[rDimNum] = tilingData->shape[i];
+                rStride[rDimNum++] = tilingData->stride[i];
+                rTotal *= tilingData->shape[i];
+            }
+        }
+        uint64_t preEleNum = std::max<uint64_t>(1, tilingData->basicBlock / sizeof(DataType));
+        uint64_t postEleNum = std::max<uint64_t>(1, tilingData->resultBlock / sizeof(DataType));
+        rFactor = std::max<uint64_t>(1, std::min(rTotal, preEleNum));
+        aFactor = std::max<uint64_t>(1, std::min(postEleNum, preEleNum / rFactor));
+        preBlockLen = rFactor * aFactor * OpDag::MaxDtypeBytes;
+        postBlockLen = aFactor * OpDag::MaxDtypeBytes;
+        prePool.assign(preBlockLen * preBufferNum, 0);
+        postPool.assign(postBlockLen * postBufferNum, 0);
+        reduceOut.assign(aFactor, DataType());
+        acc.assign(aFactor, AccType());
+        aOffsets.assign(aFactor, 0);
+        rOffsets.assign(rFactor, 0);
+    }
+
+    template <typename U, int index>
+    void SetVar(U value)
+    {
+        static_assert(index < OpDag::Vars::Size, "The index exceeds the number of Vars defined in DAG.");
+        scalars.template Set<index>(value);
+    }
+
+    /**
+     * 依次执行每个核
+     */
+    void Process()
+    {
+        int64_t blockNum = std::max<int64_t>(1, tilingData->realCoreNum);
+        for (int64_t blockIdx = 0; blockIdx < blockNum; blockIdx++) {
+            ProcessBlock(blockIdx, blockNum);
+        }
+    }
+
+    void ProcessBlock(int64_t blockIdx, int64_t blockNum)
+    {
+        uint64_t aPerBlock = (aTotal + blockNum - 1) / blockNum;
+        uint64_t aStart = std::min(aTotal, aPerBlock * blockIdx);
+        uint64_t aEnd = std::min(aTotal, aStart + aPerBlock);
+        int32_t pingPong = 0;
+        for (uint64_t a = aStart; a < aEnd; a += aFactor) {
+            uint64_t aLen = std::min(aFactor, aEnd - a);
+            for (uint64_t i = 0; i < aLen; i++) {
+                aOffsets[i] = GetOffset(a + i, aShape, aStride, aDimNum);
+            }
+            std::fill(acc.begin(), acc.begin() + aLen, Host::HostReduce<ReduceFun>::Init());
+            for (uint64_t r = 0; r < rTotal; r += rFactor) {
+                uint64_t rLen = std::min(rFactor, rTotal - r);
+                for (uint64_t i = 0; i < rLen; i++) {
+                    rOffsets[i] = GetOffset(r + i, rShape, rStride, rDimNum);
+                }
+                RunPre<0>(aLen, rLen, pingPong);
+                pingPong ^= 1;
+            }
+            for (uint64_t i = 0; i < aLen; i++) {
+                reduceOut[i] = Host::FromAcc<DataType>(acc[i]);
+            }
+            if constexpr (OpDag::ReduceOpPos + 1 < OpDag::FunList::Size) {
+                RunPost<OpDag::ReduceOpPos + 1>(a, aLen);
+            }
+        }
+    }
+
+    void EnableProfiling(bool enable)
+    {
+        profiling = enable;
+    }
+
+    void ResetStat()
+    {
+        nodeStats.fill(HostStageStat());
+    }
+
+    // FunList中第pos个节点的统计
+    const HostStageStat& GetNodeStat(uint32_t pos) const
+    {
+        return nodeStats[pos];
+    }
+
+    HostStageStat GetStageStat(HostStage stage) const
+    {
+        HostStageStat stat;
+        for (uint32_t i = 0; i < funNums; i++) {
+            if (nodeStages[i] == stage) {
+                stat.Add(nodeStats[i]);
+            }
+        }
+        return stat;
+    }
+
+    // 节点所属阶段
+    template <class Op>
+    constexpr static HostStage GetStage()
+    {
+        using Func = typename Op::Fun;
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            return HostStage::COPY_IN;
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            return HostStage::COPY_OUT;
+        } else {
+            return HostStage::COMPUTE;
+        }
+    }
+
+protected:
+    constexpr static bool IsAxisA(int32_t axis)
+    {
+        return Pattern::FirstA ? (axis % 2 == 0) : (axis % 2 == 1);
+    }
+
+    // 合轴后A轴或R轴上的第index个元素在输入上的偏移
+    static int64_t GetOffset(uint64_t index, const uint64_t* shape, const int64_t* stride, int32_t dimNum)
+    {
+        int64_t offset = 0;
+        for (int32_t i = dimNum - 1; i >= 0; i--) {
+            offset += static_cast<int64_t>(index % shape[i]) * stride[i];
+            index /= shape[i];
+        }
+        return offset;
+    }
+
+    // 获取buffer个数：buffer id的最大值 + 1
+    constexpr static uint32_t GetBufferNum(const int32_t* const* ids, int32_t rows, int32_t start, int32_t end)
+    {
+        int32_t maxId = -1;
+        for (int32_t row = 0; row < rows; row++) {
+            for (int32_t pos = start; pos < end; pos++) {
+                maxId = ids[row][pos] > maxId ? ids[row][pos] : maxId;
+            }
+        }
+        return static_cast<uint32_t>(maxId + 1);
+    }
+
+    template <int pos>
+    constexpr static bool IsPreNode()
+    {
+        return pos < OpDag::ReduceOpPos;
+    }
+
+    template <typename T, int pos>
+    T* GetBuffer(int32_t pingPong)
+    {
+        if constexpr (IsPreNode<pos>()) {
+            int32_t bufId = pingPong == 0 ? preBufferIds[0][pos] : preBufferIds[1][pos];
+            return reinterpret_cast<T*>(prePool.data() + bufId * preBlockLen);
+        } else {
+            static_assert(pos != OpDag::ReduceOpPos, "ReduceOp result is not in the post buffer pool.");
+            int32_t bufId = postBufferIds[0][pos - OpDag::ReduceOpPos - 1];
+            return reinterpret_cast<T*>(postPool.data() + bufId * postBlockLen);
+        }
+    }
+
+    template <class Op, int start = 0>
+    constexpr static int GetFunOutputPos()
+    {
+        if constexpr (std::is_same<typename OpDag::FunList::template At<start>, Op>::value) {
+            return start;
+        } else if constexpr (start + 1 < OpDag::FunList::Size) {
+            return GetFunOutputPos<Op, start + 1>();
+        }
+        static_assert(start + 1 < OpDag::FunList::Size, "The required output in FunList is not found.");
+        return -1;
+    }
+
+    template <typename ScalarType, typename scalarValue>
+    ScalarType GetScalar()
+    {
+        if constexpr (Placeholder::IsVar<scalarValue>::Value) {
+            return scalars.template Get<scalarValue::Pos>();
+        } else if constexpr (Placeholder::IsInHolder<scalarValue>::Value) {
+            ScalarType scalar;
+            std::memcpy(&scalar, inGm[scalarValue::Pos], sizeof(ScalarType));
+            return scalar;
+        } else {
+            static_assert(Placeholder::IsConstValue<scalarValue>::Value,
+                          "The input parameter type is not FunBind, Var, Const or Holder.");
+            return static_cast<ScalarType>(scalarValue::value);
+        }
+    }
+
+    // Reduce前的搬入：按[aLen, rLen]排布到ub，R轴连续时按行拷贝
+    template <typename Op, int pos>
+    void CopyInPre(uint64_t aLen, uint64_t rLen, int32_t pingPong)
+    {
+        static_assert(Op::InHolders::Size == 1, "CopyIn input inHolders num should be 1.");
+        using InputOp = typename Op::InHolders::template At<0>;
+        using TensorType = typename Op::template FunInArgType<0>;
+        if constexpr (Op::IsScalarOp) {
+            opScalars.template Set<pos>(GetScalar<TensorType, InputOp>());
+            return;
+        }
+        static_assert(std::is_same<typename InputOp::DType, TensorType>::value,
+                      "CopyIn data type is inconsistent with in holder data type.");
+        const TensorType* src = reinterpret_cast<const TensorType*>(inGm[InputOp::Pos]);
+        TensorType* dst = GetBuffer<TensorType, pos>(pingPong);
+        bool rContiguous = rOffsets[rLen - 1] - rOffsets[0] == static_cast<int64_t>(rLen - 1);
+        for (uint64_t i = 0; i < aLen; i++) {
+            const TensorType* row = src + aOffsets[i];
+            if (rContiguous) {
+                std::memcpy(dst + i * rLen, row + rOffsets[0], rLen * sizeof(TensorType));
+            } else {
+                for (uint64_t j = 0; j < rLen; j++) {
+                    dst[i * rLen + j] = row[rOffsets[j]];
+                }
+            }
+        }
+        nodeStats[pos].bytes += aLen * rLen * sizeof(TensorType);
+    }
+
+    // Reduce后的搬入：输入shape与输出一致，在A轴上连续
+    template <typename Op, int pos>
+    void CopyInPost(uint64_t aIndex, uint64_t aLen)
+    {
+        static_assert(Op::InHolders::Size == 1, "CopyIn input inHolders num should be 1.");
+        using InputOp = typename Op::InHolders::template At<0>;
+        using TensorType = typename Op::template FunInArgType<0>;
+        if constexpr (Op::IsScalarOp) {
+            opScalars.template Set<pos>(GetScalar<TensorType, InputOp>());
+            return;
+        }
+        static_assert(std::is_same<typename InputOp::DType, TensorType>::value,
+                      "CopyIn data type is inconsistent with in holder data type.");
+        uint64_t bytes = aLen * sizeof(TensorType);
+        std::memcpy(GetBuffer<TensorType, pos>(0), inGm[InputOp::Pos] + aIndex * sizeof(TensorType), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    template <typename Op, int pos>
+    void CopyOut(uint64_t aIndex, uint64_t aLen)
+    {
+        static_assert(Op::Args::Size == 2, "Input args should be 2");
+        using input = typename Op::Args::template At<1>;
+        using output = typename Op::Args::template At<0>;
+        using inputType = typename Op::template FunInArgType<0>;
+        static_assert(Placeholder::IsOutHolder<output>::Value, "output args should be out holder");
+        static_assert(output::Pos < outputNums, "output Pos is not less than output number.");
+        static_assert(std::is_same<typename output::DType, inputType>::value,
+                      "CopyOut data type is inconsistent with Op data type.");
+        uint64_t bytes = aLen * sizeof(inputType);
+        std::memcpy(outGm[output::Pos] + aIndex * sizeof(inputType), GetArgTensor<inputType, input>(0), bytes);
+        nodeStats[pos].bytes += bytes;
+    }
+
+    // ReduceOp：[aLen, rLen]按行归约并累加到acc上
+    void Reduce(uint64_t aLen, uint64_t rLen, int32_t pingPong)
+    {
+        using InputOp = typename ReduceOpBind::InArgs::template At<0>;
+        static_assert(__aux::TypeIsFunBind<InputOp>::Value, "ReduceOp input should be a node.");
+        const DataType* src = GetBuffer<DataType, GetFunOutputPos<InputOp>()>(pingPong);
+        for (uint64_t i = 0; i < aLen; i++) {
+            AccType value = acc[i];
+            const DataType* row = src + i * rLen;
+            for (uint64_t j = 0; j < rLen; j++) {
+                value = Host::HostReduce<ReduceFun>::Apply(value, Host::ToAcc(row[j]));
+            }
+            acc[i] = value;
+        }
+    }
+
+    template <typename TensorType, typename InputOp>
+    const TensorType* GetArgTensor(int32_t pingPong)
+    {
+        if constexpr (std::is_same<InputOp, ReduceOpBind>::value) {
+            static_assert(std::is_same<TensorType, DataType>::value,
+                          "ReduceOp output data type is inconsistent with Op data type.");
+            return reduceOut.data();
+        } else {
+            return GetBuffer<TensorType, GetFunOutputPos<InputOp>()>(pingPong);
+        }
+    }
+
+    template <typename Op, int argPos>
+    auto ConvertArgs(int32_t pingPong)
+    {
+        using InputOp = typename Op::InArgs::template At<argPos>;
+        using TensorType = typename Op::template FunInArgType<argPos>;
+        if constexpr (__aux::TypeIsFunBind<InputOp>::Value) {
+            if constexpr (InputOp::IsScalarOp) {
+                TensorType scalar = opScalars.template Get<GetFunOutputPos<InputOp>()>();
+                return scalar;
+            } else {
+                return GetArgTensor<TensorType, InputOp>(pingPong);
+            }
+        } else {
+            return GetScalar<TensorType, InputOp>();
+        }
+    }
+
+    template <typename Op, size_t... I>
+    auto MakeArgs(int32_t pingPong, std::index_sequence<I...>)
+    {
+        return std::make_tuple(ConvertArgs<Op, I>(pingPong)...);
+    }
+
+    template <class Op, int pos>
+    void RunNormalOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        static_assert(!Vec::IsCopyInBrcOp<typename Op::Fun>::Value && !Vec::IsVecBrcOp<typename Op::Fun>::Value,
+                      "ReduceHostSch does not support broadcast nodes.");
+        OutputType* outTensor = GetBuffer<OutputType, pos>(pingPong);
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [outTensor, tileLength](auto... inputs) {
+                Host::HostFun<typename Op::Fun>::Call(outTensor, inputs..., static_cast<uint32_t>(tileLength));
+            },
+            inputArgs);
+    }
+
+    template <class Op, int pos>
+    void RunScalarOp(uint64_t tileLength, int32_t pingPong)
+    {
+        using OutputType = typename Op::template FunRetArgType<0>;
+        OutputType outScalar;
+        auto inputArgs = MakeArgs<Op>(pingPong, std::make_index_sequence<Op::InputSize>{});
+        std::apply(
+            [&outScalar, tileLength](auto... inputs) {
+                typename Op::Fun(outScalar, inputs..., static_cast<int>(tileLength));
+            },
+            inputArgs);
+        opScalars.template Set<pos>(outScalar);
+    }
+
+    std::chrono::steady_clock::time_point StartProfiling() const
+    {
+        return profiling ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    }
+
+    void UpdateStat(uint32_t pos, uint64_t elements, std::chrono::steady_clock::time_point start)
+    {
+        HostStageStat& stat = nodeStats[pos];
+        stat.calls++;
+        stat.elements += elements;
+        if (profiling) {
+            stat.nanoseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                          std::chrono::steady_clock::now() - start)
+                                                          .count());
+        }
+    }
+
+    // 执行Reduce前的节点及ReduceOp
+    template <int pos = 0>
+    void RunPre(uint64_t aLen, uint64_t rLen, int32_t pingPong)
+    {
+        using Op = typename OpDag::FunList::template At<pos>;
+        using Func = typename Op::Fun;
+        auto start = StartProfiling();
+        uint64_t tileLength = aLen * rLen;
+        if constexpr (pos == OpDag::ReduceOpPos) {
+            Reduce(aLen, rLen, pingPong);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            CopyInPre<Op, pos>(aLen, rLen, pingPong);
+        } else if constexpr (Op::IsScalarOp) {
+            RunScalarOp<Op, pos>(tileLength, pingPong);
+        } else {
+            static_assert(!__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value,
+                          "ReduceHostSch does not support CopyOut before ReduceOp.");
+            RunNormalOp<Op, pos>(tileLength, pingPong);
+        }
+        UpdateStat(pos, tileLength, start);
+
+        if constexpr (pos < OpDag::ReduceOpPos) {
+            RunPre<pos + 1>(aLen, rLen, pingPong);
+        }
+    }
+
+    // 执行Reduce后的节点
+    template <int pos>
+    void RunPost(uint64_t aIndex, uint64_t aLen)
+    {
+        using Op = typename OpDag::FunList::template At<pos>;
+        using Func = typename Op::Fun;
+        auto start = StartProfiling();
+        if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyIn>::Value) {
+            CopyInPost<Op, pos>(aIndex, aLen);
+        } else if constexpr (__aux::IsSameTemplateType<Func, Vec::CopyOut>::Value) {
+            CopyOut<Op, pos>(aIndex, aLen);
+        } else if constexpr (Op::IsScalarOp) {
+            RunScalarOp<Op, pos>(aLen, 0);
+        } else {
+            RunNormalOp<Op, pos>(aLen, 0);
+        }
+        UpdateStat(pos, aLen, start);
+
+        if constexpr (pos + 1 < OpDag::FunList::Size) {
+            RunPost<pos + 1>(aIndex, aLen);
+        }
+    }
+
+    template <size_t... I>
+    constexpr static std::array<HostStage, sizeof...(I)> MakeNodeStages(std::index_sequence<I...>)
+    {
+        return {GetStage<typename OpDag::FunList::template At<I>>()...};
+    }
+
+private:
+    constexpr static int inputNums = OpDag::InputSize;
+    constexpr static int outputNums = OpDag::OutputSize;
+    constexpr static uint32_t funNums = OpDag::FunList::Size;
+    constexpr static int32_t postNodeNum = static_cast<int32_t>(funNums) - OpDag::ReduceOpPos - 1;
+    constexpr static auto preBufferIds = OpDag::template GetReduceBufferIds<true>();
+    constexpr static auto postBufferIds = OpDag::template GetReduceBufferIds<false>();
+    constexpr static uint32_t preBufferNum = GetBufferNum(preBufferIds, 2, 0, OpDag::ReduceOpPos);
+    constexpr static uint32_t postBufferNum = GetBufferNum(postBufferIds, 1, 0, postNodeNum);
+    constexpr static std::array<HostStage, funNums> nodeStages = MakeNodeStages(std::make_index_sequence<funNums>{});
+
+    uint8_t* inGm[inputNums > 0 ? inputNums : 1] = {};
+    uint8_t* outGm[outputNums > 0 ? outputNums : 1] = {};
+    uint64_t aShape[ReduceOpTmpl::MAX_DIM] = {0};
+    int64_t aStride[ReduceOpTmpl::MAX_DIM] = {0};
+    uint64_t rShape[ReduceOpTmpl::MAX_DIM] = {0};
+    int64_t rStride[ReduceOpTmpl::MAX_DIM] = {0};
+    int32_t aDimNum = 0;
+    int32_t rDimNum = 0;
+    uint64_t aTotal = 1;
+    uint64_t rTotal = 1;
+    uint64_t aFactor = 1;
+    uint64_t rFactor = 1;
+    uint64_t preBlockLen = 0;
+    uint64_t postBlockLen = 0;
+    std::vector<uint8_t> prePool;
+    std::vector<uint8_t> postPool;
+    std::vector<DataType> reduceOut;
+    std::vector<AccType> acc;
+    std::vector<int64_t> aOffsets;
+    std::vector<int64_t> rOffsets;
+    bool profiling = false;
+    std::array<HostStageStat, funNums> nodeStats{};
+
+    const ReduceOpTilingData* tilingData;
+    typename OpDag::VarType scalars;
+    typename OpDag::ScalarOpType opScalars;
+};
+
+} // namespace Base
+} // namespace Ops
+
+#endif // REDUCE_HOST_SCH_H_
@@ -22,6 +22,7 @@
 #include "tiling/platform/platform_ascendc.h"
 #include "op_common/atvoss/util/dag.h"
 #include "op_common/atvoss/reduce/reduce_tiling_data.h"
+#include "op_common/atvoss/tuner/tiling_tuner.h"
 #include "op_common/log/log.h"
 #include "op_common/op_host/util/platform_util.h"
 #include "op_common/op_host/util/opbase_export.h"
@@ -267,6 +268,15 @@ public:
         : context_(context), compileInfo_(compileInfo), tilingData_(tilingData){};
 
     virtual ~ReduceOpTiling() {}
+
+    /*
+     * \brief offline autotune mode, tiling enumerates candidates with the tuner and records the best one into
+     *  TilingTuneTable::Instance() before consulting the table
+     *
+     * @param autoTuner
+     *  tuner used for offline autotune, nullptr to disable
+     */
+    void SetAutoTuner(const TilingAutoTuner* autoTuner) { autoTuner_ = autoTuner; }
     /*
      * \brief reduce template do tiling with input shape and axis
      *
@@ -382,6 +392,12 @@ protected:
     template <class Pattern>
     void ComputeProgressUnitA(const uint64_t* shape);
 
+    template <class Pattern>
+    void MakeTuneProblem(const uint64_t* shape, TilingTuneProblem& problem);
+
+    template <class Pattern>
+    bool ApplyTunedTiling(const uint64_t* shape);
+
     template <class Pattern>
     void ComputeRFirst(const uint64_t* shape);
 
@@ -436,6 +452,7 @@ protected:
     ReduceTilingKey tilingKey_;
     ReduceOpInputParam opInput_;
     ReduceOpDagParam opDag_;
+    const TilingAutoTuner* autoTuner_{nullptr};
     int64_t viewStride_[MAX_DIM] = {0};   // 每个轴slice切片的个数
     uint64_t sliceNum_[MAX_DIM] = {0};    // 每个轴slice切片的个数
     uint64_t sliceShape_[MAX_DIM] = {0};  // 每个轴slice切片后的shape大小
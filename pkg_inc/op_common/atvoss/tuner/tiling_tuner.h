@@ -0,0 +1,714 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_tuner.h
+ * \brief reduce/broadcast模板切分的代价模型、离线调优及按shape分档的调优结果表
+ */
+
+#ifndef ATVOSS_TILING_TUNER_H_
+#define ATVOSS_TILING_TUNER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Ops {
+namespace Base {
+
+// 调优结果表路径，进程内首次查询时加载
+constexpr const char* TILING_TUNE_TABLE_ENV = "ASCEND_OP_TILING_TUNE_TABLE";
+constexpr const char* TILING_TUNE_TABLE_HEADER = "# atvoss tiling tune table v1";
+// 不大于该值的轴按原值分档，小轴(如reduce中间的小R轴)对切分影响大，不做合并
+constexpr uint64_t TILING_TUNE_EXACT_DIM = 16;
+constexpr size_t TILING_TUNE_MAX_FACTOR_NUM = 24;
+constexpr size_t TILING_TUNE_DEFAULT_MEASURE_NUM = 8;
+// 查询线程按线程号分散计数的槽位数，避免并发查询争用同一缓存行
+constexpr size_t TILING_TUNE_READER_SLOTS = 16;
+
+enum class TilingTuneKind : uint32_t {
+    REDUCE = 0,
+    BROADCAST = 1
+};
+
+/**
+ * 一次切分问题的描述
+ * reduce: dims为补维后的shape，axisIsA标识每根轴是否为A轴，tileCapacity为BasicBlock可容纳的元素个数
+ * broadcast: dims为合轴后的输出shape，axisIsA全部为true，tileCapacity为maxElemNum
+ */
+struct TilingTuneProblem {
+    TilingTuneKind kind = TilingTuneKind::REDUCE;
+    std::vector<uint64_t> dims;
+    std::vector<bool> axisIsA;
+    uint64_t dtypeBytes = 1;
+    uint64_t tileCapacity = 0;
+    uint64_t alignElems = 1;         // 尾轴切分需对齐的元素个数
+    uint64_t maxInnerA = 0;          // R轴切分时UB内A轴的上限，0表示不限制
+    uint64_t maxInnerAWithRFull = 0; // R轴全载时UB内A轴的上限，0表示不限制
+    uint64_t coreNum = 1;
+    uint64_t cacheLineSize = 1;
+};
+
+/**
+ * 候选切分，axisA/factorA为A轴(broadcast为ub切分轴)的切分轴及切分因子，
+ * axisR/factorR为R轴的切分轴及切分因子，axisR为-1表示R轴在UB内全载
+ */
+struct TilingCandidate {
+    int32_t axisA = -1;
+    uint64_t factorA = 1;
+    int32_t axisR = -1;
+    uint64_t factorR = 1;
+};
+
+struct TilingTuneFeature {
+    uint64_t innerA = 1;              // 单个tile内A轴元素个数(含尾轴对齐)
+    uint64_t outerA = 1;              // A轴tile个数
+    uint64_t innerR = 1;              // 单个tile内R轴元素个数(含尾轴对齐)
+    uint64_t outerR = 1;              // R轴tile个数
+    uint64_t tileElems = 0;           // 单个tile占用的元素个数
+    uint64_t usedCoreNum = 0;         // 实际使用的核数
+    uint64_t tilesPerCore = 0;        // 单核最多处理的tile个数
+    uint64_t groupR = 1;              // R轴分核的组数，大于1时需要核间二次reduce
+    uint64_t burstElems = 0;          // 单次连续搬运的元素个数
+    uint64_t burstNum = 0;            // 单个tile的搬运次数
+    double coreBalance = 0.0;         // 核间负载均衡度
+    double ubUtilization = 0.0;       // UB利用率
+    double cacheLineEfficiency = 0.0; // 连续搬运按cacheline对齐后的有效比例
+    double tailWaste = 0.0;           // 尾块及对齐补齐导致的无效计算比例
+};
+
+/**
+ * 切分代价模型，返回值越小越好，只用于候选之间比较，不代表实际耗时
+ */
+class TilingCostModel {
+public:
+    virtual ~TilingCostModel() = default;
+
+    virtual double Evaluate(const TilingTuneProblem& problem, const TilingTuneFeature& feature) const = 0;
+};
+
+struct TilingCostWeights {
+    double tileOverhead = 1024.0;   // 每个tile的搬入、同步及循环开销
+    double burstOverhead = 32.0;    // 每次搬运指令的开销
+    double byteCost = 0.125;        // 每个有效搬运字节的开销
+    double groupROverhead = 4096.0; // 核间二次reduce的开销
+};
+
+/**
+ * 默认代价模型: 耗时最长的核上 tile个数 * (tile固定开销 + 搬运次数开销 + 按cacheline效率折算的搬运字节开销)
+ * 核间不均衡、UB未用满、尾块浪费分别体现在tilesPerCore、tile个数及tileElems上
+ */
+class DefaultTilingCostModel : public TilingCostModel {
+public:
+    DefaultTilingCostModel() = default;
+
+    explicit DefaultTilingCostModel(const TilingCostWeights& weights) : weights_(weights) {}
+
+    double Evaluate(const TilingTuneProblem& problem, const TilingTuneFeature& feature) const override
+    {
+        double efficiency = feature.cacheLineEfficiency > 0.0 ? feature.cacheLineEfficiency : 1.0;
+        double tileBytes = static_cast<double>(feature.tileElems * problem.dtypeBytes) / efficiency;
+        double tileCost = weights_.tileOverhead + weights_.burstOverhead * static_cast<double>(feature.burstNum) +
+                          weights_.byteCost * tileBytes;
+        double cost = static_cast<double>(feature.tilesPerCore) * tileCost;
+        if (feature.groupR > 1) {
+            cost += weights_.groupROverhead * static_cast<double>(feature.groupR);
+        }
+        return cost;
+    }
+
+private:
+    TilingCostWeights weights_;
+};
+
+namespace TilingTuneTmpl {
+inline uint64_t CeilDivU64(uint64_t a, uint64_t b)
+{
+    return b == 0 ? 0 : (a + b - 1) / b;
+}
+
+inline uint64_t CeilAlignU64(uint64_t a, uint64_t b)
+{
+    return CeilDivU64(a, b) * b;
+}
+
+inline bool IsLastAxis(const TilingTuneProblem& problem, size_t axis)
+{
+    return axis + 1 == problem.dims.size();
+}
+
+// tile内该轴的长度，尾轴按alignElems对齐
+inline uint64_t TileExtent(const TilingTuneProblem& problem, size_t axis, uint64_t len)
+{
+    return IsLastAxis(problem, axis) ? CeilAlignU64(len, problem.alignElems) : len;
+}
+
+// 与ReduceOpTiling::SetTilingData的分核一致
+inline void SplitReduceCore(const TilingTuneProblem& problem, TilingTuneFeature& feature)
+{
+    uint64_t total = feature.outerA * feature.outerR;
+    uint64_t perCoreNum = CeilDivU64(total, problem.coreNum);
+    uint64_t numBlocks = CeilDivU64(total, perCoreNum);
+    if (feature.outerA < numBlocks) {
+        uint64_t tmpBlockDim = CeilAlignU64(numBlocks, feature.outerA);
+        numBlocks = tmpBlockDim <= problem.coreNum ? tmpBlockDim : numBlocks / feature.outerA * feature.outerA;
+    }
+    uint64_t factorACntPerCore = CeilDivU64(feature.outerA, numBlocks);
+    uint64_t factorRCntPerCore = CeilDivU64(feature.outerR, CeilDivU64(numBlocks, feature.outerA));
+    feature.groupR = CeilDivU64(feature.outerR, factorRCntPerCore);
+    feature.usedCoreNum = CeilDivU64(feature.outerA, factorACntPerCore) * feature.groupR;
+    feature.tilesPerCore = factorACntPerCore * factorRCntPerCore;
+}
+
+// 与DoBrodcastTiling的分核一致
+inline void SplitBroadcastCore(const TilingTuneProblem& problem, TilingTuneFeature& feature)
+{
+    uint64_t blockFormer = CeilDivU64(feature.outerA, problem.coreNum);
+    feature.usedCoreNum = CeilDivU64(feature.outerA, blockFormer);
+    feature.tilesPerCore = blockFormer;
+    feature.groupR = 1;
+}
+
+template <typename PutChar>
+inline void PutNumber(uint64_t value, PutChar& put)
+{
+    char digits[20];
+    size_t len = 0;
+    do {
+        digits[len++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (len > 0) {
+        put(digits[--len]);
+    }
+}
+
+// 不大于TILING_TUNE_EXACT_DIM的轴按原值，大轴按2的幂次分档，记为p<幂次>
+template <typename PutChar>
+inline void PutBucketDim(uint64_t dim, PutChar& put)
+{
+    if (dim <= TILING_TUNE_EXACT_DIM) {
+        PutNumber(dim, put);
+        return;
+    }
+    uint32_t exp = 0;
+    while ((static_cast<uint64_t>(1) << exp) < dim) {
+        exp++;
+    }
+    put('p');
+    PutNumber(exp, put);
+}
+
+// 逐字符输出分档key，拼接字符串和计算哈希共用，保证两者一致
+template <typename PutChar>
+inline void PutTuneKey(const TilingTuneProblem& problem, PutChar& put)
+{
+    put(problem.kind == TilingTuneKind::REDUCE ? 'R' : 'B');
+    for (uint64_t value : {problem.dtypeBytes, problem.coreNum, problem.tileCapacity}) {
+        put('|');
+        PutNumber(value, put);
+    }
+    put('|');
+    for (size_t i = 0; i < problem.dims.size(); i++) {
+        if (i != 0) {
+            put(',');
+        }
+        put(problem.axisIsA[i] ? 'a' : 'r');
+        PutBucketDim(problem.dims[i], put);
+    }
+}
+
+// FNV-1a
+class TuneKeyHasher {
+public:
+    void operator()(char c)
+    {
+        hash_ = (hash_ ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+    }
+
+    uint64_t Get() const
+    {
+        return hash_;
+    }
+
+private:
+    uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+} // namespace TilingTuneTmpl
+
+/**
+ * 计算候选切分的特征，候选不合法(切分轴类型不匹配、tile超过容量、尾轴未对齐等)时返回false
+ */
+inline bool EvaluateTilingCandidate(const TilingTuneProblem& problem, const TilingCandidate& candidate,
+                                    TilingTuneFeature& feature)
+{
+    using namespace TilingTuneTmpl;
+    size_t dimNum = problem.dims.size();
+    if (dimNum == 0 || problem.axisIsA.size() != dimNum || problem.tileCapacity == 0 || problem.coreNum == 0) {
+        return false;
+    }
+    bool isReduce = problem.kind == TilingTuneKind::REDUCE;
+    if (candidate.axisA < 0 || static_cast<size_t>(candidate.axisA) >= dimNum || !problem.axisIsA[candidate.axisA]) {
+        return false;
+    }
+    if (candidate.axisR >= 0 && (!isReduce || static_cast<size_t>(candidate.axisR) >= dimNum ||
+                                 problem.axisIsA[candidate.axisR])) {
+        return false;
+    }
+
+    feature = TilingTuneFeature();
+    uint64_t totalElems = 1;
+    uint64_t paddedElems = 1;
+    uint64_t burstElems = 1;
+    bool burstOpen = true;
+    for (size_t i = dimNum; i-- > 0;) {
+        uint64_t len = problem.dims[i];
+        if (len == 0) {
+            return false;
+        }
+        bool isA = problem.axisIsA[i];
+        int32_t splitAxis = isA ? candidate.axisA : candidate.axisR;
+        uint64_t factor = isA ? candidate.factorA : candidate.factorR;
+        uint64_t inner = 1;
+        uint64_t outer = len;
+        if (static_cast<int32_t>(i) > splitAxis) {
+            inner = TileExtent(problem, i, len);
+            outer = 1;
+        } else if (static_cast<int32_t>(i) == splitAxis) {
+            bool unaligned = IsLastAxis(problem, i) && factor < len && factor % problem.alignElems != 0;
+            if (factor == 0 || factor > len || unaligned) {
+                return false;
+            }
+            inner = TileExtent(problem, i, factor);
+            outer = CeilDivU64(len, factor);
+        }
+        if (isA) {
+            feature.innerA *= inner;
+            feature.outerA *= outer;
+        } else {
+            feature.innerR *= inner;
+            feature.outerR *= outer;
+        }
+        totalElems *= len;
+        paddedElems *= inner * outer;
+        // 从尾轴向前，全载的轴可以合并为一次连续搬运，遇到切分轴或tile外的轴后结束
+        if (burstOpen) {
+            burstElems *= (static_cast<int32_t>(i) == splitAxis ? factor : (outer == 1 ? len : 1));
+            burstOpen = outer == 1;
+        }
+    }
+    feature.tileElems = feature.innerA * feature.innerR;
+    if (feature.tileElems > problem.tileCapacity) {
+        return false;
+    }
+    uint64_t maxInnerA = candidate.axisR < 0 ? problem.maxInnerAWithRFull : problem.maxInnerA;
+    if (isReduce && maxInnerA != 0 && feature.innerA > maxInnerA) {
+        return false;
+    }
+
+    if (isReduce) {
+        SplitReduceCore(problem, feature);
+    } else {
+        SplitBroadcastCore(problem, feature);
+    }
+    uint64_t tileNum = feature.outerA * feature.outerR;
+    uint64_t burstBytes = burstElems * problem.dtypeBytes;
+    feature.burstElems = burstElems;
+    feature.burstNum = CeilDivU64(feature.tileElems, burstElems);
+    feature.coreBalance = static_cast<double>(tileNum) /
+                          static_cast<double>(feature.tilesPerCore * problem.coreNum);
+    feature.ubUtilization = static_cast<double>(feature.tileElems) / static_cast<double>(problem.tileCapacity);
+    feature.cacheLineEfficiency = static_cast<double>(burstBytes) /
+                                  static_cast<double>(CeilAlignU64(burstBytes, problem.cacheLineSize));
+    feature.tailWaste = 1.0 - static_cast<double>(totalElems) / static_cast<double>(paddedElems);
+    return true;
+}
+
+/**
+ * 按shape分档的调优结果表
+ * 分档key由切分类型、dtype、核数、tile容量、A/R轴类型及每根轴的分档组成，查表结果在使用前需重新校验
+ * 查询在tiling热路径上，不加锁也不拼接key: 写入(离线调优及加载)时复制整表后发布新版本，
+ * 被替换的旧版本待没有查询在途时(各槽位计数均为0)于下次发布时释放，内存只保留当前表及尚在读取的旧表
+ */
+class TilingTuneTable {
+public:
+    struct Entry {
+        std::string key;
+        TilingCandidate candidate;
+        double cost = 0.0;
+    };
+    using EntryMap = std::unordered_map<uint64_t, Entry>;
+
+    static TilingTuneTable& Instance()
+    {
+        static TilingTuneTable table;
+        static std::once_flag loadFlag;
+        std::call_once(loadFlag, []() {
+            const char* path = std::getenv(TILING_TUNE_TABLE_ENV);
+            if (path != nullptr && path[0] != '\0') {
+                (void)table.Load(path);
+            }
+        });
+        return table;
+    }
+
+    static std::string MakeKey(const TilingTuneProblem& problem)
+    {
+        std::string key;
+        auto put = [&key](char c) { key.push_back(c); };
+        TilingTuneTmpl::PutTuneKey(problem, put);
+        return key;
+    }
+
+    // 等于HashKey(MakeKey(problem))
+    static uint64_t MakeKeyHash(const TilingTuneProblem& problem)
+    {
+        TilingTuneTmpl::TuneKeyHasher hasher;
+        TilingTuneTmpl::PutTuneKey(problem, hasher);
+        return hasher.Get();
+    }
+
+    static uint64_t HashKey(const std::string& key)
+    {
+        TilingTuneTmpl::TuneKeyHasher hasher;
+        for (char c : key) {
+            hasher(c);
+        }
+        return hasher.Get();
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    size_t Size() const
+    {
+        ReadGuard guard(*this);
+        return guard.entries == nullptr ? 0 : guard.entries->size();
+    }
+
+    // 命中的切分仍需调用方按当前shape校验，哈希冲突时同样被校验拦截
+    bool Find(const TilingTuneProblem& problem, TilingCandidate& candidate) const
+    {
+        ReadGuard guard(*this);
+        const EntryMap* entries = guard.entries;
+        if (entries == nullptr || entries->empty()) {
+            return false;
+        }
+        auto iter = entries->find(MakeKeyHash(problem));
+        if (iter == entries->end()) {
+            return false;
+        }
+        candidate = iter->second.candidate;
+        return true;
+    }
+
+    // 同一分档保留代价更小的结果
+    void Record(const TilingTuneProblem& problem, const TilingCandidate& candidate, double cost)
+    {
+        std::string key = MakeKey(problem);
+        uint64_t hash = HashKey(key);
+        std::lock_guard<std::mutex> lock(mutex_);
+        const EntryMap* current = entries_.load(std::memory_order_relaxed);
+        if (current != nullptr) {
+            auto iter = current->find(hash);
+            if (iter != current->end() && iter->second.cost <= cost) {
+                return;
+            }
+        }
+        auto next = current == nullptr ? std::make_unique<EntryMap>() : std::make_unique<EntryMap>(*current);
+        (*next)[hash] = Entry{std::move(key), candidate, cost};
+        Publish(std::move(next));
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Publish(std::make_unique<EntryMap>());
+    }
+
+    bool Save(const std::string& path) const
+    {
+        std::ofstream ofs(path, std::ios::out | std::ios::trunc);
+        if (!ofs.is_open()) {
+            return false;
+        }
+        ofs << TILING_TUNE_TABLE_HEADER << "\n";
+        std::lock_guard<std::mutex> lock(mutex_);
+        const EntryMap* entries = entries_.load(std::memory_order_relaxed);
+        if (entries != nullptr) {
+            for (const auto& item : *entries) {
+                const TilingCandidate& c = item.second.candidate;
+                ofs << item.second.key << " " << c.axisA << " " << c.factorA << " " << c.axisR << " " << c.factorR
+                    << " " << item.second.cost << "\n";
+            }
+        }
+        return ofs.good();
+    }
+
+    // 文件头不匹配时整体丢弃，单行格式错误时跳过该行
+    bool Load(const std::string& path)
+    {
+        std::ifstream ifs(path);
+        std::string line;
+        if (!ifs.is_open() || !std::getline(ifs, line) || line != TILING_TUNE_TABLE_HEADER) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        const EntryMap* current = entries_.load(std::memory_order_relaxed);
+        auto next = current == nullptr ? std::make_unique<EntryMap>() : std::make_unique<EntryMap>(*current);
+        while (std::getline(ifs, line)) {
+            std::istringstream iss(line);
+            Entry entry;
+            if (iss >> entry.key >> entry.candidate.axisA >> entry.candidate.factorA >> entry.candidate.axisR >>
+                entry.candidate.factorR >> entry.cost) {
+                uint64_t hash = HashKey(entry.key);
+                (*next)[hash] = std::move(entry);
+            }
+        }
+        Publish(std::move(next));
+        return true;
+    }
+
+private:
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> count{0};
+    };
+
+    // 先计数再取表: 发布方换表后看到全部槽位为0时，之后开始的查询只会取到新表
+    struct ReadGuard {
+        explicit ReadGuard(const TilingTuneTable& table) : slot(table.readers_[GetReaderSlot()])
+        {
+            slot.count.fetch_add(1, std::memory_order_seq_cst);
+            entries = table.entries_.load(std::memory_order_seq_cst);
+        }
+        ~ReadGuard()
+        {
+            slot.count.fetch_sub(1, std::memory_order_release);
+        }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ReaderSlot& slot;
+        const EntryMap* entries = nullptr;
+    };
+
+    static size_t GetReaderSlot()
+    {
+        thread_local const size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                                         TILING_TUNE_READER_SLOTS;
+        return slot;
+    }
+
+    // 调用方持有mutex_
+    void Publish(std::unique_ptr<EntryMap> next)
+    {
+        entries_.store(next.get(), std::memory_order_seq_cst);
+        if (current_ != nullptr) {
+            retired_.push_back(std::move(current_));
+        }
+        current_ = std::move(next);
+        for (const auto& reader : readers_) {
+            if (reader.count.load(std::memory_order_seq_cst) != 0) {
+                return;
+            }
+        }
+        retired_.clear();
+    }
+
+    mutable std::mutex mutex_;
+    std::atomic<const EntryMap*> entries_{nullptr};
+    mutable ReaderSlot readers_[TILING_TUNE_READER_SLOTS];
+    std::unique_ptr<const EntryMap> current_;
+    // 已被替换但可能仍有查询在读的旧表
+    std::vector<std::unique_ptr<const EntryMap>> retired_;
+};
+
+// 实测回调，返回候选切分的实际耗时(us)，小于0表示该候选无法运行
+using TilingMeasureFunc = std::function<double(const TilingTuneProblem&, const TilingCandidate&)>;
+
+struct TilingTuneResult {
+    bool found = false;
+    TilingCandidate candidate;
+    TilingTuneFeature feature;
+    double cost = 0.0;     // 代价模型结果
+    double measured = -1.0; // 实测耗时，未实测时为-1
+    size_t evaluated = 0;  // 合法候选个数
+};
+
+/**
+ * 离线调优: 枚举候选切分，用代价模型打分，设置实测回调时对模型排序靠前的候选实测后取最快的一个
+ */
+class TilingAutoTuner {
+public:
+    explicit TilingAutoTuner(std::shared_ptr<TilingCostModel> model = nullptr)
+        : model_(model != nullptr ? std::move(model) : std::make_shared<DefaultTilingCostModel>())
+    {}
+
+    void SetMeasureFunc(TilingMeasureFunc measure, size_t measureNum = TILING_TUNE_DEFAULT_MEASURE_NUM)
+    {
+        measure_ = std::move(measure);
+        measureNum_ = measureNum == 0 ? 1 : measureNum;
+    }
+
+    std::vector<TilingCandidate> Enumerate(const TilingTuneProblem& problem) const
+    {
+        std::vector<TilingCandidate> candidates;
+        TilingTuneFeature feature;
+        for (size_t axisA = 0; axisA < problem.dims.size(); axisA++) {
+            if (!problem.axisIsA[axisA]) {
+                continue;
+            }
+            uint64_t innerA = InnerFull(problem, axisA, true);
+            for (uint64_t factorA : GetFactors(problem, axisA, problem.tileCapacity / innerA)) {
+                TilingCandidate candidate;
+                candidate.axisA = static_cast<int32_t>(axisA);
+                candidate.factorA = factorA;
+                if (problem.kind == TilingTuneKind::BROADCAST) {
+                    candidates.push_back(candidate);
+                    continue;
+                }
+                // R轴全载
+                if (EvaluateTilingCandidate(problem, candidate, feature)) {
+                    candidates.push_back(candidate);
+                }
+                uint64_t tileA = innerA * TilingTuneTmpl::TileExtent(problem, axisA, factorA);
+                for (size_t axisR = 0; axisR < problem.dims.size(); axisR++) {
+                    if (problem.axisIsA[axisR]) {
+                        continue;
+                    }
+                    uint64_t innerR = InnerFull(problem, axisR, false);
+                    for (uint64_t factorR : GetFactors(problem, axisR, problem.tileCapacity / (tileA * innerR))) {
+                        candidate.axisR = static_cast<int32_t>(axisR);
+                        candidate.factorR = factorR;
+                        candidates.push_back(candidate);
+                    }
+                }
+            }
+        }
+        return candidates;
+    }
+
+    TilingTuneResult Tune(const TilingTuneProblem& problem) const
+    {
+        struct Scored {
+            TilingCandidate candidate;
+            TilingTuneFeature feature;
+            double cost;
+        };
+        std::vector<Scored> scored;
+        for (const auto& candidate : Enumerate(problem)) {
+            Scored item{candidate, TilingTuneFeature(), 0.0};
+            if (EvaluateTilingCandidate(problem, candidate, item.feature)) {
+                item.cost = model_->Evaluate(problem, item.feature);
+                scored.push_back(item);
+            }
+        }
+        TilingTuneResult result;
+        result.evaluated = scored.size();
+        if (scored.empty()) {
+            return result;
+        }
+        std::stable_sort(scored.begin(), scored.end(),
+                         [](const Scored& a, const Scored& b) { return a.cost < b.cost; });
+        size_t best = 0;
+        if (measure_) {
+            for (size_t i = 0; i < std::min(measureNum_, scored.size()); i++) {
+                double measured = measure_(problem, scored[i].candidate);
+                if (measured >= 0.0 && (result.measured < 0.0 || measured < result.measured)) {
+                    result.measured = measured;
+                    best = i;
+                }
+            }
+        }
+        result.found = true;
+        result.candidate = scored[best].candidate;
+        result.feature = scored[best].feature;
+        result.cost = scored[best].cost;
+        return result;
+    }
+
+    // 调优并写入结果表，有实测结果时以实测耗时作为表中的代价
+    TilingTuneResult TuneAndRecord(const TilingTuneProblem& problem, TilingTuneTable& table) const
+    {
+        TilingTuneResult result = Tune(problem);
+        if (result.found) {
+            table.Record(problem, result.candidate, result.measured >= 0.0 ? result.measured : result.cost);
+        }
+        return result;
+    }
+
+private:
+    // 切分轴之后同类型轴全载时的元素个数
+    static uint64_t InnerFull(const TilingTuneProblem& problem, size_t axis, bool isA)
+    {
+        uint64_t inner = 1;
+        for (size_t i = axis + 1; i < problem.dims.size(); i++) {
+            if (problem.axisIsA[i] == isA) {
+                inner *= TilingTuneTmpl::TileExtent(problem, i, problem.dims[i]);
+            }
+        }
+        return inner == 0 ? 1 : inner;
+    }
+
+    // 候选切分因子: 全载、UB可容纳的最大值及其均分值、2的幂次、按1~16均分，尾轴按alignElems对齐
+    static std::vector<uint64_t> GetFactors(const TilingTuneProblem& problem, size_t axis, uint64_t maxFactor)
+    {
+        std::vector<uint64_t> factors;
+        uint64_t len = problem.dims[axis];
+        maxFactor = std::min(maxFactor, len);
+        if (maxFactor == 0) {
+            return factors;
+        }
+        bool lastAxis = TilingTuneTmpl::IsLastAxis(problem, axis);
+        auto add = [&factors, len, maxFactor, lastAxis, &problem](uint64_t factor) {
+            if (lastAxis && factor < len) {
+                factor = factor / problem.alignElems * problem.alignElems;
+            }
+            if (factor > 0 && factor <= maxFactor) {
+                factors.push_back(factor);
+            }
+        };
+        add(maxFactor);
+        add(TilingTuneTmpl::CeilDivU64(len, TilingTuneTmpl::CeilDivU64(len, maxFactor)));
+        for (uint64_t factor = 1; factor <= maxFactor; factor <<= 1) {
+            add(factor);
+        }
+        for (uint64_t part = 1; part <= TILING_TUNE_EXACT_DIM; part++) {
+            add(TilingTuneTmpl::CeilDivU64(len, part));
+        }
+        std::sort(factors.begin(), factors.end());
+        factors.erase(std::unique(factors.begin(), factors.end()), factors.end());
+        if (factors.size() > TILING_TUNE_MAX_FACTOR_NUM) {
+            factors.erase(factors.begin(), factors.end() - TILING_TUNE_MAX_FACTOR_NUM);
+        }
+        return factors;
+    }
+
+    std::shared_ptr<TilingCostModel> model_;
+    TilingMeasureFunc measure_;
+    size_t measureNum_ = TILING_TUNE_DEFAULT_MEASURE_NUM;
+};
+
+} // namespace Base
+} // namespace Ops
+
+#endif // ATVOSS_TILING_TUNER_H_
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+# -----------------------------------------------------------------------------------------------------------
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""
+Generate the OPP directory manifest read through ACLNN_OPP_MANIFEST ahead of time, e.g. when building an image.
+
+usage: gen_opp_manifest.py $ASCEND_OPP_PATH [more directories] -o <manifest file> [--max-depth <depth>]
+
+Every directory under the given roots, symbolic links followed, is recorded with its mtime and its entries in
+readdir order, the file format is described in opp_manifest.h. A process started with ACLNN_OPP_MANIFEST set to a
+missing file writes a manifest of just the directories it lists, which is the smaller alternative.
+"""
+import argparse
+import os
+import sys
+
+HEADER = "aclnn_opp_manifest 1"
+NSEC_PER_SEC = 1000000000
+
+
+def entry_type(entry):
+    if entry.is_symlink():
+        return "l"
+    if entry.is_dir(follow_symlinks=False):
+        return "d"
+    if entry.is_file(follow_symlinks=False):
+        return "f"
+    return "l"
+
+
+def is_recordable(name):
+    # same names as OppManifest::ListDir records, the line based format can not hold the others
+    return "\n" not in name and not name[0].isspace()
+
+
+def list_dir(real_dir):
+    st = os.stat(real_dir)
+    entries = []
+    sub_dirs = []
+    with os.scandir(real_dir) as it:
+        for entry in it:
+            if not is_recordable(entry.name):
+                return None, sub_dirs
+            entry_st = entry.stat(follow_symlinks=False)
+            kind = entry_type(entry)
+            entries.append("%s %d %d %s" % (kind, entry_st.st_size, int(entry_st.st_mtime), entry.name))
+            if kind != "f" and entry.is_dir():
+                sub_dirs.append(entry.path)
+    mtime_sec, mtime_nsec = divmod(st.st_mtime_ns, NSEC_PER_SEC)
+    lines = ["D %d %d %d %s" % (mtime_sec, mtime_nsec, len(entries), real_dir)]
+    lines.extend(entries)
+    return lines, sub_dirs
+
+
+def generate(roots, max_depth):
+    lines = [HEADER]
+    visited = set()
+    pending = [(os.path.realpath(root), 0) for root in roots]
+    while pending:
+        real_dir, depth = pending.pop()
+        if real_dir in visited:
+            continue
+        visited.add(real_dir)
+        try:
+            dir_lines, sub_dirs = list_dir(real_dir)
+        except OSError as err:
+            print("skip %s: %s" % (real_dir, err), file=sys.stderr)
+            continue
+        if dir_lines is not None:
+            lines.extend(dir_lines)
+        if max_depth < 0 or depth < max_depth:
+            pending.extend((os.path.realpath(sub_dir), depth + 1) for sub_dir in sub_dirs)
+    return lines, len(visited)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the OPP directory manifest.")
+    parser.add_argument("roots", nargs="+", help="OPP directories, e.g. $ASCEND_OPP_PATH")
+    parser.add_argument("-o", "--output", required=True, help="manifest file, the value of ACLNN_OPP_MANIFEST")
+    parser.add_argument("--max-depth", type=int, default=-1, help="directory levels below the roots, -1 for all")
+    args = parser.parse_args()
+    lines, dir_num = generate(args.roots, args.max_depth)
+    tmp_path = "%s.tmp.%d" % (args.output, os.getpid())
+    with open(tmp_path, "w", encoding="utf-8") as manifest:
+        manifest.write("\n".join(lines) + "\n")
+    os.replace(tmp_path, args.output)
+    print("recorded %d directories to %s" % (dir_num, args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+# -----------------------------------------------------------------------------------------------------------
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""
+Convert the op info files recorded with ACLNN_OP_INFO_RECORD_FORMAT=bin to the json files of the default format.
+
+usage: op_info_bin_to_json.py <pid>_bin/op_info_0.bin [more .bin files] -o <output dir>
+
+The json files are written to <output dir>/<pid>/, <pid>_debug/ and <pid>_opcompile/ with the same names and
+contents as the ones dumped by OpInfoDump. The file layout is described in op_info_bin_record.h.
+"""
+import argparse
+import array
+import json
+import os
+import struct
+import sys
+
+MAGIC = 0x52494F41
+VERSION = 1
+FILE_HEADER = struct.Struct("<IIII")
+RECORD_HEADER = struct.Struct("<IIQQ")
+RECORD_TYPE_OP = 1
+RECORD_TYPE_BLOB = 2
+FLAG_OP_INFO = 1
+FLAG_OP_COMPILE = 1 << 1
+JSON_INDENT = 2
+
+# same data types as BIN_TO_JSON in bin_to_json.cpp
+DTYPE_TO_ARRAY_CODE = {
+    "DT_INT8": "b",
+    "DT_UINT8": "B",
+    "DT_INT16": "h",
+    "DT_UINT16": "H",
+    "DT_INT32": "i",
+    "DT_UINT32": "I",
+    "DT_INT64": "q",
+    "DT_UINT64": "Q",
+    "DT_FLOAT": "f",
+    "DT_DOUBLE": "d",
+}
+
+
+def read_records(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < FILE_HEADER.size:
+        raise ValueError("%s is too short to be an op info file" % path)
+    magic, version, pid, _ = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("%s is not an op info file of version %d" % (path, VERSION))
+    offset = FILE_HEADER.size
+    while offset + RECORD_HEADER.size <= len(data):
+        record_type, flags, hash_value, length = RECORD_HEADER.unpack_from(data, offset)
+        offset += RECORD_HEADER.size
+        if offset + length > len(data):
+            print("warning: %s is truncated, the last record is skipped" % path, file=sys.stderr)
+            break
+        yield pid, record_type, flags, hash_value, data[offset:offset + length]
+        offset += length
+
+
+def blob_to_list(dtype, blob):
+    code = DTYPE_TO_ARRAY_CODE.get(dtype)
+    if code is None:
+        raise ValueError("unsupported const data type %s" % dtype)
+    values = array.array(code)
+    item_num = len(blob) // values.itemsize
+    values.frombytes(blob[:item_num * values.itemsize])
+    if sys.byteorder != "little":
+        values.byteswap()
+    return values.tolist()
+
+
+def resolve_const_data(tensors, blobs):
+    if not isinstance(tensors, list):
+        return
+    for tensor in tensors:
+        if isinstance(tensor, list):
+            resolve_const_data(tensor, blobs)
+            continue
+        if not isinstance(tensor, dict) or not isinstance(tensor.get("const_data"), dict):
+            continue
+        ref = tensor["const_data"]
+        blob = blobs.get(int(ref["hash"], 16))
+        tensor["const_data"] = "NULL" if blob is None else blob_to_list(ref["dtype"], blob)
+
+
+def first_shape_str(inputs):
+    # same as GetFirstShapeStr in op_info_serialize.cpp
+    if not inputs:
+        return ""
+    tensor = inputs[0]
+    if isinstance(tensor, list):
+        if not tensor or tensor[0] is None:
+            return ""
+        tensor = tensor[0]
+    if tensor is None:
+        return ""
+    return tensor["dtype"] + "_" + tensor["format"] + "_" + "".join("%d_" % dim for dim in tensor["shape"])
+
+
+class JsonWriter:
+    def __init__(self, output_dir):
+        self.output_dir = output_dir
+        self.counts = {}
+        self.written = {}
+
+    def write(self, sub_dir, op_json):
+        if not isinstance(op_json.get("inputs"), list):
+            return
+        content = json.dumps(op_json, indent=JSON_INDENT, sort_keys=True, ensure_ascii=False)
+        # every directory holds distinct json as the sets of OpInfoSerialize do
+        written = self.written.setdefault(sub_dir, set())
+        if content in written:
+            return
+        written.add(content)
+        cnt = self.counts.get(sub_dir, 0)
+        self.counts[sub_dir] = cnt + 1
+        name = op_json["op_type"] + "_" + first_shape_str(op_json["inputs"]) + str(cnt) + ".json"
+        dir_path = os.path.join(self.output_dir, sub_dir)
+        os.makedirs(dir_path, exist_ok=True)
+        with open(os.path.join(dir_path, name), "w", encoding="utf-8") as f:
+            f.write(content)
+
+
+def convert(bin_files, output_dir):
+    # blobs of all files are read first, a record may refer to a blob written just before a flush
+    blobs = {}
+    ops = []
+    for path in bin_files:
+        for pid, record_type, flags, hash_value, payload in read_records(path):
+            if record_type == RECORD_TYPE_BLOB:
+                blobs[hash_value] = payload
+            elif record_type == RECORD_TYPE_OP:
+                ops.append((pid, flags, payload))
+
+    writer = JsonWriter(output_dir)
+    for pid, flags, payload in ops:
+        op_json = json.loads(payload.decode("utf-8"))
+        resolve_const_data(op_json.get("inputs"), blobs)
+        writer.write("%d_debug" % pid, op_json)
+        if flags & FLAG_OP_INFO:
+            writer.write("%d" % pid, op_json)
+        if flags & FLAG_OP_COMPILE:
+            op_json.pop("bin_type", None)
+            op_json.pop("bin_info", None)
+            writer.write("%d_opcompile" % pid, op_json)
+    return len(ops), len(blobs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert binary op info records to json files.")
+    parser.add_argument("bin_files", nargs="+", help="op_info_<n>.bin files recorded by one process")
+    parser.add_argument("-o", "--output", default=".", help="output directory")
+    args = parser.parse_args()
+    op_num, blob_num = convert(args.bin_files, args.output)
+    print("converted %d op records with %d const data blobs to %s" % (op_num, blob_num, args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -9,8 +9,10 @@
  */
 
 #include "opdev/aicpu/aicpu_ext_info_handle.h"
+#include <algorithm>
 #include <climits>
 #include <map>
+#include <mutex>
 #include "opdev/aicpu/aicpu_task.h"
 #include "opdev/common_types.h"
 #include "opdev/shape_utils.h"
@@ -18,6 +20,7 @@
 #include "proto/fwk_adapter.pb.h"
 #include "proto/node_def.pb.h"
 #include "acl/acl_rt.h"
+#include "shape_future.h"
 
 namespace op {
 namespace internal {
@@ -73,6 +76,9 @@ TFDataType ConvertGeDataType2TfDataType(const ge::DataType dataType, const bool
 constexpr int64_t kDimEndFlag = std::numeric_limits<int64_t>::min();
 // 为防止和路径3的kernel_id重复，此处的kernel_id从10000开始计数
 static std::atomic<std::uint64_t> gKernelId(10000U);
+
+std::mutex gExtInfoLayoutMutex;
+std::map<std::string, std::shared_ptr<const AicpuExtInfoLayout>> gExtInfoLayouts;
 } // namespace
 
 uint64_t AicpuExtInfoHandler::GenerateKernelId() { return gKernelId++; }
@@ -89,6 +95,15 @@ aclnnStatus AicpuExtInfoHandler::AppendExtInfoShape(const FVector<const aclTenso
     aicpuExtInfo->infoLen = sizeof(AicpuShapeAndType) * shapeNum;
 
     AicpuShapeAndType* inputs = reinterpret_cast<AicpuShapeAndType*>(aicpuExtInfo->infoMsg);
+    AICPU_ASSERT_OK_RETVAL(FillShapeAndType(tensors, type, inputs, isTf));
+    taskExtInfo.append(s);
+    return OK;
+}
+
+aclnnStatus AicpuExtInfoHandler::FillShapeAndType(const FVector<const aclTensor*>& tensors,
+                                                  const aicpu::FWKAdapter::FWKTaskExtInfoType type,
+                                                  AicpuShapeAndType* slots, bool isTf) const
+{
     for (size_t index = 0; index < tensors.size(); ++index) {
         if (tensors[index] == nullptr) {
             continue;
@@ -97,15 +112,14 @@ aclnnStatus AicpuExtInfoHandler::AppendExtInfoShape(const FVector<const aclTenso
             AICPU_ASSERT_NOTNULL_RETVAL(space_);
             auto space = (AicpuTaskSpace*)space_;
             const bool isRef = space->IsRef(index, type == aicpu::FWKAdapter::FWK_ADPT_EXT_INPUT_SHAPE);
-            inputs[index].type = ConvertGeDataType2TfDataType(tensors[index]->GetDataType(), isRef);
+            slots[index].type = ConvertGeDataType2TfDataType(tensors[index]->GetDataType(), isRef);
         } else {
-            inputs[index].type = tensors[index]->GetDataType();
+            slots[index].type = tensors[index]->GetDataType();
         }
-        OP_LOGD("inputs %zu type is %d\n", index, inputs[index].type);
+        OP_LOGD("inputs %zu type is %d\n", index, slots[index].type);
         auto& shape = tensors[index]->GetOriginalShape();
-        AICPU_ASSERT_OK_RETVAL(UpdateShape(shape, &inputs[index]));
+        AICPU_ASSERT_OK_RETVAL(UpdateShape(shape, &slots[index]));
     }
-    taskExtInfo.append(s);
     return OK;
 }
 
@@ -200,6 +214,91 @@ aclnnStatus AicpuExtInfoHandler::GenCCExtBuffer(const FVector<const aclTensor*>&
     return OK;
 }
 
+aclnnStatus AicpuExtInfoHandler::BuildExtInfoLayout(const bool isTf, AicpuExtInfoLayout& layout) const
+{
+    // Same sequence as GenTfExtBuffer/GenCCExtBuffer, with every tensor slot left unfilled.
+    const FVector<const aclTensor*> inputs(inputNum_, nullptr);
+    const FVector<const aclTensor*> outputs(outputNum_, nullptr);
+    std::string& image = layout.image;
+    // WARNING: OP NAME MUST BE THE FIRST EXTEND INFO FOR RUNTIME!!!
+    AICPU_ASSERT_OK_RETVAL(AppendExtOpName(image));
+    AICPU_ASSERT_OK_RETVAL(AppendExtShapeType(image));
+    AICPU_ASSERT_OK_RETVAL(AppendExtBitMap(image));
+    layout.inputShapeOffset = image.size() + sizeof(AicpuExtInfo);
+    AICPU_ASSERT_OK_RETVAL(AppendExtInfoShape(inputs, aicpu::FWKAdapter::FWK_ADPT_EXT_INPUT_SHAPE, image, isTf));
+    layout.outputShapeOffset = image.size() + sizeof(AicpuExtInfo);
+    AICPU_ASSERT_OK_RETVAL(AppendExtInfoShape(outputs, aicpu::FWKAdapter::FWK_ADPT_EXT_OUTPUT_SHAPE, image, isTf));
+    if (!isTf) {
+        layout.sessionInfoOffset = image.size() + sizeof(AicpuExtInfo);
+        AICPU_ASSERT_OK_RETVAL(AppendSessionInfo(image));
+    }
+    return OK;
+}
+
+aclnnStatus AicpuExtInfoHandler::GetExtInfoLayout(const bool isTf,
+                                                  std::shared_ptr<const AicpuExtInfoLayout>& layout) const
+{
+    const std::string key = nodeName_ + "_" + std::to_string(inputNum_) + "_" + std::to_string(outputNum_) + "_" +
+                            std::to_string(static_cast<int32_t>(unknownType_)) + (isTf ? "_tf" : "_cc");
+    std::lock_guard<std::mutex> lock(gExtInfoLayoutMutex);
+    const auto iter = gExtInfoLayouts.find(key);
+    if (iter != gExtInfoLayouts.end()) {
+        layout = iter->second;
+        return OK;
+    }
+    auto newLayout = std::make_shared<AicpuExtInfoLayout>();
+    AICPU_ASSERT_NOTNULL_RETVAL(newLayout);
+    AICPU_ASSERT_OK_RETVAL(BuildExtInfoLayout(isTf, *newLayout));
+    OP_LOGI("Node[%s] build ext info layout, key %s, len %zu.", nodeName_.c_str(), key.c_str(),
+            newLayout->image.size());
+    layout = newLayout;
+    gExtInfoLayouts.emplace(key, layout);
+    return OK;
+}
+
+aclnnStatus AicpuExtInfoHandler::ApplyExtInfoLayout(const AicpuExtInfoLayout& layout,
+                                                    const FVector<const aclTensor*>& inputs,
+                                                    const FVector<aclTensor*>& outputs, const bool isTf,
+                                                    uint8_t* hostAddr)
+{
+    AICPU_ASSERT_NOTNULL_RETVAL(hostAddr);
+    AICPU_ASSERT_TRUE_RETVAL(!layout.image.empty());
+    AICPU_ASSERT_TRUE_RETVAL((inputs.size() == inputNum_) && (outputs.size() == outputNum_));
+    extInfoLen_ = layout.image.size();
+    extInfo_ = hostAddr;
+    if (memcpy_s(extInfo_, extInfoLen_, layout.image.data(), extInfoLen_) != EOK) {
+        OP_LOGE(ACLNN_ERR_INNER, "[Update][extInfo_][%s] Failed to copy ext info layout", nodeName_.c_str());
+        return ACLNN_ERR_INNER;
+    }
+
+    auto inputSlots = PtrToPtr<uint8_t, AicpuShapeAndType>(extInfo_ + layout.inputShapeOffset);
+    auto outputSlots = PtrToPtr<uint8_t, AicpuShapeAndType>(extInfo_ + layout.outputShapeOffset);
+    inputShapeAndType_.clear();
+    outputShapeAndType_.clear();
+    for (uint32_t index = 0U; index < inputNum_; ++index) {
+        inputShapeAndType_.emplace_back(inputSlots + index);
+    }
+    for (uint32_t index = 0U; index < outputNum_; ++index) {
+        outputShapeAndType_.emplace_back(outputSlots + index);
+    }
+    outputShapeOffset_ = layout.outputShapeOffset;
+    outputShapeLen_ = outputNum_ * sizeof(AicpuShapeAndType);
+    outputShape_.resize(outputNum_);
+
+    AICPU_ASSERT_OK_RETVAL(FillShapeAndType(inputs, aicpu::FWKAdapter::FWK_ADPT_EXT_INPUT_SHAPE, inputSlots, isTf));
+    FVector<const aclTensor*> tmp_outputs;
+    tmp_outputs.insert(tmp_outputs.cend(), outputs.cbegin(), outputs.cend());
+    AICPU_ASSERT_OK_RETVAL(
+        FillShapeAndType(tmp_outputs, aicpu::FWKAdapter::FWK_ADPT_EXT_OUTPUT_SHAPE, outputSlots, isTf));
+
+    sessionInfoOffset_ = layout.sessionInfoOffset;
+    if (sessionInfoOffset_ != kInvalidExtInfoOffset) {
+        auto sessionInfo = PtrToPtr<uint8_t, AicpuSessionInfo>(extInfo_ + sessionInfoOffset_);
+        sessionInfo->kernelId = GenerateKernelId();
+    }
+    return OK;
+}
+
 aclnnStatus AicpuExtInfoHandler::Parse(const std::string& extInfo, uint8_t* hostAddr)
 {
     AICPU_ASSERT_TRUE_RETVAL(!extInfo.empty());
@@ -213,6 +312,7 @@ aclnnStatus AicpuExtInfoHandler::Parse(const std::string& extInfo, uint8_t* host
 
     inputShapeAndType_.clear();
     outputShapeAndType_.clear();
+    sessionInfoOffset_ = kInvalidExtInfoOffset;
 
     const auto extInfoData = extInfo_;
     size_t offset = 0UL;
@@ -231,6 +331,9 @@ aclnnStatus AicpuExtInfoHandler::Parse(const std::string& extInfo, uint8_t* host
                 outputShape_.resize(outputNum_);
                 AICPU_ASSERT_OK_RETVAL(ParseExtOutputShape(aicpuExtInfo));
                 break;
+            case aicpu::FWKAdapter::FWK_ADPT_EXT_SESSION_INFO:
+                sessionInfoOffset_ = offset + sizeof(AicpuExtInfo);
+                break;
             default:
                 OP_LOGD("Node[%s] ignore infoType=%d, infoLen=%u.", nodeName_.c_str(), aicpuExtInfo.infoType,
                         aicpuExtInfo.infoLen);
@@ -377,6 +480,7 @@ aclnnStatus AicpuExtInfoHandler::UpdateOutputShapeFromExtInfo(const FVector<aclT
         AICPU_ASSERT_OK_RETVAL(GetOutputShapeAndType(i, const_cast<gert::Shape&>(outputs[i]->GetStorageShape()), type));
         AICPU_ASSERT_OK_RETVAL(
             GetOutputShapeAndType(i, const_cast<gert::Shape&>(outputs[i]->GetOriginalShape()), type));
+        outputs[i]->InvalidateSignature();
         OP_LOGI("output[%zu], ViewShape is %s, StorageShape is %s, OriginalShape is %s.", i,
                 op::ToString(outputs[i]->GetViewShape()).GetString(),
                 op::ToString(outputs[i]->GetStorageShape()).GetString(),
@@ -385,6 +489,58 @@ aclnnStatus AicpuExtInfoHandler::UpdateOutputShapeFromExtInfo(const FVector<aclT
     return OK;
 }
 
+aclnnStatus AicpuExtInfoHandler::DeferOutputShapeFromExtInfo(const FVector<aclTensor*>& outputs, aclrtStream stream)
+{
+    if (outputShapeLen_ == 0U) {
+        return OK;
+    }
+    AICPU_ASSERT_NOTNULL_RETVAL(deviceExtInfo_);
+    // the staging buffer is reused by the next launch of this task, the previous shapes must be consumed first
+    if (pendingShape_ != nullptr && !pendingShape_->IsResolved()) {
+        AICPU_ASSERT_OK_RETVAL(pendingShape_->Wait());
+    }
+    pendingShape_ = nullptr;
+    if (hostOutputShape_ == nullptr) {
+        void* hostAddr = nullptr;
+        AICPU_ASSERT_RTOK_RETVAL(aclrtMallocHost(&hostAddr, outputShapeLen_));
+        hostOutputShape_ = std::shared_ptr<void>(hostAddr, [](void* addr) { (void)aclrtFreeHost(addr); });
+    }
+    auto outputShapeDeviceAddr = ValueToPtr(PtrToValue(deviceExtInfo_) + outputShapeOffset_);
+    AICPU_ASSERT_RTOK_RETVAL(aclrtMemcpyAsync(hostOutputShape_.get(), outputShapeLen_, outputShapeDeviceAddr,
+                                              outputShapeLen_, ACL_MEMCPY_DEVICE_TO_HOST, stream));
+    aclrtEvent event = nullptr;
+    AICPU_ASSERT_RTOK_RETVAL(aclrtCreateEventExWithFlag(&event, ACL_EVENT_SYNC));
+    const aclError ret = aclrtRecordEvent(event, stream);
+    if (ret != ACL_SUCCESS) {
+        (void)aclrtDestroyEvent(event);
+        AICPU_ASSERT_RTOK_RETVAL(ret);
+    }
+    RecordAicpuTime(kShapeD2hCopyEnd);
+
+    std::vector<aclTensor*> tensors(outputs.begin(), outputs.end());
+    const size_t shapeNum = std::min(static_cast<size_t>(outputNum_), outputShapeLen_ / sizeof(AicpuShapeAndType));
+    auto staging = hostOutputShape_;
+    auto resolveFunc = [staging, shapeNum](const std::vector<aclTensor*>& targets) -> aclnnStatus {
+        const auto shapes = static_cast<const AicpuShapeAndType*>(staging.get());
+        for (size_t i = 0U; i < targets.size(); i++) {
+            if (targets[i] == nullptr) {
+                continue;
+            }
+            AICPU_ASSERT_TRUE_RETVAL(i < shapeNum);
+            ge::DataType type;
+            GetShapeAndType(shapes[i], const_cast<gert::Shape&>(targets[i]->GetViewShape()), type);
+            GetShapeAndType(shapes[i], const_cast<gert::Shape&>(targets[i]->GetStorageShape()), type);
+            GetShapeAndType(shapes[i], const_cast<gert::Shape&>(targets[i]->GetOriginalShape()), type);
+            targets[i]->InvalidateSignature();
+            OP_LOGI("deferred output[%zu], ViewShape is %s.", i, op::ToString(targets[i]->GetViewShape()).GetString());
+        }
+        return OK;
+    };
+    pendingShape_ = std::make_shared<ShapeFuture>(event, tensors, resolveFunc);
+    AICPU_ASSERT_OK_RETVAL(ShapeFutureRegistry::Instance().Attach(pendingShape_));
+    return OK;
+}
+
 aclnnStatus AicpuExtInfoHandler::UpdateInputAndOutputShape(const FVector<const aclTensor*>& inputs,
                                                            const FVector<aclTensor*>& outputs, aclrtStream stream,
                                                            const aclOpExecutor* executor,
@@ -408,6 +564,13 @@ aclnnStatus AicpuExtInfoHandler::UpdateInputAndOutputShape(const FVector<const a
 
 aclnnStatus AicpuExtInfoHandler::UpdateKernelId()
 {
+    if ((sessionInfoOffset_ != kInvalidExtInfoOffset) &&
+        ((sessionInfoOffset_ + sizeof(AicpuSessionInfo)) <= extInfoLen_)) {
+        AicpuSessionInfo* sessionInfo = PtrToPtr<uint8_t, AicpuSessionInfo>(extInfo_ + sessionInfoOffset_);
+        sessionInfo->kernelId = GenerateKernelId();
+        OP_LOGI("Node[%s] update kernelid=%lu.", nodeName_.c_str(), sessionInfo->kernelId);
+        return OK;
+    }
     const auto extInfoData = extInfo_;
     size_t offset = 0UL;
     while ((offset + sizeof(AicpuExtInfo)) <= extInfoLen_) {
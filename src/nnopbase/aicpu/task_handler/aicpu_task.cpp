@@ -17,6 +17,7 @@
 #include "opdev/fast_vector.h"
 #include "mmpa/mmpa_api.h"
 #include "op_dfx_internal.h"
+#include "shape_future.h"
 #include "opdev/op_dfx.h"
 #include "aicpu_json_load_manager.h"
 #include "runtime/rt_external.h"
@@ -116,12 +117,13 @@ aclnnStatus AicpuTfTask::Init(const FVector<const aclTensor*>& inputs, const FVe
     extInfoHandle_ = std::make_unique<AicpuExtInfoHandler>(opType_, inputs.size(), outputs.size(), unknownType_);
     AICPU_ASSERT_NOTNULL_RETVAL(extInfoHandle_);
     extInfoHandle_->SetSpace(space_);
-    std::string extInfo;
-    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->GenTfExtBuffer(inputs, outputs, extInfo));
+    std::shared_ptr<const AicpuExtInfoLayout> extInfoLayout;
+    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->GetExtInfoLayout(true, extInfoLayout));
+    const size_t extInfoLen = extInfoLayout->image.size();
 
     const bool needDeviceExt = (unknownType_ == ge::DEPEND_SHAPE_RANGE) ? true : false;
     if (needDeviceExt) {
-        deviceExtMemSize_ = static_cast<uint64_t>(extInfo.size());
+        deviceExtMemSize_ = static_cast<uint64_t>(extInfoLen);
     }
     uint32_t ioNum = inputs.size() + outputs.size();
     // ge::MakeUnique
@@ -133,11 +135,11 @@ aclnnStatus AicpuTfTask::Init(const FVector<const aclTensor*>& inputs, const FVe
     STR_FWK_OP_KERNEL fwkOpKernel;
     std::string taskInfo;
     AICPU_ASSERT_OK_RETVAL(tf_argsHandle->GenTfArgs(inputs, outputs, attrs, fwkOpKernel, taskInfo));
-    AICPU_ASSERT_OK_RETVAL(tf_argsHandle->BuildTfArgs(fwkOpKernel, taskInfo, extInfo.size()));
+    AICPU_ASSERT_OK_RETVAL(tf_argsHandle->BuildTfArgs(fwkOpKernel, taskInfo, extInfoLen));
 
     // build ext info handle
     uint8_t* hostExtAddr = tf_argsHandle->GetExtInfoAddr();
-    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->Parse(extInfo, hostExtAddr));
+    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->ApplyExtInfoLayout(*extInfoLayout, inputs, outputs, true, hostExtAddr));
     argsHandle_ = std::move(tf_argsHandle);
 
     // load bin from json
@@ -207,7 +209,11 @@ aclnnStatus AicpuTfTask::Run(aclOpExecutor* executor, aclrtStream stream)
 
     RecordAicpuTime(kShapeD2hCopyEnd);
     if (unknownType_ == ge::DEPEND_SHAPE_RANGE) {
-        AICPU_ASSERT_OK_RETVAL(extInfoHandle_->UpdateOutputShapeFromExtInfo(outputs_, stream));
+        if (IsDeferredShapeEnable()) {
+            AICPU_ASSERT_OK_RETVAL(extInfoHandle_->DeferOutputShapeFromExtInfo(outputs_, stream));
+        } else {
+            AICPU_ASSERT_OK_RETVAL(extInfoHandle_->UpdateOutputShapeFromExtInfo(outputs_, stream));
+        }
     }
     RecordAicpuTime(kUpdateOutputShapeEnd);
 
@@ -272,12 +278,13 @@ aclnnStatus AicpuCCTask::Init(const FVector<const aclTensor*>& inputs, const FVe
 
     extInfoHandle_ = std::make_unique<AicpuExtInfoHandler>(opType_, inputs.size(), outputs.size(), unknownType_);
     AICPU_ASSERT_NOTNULL_RETVAL(extInfoHandle_);
-    std::string extInfo;
-    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->GenCCExtBuffer(inputs, outputs, extInfo));
+    std::shared_ptr<const AicpuExtInfoLayout> extInfoLayout;
+    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->GetExtInfoLayout(false, extInfoLayout));
+    const size_t extInfoLen = extInfoLayout->image.size();
 
     const bool needDeviceExt = (unknownType_ == ge::DEPEND_SHAPE_RANGE) ? true : false;
     if (needDeviceExt) {
-        deviceExtMemSize_ = static_cast<uint64_t>(extInfo.size());
+        deviceExtMemSize_ = static_cast<uint64_t>(extInfoLen);
     }
     const uint32_t ioNum = inputs.size() + outputs.size();
     auto cc_argsHandle = std::make_unique<AicpuCCArgsHandler>(opType_, opType_, ioNum, needDeviceExt);
@@ -290,10 +297,10 @@ aclnnStatus AicpuCCTask::Init(const FVector<const aclTensor*>& inputs, const FVe
     // 这个需要传递进来
     std::string kernelSoName = kDefaultKernelSo;
     AICPU_ASSERT_OK_RETVAL(GetKernelNameAndSoName(kernelSoName));
-    AICPU_ASSERT_OK_RETVAL(cc_argsHandle->BuildCCArgs(taskInfo, functionName_, kernelSoName, extInfo.size()));
+    AICPU_ASSERT_OK_RETVAL(cc_argsHandle->BuildCCArgs(taskInfo, functionName_, kernelSoName, extInfoLen));
     uint8_t* hostExtAddr = cc_argsHandle->GetExtInfoAddr();
-    // 解析extend info 并且填充AicpuExtInfoHandler的结构体应该没啥必要, 应该只需要input/output shape
-    extInfoHandle_->Parse(extInfo, hostExtAddr);
+    // 直接把预生成的 ext info 拷入 args, 只填写 shape/type 和 kernel id, 无需再解析
+    AICPU_ASSERT_OK_RETVAL(extInfoHandle_->ApplyExtInfoLayout(*extInfoLayout, inputs, outputs, false, hostExtAddr));
     argsHandle_ = std::move(cc_argsHandle);
     OP_LOGI("Finish AicpuCCTask::Init, opType[%s]", opType_.c_str());
     return OK;
@@ -363,7 +370,11 @@ aclnnStatus AicpuCCTask::Run(aclOpExecutor* executor, aclrtStream stream)
     RecordAicpuTime(kShapeD2hCopyEnd);
     if (unknownType_ == ge::DEPEND_SHAPE_RANGE) {
         OP_LOGI("op [%s] is 3th op\n", opType_.c_str());
-        AICPU_ASSERT_OK_RETVAL(extInfoHandle_->UpdateOutputShapeFromExtInfo(outputs_, stream));
+        if (IsDeferredShapeEnable()) {
+            AICPU_ASSERT_OK_RETVAL(extInfoHandle_->DeferOutputShapeFromExtInfo(outputs_, stream));
+        } else {
+            AICPU_ASSERT_OK_RETVAL(extInfoHandle_->UpdateOutputShapeFromExtInfo(outputs_, stream));
+        }
     }
     OP_LOGI("Finish AicpuCCTask::Run, opType[%s]", opType_.c_str());
     RecordAicpuTime(kUpdateOutputShapeEnd);
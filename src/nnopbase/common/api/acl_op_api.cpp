@@ -22,6 +22,7 @@
 #include "kernel_utils.h"
 #include "op_cache_internal.h"
 #include "kernel_mgr.h"
+#include "kernel_prewarm.h"
 #include "dlopen_api.h"
 #include "op_dfx_internal.h"
 #include "file_utils.h"
@@ -550,6 +551,39 @@ aclnnStatus aclnnReselectStaticKernelWithPath(const char* staticKernelPath)
     return OK;
 }
 
+aclnnStatus aclnnPrewarmKernels(const char* prewarmListPath)
+{
+    if (prewarmListPath == nullptr) {
+        OP_LOGE(ACLNN_ERR_PARAM_NULLPTR, "Input prewarmListPath is nullptr.");
+        return ACLNN_ERR_PARAM_NULLPTR;
+    }
+    std::string realPath = op::RealPath(prewarmListPath);
+    if (realPath.empty()) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "Invalid prewarm list path: %s.", prewarmListPath);
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    OP_LOGI("Start prewarm kernels of %s.", realPath.c_str());
+    return op::internal::KernelPrewarmer::Instance().SubmitFile(realPath);
+}
+
+aclnnStatus aclnnGetPrewarmProgress(uint64_t* totalNum, uint64_t* doneNum, uint64_t* failedNum)
+{
+    NNOPBASE_ASSERT_NULLPTR_WITH_RETURN(totalNum, ACLNN_ERR_PARAM_NULLPTR);
+    NNOPBASE_ASSERT_NULLPTR_WITH_RETURN(doneNum, ACLNN_ERR_PARAM_NULLPTR);
+    NNOPBASE_ASSERT_NULLPTR_WITH_RETURN(failedNum, ACLNN_ERR_PARAM_NULLPTR);
+    const op::internal::PrewarmProgress progress = op::internal::KernelPrewarmer::Instance().GetProgress();
+    *totalNum = progress.submitted;
+    *doneNum = progress.done;
+    *failedNum = progress.failed;
+    return OK;
+}
+
+aclnnStatus aclnnWaitPrewarm()
+{
+    op::internal::KernelPrewarmer::Instance().Wait();
+    return OK;
+}
+
 aclnnStatus aclDumpOpTensors(const char* opType, const char* opName, aclTensor** tensors, size_t inputTensorNum,
                              size_t outputTensorNum, aclrtStream stream)
 {
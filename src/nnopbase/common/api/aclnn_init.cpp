@@ -16,6 +16,8 @@
 #include "opdev/op_log.h"
 #include "opp_resource_loader.h"
 #include "op_dfx_internal.h"
+#include "async_dump.h"
+#include "prof_report_cache.h"
 #include "kernel_mgr.h"
 #include "opdev/aicpu/aicpu_task.h"
 #include "file_utils.h"
@@ -85,6 +87,8 @@ aclnnStatus aclnnInit([[maybe_unused]] const char* configPath)
 
 aclnnStatus aclnnFinalize()
 {
+    op::internal::AsyncDumper::Instance().Flush();
+    op::internal::FlushAllProfReport();
     op::internal::aclnnAicpuFinalize();
     op::internal::gKernelMgr.ReleaseTilingParse();
     return ACLNN_SUCCESS;
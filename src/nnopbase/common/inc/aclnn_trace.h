@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_ACLNN_TRACE_H_
+#define OP_API_OP_API_COMMON_INC_ACLNN_TRACE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "acl/acl_rt.h"
+#include "opdev/common_types.h"
+#include "opdev/op_dfx.h"
+
+namespace op {
+namespace internal {
+
+/**
+ * Trace of the aclnn calls of a process, for replaying them offline against the stub runtime.
+ * ACLNN_TRACE_FILE=<path> enables it, a "%p" in the path is replaced by the pid.
+ *
+ * The file is a 16 byte header, "ACLNNTRC" followed by the u32 version and a reserved u32, and then records in host
+ * byte order:
+ *   u32 length of the rest of the record | u8 event | u8 reserved | u16 name length | name |
+ *   u64 begin ns (steady clock) | u64 duration ns | i32 stream id, -1 for none | u32 thread index | i32 result |
+ *   u16 arg num | args
+ * An arg is u8 kind | u8 is output | payload:
+ *   TENSOR:      i32 dtype | i32 format | i64 view offset | u8 dim num | i64 view dims | i64 strides |
+ *                u8 storage dim num | i64 storage dims
+ *   TENSOR_LIST: u32 num | num times (u8 present | TENSOR payload if present)
+ *   INT, BOOL:   i64               FLOAT: f64               SCALAR: i32 dtype | f64
+ *   STRING, BYTES: u32 len | bytes
+ *   INT_LIST: u32 num | i64s       FLOAT_LIST: u32 num | f64s  BOOL_LIST: u32 num | u8s
+ *   NULL_ARG, UNKNOWN: nothing
+ * Records are buffered per thread and written in blocks, those of a thread are in call order.
+ */
+enum class TraceEvent : uint8_t {
+    L2_GET_WORKSPACE = 1, // composite GetWorkspaceSize, result 1 on an executor cache hit
+    L2_RUN = 2,           // composite Run
+    INDV_MATCH_ARGS = 3,  // individual op from NnopbaseGetExecutor to NnopbaseMatchArgs, result 1 on a hit
+    INDV_LAUNCH = 4,      // individual op NnopbaseRunWithWorkspace
+};
+
+enum class TraceArgKind : uint8_t {
+    NULL_ARG = 0,
+    TENSOR,
+    TENSOR_LIST,
+    INT,
+    FLOAT,
+    BOOL,
+    STRING,
+    INT_LIST,
+    FLOAT_LIST,
+    BOOL_LIST,
+    SCALAR,
+    BYTES,
+    UNKNOWN,
+};
+
+constexpr uint32_t kTraceVersion = 1U;
+
+struct TraceTensorDesc {
+    int32_t dtype{0};
+    int32_t format{0};
+    int64_t offset{0};
+    std::vector<int64_t> viewShape;
+    std::vector<int64_t> strides;
+    std::vector<int64_t> storageShape;
+};
+
+struct TraceArg {
+    TraceArgKind kind{TraceArgKind::UNKNOWN};
+    bool isOutput{false};
+    std::vector<TraceTensorDesc> tensors; // one for TENSOR, a null TENSOR_LIST element is absent from present
+    std::vector<bool> present;            // TENSOR_LIST only
+    std::vector<int64_t> ints;            // INT, BOOL, INT_LIST, BOOL_LIST, the dtype of SCALAR
+    std::vector<double> floats;           // FLOAT, FLOAT_LIST, the value of SCALAR
+    std::string bytes;                    // STRING, BYTES
+};
+
+struct TraceRecord {
+    TraceEvent event{TraceEvent::L2_GET_WORKSPACE};
+    std::string name;
+    uint64_t beginNs{0};
+    uint64_t durationNs{0};
+    int32_t streamId{-1};
+    uint32_t threadIndex{0};
+    int32_t result{0};
+    std::vector<TraceArg> args;
+};
+
+// Record being built and the finished records of one thread.
+struct ThreadTraceBuffer {
+    ThreadTraceBuffer();
+    ~ThreadTraceBuffer();
+
+    std::string pending;
+    const void* owner{nullptr};
+    bool active{false};
+    uint16_t argNum{0};
+    uint64_t beginNs{0};
+    uint32_t threadIndex{0};
+
+    std::mutex mutex; // guards data, which the exit flush drains from another thread
+    std::string data;
+};
+
+class TraceRecorder {
+public:
+    static TraceRecorder& Instance();
+
+    static bool IsEnabled() { return opTraceSwitch.recordFlag; }
+
+    // A record is begun by its owner, receives the args of the call and is finished by the same owner. Begin drops an
+    // unfinished record of another owner, except for an L2 GetWorkspaceSize which keeps its nested calls out.
+    static void Begin(TraceEvent event, const char* name, const void* owner, aclrtStream stream = nullptr);
+    static void End(const void* owner);
+    static void SetResult(int32_t result);
+
+    static void AddNull(bool isOutput);
+    static void AddUnknown(bool isOutput);
+    static void AddTensor(const aclTensor* tensor, bool isOutput);
+    static void AddTensorList(const aclTensor* const* tensors, uint64_t size, bool isOutput);
+    static void AddInt(int64_t value, bool isOutput);
+    static void AddFloat(double value, bool isOutput);
+    static void AddBool(bool value, bool isOutput);
+    static void AddString(const char* value, bool isOutput);
+    static void AddBytes(const void* data, size_t len, bool isOutput);
+    static void AddIntList(const int64_t* values, uint64_t size, bool isOutput);
+    static void AddFloatList(const float* values, uint64_t size, bool isOutput);
+    static void AddBoolList(const bool* values, uint64_t size, bool isOutput);
+    static void AddScalar(const aclScalar* scalar, bool isOutput);
+
+    // Write the finished records of every thread.
+    void Flush();
+
+    void Register(ThreadTraceBuffer* buffer);
+    void Unregister(ThreadTraceBuffer* buffer);
+    void Write(std::string& data);
+
+    // Reset the output path and start a new file, for tests.
+    void Reset(const std::string& path);
+
+private:
+    TraceRecorder();
+    ~TraceRecorder() = default;
+
+    void OpenLocked();
+
+    std::mutex fileMutex_;
+    std::string path_;
+    FILE* file_{nullptr};
+    bool opened_{false};
+
+    std::mutex bufferMutex_;
+    std::vector<ThreadTraceBuffer*> buffers_;
+};
+
+// Traces the call of its scope.
+class TraceScope {
+public:
+    TraceScope(TraceEvent event, const char* name, aclrtStream stream)
+    {
+        if (TraceRecorder::IsEnabled()) {
+            TraceRecorder::Begin(event, name, this, stream);
+        }
+    }
+    ~TraceScope()
+    {
+        if (TraceRecorder::IsEnabled()) {
+            TraceRecorder::End(this);
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+aclnnStatus ReadTraceFile(const std::string& path, std::vector<TraceRecord>& records);
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_ACLNN_TRACE_H_
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_ALLOC_STATS_H_
+#define OP_API_OP_API_COMMON_INC_ALLOC_STATS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace op {
+namespace internal {
+
+// ACLNN_ALLOC_STATS=<seconds> turns the BlockPool/BlockCache statistics on and dumps them to the event log
+// every <seconds>. SetAllocStatsEnable() turns them on without the periodic dump.
+constexpr size_t kAllocStatsMaxClass = 64U;
+
+// request size histogram: 64B steps up to 256B, then 4 buckets per power of two up to 1MB, and one over 1MB
+constexpr size_t kAllocSizeBucketBase = 64U;
+constexpr size_t kAllocSizeBucketPerPower = 4U;
+constexpr size_t kAllocSizeBucketNum = 53U;
+
+inline size_t GetAllocSizeBucket(size_t size)
+{
+    if (size <= kAllocSizeBucketBase * kAllocSizeBucketPerPower) {
+        return size == 0U ? 0U : (size - 1U) / kAllocSizeBucketBase;
+    }
+    const size_t value = size - 1U;
+    const size_t power = 63U - static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(value)));
+    const size_t bucket = kAllocSizeBucketPerPower + (power - 8U) * kAllocSizeBucketPerPower +
+                          ((value >> (power - 2U)) & (kAllocSizeBucketPerPower - 1U));
+    return std::min(bucket, kAllocSizeBucketNum - 1U);
+}
+
+// largest size of a bucket, 0 for the bucket over 1MB
+inline size_t GetAllocSizeBucketLimit(size_t bucket)
+{
+    if (bucket < kAllocSizeBucketPerPower) {
+        return (bucket + 1U) * kAllocSizeBucketBase;
+    }
+    if (bucket >= kAllocSizeBucketNum - 1U) {
+        return 0U;
+    }
+    const size_t power = 8U + (bucket - kAllocSizeBucketPerPower) / kAllocSizeBucketPerPower;
+    const size_t step = kAllocSizeBucketPerPower + (bucket - kAllocSizeBucketPerPower) % kAllocSizeBucketPerPower;
+    return (step + 1U) << (power - 2U);
+}
+
+enum class AllocStatsItem : uint32_t {
+    ALLOC = 0,          // blocks handed out by BlockPool::Malloc or BlockCache::CacheAlloc
+    FREE,               // blocks given back by BlockPool::Free or BlockCache::CacheFree
+    POOL_ALLOC,         // blocks taken from a BlockStore
+    POOL_FREE,          // blocks given back to a BlockStore
+    MALLOC,             // SYS_TAG blocks from std::malloc because the store was empty or the size has no class
+    MALLOC_BYTES,
+    CACHE_HIT,          // allocations served by the thread cache list
+    CACHE_REFILL,       // batches the thread cache allocated on a miss
+    CACHE_REFILL_BLOCK, // blocks of those batches
+    CACHE_FLUSH,        // frees passed to the BlockPool because the thread cache was full
+    ITEM_NUM
+};
+
+struct AllocClassStats {
+    size_t blockSize{0}; // 0 for the class of the sizes over the largest block
+    uint64_t items[static_cast<size_t>(AllocStatsItem::ITEM_NUM)]{};
+
+    uint64_t Get(AllocStatsItem item) const { return items[static_cast<size_t>(item)]; }
+};
+
+struct AllocThreadStats {
+    uint64_t tid{0};
+    // bytes the thread allocated minus the bytes it freed, blocks freed by another thread move it below zero
+    int64_t liveBytes{0};
+    uint64_t allocNum{0};
+    uint64_t freeNum{0};
+};
+
+struct AllocStatsSnapshot {
+    bool enabled{false};
+    std::vector<AllocClassStats> classes;
+    // running threads, the exited ones are summed up in exitedThreads
+    std::vector<AllocThreadStats> threads;
+    AllocThreadStats exitedThreads;
+    uint64_t lockContendedNum{0};
+    uint64_t lockWaitNs{0};
+    // requests of BlockPool::Malloc and BlockCache::CacheAlloc per size bucket
+    uint64_t sizes[kAllocSizeBucketNum]{};
+};
+
+class AllocStats {
+public:
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    static void SetEnable(bool enable);
+
+    // cls is the size class of the block, classNum (see SetClassSizes) for sizes over the largest class
+    static void Add(AllocStatsItem item, size_t cls, uint64_t value = 1U);
+
+    static void AddLiveBytes(int64_t bytes);
+
+    static void AddRequestSize(size_t size);
+
+    static void AddLockWait(uint64_t ns);
+
+    // block size of each class, called by the BlockPool when its classes are set up
+    static void SetClassSizes(const std::vector<size_t>& sizes);
+
+    // read ACLNN_ALLOC_STATS, the dump thread starts with the first thread recording statistics
+    static void InitFromEnv();
+
+    static void GetSnapshot(AllocStatsSnapshot& snapshot);
+
+    static void Reset();
+
+    static void DumpToLog();
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+void SetAllocStatsEnable(bool enable);
+
+void GetAllocStats(AllocStatsSnapshot& snapshot);
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_ALLOC_STATS_H_
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_ASYNC_DUMP_H_
+#define OP_API_OP_API_COMMON_INC_ASYNC_DUMP_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "acl/acl_rt.h"
+#include "dump/adump_pub.h"
+
+namespace op {
+namespace internal {
+
+// ACLNN_ASYNC_DUMP=1 moves L0/L2 tensor dumps off the launch path,
+// ACLNN_ASYNC_DUMP_BUDGET_MB sizes the snapshot arena of each context (default 1024)
+constexpr size_t kAsyncDumpDefaultBudgetMb = 1024U;
+constexpr size_t kAsyncDumpMaxQueueDepth = 1024U;
+constexpr size_t kAsyncDumpMaxBatchSize = 32U;
+constexpr size_t kAsyncDumpEventPoolSize = 64U;
+
+struct AsyncDumpStats {
+    uint64_t submitted{0};    // requests queued
+    uint64_t dumped{0};       // requests handed to adump
+    uint64_t failed{0};       // requests that failed in the dump thread
+    uint64_t dropped{0};      // requests dropped because of the memory budget or queue depth
+    uint64_t droppedBytes{0}; // tensor bytes of the dropped requests
+    uint64_t batches{0};      // batches processed by the dump thread
+    size_t pendingNum{0};     // requests queued or in the dump thread
+    size_t pendingBytes{0};   // device memory held by the pending requests
+    size_t peakPendingBytes{0};
+};
+
+/**
+ * Asynchronous dump pipeline. On the launch path Submit() only snapshots the tensors with device-to-device copies
+ * enqueued behind the kernel on the same stream, records an event and queues the metadata. A dump thread waits for
+ * the events and calls adump on its own stream for a batch of requests, then synchronizes that stream once per batch
+ * and releases the snapshots. The launch stream is never synchronized by the dump.
+ *
+ * Snapshots and events come from an arena and an event pool per context, allocated by the first request of the
+ * context, so the launch path neither mallocs device memory nor creates events.
+ */
+class AsyncDumper {
+public:
+    static AsyncDumper& Instance();
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void SetEnable(bool enable);
+
+    void SetMemoryBudget(size_t bytes) { budget_.store(bytes, std::memory_order_relaxed); }
+
+    size_t GetMemoryBudget() const { return budget_.load(std::memory_order_relaxed); }
+
+    /**
+     * Returns false if the request was not taken over and the caller should dump synchronously: the pipeline is
+     * disabled, the stream is being captured or a tensor is not on device. Requests over the memory budget or the
+     * queue depth are dropped, counted and still return true.
+     */
+    bool Submit(const std::string& opType, const std::string& opName, const std::vector<Adx::TensorInfoV2>& tensors,
+                aclrtStream stream);
+
+    // Block until every request submitted before the call has been dumped.
+    void Flush();
+
+    // Dump everything pending, stop the dump thread and release its streams. Later dumps are synchronous.
+    void Shutdown();
+
+    AsyncDumpStats GetStats() const;
+
+    void ResetStats();
+
+private:
+    struct DumpRequest {
+        std::string opType;
+        std::string opName;
+        std::vector<Adx::TensorInfoV2> tensors;
+        aclrtContext context{nullptr};
+        aclrtEvent event{nullptr};
+        void* snapshot{nullptr};
+        size_t bytes{0U};
+        uint64_t seq{0U};
+    };
+
+    AsyncDumper();
+    ~AsyncDumper() = default;
+
+    bool Snapshot(DumpRequest& request, aclrtStream stream);
+    enum class SlotResult { OK, FULL, ERROR };
+
+    // A ring over one device allocation, blocks are allocated in request order and may be released in any order.
+    struct SnapshotArena {
+        struct Block {
+            size_t offset{0U};
+            size_t size{0U};
+            bool released{false};
+        };
+        void* base{nullptr};
+        size_t size{0U};
+        size_t head{0U};
+        std::deque<Block> blocks;
+        std::vector<aclrtEvent> freeEvents;
+        std::vector<aclrtEvent> events;
+    };
+
+    // the functions below require mutex_
+    SlotResult AcquireSlot(DumpRequest& request);
+    void ReleaseSlot(DumpRequest& request);
+    bool ResetArena(SnapshotArena& arena, size_t size);
+    void DestroyArenas();
+    bool GetDumpStream(aclrtContext context, aclrtStream& stream);
+    void ProcessBatch(std::vector<DumpRequest>& batch);
+    void StartWorker();
+    void StopWorker();
+    void WorkerLoop();
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<bool> shutdown_{false};
+    std::atomic<size_t> budget_{kAsyncDumpDefaultBudgetMb << 20U};
+
+    mutable std::mutex mutex_; // protects the queue, the counters below and the worker state
+    std::condition_variable queueCv_;
+    std::condition_variable doneCv_;
+    std::deque<DumpRequest> queue_;
+    std::thread worker_;
+    bool stop_{false};
+    uint64_t nextSeq_{0U};
+    uint64_t doneSeq_{0U};
+    AsyncDumpStats stats_;
+    std::unordered_map<aclrtContext, SnapshotArena> arenas_;
+
+    // only touched by the dump thread, or after it has been joined
+    std::unordered_map<aclrtContext, aclrtStream> dumpStreams_;
+};
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_ASYNC_DUMP_H_
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_ASYNC_LOG_H_
+#define OP_API_OP_API_COMMON_INC_ASYNC_LOG_H_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace op {
+namespace internal {
+
+// ACLNN_ASYNC_LOG=0: synchronous (default), 1: async and drop on overflow, 2: async and block on overflow
+enum class AsyncLogMode : int32_t {
+    DISABLE = 0,
+    DROP = 1,
+    BLOCK = 2
+};
+
+constexpr size_t kAsyncLogMaxArgs = 16U;
+constexpr size_t kAsyncLogStrPoolSize = 1024U;
+constexpr size_t kAsyncLogRingCapacity = 256U;
+constexpr size_t kAsyncLogLineSize = 1024U;
+
+enum class AsyncLogArgType : uint8_t {
+    INT = 0,
+    UINT,
+    LONG,
+    ULONG,
+    LLONG,
+    ULLONG,
+    SIZE,
+    INTMAX,
+    UINTMAX,
+    PTRDIFF,
+    DOUBLE,
+    PTR,
+    STR
+};
+
+struct AsyncLogArg {
+    AsyncLogArgType type;
+    union {
+        uint64_t u64;
+        double f64;
+        const void* ptr;
+        uint32_t strOffset;
+    };
+};
+
+/**
+ * One captured log call. The format is copied to the start of strPool, followed by the %s arguments,
+ * so a record never points into the caller: neither at temporaries nor at the literals of an op .so
+ * that may be unloaded before the record is written. When the format cannot be captured (e.g. %n,
+ * long double, too many arguments, a format that does not fit in strPool) the message is formatted
+ * on the caller thread into strPool.
+ */
+struct AsyncLogRecord {
+    int32_t moduleId;
+    int32_t level;
+    uint16_t argNum;
+    uint16_t strPoolUsed;
+    bool preformatted;
+    std::array<AsyncLogArg, kAsyncLogMaxArgs> args;
+    std::array<char, kAsyncLogStrPoolSize> strPool;
+};
+
+struct AsyncLogStats {
+    uint64_t recorded{0};
+    uint64_t written{0};
+    uint64_t dropped{0};
+    uint64_t blocked{0};
+};
+
+// Single producer (the owning thread) / single consumer (whoever holds the drain lock) ring.
+class AsyncLogRing {
+public:
+    AsyncLogRecord* AcquireSlot()
+    {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= kAsyncLogRingCapacity) {
+            return nullptr;
+        }
+        return &slots_[tail % kAsyncLogRingCapacity];
+    }
+
+    void Publish() { tail_.store(tail_.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+    const AsyncLogRecord* Front() const
+    {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slots_[head % kAsyncLogRingCapacity];
+    }
+
+    void Pop() { head_.store(head_.load(std::memory_order_relaxed) + 1U, std::memory_order_release); }
+
+    bool Empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+
+    void Retire() { retired_.store(true, std::memory_order_release); }
+
+    bool IsRetired() const { return retired_.load(std::memory_order_acquire); }
+
+private:
+    alignas(64) std::atomic<uint64_t> head_{0U};
+    alignas(64) std::atomic<uint64_t> tail_{0U};
+    std::atomic<bool> retired_{false};
+    std::array<AsyncLogRecord, kAsyncLogRingCapacity> slots_;
+};
+
+bool CaptureAsyncLogRecord(AsyncLogRecord& record, int32_t moduleId, int32_t level, const char* fmt, va_list args);
+
+// Returns the length of the formatted text (truncated to len - 1).
+size_t FormatAsyncLogRecord(const AsyncLogRecord& record, char* buf, size_t len);
+
+class AsyncLogger {
+public:
+    static AsyncLogger& Instance();
+
+    bool IsEnabled() const { return mode_.load(std::memory_order_relaxed) != AsyncLogMode::DISABLE; }
+
+    AsyncLogMode GetMode() const { return mode_.load(std::memory_order_relaxed); }
+
+    void SetMode(AsyncLogMode mode);
+
+    // Returns false if the record was not queued and the caller should fall back to synchronous logging.
+    bool Record(int32_t moduleId, int32_t level, const char* fmt, va_list args);
+
+    // Write out everything queued by any thread before returning.
+    void Flush();
+
+    // Stop the writer thread and flush. Later logs are emitted synchronously.
+    void Shutdown();
+
+    AsyncLogStats GetStats() const;
+
+    void ResetStats();
+
+private:
+    AsyncLogger();
+    ~AsyncLogger() = default;
+
+    AsyncLogRing* GetThreadRing();
+    void StartWriter();
+    void StopWriter();
+    void WriterLoop();
+    size_t DrainRings();
+
+    std::atomic<AsyncLogMode> mode_{AsyncLogMode::DISABLE};
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> shutdown_{false};
+    std::thread writer_;
+    std::mutex writerMutex_;
+    std::condition_variable writerCv_;
+
+    std::mutex ringsMutex_;
+    std::vector<std::shared_ptr<AsyncLogRing>> rings_;
+    std::atomic<uint64_t> ringsGeneration_{0U};
+
+    // serializes consumers of the rings: the writer thread and explicit Flush() callers
+    std::mutex drainMutex_;
+    std::vector<std::shared_ptr<AsyncLogRing>> drainSnapshot_;
+    uint64_t drainGeneration_{UINT64_MAX};
+
+    std::atomic<uint64_t> recorded_{0U};
+    std::atomic<uint64_t> written_{0U};
+    std::atomic<uint64_t> dropped_{0U};
+    std::atomic<uint64_t> blocked_{0U};
+};
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_ASYNC_LOG_H_
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -22,9 +23,13 @@
 #include <mutex>
 #include <new>
 #include <numeric>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
+#include <malloc.h>
 #include <unistd.h>
+#include "alloc_stats.h"
 #include "block_store.h"
 #include "opdev/op_log.h"
 
@@ -55,12 +60,33 @@ public:
     OpSpinlock() { atomic_flag = 0; }
     void lock()
     {
-        for (int i = 0; atomic_flag.load(std::memory_order_relaxed) != 0 ||
-                        atomic_flag.exchange(1, std::memory_order_acquire) != 0;
-             i++) {
+        if (atomic_flag.load(std::memory_order_relaxed) == 0 &&
+            atomic_flag.exchange(1, std::memory_order_acquire) == 0) {
+            return;
         }
+        LockContended();
+    }
+    bool try_lock()
+    {
+        return atomic_flag.load(std::memory_order_relaxed) == 0 &&
+               atomic_flag.exchange(1, std::memory_order_acquire) == 0;
     }
     void unlock() { atomic_flag.store(0, std::memory_order_release); }
+
+private:
+    void LockContended()
+    {
+        const bool timed = AllocStats::IsEnabled();
+        const auto start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        while (atomic_flag.load(std::memory_order_relaxed) != 0 ||
+               atomic_flag.exchange(1, std::memory_order_acquire) != 0) {
+        }
+        if (timed) {
+            const auto wait = std::chrono::steady_clock::now() - start;
+            AllocStats::AddLockWait(
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count()));
+        }
+    }
 };
 
 class BlockPool {
@@ -76,14 +102,28 @@ public:
 
     ~BlockPool() { UnInit(); }
 
-    static void* Malloc(size_t size) { return get_instance().MallocImpl(size); }
+    static void* Malloc(size_t size)
+    {
+        void* p = get_instance().MallocImpl(size);
+        if (p != nullptr && AllocStats::IsEnabled()) {
+            AllocStats::AddRequestSize(size);
+            RecordUserBlock(p, AllocStatsItem::ALLOC);
+        }
+        return p;
+    }
 
     static size_t BatchMalloc(size_t size, void** addrList, size_t batch)
     {
         return get_instance().BatchMatchImpl(size, addrList, batch);
     }
 
-    static void Free(void* block) { return get_instance().FreeImpl(block); }
+    static void Free(void* block)
+    {
+        if (block != nullptr && AllocStats::IsEnabled()) {
+            RecordUserBlock(block, AllocStatsItem::FREE);
+        }
+        return get_instance().FreeImpl(block);
+    }
 
     static void* GetOneHugeBlock() { return get_instance().GetOneHugeBlockImpl(); }
 
@@ -91,6 +131,12 @@ public:
 
     static bool InHugeMemRange(void* p) { return get_instance().InHugeMemRangeImpl(p); }
 
+    // the huge block containing p, p must be in the huge memory range
+    static void* GetHugeBlockBase(const void* p) { return get_instance().GetHugeBlockBaseImpl(p); }
+
+    // give the pages of the free huge blocks back to the OS, return the number of blocks trimmed
+    static size_t TrimHugeBlocks() { return get_instance().TrimHugeBlocksImpl(); }
+
 private:
     static BlockPool& globalPool_;
 
@@ -104,8 +150,14 @@ private:
     {
         void* p = PoolMalloc(size);
         if (p != nullptr) {
+            if (AllocStats::IsEnabled()) {
+                AllocStats::Add(AllocStatsItem::POOL_ALLOC, GetBlockClass(BlockStore::GetBlockHeader(p)));
+            }
             return p;
         }
+        if (size > BLOCK_MAX_SIZE && size <= spanMaxSize_) {
+            return SpanMalloc(size);
+        }
 
         p = std::malloc(sizeof(BlockStore::BlockHeader) + size);
         if (p == nullptr) {
@@ -117,6 +169,12 @@ private:
         new (head) BlockStore::BlockHeader;
         head->userTag_ = SYS_TAG;
         head->cacheExt_ = BlockStore::NOT_IN_CACHE;
+        // keep the size class of a fallback block for the statistics, sizes without a class stay INVALID_STORE
+        head->blockIdx_ = GetStoreIndexImpl(size);
+        if (AllocStats::IsEnabled()) {
+            AllocStats::Add(AllocStatsItem::MALLOC, GetBlockClass(head));
+            AllocStats::Add(AllocStatsItem::MALLOC_BYTES, GetBlockClass(head), size);
+        }
         return head + 1;
     }
 
@@ -141,6 +199,8 @@ private:
             }
         }
 
+        const size_t poolNum = n;
+        const int idx = GetStoreIndexImpl(size);
         while (n < batch) {
             void* block = std::malloc(sizeof(BlockStore::BlockHeader) + store->GetBlockSize());
             if (block) {
@@ -148,11 +208,18 @@ private:
                 // std::malloc 不调用构造函数，需 placement new 初始化 magic_ 等非静态成员数据初始化
                 new (head) BlockStore::BlockHeader;
                 head->userTag_ = SYS_TAG;
+                head->blockIdx_ = idx;
                 addrList[n++] = head + 1;
             } else {
                 break;
             }
         }
+        if (AllocStats::IsEnabled()) {
+            AllocStats::Add(AllocStatsItem::POOL_ALLOC, static_cast<size_t>(idx), poolNum);
+            AllocStats::Add(AllocStatsItem::MALLOC, static_cast<size_t>(idx), n - poolNum);
+            AllocStats::Add(AllocStatsItem::MALLOC_BYTES, static_cast<size_t>(idx),
+                            (n - poolNum) * store->GetBlockSize());
+        }
         return n;
     }
 
@@ -163,17 +230,61 @@ private:
             std::free(static_cast<BlockStore::BlockHeader*>(block) - 1);
             return;
         }
+        if (tag == SPAN_TAG) {
+            SpanFree(block);
+            return;
+        }
 
         size_t idx = tag - DEFAULT_TAG;
-        if (idx > MAX_STORE) {
+        if (idx >= storeNum_) {
             // FATAL: try to free block not belong to this BlockPool
             return;
         }
+        if (AllocStats::IsEnabled()) {
+            AllocStats::Add(AllocStatsItem::POOL_FREE, idx);
+        }
         BlockStore& store = blockStoreArray_[idx];
         const std::lock_guard<OpSpinlock> guard(guard_);
         store.Free(block);
     }
 
+    // size class of a block for the statistics, storeNum_ for the blocks over the largest class
+    static size_t GetBlockClass(const BlockStore::BlockHeader* head)
+    {
+        const size_t storeNum = get_instance().storeNum_;
+        if (head->userTag_ == SPAN_TAG) {
+            return storeNum;
+        }
+        if (head->userTag_ != SYS_TAG) {
+            return static_cast<size_t>(head->userTag_ - DEFAULT_TAG);
+        }
+        if (head->blockIdx_ >= 0 && static_cast<size_t>(head->blockIdx_) < storeNum) {
+            return static_cast<size_t>(head->blockIdx_);
+        }
+        return storeNum;
+    }
+
+    static size_t GetBlockBytes(BlockStore::BlockHeader* head)
+    {
+        const BlockPool& pool = get_instance();
+        if (head->userTag_ == SPAN_TAG) {
+            return static_cast<size_t>(head->blockIdx_) * pool.spanPageSize_ - sizeof(BlockStore::BlockHeader);
+        }
+        const size_t cls = GetBlockClass(head);
+        if (cls < pool.storeNum_) {
+            return pool.StoreIndex[cls].size;
+        }
+        return malloc_usable_size(head) - sizeof(BlockStore::BlockHeader);
+    }
+
+    static void RecordUserBlock(void* block, AllocStatsItem item)
+    {
+        BlockStore::BlockHeader* head = BlockStore::GetBlockHeader(block);
+        const int64_t bytes = static_cast<int64_t>(GetBlockBytes(head));
+        AllocStats::Add(item, GetBlockClass(head));
+        AllocStats::AddLiveBytes(item == AllocStatsItem::ALLOC ? bytes : -bytes);
+    }
+
     inline void* PoolMalloc(size_t size)
     {
         const std::lock_guard<OpSpinlock> guard(guard_);
@@ -210,32 +321,62 @@ private:
 
     inline bool InHugeMemRangeImpl(const void* addr) { return (addr >= hugeMemStart_) && (addr < hugeMemEnd_); }
 
+    inline void* GetHugeBlockBaseImpl(const void* addr)
+    {
+        const size_t offset = static_cast<size_t>(static_cast<const char*>(addr) - static_cast<char*>(hugeMemStart_));
+        return static_cast<char*>(hugeMemStart_) + offset / kHugeBlockSize * kHugeBlockSize;
+    }
+
+    size_t TrimHugeBlocksImpl();
+
+    void* SpanMalloc(size_t size);
+    void SpanFree(void* block);
+
     bool Init();
     void UnInit();
 
     /**
-     * @brief Block size and count of BlockStore
+     * @brief Block size and count of BlockStore, and how the thread BlockCache keeps the blocks of the size
      */
     struct BlockDesc {
-        BlockDesc(size_t s, size_t c) : size(s), count(c){};
+        BlockDesc() = default;
+        BlockDesc(size_t s, size_t c, size_t cc, size_t b) : size(s), count(c), cacheCount(cc), batch(b){};
         size_t size{0};
         size_t count{0};
+        size_t cacheCount{0}; // blocks a thread cache keeps before passing the frees to the pool
+        size_t batch{1};      // blocks a thread cache allocates on a miss
     };
 
     static const int INVALID_STORE = -1;
-    static const int MAX_STORE = 6;
+    static const int MAX_STORE = 36;
     static const int BLOCK_BASE_SIZE = 64;
     static const uint32_t BLOCK_MAX_SIZE = BLOCK_BASE_SIZE * 1024;
+    static const uint32_t SPAN_MAX_SIZE = BLOCK_MAX_SIZE * 16;
     static const uint16_t DEFAULT_TAG = 0x1337;
     static const uint16_t SYS_TAG = 0xfeed;
+    static const uint16_t SPAN_TAG = 0xface;
     OpSpinlock guard_;
 
-    const std::array<BlockDesc, MAX_STORE> StoreIndex = {BlockDesc(BLOCK_BASE_SIZE, 32768),      // 64B 2MB
-                                                         BlockDesc(BLOCK_BASE_SIZE * 4, 16384),  // 256B 4MB
-                                                         BlockDesc(BLOCK_BASE_SIZE * 16, 32768), // 1KB 32MB
-                                                         BlockDesc(BLOCK_BASE_SIZE * 64, 8192),  // 4KB 32MB
-                                                         BlockDesc(BLOCK_BASE_SIZE * 256, 2048), // 16KB 32MB
-                                                         BlockDesc(BLOCK_MAX_SIZE, 512)};        // 64KB 32MB
+    /**
+     * ACLNN_BLOCK_POOL_CLASSES replaces the default classes below:
+     *   fine                   4 classes per power of two from 64B to 64KB
+     *   <size>:<num>[,...]     classes derived from a request size histogram, e.g. the "Alloc stats sizes" line
+     *                          ACLNN_ALLOC_STATS dumps, only the sizes requested get a class
+     * The blocks are spread over ACLNN_BLOCK_POOL_MB (default the size of the default classes) by the bytes
+     * requested of each class, and the requests over 64KB up to SPAN_MAX_SIZE are served by page granular spans
+     * kept after free.
+     */
+    static std::vector<BlockDesc> GetDefaultStoreIndex();
+    static bool ParseStoreIndex(const std::string& config, size_t budget, std::vector<BlockDesc>& stores);
+    static void DeriveStoreIndex(const std::vector<std::pair<size_t, uint64_t>>& histogram, size_t budget,
+                                 std::vector<BlockDesc>& stores);
+    static bool LoadStoreIndex(std::vector<BlockDesc>& stores);
+    bool InitStores(const std::vector<BlockDesc>& stores);
+
+    std::array<BlockDesc, MAX_STORE> StoreIndex;
+    size_t storeNum_{0};
+    // size class of each BLOCK_BASE_SIZE step up to BLOCK_MAX_SIZE
+    std::array<int8_t, BLOCK_MAX_SIZE / BLOCK_BASE_SIZE> storeLookup_;
 
     using StoreArray = std::array<BlockStore, MAX_STORE>;
     StoreArray blockStoreArray_;
@@ -243,31 +384,27 @@ private:
     HugeMemArray hugeMemArray_;
     void* hugeMemStart_;
     void* hugeMemEnd_;
-    static int GetStoreIndex(size_t req_size)
+
+    // free spans by page number, linked through their first user bytes
+    std::vector<BlockStore::BlockHeader*> spanFreeList_;
+    size_t spanMaxSize_{0};
+    size_t spanPageSize_{0};
+    size_t spanCachedBytes_{0};
+    size_t spanCacheMaxBytes_{0};
+
+    static int GetStoreIndex(size_t req_size) { return get_instance().GetStoreIndexImpl(req_size); }
+
+    inline int GetStoreIndexImpl(size_t req_size) const
     {
         if (req_size == 0 || req_size > BLOCK_MAX_SIZE) {
             return INVALID_STORE;
         }
-
-        if (req_size <= BLOCK_BASE_SIZE) {
-            return 0;
-        }
-
-        int idx = 1;
-        req_size -= 1;
-        req_size = req_size >> 6;
-        do {
-            if (req_size < 4) {
-                break;
-            }
-            idx++;
-            req_size = req_size >> 2;
-        } while (req_size);
-        return idx;
+        return storeLookup_[(req_size - 1) / BLOCK_BASE_SIZE];
     }
+
     inline BlockStore* GetStore(size_t req_size)
     {
-        int idx = GetStoreIndex(req_size);
+        int idx = GetStoreIndexImpl(req_size);
         if (idx == INVALID_STORE) {
             return nullptr;
         }
@@ -281,10 +418,12 @@ public:
 
     ~BlockCache()
     {
-        OP_LOGD("BlockCache destructing, cacheCount per size class: "
-                "size64B [%zu], size256B [%zu], size1KB [%zu], "
-                "size4KB [%zu], size16KB [%zu], size64KB [%zu].",
-                cacheCount_[0], cacheCount_[1], cacheCount_[2], cacheCount_[3], cacheCount_[4], cacheCount_[5]);
+        for (int i = 0; i < BlockPool::MAX_STORE; i++) {
+            if (cacheCount_[i] != 0) {
+                OP_LOGD("BlockCache destructing, size class %d size [%zu] cacheCount [%zu].", i,
+                        BlockPool::get_instance().StoreIndex[i].size, cacheCount_[i]);
+            }
+        }
         for (int i = 0; i < BlockPool::MAX_STORE; i++) {
             BlockStore::BlockHeader* head = cacheHead_[i];
             while (head != nullptr) {
@@ -297,9 +436,23 @@ public:
         }
     }
 
-    static void* CacheAlloc(size_t size) { return get_instance().CacheAllocImpl(size); }
+    static void* CacheAlloc(size_t size)
+    {
+        void* p = get_instance().CacheAllocImpl(size);
+        if (p != nullptr && AllocStats::IsEnabled()) {
+            AllocStats::AddRequestSize(size);
+            BlockPool::RecordUserBlock(p, AllocStatsItem::ALLOC);
+        }
+        return p;
+    }
 
-    static void CacheFree(void* block) { return get_instance().CacheFreeImpl(block); }
+    static void CacheFree(void* block)
+    {
+        if (AllocStats::IsEnabled()) {
+            BlockPool::RecordUserBlock(block, AllocStatsItem::FREE);
+        }
+        return get_instance().CacheFreeImpl(block);
+    }
 
     // 返回当前线程 BlockCache 实例地址，供 CheckDoubleFree 判定 block 活跃态使用
     static uintptr_t CurrentThreadCacheAddr() { return reinterpret_cast<uintptr_t>(&get_instance()); }
@@ -321,7 +474,7 @@ private:
     // 使 ~BlockCache 析构能直接 std::free 释放，彻底规避 use-after-free）
     size_t BatchMallocSysMem(int index, void** addrList, size_t batch)
     {
-        size_t blockSize = CacheIndex[index].size;
+        size_t blockSize = BlockPool::get_instance().StoreIndex[index].size;
         size_t n = 0;
         while (n < batch) {
             void* block = std::malloc(sizeof(BlockStore::BlockHeader) + blockSize);
@@ -343,12 +496,17 @@ private:
     void* PoolAlloc(size_t size, int index)
     {
         if (index == BlockPool::INVALID_STORE) {
-            return BlockPool::Malloc(size);
+            return BlockPool::get_instance().MallocImpl(size);
         }
 
-        size_t batch = CacheBatchSize[index];
+        size_t batch = std::min(BlockPool::get_instance().StoreIndex[index].batch,
+                                static_cast<size_t>(ADDR_LIST_LARGEST_SIZE));
         void* addrList[ADDR_LIST_LARGEST_SIZE];
         size_t n = BatchMallocSysMem(index, addrList, batch);
+        if (n && AllocStats::IsEnabled()) {
+            AllocStats::Add(AllocStatsItem::CACHE_REFILL, static_cast<size_t>(index));
+            AllocStats::Add(AllocStatsItem::CACHE_REFILL_BLOCK, static_cast<size_t>(index), n);
+        }
         if (n) {
             const std::lock_guard<OpSpinlock> guard(guard_);
             for (size_t i = 0; i < n; i++) {
@@ -380,6 +538,7 @@ private:
             return nullptr;
         }
 
+        void* hit = nullptr;
         {
             const std::lock_guard<OpSpinlock> guard(guard_);
             if (!CacheEmpty(index)) {
@@ -387,9 +546,15 @@ private:
                 cacheHead_[index] = reinterpret_cast<BlockStore::BlockHeader*>(head->cacheExt_);
                 cacheCount_[index]--;
                 head->cacheExt_ = reinterpret_cast<uintptr_t>(this);
-                return head + 1;
+                hit = head + 1;
             }
         }
+        if (hit != nullptr) {
+            if (AllocStats::IsEnabled()) {
+                AllocStats::Add(AllocStatsItem::CACHE_HIT, static_cast<size_t>(index));
+            }
+            return hit;
+        }
         return PoolAlloc(size, index);
     }
 
@@ -405,7 +570,7 @@ private:
     {
         BlockStore::BlockHeader* head = BlockStore::GetBlockHeader(block);
         if (head->cacheExt_ == BlockStore::NOT_IN_CACHE) {
-            BlockPool::Free(block);
+            BlockPool::get_instance().FreeImpl(block);
             return;
         }
 
@@ -416,9 +581,13 @@ private:
             return;
         }
 
-        if (head->cacheExt_ != reinterpret_cast<uintptr_t>(this) && cacheCount_[idx] > cacheMaxCount_[idx]) {
+        if (head->cacheExt_ != reinterpret_cast<uintptr_t>(this) &&
+            cacheCount_[idx] > BlockPool::get_instance().StoreIndex[idx].cacheCount) {
             OP_LOGD("free cache pool block to block pool");
-            BlockPool::Free(block);
+            if (AllocStats::IsEnabled()) {
+                AllocStats::Add(AllocStatsItem::CACHE_FLUSH, static_cast<size_t>(idx));
+            }
+            BlockPool::get_instance().FreeImpl(block);
             return;
         }
 
@@ -428,28 +597,9 @@ private:
         cacheCount_[idx]++;
     }
 
-    // cache size limit and cache block recycle in future
-    const std::array<BlockPool::BlockDesc, BlockPool::MAX_STORE> CacheIndex = {
-        BlockPool::BlockDesc(BlockPool::BLOCK_BASE_SIZE, 4096),      // 64B 256KB
-        BlockPool::BlockDesc(BlockPool::BLOCK_BASE_SIZE * 4, 2048),  // 256B 512KB
-        BlockPool::BlockDesc(BlockPool::BLOCK_BASE_SIZE * 16, 4096), // 1KB 4MB
-        BlockPool::BlockDesc(BlockPool::BLOCK_BASE_SIZE * 64, 1024), // 4KB 4MB
-        BlockPool::BlockDesc(BlockPool::BLOCK_BASE_SIZE * 256, 256), // 16KB 4MB
-        BlockPool::BlockDesc(BlockPool::BLOCK_MAX_SIZE, 64)          // 64KB 4MB
-    };
-
-    const std::array<size_t, BlockPool::MAX_STORE> CacheBatchSize = {16, 8, 16, 4, 1, 1};
-
+    // cache size limit and batch size of each class are in BlockPool::StoreIndex
     BlockStore::BlockHeader* cacheHead_[BlockPool::MAX_STORE] = {nullptr};
-    std::array<size_t, BlockPool::MAX_STORE> cacheCount_ = {0, 0, 0, 0, 0, 0};
-    const std::array<size_t, BlockPool::MAX_STORE> cacheMaxCount_ = {
-        4096, // 64B 256KB
-        2048, // 256B 512KB
-        4096, // 1KB 4MB
-        1024, // 4KB 4MB
-        256,  // 16KB 4MB
-        64    // 64KB 4MB
-    };
+    std::array<size_t, BlockPool::MAX_STORE> cacheCount_ = {};
 };
 
 } // namespace internal
@@ -22,6 +22,7 @@ int32_t GetPoolIndex();
 void UpdateHugeMemIndex(int32_t id);
 void FreeHugeMem();
 void* GetAddr(const int32_t id, size_t size);
+void ReleaseHugeAddr(const void* addr);
 bool CheckDoubleFree(void* addr);
 } // namespace internal
 } // namespace op
@@ -43,6 +43,11 @@ public:
     uint32_t GetOpType() const { return opType_; }
     void SetOpType(uint32_t type) { opType_ = type; }
     void UpdateThreadLocal() { op::internal::GetThreadLocalContext().logInfo_.l0Name = opLogInfo_.l0Name; }
+    // Args and kernel bin known before the launch, nullptr if the executor can not tell which memory the launch
+    // touches. aclOpExecutor::Run uses them to fuse the memset and overflow check side tasks of the launches.
+    virtual OpArgContext* GetLaunchArgs() { return nullptr; }
+    virtual internal::OpKernelBin* GetLaunchBin() { return nullptr; }
+    virtual void OverflowDump() {}
 
 protected:
     uint32_t opType_;
@@ -179,17 +184,8 @@ public:
             op::internal::DumpL0(*args_->GetOpArg(op::OP_OUTPUT_ARG), opLogInfo_, OpOutputType, executor_->GetStream());
         }
 
-        if (res == ACLNN_SUCCESS && op::internal::IsOverflowDumpEnable()) {
-            aclmdlRICaptureStatus status;
-            aclmdlRI captureMdl;
-            if ((aclmdlRICaptureGetInfo(executor_->GetStream(), &status, &captureMdl) == ACL_SUCCESS) &&
-                (status == ACL_MODEL_RI_CAPTURE_STATUS_ACTIVE)) {
-                OP_LOGI("No need to perform overflow check in the capture scenario.");
-            } else {
-                (void)op::internal::OverflowDumpProcess(args_, const_cast<aclOpExecutor*>(executor_),
-                                                        executor_->GetStream(), opLogInfo_);
-                internal::GetLauncherCtx().ClearTilingCache();
-            }
+        if (res == ACLNN_SUCCESS && op::internal::IsOverflowDumpEnable() && !threadLocalCtx.overflowCheckDeferred_) {
+            OverflowDump();
         }
         if (isRepeatable) {
             launchCtx_ = std::move(internal::GetLauncherCtx());
@@ -199,6 +195,24 @@ public:
         return res;
     }
 
+    OpArgContext* GetLaunchArgs() override { return args_; }
+
+    op::internal::OpKernelBin* GetLaunchBin() override { return launchCtx_.GetOpKernelBin(); }
+
+    void OverflowDump() override
+    {
+        aclmdlRICaptureStatus status;
+        aclmdlRI captureMdl;
+        if ((aclmdlRICaptureGetInfo(executor_->GetStream(), &status, &captureMdl) == ACL_SUCCESS) &&
+            (status == ACL_MODEL_RI_CAPTURE_STATUS_ACTIVE)) {
+            OP_LOGI("No need to perform overflow check in the capture scenario.");
+        } else {
+            (void)op::internal::OverflowDumpProcess(args_, const_cast<aclOpExecutor*>(executor_),
+                                                    executor_->GetStream(), opLogInfo_);
+            internal::GetLauncherCtx().ClearTilingCache();
+        }
+    }
+
     op::internal::OpKernelBin* GetBin() override
     {
         internal::OpKernel* opKernel = op::internal::gKernelMgr.GetKernel(opType_);
@@ -31,6 +31,7 @@
 #include "aclnn_engine/op_run_context.h"
 #include "aclnn_engine/kernel_arg.h"
 #include "aclnn_engine/op_kernel.h"
+#include "aclnn_engine/static_kernel_index.h"
 #include "aclnn_engine/tilingctx_builder.h"
 
 namespace op {
@@ -98,6 +99,22 @@ public:
         return ACLNN_SUCCESS;
     }
 
+    aclnnStatus Prewarm(uint32_t opType, OpArgContext* opArgCtx, bool runTiling)
+    {
+        aclnnStatus ret = AclOpKernelInit(opType);
+        if (ret != ACLNN_SUCCESS) {
+            OP_LOGW("AclOpKernelInit failed, opType: %s.", op::OpTypeDict::ToString(opType).GetString());
+            return ret;
+        }
+        OpKernel* kernel = GetKernel(opType);
+        if (kernel == nullptr) {
+            OP_LOGW("Kernel Not Found. opType: %u", opType);
+            return ACLNN_ERR_INNER;
+        }
+        return kernel->Prewarm(*opArgCtx->GetOpArg(op::OP_INPUT_ARG), *opArgCtx->GetOpArg(op::OP_OUTPUT_ARG),
+                               *opArgCtx->GetOpArg(op::OP_ATTR_ARG), runTiling);
+    }
+
     aclnnStatus AclOpKernelInit(uint32_t opType);
 
     aclnnStatus SelectMemsetOpBin(size_t inputNum, OpKernelBin*& opBin);
@@ -159,6 +176,8 @@ private:
     std::string builtInBinAndJsonDir_;
     std::string staticBinAndJsonDir_;
     nlohmann::json staticConfigJson_;
+    // nullptr if the index is neither loadable nor buildable, static kernels then come from staticConfigJson_
+    std::shared_ptr<const StaticKernelIndex> staticKernelIndex_;
 
     std::string debugConfigDir_;
     std::string debugDynBinAndJsonDir_;
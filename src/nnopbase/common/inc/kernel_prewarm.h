@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_KERNEL_PREWARM_H_
+#define OP_API_OP_API_COMMON_INC_KERNEL_PREWARM_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "acl/acl_rt.h"
+#include "opdev/op_arg_def.h"
+#include "opdev/op_config.h"
+
+namespace op {
+namespace internal {
+
+// ACLNN_PREWARM_THREAD_NUM sets the number of prewarm threads (default 2)
+constexpr size_t kPrewarmDefaultThreadNum = 2U;
+constexpr size_t kPrewarmMaxThreadNum = 16U;
+
+struct PrewarmProgress {
+    uint64_t submitted{0}; // tasks queued
+    uint64_t done{0};      // tasks finished successfully
+    uint64_t failed{0};    // tasks finished with an error
+    size_t pendingNum{0};  // tasks queued or running
+};
+
+/**
+ * Pre-warms kernels ahead of their first call, so that traffic moving into a new shape bucket does not pay for the
+ * binary selection, the kernel load and registration and the tiling parse context on its first call. A task selects
+ * the binary of the op for the given tensor descriptors and attrs, loads it on the device of the submitting thread,
+ * builds its tiling parse context and, if asked, runs the tiling once to resolve the function handle of its tiling
+ * key. Nothing is launched. Tasks run on a small thread pool started by the first submit, in the context and with
+ * the core num config of the submitting thread.
+ */
+class KernelPrewarmer {
+public:
+    using PrewarmFunc = std::function<aclnnStatus()>;
+
+    static KernelPrewarmer& Instance();
+
+    // Takes over args, which is destroyed by DestroyOpArgContext once the task has run. The tiling only runs if
+    // runTiling is set and the op has no value-depend input, whose host data a prewarm task does not have.
+    aclnnStatus Submit(uint32_t opType, OpArgContext* args, bool runTiling = false);
+
+    // Runs func on a prewarm thread, e.g. the GetWorkspaceSize call of an L2 api to fill the executor cache.
+    aclnnStatus Submit(PrewarmFunc func);
+
+    /**
+     * Submits every op of a prewarm list, a json file of the form
+     *   {"ops": [{"op_type": "Add", "buckets": [128, 256], "tiling": false,
+     *             "inputs": [{"shape": [-1, 1024], "dtype": "DT_FLOAT16", "format": "ND"}, null, [...]],
+     *             "outputs": [...], "attrs": [{"type": "int", "value": 1}, ...]}]}
+     * A tensor is an object, a tensor list an array of them and an absent optional tensor null. Every -1 dim is
+     * replaced by each of the buckets in turn, one task per bucket. Attr types are int, float, bool, string, dtype,
+     * int_list, float_list and bool_list. The tensors have no data, so "tiling" (default false) should only be set
+     * for ops whose tiling reads nothing but the shapes and attrs; it is ignored for ops with value-depend inputs.
+     */
+    aclnnStatus SubmitFile(const std::string& path);
+
+    PrewarmProgress GetProgress() const;
+
+    // Block until every task submitted so far has run.
+    void Wait();
+
+    // Drop the queued tasks, wait for the running ones and stop the threads. Later submits start them again.
+    void Shutdown();
+
+private:
+    struct PrewarmTask {
+        PrewarmFunc func;
+        aclrtContext context{nullptr};
+        OpConfigInfo opConfigInfo;
+    };
+
+    KernelPrewarmer() = default;
+    ~KernelPrewarmer() = default;
+
+    aclnnStatus Enqueue(PrewarmFunc func);
+    void StartWorkers();
+    void WorkerLoop();
+
+    mutable std::mutex mutex_; // protects the queue, the progress and the worker state
+    std::condition_variable queueCv_;
+    std::condition_variable doneCv_;
+    std::deque<PrewarmTask> queue_;
+    std::vector<std::thread> workers_;
+    bool stop_{false};
+    PrewarmProgress progress_;
+};
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_KERNEL_PREWARM_H_
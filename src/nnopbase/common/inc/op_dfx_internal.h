@@ -117,6 +117,7 @@ void SummaryAttrArg([[maybe_unused]] size_t idx, OpArg& value, std::vector<AttrI
 void SummaryAttrArg([[maybe_unused]] size_t idx, OpArg& value, std::string& attrStr);
 
 void ReportAttrInfo(std::string& attrStr, uint64_t summaryId);
+void ReportAttrInfo(uint64_t id, uint64_t summaryId);
 
 inline void ReportAttrInfo(OpArgList& attrs, std::string& attrStr, std::vector<AttrInfo>& attrInfos)
 {
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_OPP_MANIFEST_H_
+#define OP_API_OP_API_COMMON_INC_OPP_MANIFEST_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "aclnn/aclnn_base.h"
+
+namespace op {
+namespace internal {
+
+enum class OppEntryType : char {
+    FILE = 'f', // regular file, its real path is the real dir path plus its name
+    DIR = 'd',
+    OTHER = 'l' // symbolic link or unknown, needs RealPath
+};
+
+struct OppManifestEntry {
+    std::string name;
+    OppEntryType type{OppEntryType::OTHER};
+    uint64_t size{0U};
+    int64_t mtime{0};
+};
+
+/**
+ * Directory listings of the OPP trees, kept in the file ACLNN_OPP_MANIFEST names, so that the loaders do not scan
+ * the same directories on every process start, which takes seconds on network and overlay filesystems.
+ *
+ * A directory is listed from the manifest while its mtime equals the recorded one, adding, removing or renaming an
+ * entry changes it. Otherwise, and for directories the manifest does not know, the directory is scanned and the new
+ * listing is written back by Save(). Without ACLNN_OPP_MANIFEST every listing is a plain scan.
+ *
+ * The file is text, one "D <mtime sec> <mtime nsec> <entry num> <real dir path>" line per directory followed by one
+ * "<type> <size> <mtime sec> <name>" line per entry, scripts/util/gen_opp_manifest.py generates it ahead of time.
+ */
+class OppManifest {
+public:
+    static OppManifest& Instance();
+
+    bool IsEnabled() const { return !path_.empty(); }
+
+    // Lists the entries of the real directory path realDir except "." and "..", false if it can not be opened.
+    bool ListDir(const std::string& realDir, std::vector<OppManifestEntry>& entries);
+
+    // Writes the manifest back if a listing changed since it was loaded.
+    aclnnStatus Save();
+
+    // Drops the loaded listings and switches to the manifest at path, an empty path disables it.
+    void Reset(const std::string& path);
+
+private:
+    struct DirRecord {
+        int64_t mtimeSec{0};
+        int64_t mtimeNsec{0};
+        std::vector<OppManifestEntry> entries;
+    };
+
+    OppManifest();
+    void Load();
+    bool ScanDir(const std::string& realDir, DirRecord& record) const;
+
+    std::mutex mutex_;
+    std::string path_;
+    std::unordered_map<std::string, DirRecord> dirs_;
+    bool loaded_{false};
+    bool dirty_{false};
+};
+
+// Names of the files in the real directory path realDir ending with suffix, listed through OppManifest.
+aclnnStatus ListFilesBySuffix(const std::string& realDir, const std::string& suffix, std::vector<std::string>& names,
+                              std::vector<OppEntryType>* types = nullptr);
+
+// Real path of the entry name listed in the real directory realDir, RealPath is only called for non regular files.
+std::string RealEntryPath(const std::string& realDir, const std::string& name, OppEntryType type);
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_OPP_MANIFEST_H_
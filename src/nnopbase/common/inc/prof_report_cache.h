@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_PROF_REPORT_CACHE_H_
+#define OP_API_OP_API_COMMON_INC_PROF_REPORT_CACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "profiling/aprof_pub.h"
+#include "opdev/common_types.h"
+#include "opdev/op_arg_def.h"
+#include "opdev/fast_vector.h"
+
+namespace op {
+namespace internal {
+
+constexpr size_t kProfReportBatchSize = 64U;
+constexpr size_t kProfReportCacheCapacity = 512U;
+// host input tensors larger than this are hashed from their string form on every launch
+constexpr size_t kProfAttrSignatureMaxBytes = 4096U;
+
+enum class ProfReportType : uint32_t {
+    COMPACT = 0,
+    ADDITIONAL = 1
+};
+
+struct ProfReportRecord {
+    ProfReportType type;
+    union {
+        MsprofCompactInfo compactInfo;
+        MsprofAdditionalInfo additionInfo;
+    };
+};
+
+/**
+ * Sink of the node level profiling records. Every thread batches its records and hands them over
+ * kProfReportBatchSize at a time, in the order they were reported. The default reporter passes each
+ * record to MsprofReportCompactInfo / MsprofReportAdditionalInfo.
+ */
+class ProfReporter {
+public:
+    virtual ~ProfReporter() = default;
+    virtual void Report(const ProfReportRecord* records, size_t num);
+};
+
+// nullptr restores the default reporter. Records batched before the call are flushed to the old reporter.
+void SetProfReporter(ProfReporter* reporter);
+
+void ProfReportCompactInfo(const MsprofCompactInfo& compactInfo);
+void ProfReportAdditionalInfo(const MsprofAdditionalInfo& additionInfo);
+
+// Hands the records batched by the calling thread to the reporter.
+void FlushProfReport();
+
+// Hands the records batched by every thread to the reporter, called when profiling stops.
+void FlushAllProfReport();
+
+struct ProfReportStats {
+    uint64_t records{0};
+    uint64_t batches{0};
+    uint64_t tensorInfoHits{0};
+    uint64_t tensorInfoMisses{0};
+    uint64_t attrIdHits{0};
+    uint64_t attrIdMisses{0};
+};
+
+/**
+ * Per thread cache of the payloads built for profiled launches: the tensor info records keyed by
+ * (summary id, shape signature), the attr hash id keyed by (kernel, raw attr values), and the kernel
+ * launcher id of every op type. The caches of all threads are dropped when profiling starts or stops.
+ * ACLNN_PROF_REPORT_CACHE=0 disables them.
+ */
+class ProfReportCache {
+public:
+    static ProfReportCache& Instance();
+
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+    static void SetEnable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+
+    // Drops the entries of every thread, the next lookup of each thread starts from an empty cache.
+    static void Invalidate() { generation_.fetch_add(1U, std::memory_order_relaxed); }
+
+    static ProfReportStats GetStats();
+    static void ResetStats();
+
+    // Scratch buffer for building the signature of one lookup.
+    std::string& Signature() { return signature_; }
+
+    std::vector<MsprofAdditionalInfo>* FindTensorInfo(const std::string& signature);
+    std::vector<MsprofAdditionalInfo>& AddTensorInfo(const std::string& signature);
+
+    bool FindAttrId(const std::string& signature, uint64_t& attrId);
+    void AddAttrId(const std::string& signature, uint64_t attrId);
+
+    uint64_t GetKernelLauncherId(uint32_t opType);
+
+private:
+    ProfReportCache() = default;
+    void CheckGeneration();
+
+    static std::atomic<bool> enabled_;
+    static std::atomic<uint64_t> generation_;
+
+    uint64_t localGeneration_{0U};
+    std::string signature_;
+    std::unordered_map<std::string, std::vector<MsprofAdditionalInfo>> tensorInfos_;
+    std::unordered_map<std::string, uint64_t> attrIds_;
+    std::unordered_map<uint32_t, uint64_t> kernelLauncherIds_;
+};
+
+// Appends dtype, format and storage shape of every tensor.
+void AppendTensorSignature(const FVector<const aclTensor*>& tensors, std::string& signature);
+
+// Appends the raw values summarized by SummaryAttrArg, false if the attrs can not be cached.
+bool AppendAttrSignature(OpArgList& attrs, std::string& signature);
+
+// Appends the contents of the host input tensors summarized by SummaryAttrArg, false if they are too large.
+bool AppendHostInputSignature(OpArgList& inputs, std::string& signature);
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_PROF_REPORT_CACHE_H_
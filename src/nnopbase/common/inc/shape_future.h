@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_SHAPE_FUTURE_H_
+#define OP_API_OP_API_COMMON_INC_SHAPE_FUTURE_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "acl/acl_rt.h"
+#include "aclnn/aclnn_base.h"
+
+namespace op {
+namespace internal {
+
+// ACLNN_AICPU_DEFERRED_SHAPE=1 defers the output shape update of third-class aicpu ops to the first host-side query
+bool IsDeferredShapeEnable();
+
+void SetDeferredShapeEnable(bool enable);
+
+/**
+ * Output shapes of one kernel launch that are only known after the device has executed it. The producer enqueues
+ * the shape copy and records event behind it; Wait() synchronizes on the event once and runs resolveFunc, which
+ * writes the shapes back to the tensors still attached. Tensors destroyed before that are passed as nullptr.
+ * Wait() returns the cached status on every later call.
+ */
+class ShapeFuture {
+public:
+    using ResolveFunc = std::function<aclnnStatus(const std::vector<aclTensor*>& tensors)>;
+
+    ShapeFuture(aclrtEvent event, const std::vector<aclTensor*>& tensors, ResolveFunc resolveFunc);
+    ~ShapeFuture();
+
+    ShapeFuture(const ShapeFuture&) = delete;
+    ShapeFuture& operator=(const ShapeFuture&) = delete;
+
+    // Non-blocking, true once the recorded event has completed or the future has been resolved.
+    bool IsReady();
+
+    bool IsResolved() const { return resolved_.load(std::memory_order_acquire); }
+
+    aclnnStatus Wait();
+
+    const std::vector<aclTensor*>& GetTensors() const { return tensors_; }
+
+private:
+    friend class ShapeFutureRegistry;
+    void DetachTensor(const aclTensor* tensor);
+
+    std::mutex mutex_;
+    aclrtEvent event_;
+    const std::vector<aclTensor*> tensors_;
+    std::vector<bool> detached_;
+    ResolveFunc resolveFunc_;
+    std::atomic<bool> resolved_{false};
+    aclnnStatus status_ = ACLNN_SUCCESS;
+};
+
+/**
+ * Maps tensors to their pending shape futures. The shape getters of aclTensor go through ResolvePendingShape, which
+ * only reads one atomic counter while nothing is pending, so the registry costs nothing when the mode is off.
+ */
+class ShapeFutureRegistry {
+public:
+    static ShapeFutureRegistry& Instance();
+
+    // Any future still pending on one of the tensors is resolved first, its shapes must not overwrite newer ones.
+    aclnnStatus Attach(const std::shared_ptr<ShapeFuture>& future);
+
+    aclnnStatus Resolve(const aclTensor* tensor);
+
+    // Resolve every future whose event has already completed, without blocking on the others.
+    size_t ResolveReady();
+
+    aclnnStatus ResolveAll();
+
+    // Drop the pending future of a tensor destroyed or given a shape explicitly, the late update skips it.
+    void Detach(const aclTensor* tensor);
+
+    size_t PendingNum() const { return pendingNum_.load(std::memory_order_acquire); }
+
+    bool HasPending() const { return pendingNum_.load(std::memory_order_relaxed) != 0U; }
+
+private:
+    ShapeFutureRegistry() = default;
+    ~ShapeFutureRegistry() = default;
+
+    void Erase(const std::shared_ptr<ShapeFuture>& future);
+
+    std::mutex mutex_;
+    std::unordered_map<const aclTensor*, std::shared_ptr<ShapeFuture>> futures_;
+    std::atomic<size_t> pendingNum_{0U};
+};
+
+inline void ResolvePendingShape(const aclTensor* tensor)
+{
+    auto& registry = ShapeFutureRegistry::Instance();
+    if (registry.HasPending()) {
+        (void)registry.Resolve(tensor);
+    }
+}
+
+inline void DetachPendingShape(const aclTensor* tensor)
+{
+    auto& registry = ShapeFutureRegistry::Instance();
+    if (registry.HasPending()) {
+        registry.Detach(tensor);
+    }
+}
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_SHAPE_FUTURE_H_
@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_TENSOR_SIGNATURE_H_
+#define OP_API_OP_API_COMMON_INC_TENSOR_SIGNATURE_H_
+
+#include <cstdint>
+#include "opdev/common_types.h"
+
+namespace op {
+namespace internal {
+
+// 0 marks a signature that is not computed yet, CalcTensorSignature never returns it
+constexpr uint64_t kInvalidTensorSignature = 0U;
+
+/**
+ * Hashes the tensor fields the op cache keys are built from: data type, view shape, strides, offset and format,
+ * storage shape and format. Tensors with equal fields get equal signatures.
+ */
+uint64_t CalcTensorSignature(const aclTensor* tensor);
+
+// ACLNN_CACHE_FULL_KEY=1 builds the cache keys from the full tensor fields instead of the cached signatures, and
+// checks every cached signature against a recomputed one
+bool IsCacheFullKeyEnable();
+
+void SetCacheFullKeyEnable(bool enable);
+
+// Returns false and drops the cached signature if it no longer matches the fields of tensor.
+bool CheckTensorSignature(const aclTensor* tensor);
+
+} // namespace internal
+} // namespace op
+
+#endif // OP_API_OP_API_COMMON_INC_TENSOR_SIGNATURE_H_
@@ -117,6 +117,9 @@ struct OpThreadLocalContext {
     bool cacheHasFull_{false};
     const char* cacheApi_{nullptr};
     aclOpExecutor* executor_{nullptr};
+    // set by aclOpExecutor::Run for the launch whose memset / overflow check is done once for the whole Run
+    bool memSetFused_{false};
+    bool overflowCheckDeferred_{false};
 };
 
 OpThreadLocalContext& GetThreadLocalContext();
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_info_bin_record.h"
+#include <cstring>
+#include <unistd.h>
+#include "dump/adump_pub.h"
+#include "mmpa/mmpa_api.h"
+#include "graph/utils/type_utils.h"
+#include "opdev/op_log.h"
+#include "opdev/op_errno.h"
+
+namespace aclnnOpInfoRecord {
+namespace {
+constexpr size_t kEnvBufLen = 16U;
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+constexpr int HEX_WIDTH = 16;
+
+uint64_t ContentHash(const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = kFnvOffsetBasis;
+    for (size_t i = 0U; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    // the size is mixed in so that contents differ only in trailing zeros do not collide
+    hash ^= static_cast<uint64_t>(size);
+    hash *= kFnvPrime;
+    return hash;
+}
+
+std::string HashToString(uint64_t hash)
+{
+    char buf[HEX_WIDTH + 1] = {0};
+    (void)snprintf(buf, sizeof(buf), "%016lx", static_cast<unsigned long>(hash));
+    return std::string(buf);
+}
+
+template <typename T>
+void AppendValue(std::string& buffer, T value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+bool ReadBinFormatEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_OP_INFO_RECORD_FORMAT", &buf[0U], kEnvBufLen) != EN_OK) {
+        return false;
+    }
+    return strcmp(buf, "bin") == 0;
+}
+} // namespace
+
+OpInfoBinRecorder& OpInfoBinRecorder::Instance()
+{
+    static OpInfoBinRecorder instance;
+    return instance;
+}
+
+OpInfoBinRecorder::OpInfoBinRecorder() { SetEnable(ReadBinFormatEnable()); }
+
+nlohmann::json OpInfoBinRecorder::AddConstData(ge::DataType dtype, const void* addr, size_t size)
+{
+    uint64_t hash = ContentHash(addr, size);
+    {
+        std::lock_guard<std::mutex> lck(mutex_);
+        if (!IsRecorded(blobContents_, hash, addr, size)) {
+            AppendRecord(OpInfoBinRecordType::BLOB, 0U, hash, addr, size);
+            stats_.blobs++;
+        } else {
+            stats_.duplicateBlobs++;
+        }
+    }
+    nlohmann::json ref;
+    ref["dtype"] = ge::TypeUtils::DataTypeToSerialString(dtype);
+    ref["size"] = size;
+    ref["hash"] = HashToString(hash);
+    return ref;
+}
+
+void OpInfoBinRecorder::AddOpRecord(const nlohmann::json& opJson, uint32_t flags)
+{
+    const std::string payload = opJson.dump();
+    uint64_t hash = ContentHash(payload.data(), payload.size());
+    std::lock_guard<std::mutex> lck(mutex_);
+    if (IsRecorded(recordContents_, hash, payload.data(), payload.size())) {
+        stats_.duplicateRecords++;
+        return;
+    }
+    AppendRecord(OpInfoBinRecordType::OP, flags, hash, payload.data(), payload.size());
+    stats_.records++;
+}
+
+bool OpInfoBinRecorder::IsRecorded(std::unordered_map<uint64_t, std::string>& contents, uint64_t& hash,
+                                   const void* data, size_t size)
+{
+    // a hash hit only counts when the bytes match as well, otherwise probe the next hash for this content
+    while (true) {
+        const auto iter = contents.find(hash);
+        if (iter == contents.end()) {
+            contents.emplace(hash, std::string(static_cast<const char*>(data), size));
+            return false;
+        }
+        if ((iter->second.size() == size) && (memcmp(iter->second.data(), data, size) == 0)) {
+            return true;
+        }
+        OP_LOGW("Op info content hash %s collides, size %zu vs recorded %zu.", HashToString(hash).c_str(), size,
+                iter->second.size());
+        stats_.hashCollisions++;
+        hash++;
+    }
+}
+
+void OpInfoBinRecorder::AppendRecord(OpInfoBinRecordType type, uint32_t flags, uint64_t hash, const void* data,
+                                     size_t size)
+{
+    if (!fileCreated_ && buffer_.empty()) {
+        fileName_ = std::to_string(getpid()) + "_bin/op_info_" + std::to_string(fileCnt_) + ".bin";
+        AppendValue(buffer_, kOpInfoBinMagic);
+        AppendValue(buffer_, kOpInfoBinVersion);
+        AppendValue(buffer_, static_cast<uint32_t>(getpid()));
+        AppendValue(buffer_, 0U);
+    }
+    AppendValue(buffer_, static_cast<uint32_t>(type));
+    AppendValue(buffer_, flags);
+    AppendValue(buffer_, hash);
+    AppendValue(buffer_, static_cast<uint64_t>(size));
+    buffer_.append(static_cast<const char*>(data), size);
+    if (buffer_.size() >= kFlushThreshold) {
+        (void)WriteBuffer();
+    }
+}
+
+int32_t OpInfoBinRecorder::WriteBuffer()
+{
+    if (buffer_.empty()) {
+        return 0;
+    }
+    const Adx::SaveType saveType = fileCreated_ ? Adx::SaveType::APPEND : Adx::SaveType::OVERWRITE;
+    const int32_t ret = Adx::AdumpSaveToFile(buffer_.data(), buffer_.size(), fileName_.c_str(), saveType);
+    if (ret != 0) {
+        OP_LOGE(ACLNN_ERR_INNER, "Write %zu bytes to op info file %s failed.", buffer_.size(), fileName_.c_str());
+    } else {
+        stats_.writtenBytes += buffer_.size();
+    }
+    fileCreated_ = true;
+    stats_.flushes++;
+    buffer_.clear();
+    return (ret == 0) ? 0 : -1;
+}
+
+int32_t OpInfoBinRecorder::Flush()
+{
+    std::lock_guard<std::mutex> lck(mutex_);
+    const int32_t ret = WriteBuffer();
+    if (fileCreated_) {
+        OP_LOGI("Op info record file %s closed, %lu records, %lu blobs.", fileName_.c_str(), stats_.records,
+                stats_.blobs);
+        fileCnt_++;
+    }
+    fileCreated_ = false;
+    recordContents_.clear();
+    blobContents_.clear();
+    // release the memory of the largest buffer of this file
+    std::string().swap(buffer_);
+    return ret;
+}
+
+OpInfoBinRecordStats OpInfoBinRecorder::GetStats() const
+{
+    std::lock_guard<std::mutex> lck(mutex_);
+    return stats_;
+}
+} // namespace aclnnOpInfoRecord
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file op_info_bin_record.h
+ */
+#ifndef __OP_INFO_RECORD_OP_INFO_BIN_RECORD_H__
+#define __OP_INFO_RECORD_OP_INFO_BIN_RECORD_H__
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+#include "graph/types.h"
+
+namespace aclnnOpInfoRecord {
+/*
+ * Binary op info file, converted to the json files of OpInfoDump by scripts/util/op_info_bin_to_json.py.
+ * All integers are little endian.
+ *   file header: magic(uint32) version(uint32) pid(uint32) reserved(uint32)
+ *   record:      type(uint32) flags(uint32) hash(uint64) length(uint64) payload[length]
+ * OP record payload is the compact json of one op, a value depend input keeps its content in a BLOB record and
+ * refers to it by {"dtype", "size", "hash"} in "const_data". BLOB record payload is the raw tensor bytes.
+ * Records and blobs with the same content are written once per file. When different contents hit the same hash,
+ * the later one is written with the next free hash so that the hash still identifies a single blob in the file.
+ */
+constexpr uint32_t kOpInfoBinMagic = 0x52494F41U; // "AOIR"
+constexpr uint32_t kOpInfoBinVersion = 1U;
+
+enum class OpInfoBinRecordType : uint32_t { OP = 1, BLOB = 2 };
+
+enum OpInfoBinRecordFlag : uint32_t {
+    OP_INFO_BIN_FLAG_OP_INFO = 1U,        // dumped to <pid>/, op type in white list
+    OP_INFO_BIN_FLAG_OP_COMPILE = 1U << 1 // dumped to <pid>_opcompile/, op type not in black list
+};
+
+struct OpInfoBinRecordStats {
+    uint64_t records{0};          // op records written
+    uint64_t duplicateRecords{0}; // op records skipped as the same record was written
+    uint64_t blobs{0};            // tensor blobs written
+    uint64_t duplicateBlobs{0};   // tensor blobs skipped as the same content was written
+    uint64_t hashCollisions{0};   // hash hits whose content differs from the recorded one
+    uint64_t writtenBytes{0};     // bytes handed to adump
+    uint64_t flushes{0};
+};
+
+/*
+ * Streaming recorder used instead of the json sets of OpInfoSerialize when ACLNN_OP_INFO_RECORD_FORMAT=bin.
+ * Records are appended to a buffer that is written to <pid>_bin/op_info_<n>.bin every kFlushThreshold bytes,
+ * so the buffer held does not grow with the number of recorded ops. The distinct contents of the current file are
+ * kept until Flush to verify hash hits byte by byte.
+ */
+class OpInfoBinRecorder {
+public:
+    static OpInfoBinRecorder& Instance();
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void SetEnable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+
+    // Saves the tensor content as a blob and returns the reference stored as "const_data".
+    nlohmann::json AddConstData(ge::DataType dtype, const void* addr, size_t size);
+
+    void AddOpRecord(const nlohmann::json& opJson, uint32_t flags);
+
+    // Writes the buffered records and closes the current file, the next record starts a new file.
+    int32_t Flush();
+
+    OpInfoBinRecordStats GetStats() const;
+
+private:
+    OpInfoBinRecorder();
+    ~OpInfoBinRecorder() = default;
+
+    bool IsRecorded(std::unordered_map<uint64_t, std::string>& contents, uint64_t& hash, const void* data,
+                    size_t size);
+    void AppendRecord(OpInfoBinRecordType type, uint32_t flags, uint64_t hash, const void* data, size_t size);
+    int32_t WriteBuffer();
+
+    static constexpr size_t kFlushThreshold = 4U * 1024U * 1024U;
+
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    std::string buffer_;
+    std::string fileName_;
+    uint32_t fileCnt_{0U};
+    bool fileCreated_{false};
+    std::unordered_map<uint64_t, std::string> recordContents_;
+    std::unordered_map<uint64_t, std::string> blobContents_;
+    OpInfoBinRecordStats stats_;
+};
+} // namespace aclnnOpInfoRecord
+#endif // __OP_INFO_RECORD_OP_INFO_BIN_RECORD_H__
@@ -18,6 +18,7 @@
 #include "opdev/op_errno.h"
 #include "platform/platform_info.h"
 #include "tiling_context_to_json.h"
+#include "op_info_bin_record.h"
 #include "ini_parse.h"
 
 namespace aclnnOpInfoRecord {
@@ -202,11 +203,26 @@ void AddJsonToOpInfo(const nlohmann::json& opJson)
 
 void AddJsonToOpInfoDebug(const nlohmann::json& opJson) { g_opInfoStatisticsDebug.emplace(opJson); }
 
+void AddJsonToOpInfoBin(const nlohmann::json& opJson)
+{
+    // the op compile json is the same as the others without "bin_type" and "bin_info", the converter removes them
+    uint32_t flags = 0U;
+    if (g_opTypeWhiteList.find(opJson["op_type"]) != g_opTypeWhiteList.cend()) {
+        flags |= OP_INFO_BIN_FLAG_OP_INFO;
+    }
+    if (g_opTypeBlackList.find(opJson["op_type"]) == g_opTypeBlackList.cend()) {
+        flags |= OP_INFO_BIN_FLAG_OP_COMPILE;
+    }
+    OpInfoBinRecorder::Instance().AddOpRecord(opJson, flags);
+}
+
 } // namespace
 
 int32_t OpInfoDump(void)
 {
     int32_t ret = 0;
+    // records of the binary format are already written except the last buffer
+    const int32_t binRet = OpInfoBinRecorder::Instance().IsEnabled() ? OpInfoBinRecorder::Instance().Flush() : 0;
     std::lock_guard<std::mutex> lck(g_opInfoStatisticsLck);
     OP_LOGI("Op info record start to dump %zu json!", g_opInfoStatistics.size());
     ret = DumpJson(g_opInfoStatistics, OpInfoType::OP_INFO);
@@ -217,7 +233,7 @@ int32_t OpInfoDump(void)
     OP_LOGI("Op info record start to dump %zu debug json!", g_opInfoStatisticsDebug.size());
     ret = DumpJson(g_opInfoStatisticsDebug, OpInfoType::OP_INFO_FOR_DEBUG);
     g_opInfoStatisticsDebug.clear();
-    return ret;
+    return (binRet != 0) ? binRet : ret;
 }
 
 /*
@@ -252,8 +268,15 @@ int32_t OpInfoSerialize(const gert::TilingContext* ctx, const aclnnOpInfoRecord:
             OP_LOGE(ACLNN_ERR_INNER, "Json %s does not contains supportInfo keyword.", builtInJsonPath.c_str());
             return -1;
         }
+        const bool binFormat = OpInfoBinRecorder::Instance().IsEnabled();
+        ConstDataHandler constDataHandler = nullptr;
+        if (binFormat) {
+            constDataHandler = [](ge::DataType dtype, const void* addr, size_t size) {
+                return OpInfoBinRecorder::Instance().AddConstData(dtype, addr, size);
+            };
+        }
         nlohmann::json jsonDebug = TilingContextToJson(ctx, iniConfigMap, builtInJsonConfig["supportInfo"],
-                                                       kernelInfo->isMc2);
+                                                       kernelInfo->isMc2, constDataHandler);
         if (jsonDebug.is_null()) {
             return 0;
         }
@@ -261,6 +284,12 @@ int32_t OpInfoSerialize(const gert::TilingContext* ctx, const aclnnOpInfoRecord:
         jsonDebug["impl_mode"] = opt.impl_mode;
         jsonDebug["deterministic"] = (opt.deterministic == 0U) ? "false" : "true";
         jsonDebug["deterministic_level"] = opt.deterministic;
+        if (binFormat) {
+            jsonDebug["bin_type"] = kernelInfo->bin_type;
+            jsonDebug["bin_info"] = kernelInfo->bin_info;
+            AddJsonToOpInfoBin(jsonDebug);
+            return 0;
+        }
         std::lock_guard<std::mutex> lck(g_opInfoStatisticsLck);
         AddJsonToOpInfoCompile(jsonDebug); // dump json for compile, not needed "bin_type" and "bin_info"
         jsonDebug["bin_type"] = kernelInfo->bin_type;
@@ -357,7 +357,8 @@ nlohmann::json TransOutputInstanceToJson(const gert::TilingContext* ctx, size_t&
 }
 
 aclnnStatus ConstructInputOutputJson(const gert::TilingContext* ctx, const nlohmann::json& supportInfoJsonConfig,
-                                     const gert::ComputeNodeInfo* computeNodeInfo, nlohmann::json& j)
+                                     const gert::ComputeNodeInfo* computeNodeInfo, nlohmann::json& j,
+                                     const ConstDataHandler& constDataHandler)
 {
     auto opImplFunc = GetOppImplement(computeNodeInfo->GetNodeType());
     OP_CHECK(
@@ -413,6 +414,8 @@ aclnnStatus ConstructInputOutputJson(const gert::TilingContext* ctx, const nlohm
                 if (tensorAddr == nullptr) {
                     OP_LOGW("Current operator [%s] is empty!", computeNodeInfo->GetNodeType());
                     tmpJ["const_data"] = "NULL";
+                } else if (constDataHandler != nullptr) {
+                    tmpJ["const_data"] = constDataHandler(dType, tensorAddr, inputSize);
                 } else {
                     tmpJ["const_data"] = funcIter->second(tensorAddr, inputSize);
                 }
@@ -567,7 +570,8 @@ void AddExtraInfoToOpJson(nlohmann::json& opJson, const nlohmann::json& attrs)
 
 nlohmann::json TilingContextToJson(const gert::TilingContext* ctx,
                                    const std::map<std::string, std::string>& iniConfigMap,
-                                   const nlohmann::json& supportInfoJsonConfig, bool isMc2)
+                                   const nlohmann::json& supportInfoJsonConfig, bool isMc2,
+                                   const ConstDataHandler& constDataHandler)
 {
     const auto computeNodeInfo = ctx->GetComputeNodeInfo();
     nlohmann::json nullJ(nullptr);
@@ -591,7 +595,7 @@ nlohmann::json TilingContextToJson(const gert::TilingContext* ctx,
         opJson["tune_mode"] = "all";
     }
 
-    auto ret = ConstructInputOutputJson(ctx, supportInfoJsonConfig, computeNodeInfo, opJson);
+    auto ret = ConstructInputOutputJson(ctx, supportInfoJsonConfig, computeNodeInfo, opJson, constDataHandler);
     if (ret != OK) {
         OP_LOGE(ACLNN_ERR_INNER, "Failed to construct input/output/attr.");
         return nullJ;
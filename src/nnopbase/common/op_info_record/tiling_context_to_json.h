@@ -13,14 +13,19 @@
  */
 #ifndef __OP_INFO_RECORD_TILING_CONTEXT_TO_JSON_H__
 #define __OP_INFO_RECORD_TILING_CONTEXT_TO_JSON_H__
+#include <functional>
 #include <nlohmann/json.hpp>
 
 #include "exe_graph/runtime/tiling_context.h"
 #include "graph/operator.h"
 
 namespace aclnnOpInfoRecord {
+// Returns the json saved as "const_data" of a value depend input, the content is converted by BIN_TO_JSON if not set.
+using ConstDataHandler = std::function<nlohmann::json(ge::DataType dtype, const void* addr, size_t size)>;
+
 nlohmann::json TilingContextToJson(const gert::TilingContext* ctx,
                                    const std::map<std::string, std::string>& iniConfigMap,
-                                   const nlohmann::json& supportInfoJsonConfig, bool isMc2);
+                                   const nlohmann::json& supportInfoJsonConfig, bool isMc2,
+                                   const ConstDataHandler& constDataHandler = nullptr);
 }
 #endif // __OP_INFO_RECORD_TILING_CONTEXT_TO_JSON_H__
\ No newline at end of file
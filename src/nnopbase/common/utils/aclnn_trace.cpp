@@ -0,0 +1,707 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "aclnn_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+#include "thread_local_context.h"
+
+namespace op {
+namespace internal {
+namespace {
+const char kTraceMagic[] = "ACLNNTRC";
+constexpr size_t kTraceMagicLen = 8U;
+constexpr size_t kTraceFlushSize = 64U * 1024U;
+constexpr size_t kRecordLenSize = sizeof(uint32_t);
+// offsets from the end of the name
+constexpr size_t kDurationOffset = sizeof(uint64_t);
+constexpr size_t kResultOffset = kDurationOffset + sizeof(uint64_t) + sizeof(int32_t) + sizeof(uint32_t);
+constexpr size_t kArgNumOffset = kResultOffset + sizeof(int32_t);
+constexpr size_t kNameOffset = kRecordLenSize + sizeof(uint8_t) * 2U + sizeof(uint16_t);
+
+std::atomic<uint32_t> gTraceThreadNum{0U};
+
+std::string GetTracePath()
+{
+    char path[MMPA_MAX_PATH] = {};
+    if (mmGetEnv("ACLNN_TRACE_FILE", &path[0U], MMPA_MAX_PATH) != EN_OK) {
+        return "";
+    }
+    std::string tracePath(path);
+    const size_t pos = tracePath.find("%p");
+    if (pos != std::string::npos) {
+        tracePath.replace(pos, 2U, std::to_string(getpid()));
+    }
+    return tracePath;
+}
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+template <typename T>
+void Append(std::string& buf, const T value)
+{
+    buf.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void Patch(std::string& buf, size_t pos, const T value)
+{
+    (void)memcpy(&buf[pos], &value, sizeof(T));
+}
+
+ThreadTraceBuffer& GetThreadTraceBuffer()
+{
+    static thread_local ThreadTraceBuffer buffer;
+    return buffer;
+}
+
+// The record being built on this thread, nullptr if there is none.
+ThreadTraceBuffer* GetActiveBuffer()
+{
+    if (!TraceRecorder::IsEnabled()) {
+        return nullptr;
+    }
+    ThreadTraceBuffer& buffer = GetThreadTraceBuffer();
+    return buffer.active ? &buffer : nullptr;
+}
+
+void BeginArg(ThreadTraceBuffer& buffer, TraceArgKind kind, bool isOutput)
+{
+    Append(buffer.pending, static_cast<uint8_t>(kind));
+    Append(buffer.pending, static_cast<uint8_t>(isOutput));
+    buffer.argNum++;
+}
+
+void AppendDims(std::string& buf, const op::Shape& shape)
+{
+    const size_t dimNum = shape.GetDimNum();
+    Append(buf, static_cast<uint8_t>(dimNum));
+    for (size_t i = 0U; i < dimNum; i++) {
+        Append(buf, shape.GetDim(i));
+    }
+}
+
+void AppendTensorDesc(std::string& buf, const aclTensor* tensor)
+{
+    Append(buf, static_cast<int32_t>(tensor->GetDataType()));
+    Append(buf, static_cast<int32_t>(tensor->GetViewFormat()));
+    Append(buf, tensor->GetViewOffset());
+    AppendDims(buf, tensor->GetViewShape());
+    const op::Strides& strides = tensor->GetViewStrides();
+    for (size_t i = 0U; i < tensor->GetViewShape().GetDimNum(); i++) {
+        Append(buf, i < strides.size() ? static_cast<int64_t>(strides[i]) : static_cast<int64_t>(0));
+    }
+    AppendDims(buf, tensor->GetStorageShape());
+}
+
+template <typename T, typename V>
+void AppendList(ThreadTraceBuffer& buffer, TraceArgKind kind, const V* values, uint64_t size, bool isOutput)
+{
+    BeginArg(buffer, kind, isOutput);
+    if (values == nullptr) {
+        size = 0U;
+    }
+    Append(buffer.pending, static_cast<uint32_t>(size));
+    for (uint64_t i = 0U; i < size; i++) {
+        Append(buffer.pending, static_cast<T>(values[i]));
+    }
+}
+
+class TraceParser {
+public:
+    TraceParser(const std::string& data, size_t pos, size_t end) : data_(data), pos_(pos), end_(end) {}
+
+    template <typename T>
+    bool Read(T& value)
+    {
+        if (end_ - pos_ < sizeof(T)) {
+            return false;
+        }
+        (void)memcpy(&value, &data_[pos_], sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(size_t len, std::string& value)
+    {
+        if (end_ - pos_ < len) {
+            return false;
+        }
+        value.assign(data_, pos_, len);
+        pos_ += len;
+        return true;
+    }
+
+    template <typename T, typename V>
+    bool ReadList(std::vector<V>& values)
+    {
+        uint32_t num = 0U;
+        if (!Read(num)) {
+            return false;
+        }
+        for (uint32_t i = 0U; i < num; i++) {
+            T value{};
+            if (!Read(value)) {
+                return false;
+            }
+            values.push_back(static_cast<V>(value));
+        }
+        return true;
+    }
+
+    bool ReadDims(std::vector<int64_t>& dims)
+    {
+        uint8_t dimNum = 0U;
+        if (!Read(dimNum)) {
+            return false;
+        }
+        dims.resize(dimNum);
+        for (auto& dim : dims) {
+            if (!Read(dim)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadTensor(TraceTensorDesc& desc)
+    {
+        if (!Read(desc.dtype) || !Read(desc.format) || !Read(desc.offset) || !ReadDims(desc.viewShape)) {
+            return false;
+        }
+        desc.strides.resize(desc.viewShape.size());
+        for (auto& stride : desc.strides) {
+            if (!Read(stride)) {
+                return false;
+            }
+        }
+        return ReadDims(desc.storageShape);
+    }
+
+    bool ReadArg(TraceArg& arg)
+    {
+        uint8_t kind = 0U;
+        uint8_t isOutput = 0U;
+        if (!Read(kind) || !Read(isOutput) || kind > static_cast<uint8_t>(TraceArgKind::UNKNOWN)) {
+            return false;
+        }
+        arg.kind = static_cast<TraceArgKind>(kind);
+        arg.isOutput = (isOutput != 0U);
+        int64_t intValue = 0;
+        double floatValue = 0.0;
+        int32_t dtype = 0;
+        uint32_t num = 0U;
+        switch (arg.kind) {
+            case TraceArgKind::TENSOR:
+                arg.tensors.emplace_back();
+                return ReadTensor(arg.tensors.back());
+            case TraceArgKind::TENSOR_LIST:
+                if (!Read(num)) {
+                    return false;
+                }
+                for (uint32_t i = 0U; i < num; i++) {
+                    uint8_t present = 0U;
+                    if (!Read(present)) {
+                        return false;
+                    }
+                    arg.present.push_back(present != 0U);
+                    if (present != 0U) {
+                        arg.tensors.emplace_back();
+                        if (!ReadTensor(arg.tensors.back())) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            case TraceArgKind::INT:
+            case TraceArgKind::BOOL:
+                arg.ints.push_back(intValue);
+                return Read(arg.ints.back());
+            case TraceArgKind::FLOAT:
+                arg.floats.push_back(floatValue);
+                return Read(arg.floats.back());
+            case TraceArgKind::SCALAR:
+                if (!Read(dtype) || !Read(floatValue)) {
+                    return false;
+                }
+                arg.ints.push_back(dtype);
+                arg.floats.push_back(floatValue);
+                return true;
+            case TraceArgKind::STRING:
+            case TraceArgKind::BYTES:
+                return Read(num) && ReadBytes(num, arg.bytes);
+            case TraceArgKind::INT_LIST:
+                return ReadList<int64_t>(arg.ints);
+            case TraceArgKind::FLOAT_LIST:
+                return ReadList<double>(arg.floats);
+            case TraceArgKind::BOOL_LIST:
+                return ReadList<uint8_t>(arg.ints);
+            default:
+                return true;
+        }
+    }
+
+    bool ReadRecord(TraceRecord& record)
+    {
+        uint8_t event = 0U;
+        uint8_t reserved = 0U;
+        uint16_t nameLen = 0U;
+        uint16_t argNum = 0U;
+        if (!Read(event) || !Read(reserved) || !Read(nameLen) || !ReadBytes(nameLen, record.name) ||
+            !Read(record.beginNs) || !Read(record.durationNs) || !Read(record.streamId) ||
+            !Read(record.threadIndex) || !Read(record.result) || !Read(argNum)) {
+            return false;
+        }
+        record.event = static_cast<TraceEvent>(event);
+        record.args.resize(argNum);
+        for (auto& arg : record.args) {
+            if (!ReadArg(arg)) {
+                return false;
+            }
+        }
+        return pos_ == end_;
+    }
+
+private:
+    const std::string& data_;
+    size_t pos_;
+    size_t end_;
+};
+} // namespace
+
+OpTraceSwitch opTraceSwitch;
+
+OpTraceSwitch::OpTraceSwitch() : recordFlag(!GetTracePath().empty()) {}
+
+ThreadTraceBuffer::ThreadTraceBuffer() : threadIndex(gTraceThreadNum++)
+{
+    TraceRecorder::Instance().Register(this);
+}
+
+ThreadTraceBuffer::~ThreadTraceBuffer()
+{
+    // unregistered first, so that the exit flush never sees a buffer being destroyed
+    TraceRecorder::Instance().Unregister(this);
+    const std::lock_guard<std::mutex> lock(mutex);
+    TraceRecorder::Instance().Write(data);
+}
+
+TraceRecorder& TraceRecorder::Instance()
+{
+    // Intentionally leaked: thread buffers are flushed into it until the very end of the process.
+    static TraceRecorder* instance = []() {
+        TraceRecorder* recorder = new TraceRecorder();
+        (void)std::atexit([]() { TraceRecorder::Instance().Flush(); });
+        return recorder;
+    }();
+    return *instance;
+}
+
+TraceRecorder::TraceRecorder() : path_(GetTracePath())
+{
+    if (!path_.empty()) {
+        OP_LOGI("record aclnn calls to %s.", path_.c_str());
+    }
+}
+
+void TraceRecorder::Reset(const std::string& path)
+{
+    Flush();
+    const std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ != nullptr) {
+        (void)fclose(file_);
+        file_ = nullptr;
+    }
+    path_ = path;
+    opened_ = false;
+    opTraceSwitch.recordFlag = !path.empty();
+}
+
+void TraceRecorder::OpenLocked()
+{
+    opened_ = true;
+    if (path_.empty()) {
+        return;
+    }
+    file_ = fopen(path_.c_str(), "wb");
+    if (file_ == nullptr) {
+        OP_LOGW("failed to open aclnn trace file %s, calls are not recorded.", path_.c_str());
+        return;
+    }
+    std::string header(kTraceMagic, kTraceMagicLen);
+    Append(header, kTraceVersion);
+    Append(header, static_cast<uint32_t>(0U));
+    (void)fwrite(header.data(), 1U, header.size(), file_);
+}
+
+void TraceRecorder::Write(std::string& data)
+{
+    if (data.empty()) {
+        return;
+    }
+    const std::lock_guard<std::mutex> lock(fileMutex_);
+    if (!opened_) {
+        OpenLocked();
+    }
+    if (file_ != nullptr && fwrite(data.data(), 1U, data.size(), file_) != data.size()) {
+        OP_LOGW("failed to write aclnn trace file %s.", path_.c_str());
+    }
+    data.clear();
+}
+
+void TraceRecorder::Flush()
+{
+    {
+        const std::lock_guard<std::mutex> lock(bufferMutex_);
+        for (auto buffer : buffers_) {
+            const std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            Write(buffer->data);
+        }
+    }
+    const std::lock_guard<std::mutex> lock(fileMutex_);
+    if (file_ != nullptr) {
+        (void)fflush(file_);
+    }
+}
+
+void TraceRecorder::Register(ThreadTraceBuffer* buffer)
+{
+    const std::lock_guard<std::mutex> lock(bufferMutex_);
+    buffers_.push_back(buffer);
+}
+
+void TraceRecorder::Unregister(ThreadTraceBuffer* buffer)
+{
+    const std::lock_guard<std::mutex> lock(bufferMutex_);
+    buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), buffer), buffers_.end());
+}
+
+void TraceRecorder::Begin(TraceEvent event, const char* name, const void* owner, aclrtStream stream)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    ThreadTraceBuffer& buffer = GetThreadTraceBuffer();
+    if (buffer.active && buffer.pending[kRecordLenSize] == static_cast<char>(TraceEvent::L2_GET_WORKSPACE)) {
+        return;
+    }
+    int32_t streamId = -1;
+    if (stream != nullptr && aclrtStreamGetId(stream, &streamId) != ACL_SUCCESS) {
+        streamId = -1;
+    }
+    const size_t nameLen = (name == nullptr) ? 0U : std::min(strlen(name), static_cast<size_t>(UINT16_MAX));
+    std::string& pending = buffer.pending;
+    pending.clear();
+    Append(pending, static_cast<uint32_t>(0U));
+    Append(pending, static_cast<uint8_t>(event));
+    Append(pending, static_cast<uint8_t>(0U));
+    Append(pending, static_cast<uint16_t>(nameLen));
+    pending.append(name == nullptr ? "" : name, nameLen);
+    buffer.beginNs = NowNs();
+    Append(pending, buffer.beginNs);
+    Append(pending, static_cast<uint64_t>(0U));
+    Append(pending, streamId);
+    Append(pending, buffer.threadIndex);
+    Append(pending, static_cast<int32_t>(0));
+    Append(pending, static_cast<uint16_t>(0U));
+    buffer.owner = owner;
+    buffer.argNum = 0U;
+    buffer.active = true;
+}
+
+void TraceRecorder::End(const void* owner)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr || buffer->owner != owner) {
+        return;
+    }
+    const uint64_t durationNs = NowNs() - buffer->beginNs;
+    std::string& pending = buffer->pending;
+    uint16_t nameLen = 0U;
+    (void)memcpy(&nameLen, &pending[kNameOffset - sizeof(uint16_t)], sizeof(uint16_t));
+    const size_t nameEnd = kNameOffset + nameLen;
+    Patch(pending, 0U, static_cast<uint32_t>(pending.size() - kRecordLenSize));
+    Patch(pending, nameEnd + kDurationOffset, durationNs);
+    Patch(pending, nameEnd + kArgNumOffset, buffer->argNum);
+    buffer->active = false;
+    buffer->owner = nullptr;
+
+    const std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->data.append(pending);
+    if (buffer->data.size() >= kTraceFlushSize) {
+        Instance().Write(buffer->data);
+    }
+}
+
+void TraceRecorder::SetResult(int32_t result)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    uint16_t nameLen = 0U;
+    (void)memcpy(&nameLen, &buffer->pending[kNameOffset - sizeof(uint16_t)], sizeof(uint16_t));
+    Patch(buffer->pending, kNameOffset + nameLen + kResultOffset, result);
+}
+
+void TraceRecorder::AddNull(bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+    }
+}
+
+void TraceRecorder::AddUnknown(bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        BeginArg(*buffer, TraceArgKind::UNKNOWN, isOutput);
+    }
+}
+
+void TraceRecorder::AddTensor(const aclTensor* tensor, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    if (tensor == nullptr) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+        return;
+    }
+    BeginArg(*buffer, TraceArgKind::TENSOR, isOutput);
+    AppendTensorDesc(buffer->pending, tensor);
+}
+
+void TraceRecorder::AddTensorList(const aclTensor* const* tensors, uint64_t size, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    if (tensors == nullptr && size > 0U) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+        return;
+    }
+    BeginArg(*buffer, TraceArgKind::TENSOR_LIST, isOutput);
+    Append(buffer->pending, static_cast<uint32_t>(size));
+    for (uint64_t i = 0U; i < size; i++) {
+        Append(buffer->pending, static_cast<uint8_t>(tensors[i] != nullptr));
+        if (tensors[i] != nullptr) {
+            AppendTensorDesc(buffer->pending, tensors[i]);
+        }
+    }
+}
+
+void TraceRecorder::AddInt(int64_t value, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        BeginArg(*buffer, TraceArgKind::INT, isOutput);
+        Append(buffer->pending, value);
+    }
+}
+
+void TraceRecorder::AddFloat(double value, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        BeginArg(*buffer, TraceArgKind::FLOAT, isOutput);
+        Append(buffer->pending, value);
+    }
+}
+
+void TraceRecorder::AddBool(bool value, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        BeginArg(*buffer, TraceArgKind::BOOL, isOutput);
+        Append(buffer->pending, static_cast<int64_t>(value));
+    }
+}
+
+void TraceRecorder::AddString(const char* value, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    if (value == nullptr) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+        return;
+    }
+    const size_t len = strlen(value);
+    BeginArg(*buffer, TraceArgKind::STRING, isOutput);
+    Append(buffer->pending, static_cast<uint32_t>(len));
+    buffer->pending.append(value, len);
+}
+
+void TraceRecorder::AddBytes(const void* data, size_t len, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    if (data == nullptr) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+        return;
+    }
+    BeginArg(*buffer, TraceArgKind::BYTES, isOutput);
+    Append(buffer->pending, static_cast<uint32_t>(len));
+    buffer->pending.append(static_cast<const char*>(data), len);
+}
+
+void TraceRecorder::AddIntList(const int64_t* values, uint64_t size, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        AppendList<int64_t>(*buffer, TraceArgKind::INT_LIST, values, size, isOutput);
+    }
+}
+
+void TraceRecorder::AddFloatList(const float* values, uint64_t size, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        AppendList<double>(*buffer, TraceArgKind::FLOAT_LIST, values, size, isOutput);
+    }
+}
+
+void TraceRecorder::AddBoolList(const bool* values, uint64_t size, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer != nullptr) {
+        AppendList<uint8_t>(*buffer, TraceArgKind::BOOL_LIST, values, size, isOutput);
+    }
+}
+
+void TraceRecorder::AddScalar(const aclScalar* scalar, bool isOutput)
+{
+    ThreadTraceBuffer* buffer = GetActiveBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    if (scalar == nullptr) {
+        BeginArg(*buffer, TraceArgKind::NULL_ARG, isOutput);
+        return;
+    }
+    BeginArg(*buffer, TraceArgKind::SCALAR, isOutput);
+    Append(buffer->pending, static_cast<int32_t>(scalar->GetDataType()));
+    Append(buffer->pending, scalar->ToDouble());
+}
+
+aclnnStatus ReadTraceFile(const std::string& path, std::vector<TraceRecord>& records)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    CHECK_COND(ifs.is_open(), ACLNN_ERR_PARAM_INVALID, "Open aclnn trace file %s failed.", path.c_str());
+    const std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    TraceParser header(data, 0U, data.size());
+    std::string magic;
+    uint32_t version = 0U;
+    uint32_t reserved = 0U;
+    CHECK_COND(header.ReadBytes(kTraceMagicLen, magic) && magic == std::string(kTraceMagic, kTraceMagicLen) &&
+                   header.Read(version) && header.Read(reserved) && version == kTraceVersion,
+               ACLNN_ERR_PARAM_INVALID, "%s is not an aclnn trace file of version %u.", path.c_str(), kTraceVersion);
+    size_t pos = kTraceMagicLen + sizeof(uint32_t) * 2U;
+    while (pos < data.size()) {
+        uint32_t recordLen = 0U;
+        TraceParser lenParser(data, pos, data.size());
+        CHECK_COND(lenParser.Read(recordLen) && data.size() - pos - kRecordLenSize >= recordLen,
+                   ACLNN_ERR_PARAM_INVALID, "Aclnn trace file %s is truncated at offset %zu.", path.c_str(), pos);
+        pos += kRecordLenSize;
+        TraceRecord record;
+        TraceParser parser(data, pos, pos + recordLen);
+        CHECK_COND(parser.ReadRecord(record), ACLNN_ERR_PARAM_INVALID,
+                   "Aclnn trace file %s has a broken record at offset %zu.", path.c_str(), pos);
+        records.emplace_back(std::move(record));
+        pos += recordLen;
+    }
+    return ACLNN_SUCCESS;
+}
+
+} // namespace internal
+
+void BeginL2Trace(const char* funcName)
+{
+    internal::TraceRecorder::Begin(internal::TraceEvent::L2_GET_WORKSPACE,
+                                   internal::GetThreadLocalContext().logInfo_.l2ApiName, funcName);
+}
+
+void EndL2Trace(const char* funcName) { internal::TraceRecorder::End(funcName); }
+
+void AddTensorToTrace(const aclTensor* const t, bool isOutput) { internal::TraceRecorder::AddTensor(t, isOutput); }
+
+void AddTensorToTrace(const aclTensorList* const t, bool isOutput)
+{
+    if (t == nullptr) {
+        internal::TraceRecorder::AddNull(isOutput);
+        return;
+    }
+    internal::TraceRecorder::AddTensorList(t->GetData(), t->Size(), isOutput);
+}
+
+void AddArrayToTrace(const aclIntArray* const array, bool isOutput)
+{
+    if (array == nullptr) {
+        internal::TraceRecorder::AddNull(isOutput);
+        return;
+    }
+    internal::TraceRecorder::AddIntList(array->GetData(), array->Size(), isOutput);
+}
+
+void AddArrayToTrace(const aclFloatArray* const array, bool isOutput)
+{
+    if (array == nullptr) {
+        internal::TraceRecorder::AddNull(isOutput);
+        return;
+    }
+    internal::TraceRecorder::AddFloatList(array->GetData(), array->Size(), isOutput);
+}
+
+void AddArrayToTrace(const aclBoolArray* const array, bool isOutput)
+{
+    if (array == nullptr) {
+        internal::TraceRecorder::AddNull(isOutput);
+        return;
+    }
+    internal::TraceRecorder::AddBoolList(array->GetData(), array->Size(), isOutput);
+}
+
+void AddScalarToTrace(const aclScalar* const scalar, bool isOutput)
+{
+    internal::TraceRecorder::AddScalar(scalar, isOutput);
+}
+
+void AddIntToTrace(int64_t value, bool isOutput) { internal::TraceRecorder::AddInt(value, isOutput); }
+
+void AddFloatToTrace(double value, bool isOutput) { internal::TraceRecorder::AddFloat(value, isOutput); }
+
+void AddBoolToTrace(bool value, bool isOutput) { internal::TraceRecorder::AddBool(value, isOutput); }
+
+void AddStringToTrace(const char* value, bool isOutput) { internal::TraceRecorder::AddString(value, isOutput); }
+
+void AddUnknownToTrace(bool isOutput) { internal::TraceRecorder::AddUnknown(isOutput); }
+
+} // namespace op
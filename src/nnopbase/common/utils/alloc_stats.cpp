@@ -0,0 +1,355 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "alloc_stats.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 32U;
+constexpr size_t kItemNum = static_cast<size_t>(AllocStatsItem::ITEM_NUM);
+constexpr unsigned long kMaxDumpIntervalSec = 86400UL;
+
+// counters of one thread, written by the thread itself and read by snapshots
+struct ThreadAllocCounters {
+    uint64_t tid{0};
+    std::atomic<uint64_t> items[kAllocStatsMaxClass][kItemNum]{};
+    std::atomic<int64_t> liveBytes{0};
+    std::atomic<uint64_t> lockContendedNum{0};
+    std::atomic<uint64_t> lockWaitNs{0};
+    std::atomic<uint64_t> sizes[kAllocSizeBucketNum]{};
+    std::atomic<bool> retired{false};
+};
+
+void AddCounters(ThreadAllocCounters& dst, const ThreadAllocCounters& src)
+{
+    for (size_t cls = 0U; cls < kAllocStatsMaxClass; cls++) {
+        for (size_t item = 0U; item < kItemNum; item++) {
+            dst.items[cls][item].fetch_add(src.items[cls][item].load(std::memory_order_relaxed),
+                                           std::memory_order_relaxed);
+        }
+    }
+    dst.liveBytes.fetch_add(src.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    dst.lockContendedNum.fetch_add(src.lockContendedNum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    dst.lockWaitNs.fetch_add(src.lockWaitNs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    for (size_t bucket = 0U; bucket < kAllocSizeBucketNum; bucket++) {
+        dst.sizes[bucket].fetch_add(src.sizes[bucket].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+void ClearCounters(ThreadAllocCounters& counters)
+{
+    for (size_t cls = 0U; cls < kAllocStatsMaxClass; cls++) {
+        for (size_t item = 0U; item < kItemNum; item++) {
+            counters.items[cls][item].store(0U, std::memory_order_relaxed);
+        }
+    }
+    counters.liveBytes.store(0, std::memory_order_relaxed);
+    counters.lockContendedNum.store(0U, std::memory_order_relaxed);
+    counters.lockWaitNs.store(0U, std::memory_order_relaxed);
+    for (size_t bucket = 0U; bucket < kAllocSizeBucketNum; bucket++) {
+        counters.sizes[bucket].store(0U, std::memory_order_relaxed);
+    }
+}
+
+AllocThreadStats GetThreadStats(const ThreadAllocCounters& counters)
+{
+    AllocThreadStats stats;
+    stats.tid = counters.tid;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    for (size_t cls = 0U; cls < kAllocStatsMaxClass; cls++) {
+        stats.allocNum += counters.items[cls][static_cast<size_t>(AllocStatsItem::ALLOC)].load(
+            std::memory_order_relaxed);
+        stats.freeNum += counters.items[cls][static_cast<size_t>(AllocStatsItem::FREE)].load(
+            std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+// block sizes are set during the static initialization of the BlockPool, keep them constant initialized
+std::array<size_t, kAllocStatsMaxClass> gClassSizes{};
+std::atomic<size_t> gClassNum{0U};
+std::atomic<uint32_t> gDumpIntervalSec{0U};
+
+// set when the thread local holder is destroyed, records of an exiting thread go to the exited counters
+thread_local bool tCountersRetired = false;
+
+struct ThreadCountersHolder {
+    ~ThreadCountersHolder()
+    {
+        if (counters != nullptr) {
+            counters->retired.store(true, std::memory_order_release);
+            counters = nullptr;
+        }
+        tCountersRetired = true;
+    }
+    std::shared_ptr<ThreadAllocCounters> counters;
+};
+
+class AllocStatsRegistry {
+public:
+    static AllocStatsRegistry& Instance()
+    {
+        // Intentionally leaked: blocks may still be freed by static destructors after the atexit shutdown.
+        static AllocStatsRegistry* instance = []() {
+            AllocStatsRegistry* registry = new AllocStatsRegistry();
+            (void)std::atexit([]() { AllocStatsRegistry::Instance().StopDumper(); });
+            return registry;
+        }();
+        return *instance;
+    }
+
+    ThreadAllocCounters& GetThreadCounters()
+    {
+        if (tCountersRetired) {
+            return exited_;
+        }
+        thread_local ThreadCountersHolder holder;
+        if (holder.counters == nullptr) {
+            holder.counters = std::make_shared<ThreadAllocCounters>();
+            holder.counters->tid = static_cast<uint64_t>(mmGetTid());
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                threads_.push_back(holder.counters);
+            }
+            if (gDumpIntervalSec.load(std::memory_order_relaxed) != 0U) {
+                StartDumper();
+            }
+        }
+        return *holder.counters;
+    }
+
+    void Snapshot(AllocStatsSnapshot& snapshot)
+    {
+        snapshot.enabled = AllocStats::IsEnabled();
+        const size_t classNum = std::min(gClassNum.load(std::memory_order_acquire), kAllocStatsMaxClass - 1U);
+        snapshot.classes.assign(classNum + 1U, AllocClassStats());
+        for (size_t cls = 0U; cls < classNum; cls++) {
+            snapshot.classes[cls].blockSize = gClassSizes[cls];
+        }
+        snapshot.threads.clear();
+        std::fill(std::begin(snapshot.sizes), std::end(snapshot.sizes), 0U);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        FoldRetired();
+        for (const auto& counters : threads_) {
+            AddToSnapshot(*counters, snapshot);
+            snapshot.threads.push_back(GetThreadStats(*counters));
+        }
+        AddToSnapshot(exited_, snapshot);
+        snapshot.exitedThreads = GetThreadStats(exited_);
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FoldRetired();
+        for (const auto& counters : threads_) {
+            ClearCounters(*counters);
+        }
+        ClearCounters(exited_);
+    }
+
+    void StartDumper()
+    {
+        std::lock_guard<std::mutex> lock(dumperMutex_);
+        if (dumper_.joinable() || shutdown_) {
+            return;
+        }
+        dumper_ = std::thread([this]() { DumperLoop(); });
+    }
+
+    void StopDumper()
+    {
+        std::thread dumper;
+        {
+            std::lock_guard<std::mutex> lock(dumperMutex_);
+            shutdown_ = true;
+            if (!dumper_.joinable()) {
+                return;
+            }
+            dumper = std::move(dumper_);
+        }
+        dumperCv_.notify_all();
+        dumper.join();
+    }
+
+private:
+    AllocStatsRegistry() = default;
+    ~AllocStatsRegistry() = default;
+
+    static void AddToSnapshot(const ThreadAllocCounters& counters, AllocStatsSnapshot& snapshot)
+    {
+        const size_t lastClass = snapshot.classes.size() - 1U;
+        for (size_t cls = 0U; cls < kAllocStatsMaxClass; cls++) {
+            // records of the classes over the table end up in the last one
+            AllocClassStats& dst = snapshot.classes[std::min(cls, lastClass)];
+            for (size_t item = 0U; item < kItemNum; item++) {
+                dst.items[item] += counters.items[cls][item].load(std::memory_order_relaxed);
+            }
+        }
+        snapshot.lockContendedNum += counters.lockContendedNum.load(std::memory_order_relaxed);
+        snapshot.lockWaitNs += counters.lockWaitNs.load(std::memory_order_relaxed);
+        for (size_t bucket = 0U; bucket < kAllocSizeBucketNum; bucket++) {
+            snapshot.sizes[bucket] += counters.sizes[bucket].load(std::memory_order_relaxed);
+        }
+    }
+
+    // called with mutex_ held
+    void FoldRetired()
+    {
+        auto it = std::remove_if(threads_.begin(), threads_.end(), [this](const auto& counters) {
+            if (!counters->retired.load(std::memory_order_acquire)) {
+                return false;
+            }
+            AddCounters(exited_, *counters);
+            return true;
+        });
+        threads_.erase(it, threads_.end());
+    }
+
+    void DumperLoop()
+    {
+        std::unique_lock<std::mutex> lock(dumperMutex_);
+        while (!shutdown_) {
+            const uint32_t interval = gDumpIntervalSec.load(std::memory_order_relaxed);
+            (void)dumperCv_.wait_for(lock, std::chrono::seconds(interval), [this]() { return shutdown_; });
+            if (shutdown_) {
+                break;
+            }
+            lock.unlock();
+            AllocStats::DumpToLog();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadAllocCounters>> threads_;
+    // counters of the exited threads, also taken directly by the records of a thread during its exit
+    ThreadAllocCounters exited_;
+
+    std::mutex dumperMutex_;
+    std::condition_variable dumperCv_;
+    std::thread dumper_;
+    bool shutdown_{false};
+};
+} // namespace
+
+std::atomic<bool> AllocStats::enabled_{false};
+
+void AllocStats::Add(AllocStatsItem item, size_t cls, uint64_t value)
+{
+    cls = std::min(cls, kAllocStatsMaxClass - 1U);
+    AllocStatsRegistry::Instance().GetThreadCounters().items[cls][static_cast<size_t>(item)].fetch_add(
+        value, std::memory_order_relaxed);
+}
+
+void AllocStats::AddLiveBytes(int64_t bytes)
+{
+    AllocStatsRegistry::Instance().GetThreadCounters().liveBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocStats::AddRequestSize(size_t size)
+{
+    AllocStatsRegistry::Instance().GetThreadCounters().sizes[GetAllocSizeBucket(size)].fetch_add(
+        1U, std::memory_order_relaxed);
+}
+
+void AllocStats::AddLockWait(uint64_t ns)
+{
+    ThreadAllocCounters& counters = AllocStatsRegistry::Instance().GetThreadCounters();
+    counters.lockContendedNum.fetch_add(1U, std::memory_order_relaxed);
+    counters.lockWaitNs.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void AllocStats::SetClassSizes(const std::vector<size_t>& sizes)
+{
+    const size_t classNum = std::min(sizes.size(), kAllocStatsMaxClass - 1U);
+    for (size_t i = 0U; i < classNum; i++) {
+        gClassSizes[i] = sizes[i];
+    }
+    gClassNum.store(classNum, std::memory_order_release);
+}
+
+void AllocStats::InitFromEnv()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_ALLOC_STATS", &buf[0U], kEnvBufLen) != EN_OK || buf[0U] == '\0') {
+        return;
+    }
+    char* end = nullptr;
+    const unsigned long interval = std::strtoul(&buf[0U], &end, 10);
+    if (end == &buf[0U] || *end != '\0' || interval == 0UL || interval > kMaxDumpIntervalSec) {
+        OP_LOGW("Invalid ACLNN_ALLOC_STATS %s, allocator statistics stay off.", buf);
+        return;
+    }
+    gDumpIntervalSec.store(static_cast<uint32_t>(interval), std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void AllocStats::GetSnapshot(AllocStatsSnapshot& snapshot) { AllocStatsRegistry::Instance().Snapshot(snapshot); }
+
+void AllocStats::Reset() { AllocStatsRegistry::Instance().Reset(); }
+
+void AllocStats::DumpToLog()
+{
+    AllocStatsSnapshot snapshot;
+    GetSnapshot(snapshot);
+    for (size_t cls = 0U; cls < snapshot.classes.size(); cls++) {
+        const AllocClassStats& stats = snapshot.classes[cls];
+        if (std::all_of(std::begin(stats.items), std::end(stats.items), [](uint64_t v) { return v == 0U; })) {
+            continue;
+        }
+        OP_EVENT("Alloc stats class %zu size %zu: alloc %lu free %lu pool_alloc %lu pool_free %lu malloc %lu "
+                 "malloc_bytes %lu cache_hit %lu refill %lu refill_block %lu flush %lu",
+                 cls, stats.blockSize, stats.Get(AllocStatsItem::ALLOC), stats.Get(AllocStatsItem::FREE),
+                 stats.Get(AllocStatsItem::POOL_ALLOC), stats.Get(AllocStatsItem::POOL_FREE),
+                 stats.Get(AllocStatsItem::MALLOC), stats.Get(AllocStatsItem::MALLOC_BYTES),
+                 stats.Get(AllocStatsItem::CACHE_HIT), stats.Get(AllocStatsItem::CACHE_REFILL),
+                 stats.Get(AllocStatsItem::CACHE_REFILL_BLOCK), stats.Get(AllocStatsItem::CACHE_FLUSH));
+    }
+    // same format as ACLNN_BLOCK_POOL_CLASSES, the BlockPool of the next run can derive its classes from it
+    std::string sizes;
+    for (size_t bucket = 0U; bucket < kAllocSizeBucketNum - 1U; bucket++) {
+        if (snapshot.sizes[bucket] != 0U) {
+            sizes += (sizes.empty() ? "" : ",") + std::to_string(GetAllocSizeBucketLimit(bucket)) + ":" +
+                     std::to_string(snapshot.sizes[bucket]);
+        }
+    }
+    OP_EVENT("Alloc stats sizes: %s, over 1MB %lu", sizes.c_str(), snapshot.sizes[kAllocSizeBucketNum - 1U]);
+    OP_EVENT("Alloc stats lock: contended %lu wait %lu ns", snapshot.lockContendedNum, snapshot.lockWaitNs);
+    for (const auto& thread : snapshot.threads) {
+        OP_EVENT("Alloc stats thread %lu: live %ld bytes alloc %lu free %lu", thread.tid, thread.liveBytes,
+                 thread.allocNum, thread.freeNum);
+    }
+    OP_EVENT("Alloc stats exited threads: live %ld bytes alloc %lu free %lu", snapshot.exitedThreads.liveBytes,
+             snapshot.exitedThreads.allocNum, snapshot.exitedThreads.freeNum);
+}
+
+void AllocStats::SetEnable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+
+void SetAllocStatsEnable(bool enable) { AllocStats::SetEnable(enable); }
+
+void GetAllocStats(AllocStatsSnapshot& snapshot) { AllocStats::GetSnapshot(snapshot); }
+
+} // namespace internal
+} // namespace op
@@ -0,0 +1,463 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "async_dump.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "exe_graph/runtime/tensor.h"
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 32U;
+constexpr size_t kSnapshotAlign = 512U;
+constexpr size_t kMbShift = 20U;
+
+size_t AlignSnapshotSize(size_t size) { return (size + kSnapshotAlign - 1U) / kSnapshotAlign * kSnapshotAlign; }
+
+bool ReadAsyncDumpEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_ASYNC_DUMP", &buf[0U], kEnvBufLen) != EN_OK) {
+        return false;
+    }
+    return strcmp(buf, "1") == 0;
+}
+
+size_t ReadAsyncDumpBudget()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_ASYNC_DUMP_BUDGET_MB", &buf[0U], kEnvBufLen) != EN_OK || buf[0U] == '\0') {
+        return kAsyncDumpDefaultBudgetMb << kMbShift;
+    }
+    char* end = nullptr;
+    const unsigned long long budgetMb = std::strtoull(&buf[0U], &end, 10);
+    if (end == &buf[0U] || *end != '\0' || budgetMb == 0ULL) {
+        OP_LOGW("Invalid ACLNN_ASYNC_DUMP_BUDGET_MB %s, use the default %zu MB.", buf, kAsyncDumpDefaultBudgetMb);
+        return kAsyncDumpDefaultBudgetMb << kMbShift;
+    }
+    return static_cast<size_t>(budgetMb) << kMbShift;
+}
+
+bool IsOnDevice(const Adx::TensorInfoV2& info)
+{
+    return info.placement != gert::kOnHost && info.placement != gert::kFollowing;
+}
+} // namespace
+
+AsyncDumper& AsyncDumper::Instance()
+{
+    // Intentionally leaked: the dump thread is stopped by the atexit hook, before the runtime is torn down.
+    static AsyncDumper* instance = []() {
+        AsyncDumper* dumper = new AsyncDumper();
+        (void)std::atexit([]() { AsyncDumper::Instance().Shutdown(); });
+        return dumper;
+    }();
+    return *instance;
+}
+
+AsyncDumper::AsyncDumper()
+{
+    SetMemoryBudget(ReadAsyncDumpBudget());
+    SetEnable(ReadAsyncDumpEnable());
+}
+
+void AsyncDumper::SetEnable(bool enable)
+{
+    if (shutdown_.load(std::memory_order_acquire)) {
+        return;
+    }
+    enabled_.store(enable, std::memory_order_release);
+    if (enable) {
+        StartWorker();
+    } else {
+        StopWorker();
+    }
+}
+
+bool AsyncDumper::Submit(const std::string& opType, const std::string& opName,
+                         const std::vector<Adx::TensorInfoV2>& tensors, aclrtStream stream)
+{
+    if (!IsEnabled()) {
+        return false;
+    }
+    for (const auto& info : tensors) {
+        if (!IsOnDevice(info)) {
+            return false;
+        }
+    }
+    aclmdlRICaptureStatus status = ACL_MODEL_RI_CAPTURE_STATUS_NONE;
+    aclmdlRI captureMdl = nullptr;
+    if ((aclmdlRICaptureGetInfo(stream, &status, &captureMdl) == ACL_SUCCESS) &&
+        (status == ACL_MODEL_RI_CAPTURE_STATUS_ACTIVE)) {
+        // the snapshot copies would be captured into the model, dump in place
+        return false;
+    }
+
+    DumpRequest request;
+    if (aclrtGetCurrentContext(&request.context) != ACL_SUCCESS) {
+        OP_LOGW("Get current context failed, dump synchronously.");
+        return false;
+    }
+    request.opType = opType;
+    request.opName = opName;
+    request.tensors = tensors;
+    for (const auto& info : tensors) {
+        request.bytes += AlignSnapshotSize(info.tensorSize);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SlotResult result = SlotResult::FULL;
+        if ((stats_.pendingNum < kAsyncDumpMaxQueueDepth) &&
+            (stats_.pendingBytes + request.bytes <= budget_.load(std::memory_order_relaxed))) {
+            result = AcquireSlot(request);
+        }
+        if (result == SlotResult::ERROR) {
+            return false;
+        }
+        if (result == SlotResult::FULL) {
+            stats_.dropped++;
+            stats_.droppedBytes += request.bytes;
+            OP_LOGW("Drop dump of %s, pending %zu requests %zu bytes, request %zu bytes.", opName.c_str(),
+                    stats_.pendingNum, stats_.pendingBytes, request.bytes);
+            return true;
+        }
+        stats_.pendingNum++;
+        stats_.pendingBytes += request.bytes;
+        stats_.peakPendingBytes = std::max(stats_.peakPendingBytes, stats_.pendingBytes);
+    }
+
+    bool queued = false;
+    const bool copied = Snapshot(request, stream);
+    if (copied) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // a dump thread being stopped would never see the request
+        if (worker_.joinable() && !stop_) {
+            request.seq = ++nextSeq_;
+            stats_.submitted++;
+            queue_.push_back(std::move(request));
+            queued = true;
+        }
+    }
+    if (queued) {
+        queueCv_.notify_one();
+        return true;
+    }
+
+    // copies queued before the failure still write the snapshot, its slot is reused only after they are done
+    const bool copyDone = copied ? (aclrtSynchronizeEvent(request.event) == ACL_SUCCESS) :
+                                  (aclrtSynchronizeStream(stream) == ACL_SUCCESS);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (copyDone) {
+        ReleaseSlot(request);
+    } else {
+        OP_LOGW("Synchronize stream failed, leak %zu bytes of dump snapshot.", request.bytes);
+    }
+    stats_.pendingNum--;
+    stats_.pendingBytes -= request.bytes;
+    return false;
+}
+
+bool AsyncDumper::Snapshot(DumpRequest& request, aclrtStream stream)
+{
+    size_t offset = 0U;
+    for (auto& info : request.tensors) {
+        if ((info.tensorSize == 0U) || (info.tensorAddr == nullptr)) {
+            continue;
+        }
+        void* dst = static_cast<uint8_t*>(request.snapshot) + offset;
+        if (aclrtMemcpyAsync(dst, info.tensorSize, info.tensorAddr, info.tensorSize, ACL_MEMCPY_DEVICE_TO_DEVICE,
+                             stream) != ACL_SUCCESS) {
+            OP_LOGW("Copy %zu bytes for dump snapshot failed, dump synchronously.", info.tensorSize);
+            return false;
+        }
+        info.tensorAddr = static_cast<int64_t*>(dst);
+        offset += AlignSnapshotSize(info.tensorSize);
+    }
+    return aclrtRecordEvent(request.event, stream) == ACL_SUCCESS;
+}
+
+bool AsyncDumper::ResetArena(SnapshotArena& arena, size_t size)
+{
+    if (arena.base != nullptr) {
+        (void)aclrtFree(arena.base);
+        arena.base = nullptr;
+        arena.size = 0U;
+    }
+    arena.head = 0U;
+    if (aclrtMalloc(&arena.base, size, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
+        arena.base = nullptr;
+        OP_LOGW("Malloc %zu bytes for dump snapshot arena failed, dump synchronously.", size);
+        return false;
+    }
+    arena.size = size;
+    OP_LOGI("Async dump snapshot arena of %zu bytes is allocated.", size);
+    return true;
+}
+
+AsyncDumper::SlotResult AsyncDumper::AcquireSlot(DumpRequest& request)
+{
+    auto& arena = arenas_[request.context];
+    if (arena.events.empty()) {
+        for (size_t i = 0U; i < kAsyncDumpEventPoolSize; i++) {
+            aclrtEvent event = nullptr;
+            if (aclrtCreateEventExWithFlag(&event, ACL_EVENT_SYNC) != ACL_SUCCESS) {
+                break;
+            }
+            arena.events.push_back(event);
+            arena.freeEvents.push_back(event);
+        }
+    }
+    if (arena.freeEvents.empty()) {
+        // every pooled event is in flight, the pool grows to the peak number of pending requests
+        aclrtEvent event = nullptr;
+        if (aclrtCreateEventExWithFlag(&event, ACL_EVENT_SYNC) != ACL_SUCCESS) {
+            return SlotResult::ERROR;
+        }
+        arena.events.push_back(event);
+        arena.freeEvents.push_back(event);
+    }
+
+    if (request.bytes > 0U) {
+        while (!arena.blocks.empty() && arena.blocks.front().released) {
+            arena.blocks.pop_front();
+        }
+        const size_t budget = budget_.load(std::memory_order_relaxed);
+        // the arena follows a new budget once it is idle
+        if (arena.blocks.empty() && (arena.size != budget) && !ResetArena(arena, budget)) {
+            return SlotResult::ERROR;
+        }
+        size_t offset = 0U;
+        if (arena.blocks.empty()) {
+            if (request.bytes > arena.size) {
+                return SlotResult::FULL;
+            }
+        } else {
+            const size_t tail = arena.blocks.front().offset;
+            if (arena.head > tail) {
+                // free space is [head, size) and [0, tail)
+                if (arena.head + request.bytes <= arena.size) {
+                    offset = arena.head;
+                } else if (request.bytes > tail) {
+                    return SlotResult::FULL;
+                }
+            } else if (arena.head + request.bytes <= tail) {
+                offset = arena.head;
+            } else {
+                return SlotResult::FULL;
+            }
+        }
+        arena.blocks.push_back({offset, request.bytes, false});
+        arena.head = offset + request.bytes;
+        request.snapshot = static_cast<uint8_t*>(arena.base) + offset;
+    }
+    request.event = arena.freeEvents.back();
+    arena.freeEvents.pop_back();
+    return SlotResult::OK;
+}
+
+void AsyncDumper::ReleaseSlot(DumpRequest& request)
+{
+    auto& arena = arenas_[request.context];
+    if (request.event != nullptr) {
+        arena.freeEvents.push_back(request.event);
+        request.event = nullptr;
+    }
+    if (request.snapshot == nullptr) {
+        return;
+    }
+    const size_t offset = static_cast<size_t>(static_cast<uint8_t*>(request.snapshot) -
+                                              static_cast<uint8_t*>(arena.base));
+    for (auto& block : arena.blocks) {
+        if (!block.released && (block.offset == offset)) {
+            block.released = true;
+            break;
+        }
+    }
+    while (!arena.blocks.empty() && arena.blocks.front().released) {
+        arena.blocks.pop_front();
+    }
+    if (arena.blocks.empty()) {
+        arena.head = 0U;
+    }
+    request.snapshot = nullptr;
+}
+
+void AsyncDumper::DestroyArenas()
+{
+    for (auto& item : arenas_) {
+        if (aclrtSetCurrentContext(item.first) != ACL_SUCCESS) {
+            continue;
+        }
+        for (aclrtEvent event : item.second.events) {
+            (void)aclrtDestroyEvent(event);
+        }
+        if (item.second.base != nullptr) {
+            (void)aclrtFree(item.second.base);
+        }
+    }
+    arenas_.clear();
+}
+
+bool AsyncDumper::GetDumpStream(aclrtContext context, aclrtStream& stream)
+{
+    const auto it = dumpStreams_.find(context);
+    if (it != dumpStreams_.end()) {
+        stream = it->second;
+        return true;
+    }
+    if (aclrtCreateStream(&stream) != ACL_SUCCESS) {
+        OP_LOGW("Create dump stream failed.");
+        return false;
+    }
+    dumpStreams_[context] = stream;
+    return true;
+}
+
+void AsyncDumper::ProcessBatch(std::vector<DumpRequest>& batch)
+{
+    uint64_t dumped = 0U;
+    uint64_t failed = 0U;
+    size_t begin = 0U;
+    while (begin < batch.size()) {
+        // requests of one context share a dump stream, which is synchronized once for all of them
+        const aclrtContext context = batch[begin].context;
+        size_t end = begin;
+        while ((end < batch.size()) && (batch[end].context == context)) {
+            end++;
+        }
+        aclrtStream dumpStream = nullptr;
+        const bool streamReady = (aclrtSetCurrentContext(context) == ACL_SUCCESS) && GetDumpStream(context, dumpStream);
+        for (size_t i = begin; i < end; i++) {
+            auto& request = batch[i];
+            if (!streamReady || (aclrtSynchronizeEvent(request.event) != ACL_SUCCESS)) {
+                failed++;
+                continue;
+            }
+            const int32_t res = Adx::AdumpDumpTensorV2(request.opType, request.opName, request.tensors, dumpStream);
+            OP_LOGD("Async AdumpDumpTensorV2 %s res = %d.", request.opName.c_str(), res);
+            (res == 0) ? dumped++ : failed++;
+        }
+        if (streamReady && (aclrtSynchronizeStream(dumpStream) != ACL_SUCCESS)) {
+            OP_LOGW("Synchronize dump stream failed.");
+        }
+        begin = end;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& request : batch) {
+            ReleaseSlot(request);
+        }
+        stats_.dumped += dumped;
+        stats_.failed += failed;
+        stats_.batches++;
+        for (const auto& request : batch) {
+            stats_.pendingNum--;
+            stats_.pendingBytes -= request.bytes;
+        }
+        doneSeq_ = batch.back().seq;
+    }
+    doneCv_.notify_all();
+}
+
+void AsyncDumper::WorkerLoop()
+{
+    std::vector<DumpRequest> batch;
+    batch.reserve(kAsyncDumpMaxBatchSize);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queueCv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                // stop is only honoured once everything queued has been dumped
+                break;
+            }
+            while (!queue_.empty() && (batch.size() < kAsyncDumpMaxBatchSize)) {
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+        }
+        ProcessBatch(batch);
+        batch.clear();
+    }
+}
+
+void AsyncDumper::StartWorker()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (worker_.joinable()) {
+        return;
+    }
+    stop_ = false;
+    worker_ = std::thread([this]() { WorkerLoop(); });
+}
+
+void AsyncDumper::StopWorker()
+{
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!worker_.joinable()) {
+            return;
+        }
+        stop_ = true;
+        worker = std::move(worker_);
+    }
+    queueCv_.notify_all();
+    worker.join();
+    doneCv_.notify_all();
+}
+
+void AsyncDumper::Flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    const uint64_t target = nextSeq_;
+    doneCv_.wait(lock, [this, target]() { return doneSeq_ >= target || !worker_.joinable(); });
+}
+
+void AsyncDumper::Shutdown()
+{
+    shutdown_.store(true, std::memory_order_release);
+    enabled_.store(false, std::memory_order_release);
+    StopWorker();
+    for (const auto& item : dumpStreams_) {
+        if (aclrtSetCurrentContext(item.first) == ACL_SUCCESS) {
+            (void)aclrtDestroyStream(item.second);
+        }
+    }
+    dumpStreams_.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    DestroyArenas();
+}
+
+AsyncDumpStats AsyncDumper::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void AsyncDumper::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t pendingNum = stats_.pendingNum;
+    const size_t pendingBytes = stats_.pendingBytes;
+    stats_ = AsyncDumpStats();
+    stats_.pendingNum = pendingNum;
+    stats_.pendingBytes = pendingBytes;
+    stats_.peakPendingBytes = pendingBytes;
+}
+
+} // namespace internal
+} // namespace op
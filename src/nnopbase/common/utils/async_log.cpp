@@ -0,0 +1,636 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "async_log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include "securec.h"
+#include "base/dlog_pub.h"
+#include "mmpa/mmpa_api.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kMaxSpecLen = 32U;
+constexpr size_t kMaxStarArgs = 2U;
+constexpr uint32_t kEnvBufLen = 8U;
+constexpr auto kWriterIdleWait = std::chrono::milliseconds(1);
+const char* const kNullStr = "(null)";
+
+struct FormatSpec {
+    size_t len{0U}; // length of the spec including the leading '%'
+    size_t starNum{0U};
+    AsyncLogArgType type{AsyncLogArgType::INT};
+    bool valid{false};
+};
+
+bool IsFlag(const char c) { return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0' || c == '\''; }
+
+bool IsDigit(const char c) { return c >= '0' && c <= '9'; }
+
+enum class LengthMod : uint8_t {
+    NONE = 0,
+    HH,
+    H,
+    L,
+    LL,
+    BIG_L,
+    Z,
+    J,
+    T
+};
+
+LengthMod ParseLengthMod(const char*& p)
+{
+    switch (*p) {
+        case 'h':
+            ++p;
+            if (*p == 'h') {
+                ++p;
+                return LengthMod::HH;
+            }
+            return LengthMod::H;
+        case 'l':
+            ++p;
+            if (*p == 'l') {
+                ++p;
+                return LengthMod::LL;
+            }
+            return LengthMod::L;
+        case 'q':
+            ++p;
+            return LengthMod::LL;
+        case 'L':
+            ++p;
+            return LengthMod::BIG_L;
+        case 'z':
+            ++p;
+            return LengthMod::Z;
+        case 'j':
+            ++p;
+            return LengthMod::J;
+        case 't':
+            ++p;
+            return LengthMod::T;
+        default:
+            return LengthMod::NONE;
+    }
+}
+
+bool IntegerArgType(const LengthMod mod, const bool isSigned, AsyncLogArgType& type)
+{
+    switch (mod) {
+        case LengthMod::NONE:
+        case LengthMod::HH:
+        case LengthMod::H:
+            type = isSigned ? AsyncLogArgType::INT : AsyncLogArgType::UINT;
+            return true;
+        case LengthMod::L:
+            type = isSigned ? AsyncLogArgType::LONG : AsyncLogArgType::ULONG;
+            return true;
+        case LengthMod::LL:
+            type = isSigned ? AsyncLogArgType::LLONG : AsyncLogArgType::ULLONG;
+            return true;
+        case LengthMod::Z:
+            type = AsyncLogArgType::SIZE;
+            return true;
+        case LengthMod::J:
+            type = isSigned ? AsyncLogArgType::INTMAX : AsyncLogArgType::UINTMAX;
+            return true;
+        case LengthMod::T:
+            type = AsyncLogArgType::PTRDIFF;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// spec points at the '%' of a conversion that is not "%%"
+FormatSpec ParseFormatSpec(const char* spec)
+{
+    FormatSpec result;
+    const char* p = spec + 1;
+    while (IsFlag(*p)) {
+        ++p;
+    }
+    if (*p == '*') {
+        ++result.starNum;
+        ++p;
+    } else {
+        while (IsDigit(*p)) {
+            ++p;
+        }
+    }
+    if (*p == '.') {
+        ++p;
+        if (*p == '*') {
+            ++result.starNum;
+            ++p;
+        } else {
+            while (IsDigit(*p)) {
+                ++p;
+            }
+        }
+    }
+    const LengthMod mod = ParseLengthMod(p);
+    const char conv = *p;
+    if (conv == '\0') {
+        return result;
+    }
+    ++p;
+    result.len = static_cast<size_t>(p - spec);
+    switch (conv) {
+        case 'd':
+        case 'i':
+            result.valid = IntegerArgType(mod, true, result.type);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            result.valid = IntegerArgType(mod, false, result.type);
+            break;
+        case 'c':
+            result.type = AsyncLogArgType::INT;
+            result.valid = (mod == LengthMod::NONE);
+            break;
+        case 's':
+            result.type = AsyncLogArgType::STR;
+            result.valid = (mod == LengthMod::NONE);
+            break;
+        case 'p':
+            result.type = AsyncLogArgType::PTR;
+            result.valid = (mod == LengthMod::NONE);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            result.type = AsyncLogArgType::DOUBLE;
+            result.valid = (mod == LengthMod::NONE || mod == LengthMod::L);
+            break;
+        default:
+            // %n, %ls, %Lf and unknown conversions are formatted on the caller thread
+            break;
+    }
+    result.valid = result.valid && (result.len < kMaxSpecLen);
+    return result;
+}
+
+uint32_t CopyStrToPool(AsyncLogRecord& record, const char* str)
+{
+    if (str == nullptr) {
+        str = kNullStr;
+    }
+    const uint32_t offset = record.strPoolUsed;
+    const size_t remain = kAsyncLogStrPoolSize - offset;
+    if (remain == 0U) {
+        // pool exhausted, reuse the terminating byte of the last copied string
+        return static_cast<uint32_t>(kAsyncLogStrPoolSize - 1U);
+    }
+    const size_t copyLen = strnlen(str, remain - 1U);
+    if (copyLen > 0U) {
+        (void)memcpy_s(&record.strPool[offset], remain, str, copyLen);
+    }
+    record.strPool[offset + copyLen] = '\0';
+    record.strPoolUsed = static_cast<uint16_t>(offset + copyLen + 1U);
+    return offset;
+}
+
+bool CaptureArg(AsyncLogRecord& record, const AsyncLogArgType type, va_list& args)
+{
+    if (record.argNum >= kAsyncLogMaxArgs) {
+        return false;
+    }
+    AsyncLogArg& arg = record.args[record.argNum++];
+    arg.type = type;
+    switch (type) {
+        case AsyncLogArgType::INT:
+            arg.u64 = static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int)));
+            break;
+        case AsyncLogArgType::UINT:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, unsigned int));
+            break;
+        case AsyncLogArgType::LONG:
+            arg.u64 = static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, long)));
+            break;
+        case AsyncLogArgType::ULONG:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, unsigned long));
+            break;
+        case AsyncLogArgType::LLONG:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, long long));
+            break;
+        case AsyncLogArgType::ULLONG:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, unsigned long long));
+            break;
+        case AsyncLogArgType::SIZE:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, size_t));
+            break;
+        case AsyncLogArgType::INTMAX:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, intmax_t));
+            break;
+        case AsyncLogArgType::UINTMAX:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, uintmax_t));
+            break;
+        case AsyncLogArgType::PTRDIFF:
+            arg.u64 = static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+            break;
+        case AsyncLogArgType::DOUBLE:
+            arg.f64 = va_arg(args, double);
+            break;
+        case AsyncLogArgType::PTR:
+            arg.ptr = va_arg(args, void*);
+            break;
+        case AsyncLogArgType::STR:
+            arg.strOffset = CopyStrToPool(record, va_arg(args, const char*));
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+bool CaptureArgs(AsyncLogRecord& record, const char* fmt, va_list& args)
+{
+    for (const char* p = fmt; *p != '\0'; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        if (*(p + 1) == '%') {
+            ++p;
+            continue;
+        }
+        const FormatSpec spec = ParseFormatSpec(p);
+        if (!spec.valid) {
+            return false;
+        }
+        for (size_t i = 0U; i < spec.starNum; ++i) {
+            if (!CaptureArg(record, AsyncLogArgType::INT, args)) {
+                return false;
+            }
+        }
+        if (!CaptureArg(record, spec.type, args)) {
+            return false;
+        }
+        p += spec.len - 1U;
+    }
+    return true;
+}
+
+template <typename T>
+int32_t FormatOne(char* out, const size_t len, const char* spec, const int32_t* stars, const size_t starNum,
+                  const T value)
+{
+    switch (starNum) {
+        case 0U:
+            return snprintf_s(out, len, len - 1U, spec, value);
+        case 1U:
+            return snprintf_s(out, len, len - 1U, spec, stars[0U], value);
+        default:
+            return snprintf_s(out, len, len - 1U, spec, stars[0U], stars[1U], value);
+    }
+}
+
+int32_t FormatArg(const AsyncLogRecord& record, const AsyncLogArg& arg, char* out, const size_t len,
+                  const char* spec, const int32_t* stars, const size_t starNum)
+{
+    switch (arg.type) {
+        case AsyncLogArgType::INT:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<int>(static_cast<int64_t>(arg.u64)));
+        case AsyncLogArgType::UINT:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<unsigned int>(arg.u64));
+        case AsyncLogArgType::LONG:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<long>(arg.u64));
+        case AsyncLogArgType::ULONG:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<unsigned long>(arg.u64));
+        case AsyncLogArgType::LLONG:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<long long>(arg.u64));
+        case AsyncLogArgType::ULLONG:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<unsigned long long>(arg.u64));
+        case AsyncLogArgType::SIZE:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<size_t>(arg.u64));
+        case AsyncLogArgType::INTMAX:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<intmax_t>(arg.u64));
+        case AsyncLogArgType::UINTMAX:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<uintmax_t>(arg.u64));
+        case AsyncLogArgType::PTRDIFF:
+            return FormatOne(out, len, spec, stars, starNum, static_cast<ptrdiff_t>(arg.u64));
+        case AsyncLogArgType::DOUBLE:
+            return FormatOne(out, len, spec, stars, starNum, arg.f64);
+        case AsyncLogArgType::PTR:
+            return FormatOne(out, len, spec, stars, starNum, arg.ptr);
+        case AsyncLogArgType::STR:
+            return FormatOne(out, len, spec, stars, starNum, &record.strPool[arg.strOffset]);
+        default:
+            return -1;
+    }
+}
+
+AsyncLogMode ReadAsyncLogMode()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_ASYNC_LOG", &buf[0U], kEnvBufLen) != EN_OK) {
+        return AsyncLogMode::DISABLE;
+    }
+    if (strcmp(buf, "1") == 0) {
+        return AsyncLogMode::DROP;
+    }
+    if (strcmp(buf, "2") == 0) {
+        return AsyncLogMode::BLOCK;
+    }
+    return AsyncLogMode::DISABLE;
+}
+
+struct AsyncLogRingHolder {
+    ~AsyncLogRingHolder()
+    {
+        if (ring != nullptr) {
+            ring->Retire();
+        }
+    }
+    std::shared_ptr<AsyncLogRing> ring;
+};
+
+// copy the format to the start of the pool, false if it leaves no room for the arguments
+bool CopyFmtToPool(AsyncLogRecord& record, const char* fmt)
+{
+    const size_t fmtLen = strnlen(fmt, kAsyncLogStrPoolSize);
+    if (fmtLen >= kAsyncLogStrPoolSize / 2U) {
+        return false;
+    }
+    (void)CopyStrToPool(record, fmt);
+    return true;
+}
+} // namespace
+
+bool CaptureAsyncLogRecord(AsyncLogRecord& record, int32_t moduleId, int32_t level, const char* fmt, va_list args)
+{
+    record.moduleId = moduleId;
+    record.level = level;
+    record.argNum = 0U;
+    record.strPoolUsed = 0U;
+    record.preformatted = false;
+
+    bool captured = CopyFmtToPool(record, fmt);
+    if (captured) {
+        va_list captureArgs;
+        va_copy(captureArgs, args);
+        captured = CaptureArgs(record, fmt, captureArgs);
+        va_end(captureArgs);
+    }
+    if (captured) {
+        return true;
+    }
+
+    record.preformatted = true;
+    record.argNum = 0U;
+    va_list formatArgs;
+    va_copy(formatArgs, args);
+    const int32_t ret = vsnprintf_s(record.strPool.data(), kAsyncLogStrPoolSize, kAsyncLogStrPoolSize - 1U, fmt,
+                                    formatArgs);
+    va_end(formatArgs);
+    if (ret < 0) {
+        // truncated, keep what fits
+        record.strPool[kAsyncLogStrPoolSize - 1U] = '\0';
+    }
+    return false;
+}
+
+size_t FormatAsyncLogRecord(const AsyncLogRecord& record, char* buf, size_t len)
+{
+    if (len == 0U) {
+        return 0U;
+    }
+    if (record.preformatted) {
+        const size_t copyLen = strnlen(record.strPool.data(), std::min(len - 1U, kAsyncLogStrPoolSize));
+        (void)memcpy_s(buf, len, record.strPool.data(), copyLen);
+        buf[copyLen] = '\0';
+        return copyLen;
+    }
+
+    size_t pos = 0U;
+    size_t argIdx = 0U;
+    const char* p = record.strPool.data();
+    while (*p != '\0' && pos + 1U < len) {
+        if (*p != '%') {
+            buf[pos++] = *p++;
+            continue;
+        }
+        if (*(p + 1) == '%') {
+            buf[pos++] = '%';
+            p += 2;
+            continue;
+        }
+        const FormatSpec spec = ParseFormatSpec(p);
+        if (!spec.valid || argIdx + spec.starNum >= record.argNum) {
+            break;
+        }
+        char specBuf[kMaxSpecLen] = {};
+        (void)memcpy_s(specBuf, kMaxSpecLen, p, spec.len);
+        int32_t stars[kMaxStarArgs] = {};
+        for (size_t i = 0U; i < spec.starNum; ++i) {
+            stars[i] = static_cast<int32_t>(static_cast<int64_t>(record.args[argIdx++].u64));
+        }
+        const int32_t ret = FormatArg(record, record.args[argIdx++], buf + pos, len - pos, specBuf, stars,
+                                      spec.starNum);
+        if (ret < 0) {
+            // output truncated by snprintf_s, the buffer is full
+            pos += strnlen(buf + pos, len - pos - 1U);
+            break;
+        }
+        pos += static_cast<size_t>(ret);
+        p += spec.len;
+    }
+    buf[pos] = '\0';
+    return pos;
+}
+
+AsyncLogger& AsyncLogger::Instance()
+{
+    // Intentionally leaked: logs may still be issued from static destructors after the atexit flush.
+    static AsyncLogger* instance = []() {
+        AsyncLogger* logger = new AsyncLogger();
+        (void)std::atexit([]() { AsyncLogger::Instance().Shutdown(); });
+        return logger;
+    }();
+    return *instance;
+}
+
+AsyncLogger::AsyncLogger() { SetMode(ReadAsyncLogMode()); }
+
+void AsyncLogger::SetMode(AsyncLogMode mode)
+{
+    if (shutdown_.load(std::memory_order_acquire)) {
+        return;
+    }
+    mode_.store(mode, std::memory_order_release);
+    if (mode == AsyncLogMode::DISABLE) {
+        StopWriter();
+        Flush();
+    } else {
+        StartWriter();
+    }
+}
+
+AsyncLogRing* AsyncLogger::GetThreadRing()
+{
+    thread_local AsyncLogRingHolder holder;
+    if (holder.ring == nullptr) {
+        holder.ring = std::make_shared<AsyncLogRing>();
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings_.push_back(holder.ring);
+        ringsGeneration_.fetch_add(1U, std::memory_order_release);
+    }
+    return holder.ring.get();
+}
+
+bool AsyncLogger::Record(int32_t moduleId, int32_t level, const char* fmt, va_list args)
+{
+    const AsyncLogMode mode = mode_.load(std::memory_order_acquire);
+    if (mode == AsyncLogMode::DISABLE) {
+        return false;
+    }
+    AsyncLogRing* ring = GetThreadRing();
+    AsyncLogRecord* slot = ring->AcquireSlot();
+    if (slot == nullptr) {
+        if (mode == AsyncLogMode::DROP) {
+            dropped_.fetch_add(1U, std::memory_order_relaxed);
+            return true;
+        }
+        blocked_.fetch_add(1U, std::memory_order_relaxed);
+        while ((slot = ring->AcquireSlot()) == nullptr) {
+            if (!IsEnabled()) {
+                return false;
+            }
+            writerCv_.notify_one();
+            std::this_thread::yield();
+        }
+    }
+    (void)CaptureAsyncLogRecord(*slot, moduleId, level, fmt, args);
+    ring->Publish();
+    recorded_.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+}
+
+size_t AsyncLogger::DrainRings()
+{
+    std::lock_guard<std::mutex> drainLock(drainMutex_);
+    const uint64_t generation = ringsGeneration_.load(std::memory_order_acquire);
+    if (generation != drainGeneration_) {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        drainSnapshot_ = rings_;
+        drainGeneration_ = generation;
+    }
+
+    char line[kAsyncLogLineSize];
+    size_t drained = 0U;
+    bool hasRetired = false;
+    for (const auto& ring : drainSnapshot_) {
+        const AsyncLogRecord* record = nullptr;
+        while ((record = ring->Front()) != nullptr) {
+            (void)FormatAsyncLogRecord(*record, line, kAsyncLogLineSize);
+            const int32_t moduleId = record->moduleId;
+            const int32_t level = record->level;
+            ring->Pop();
+            DlogRecord(moduleId, level, "%s", line);
+            ++drained;
+        }
+        hasRetired = hasRetired || ring->IsRetired();
+    }
+    written_.fetch_add(drained, std::memory_order_relaxed);
+
+    if (hasRetired) {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+                                    [](const std::shared_ptr<AsyncLogRing>& ring) {
+                                        return ring->IsRetired() && ring->Empty();
+                                    }),
+                     rings_.end());
+        drainSnapshot_ = rings_;
+        drainGeneration_ = ringsGeneration_.fetch_add(1U, std::memory_order_acq_rel) + 1U;
+    }
+    return drained;
+}
+
+void AsyncLogger::WriterLoop()
+{
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (DrainRings() == 0U) {
+            std::unique_lock<std::mutex> lock(writerMutex_);
+            // producers blocked on a full ring notify without the lock, a missed wakeup costs one idle period
+            (void)writerCv_.wait_for(lock, kWriterIdleWait);
+        }
+    }
+    (void)DrainRings();
+}
+
+void AsyncLogger::StartWriter()
+{
+    std::lock_guard<std::mutex> lock(writerMutex_);
+    if (writer_.joinable()) {
+        return;
+    }
+    stop_.store(false, std::memory_order_release);
+    writer_ = std::thread([this]() { WriterLoop(); });
+}
+
+void AsyncLogger::StopWriter()
+{
+    std::thread writer;
+    {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        if (!writer_.joinable()) {
+            return;
+        }
+        stop_.store(true, std::memory_order_release);
+        writer = std::move(writer_);
+    }
+    writerCv_.notify_all();
+    writer.join();
+}
+
+void AsyncLogger::Flush() { (void)DrainRings(); }
+
+void AsyncLogger::Shutdown()
+{
+    shutdown_.store(true, std::memory_order_release);
+    mode_.store(AsyncLogMode::DISABLE, std::memory_order_release);
+    StopWriter();
+    Flush();
+}
+
+AsyncLogStats AsyncLogger::GetStats() const
+{
+    AsyncLogStats stats;
+    stats.recorded = recorded_.load(std::memory_order_relaxed);
+    stats.written = written_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.blocked = blocked_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AsyncLogger::ResetStats()
+{
+    recorded_.store(0U, std::memory_order_relaxed);
+    written_.store(0U, std::memory_order_relaxed);
+    dropped_.store(0U, std::memory_order_relaxed);
+    blocked_.store(0U, std::memory_order_relaxed);
+}
+
+} // namespace internal
+} // namespace op
@@ -33,7 +33,8 @@ void DeAllocate(void* addr)
 {
     OP_CHECK(addr != nullptr, OP_LOGW("deAllocate addr is nullptr."), return);
     if (op::internal::BlockPool::InHugeMemRange(addr)) {
-        // since huge mem pool use offset, so free just a dummy operation
+        // huge mem pool use offset, free only updates the live count of the owner pool
+        ReleaseHugeAddr(addr);
     } else {
         op::internal::BlockCache::CacheFree(addr);
     }
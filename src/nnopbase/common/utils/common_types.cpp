@@ -21,6 +21,8 @@
 #include "opdev/op_arg_def.h"
 #include "opdev/common_types.h"
 #include "nnopbase_error_msg.h"
+#include "shape_future.h"
+#include "tensor_signature.h"
 using namespace std;
 
 aclStorage::aclStorage(void* addr) : addr_(addr) {}
@@ -384,6 +386,7 @@ aclTensor::aclTensor(const aclScalar* value, op::DataType dataType)
 
 aclTensor::~aclTensor()
 {
+    op::internal::DetachPendingShape(this);
     if (!isView_) {
         if (GetPlacement() == op::TensorPlacement::kOnHost) {
             auto addr = static_cast<char*>(storage_->GetAddr());
@@ -394,11 +397,23 @@ aclTensor::~aclTensor()
     op::internal::DeAllocate(tensor_);
 }
 
-const op::Shape& aclTensor::GetStorageShape() const { return tensor_->GetShape().GetStorageShape(); }
+const op::Shape& aclTensor::GetStorageShape() const
+{
+    op::internal::ResolvePendingShape(this);
+    return tensor_->GetShape().GetStorageShape();
+}
 
-const op::Shape& aclTensor::GetOriginalShape() const { return tensor_->GetShape().GetOriginShape(); }
+const op::Shape& aclTensor::GetOriginalShape() const
+{
+    op::internal::ResolvePendingShape(this);
+    return tensor_->GetShape().GetOriginShape();
+}
 
-const op::Shape& aclTensor::GetViewShape() const { return viewShape_; }
+const op::Shape& aclTensor::GetViewShape() const
+{
+    op::internal::ResolvePendingShape(this);
+    return viewShape_;
+}
 
 op::Format aclTensor::GetStorageFormat() const { return tensor_->GetFormat().GetStorageFormat(); }
 
@@ -406,9 +421,17 @@ op::Format aclTensor::GetOriginalFormat() const { return tensor_->GetFormat().Ge
 
 op::Format aclTensor::GetViewFormat() const { return viewFormat_; }
 
-const op::Strides& aclTensor::GetViewStrides() const { return viewStrides_; }
+const op::Strides& aclTensor::GetViewStrides() const
+{
+    op::internal::ResolvePendingShape(this);
+    return viewStrides_;
+}
 
-op::Tensor* aclTensor::GetTensor() const { return tensor_; }
+op::Tensor* aclTensor::GetTensor() const
+{
+    op::internal::ResolvePendingShape(this);
+    return tensor_;
+}
 
 void* aclTensor::GetData() const
 {
@@ -439,7 +462,11 @@ op::DataType aclTensor::GetDataType() const
 
 int64_t aclTensor::GetViewOffset() const { return viewOffset_; }
 
-void aclTensor::SetViewOffset(int64_t offset) const { viewOffset_ = offset; }
+void aclTensor::SetViewOffset(int64_t offset) const
+{
+    viewOffset_ = offset;
+    InvalidateSignature();
+}
 
 int64_t aclTensor::GetStorageOffset() const { return storage_->GetStorageOffset(); }
 
@@ -458,28 +485,53 @@ void aclTensor::SetFromWorkspace(bool from_workspace) const { storage_->SetFromW
 
 void aclTensor::SetStorageShape(const op::Shape& shape) const
 {
+    // a shape set explicitly must not be overwritten by a late deferred update
+    op::internal::DetachPendingShape(this);
     tensor_->MutableStorageShape() = shape;
     // tensor size need to resize when storage shape update
     tensor_->SetSize(op::CalcShapeBytes(tensor_->GetShapeSize(), tensor_->GetDataType()));
+    InvalidateSignature();
 }
 
-void aclTensor::SetOriginalShape(const op::Shape& shape) const { tensor_->MutableOriginShape() = shape; }
+void aclTensor::SetOriginalShape(const op::Shape& shape) const
+{
+    op::internal::DetachPendingShape(this);
+    tensor_->MutableOriginShape() = shape;
+}
 
 void aclTensor::SetViewShape(const op::Shape& shape)
 {
+    op::internal::DetachPendingShape(this);
     viewShape_ = shape;
     op::ToContiguousStrides(viewShape_, viewStrides_);
+    InvalidateSignature();
 }
 
-void aclTensor::SetStorageFormat(op::Format format) { tensor_->SetStorageFormat(format); }
+void aclTensor::SetStorageFormat(op::Format format)
+{
+    tensor_->SetStorageFormat(format);
+    InvalidateSignature();
+}
 
 void aclTensor::SetOriginalFormat(op::Format format) { tensor_->SetOriginFormat(format); }
 
-void aclTensor::SetViewFormat(op::Format format) { viewFormat_ = format; }
+void aclTensor::SetViewFormat(op::Format format)
+{
+    viewFormat_ = format;
+    InvalidateSignature();
+}
 
-void aclTensor::SetViewStrides(const op::Strides& strides) { viewStrides_ = strides; }
+void aclTensor::SetViewStrides(const op::Strides& strides)
+{
+    viewStrides_ = strides;
+    InvalidateSignature();
+}
 
-void aclTensor::SetViewStrides(op::Strides&& strides) { viewStrides_ = std::move(strides); }
+void aclTensor::SetViewStrides(op::Strides&& strides)
+{
+    viewStrides_ = std::move(strides);
+    InvalidateSignature();
+}
 
 bool aclTensor::IsView() const { return isView_; }
 
@@ -497,8 +549,26 @@ void* aclTensor::GetStorageAddr() const { return storage_->GetAddr(); }
 
 const aclStorage* aclTensor::GetStorage() const { return storage_; }
 
+uint64_t aclTensor::GetSignature() const
+{
+    // a pending shape future writes the shapes behind the setters
+    op::internal::ResolvePendingShape(this);
+    uint64_t signature = signature_.load(std::memory_order_relaxed);
+    if (signature == op::internal::kInvalidTensorSignature) {
+        signature = op::internal::CalcTensorSignature(this);
+        signature_.store(signature, std::memory_order_relaxed);
+    }
+    return signature;
+}
+
+void aclTensor::InvalidateSignature() const
+{
+    signature_.store(op::internal::kInvalidTensorSignature, std::memory_order_relaxed);
+}
+
 bool aclTensor::IsEmpty() const
 {
+    op::internal::ResolvePendingShape(this);
     bool isEmpty = false;
     for (size_t i = 0; i < viewShape_.GetDimNum(); i++) {
         if (viewShape_[i] == 0) {
@@ -513,6 +583,7 @@ void aclTensor::InitTensor(const int64_t* viewDims, uint64_t viewDimsNum, aclDat
                            int64_t offset, aclFormat format, const int64_t* storageDims, uint64_t storageDimsNum,
                            void* tensorDataAddr)
 {
+    op::internal::DetachPendingShape(this);
     if (viewDims && viewDimsNum) {
         op::ToShape(viewDims, viewDimsNum, viewShape_);
     }
@@ -550,6 +621,7 @@ void aclTensor::InitTensor(const int64_t* viewDims, uint64_t viewDimsNum, aclDat
             tensor_->MutableTensorData().SetAddr(tensorDataAddr, nullptr);
         }
     }
+    InvalidateSignature();
 }
 
 template <typename T, typename dataType>
@@ -671,6 +743,7 @@ void aclTensor::SetDataType(op::DataType dataType)
     if (needReSize) {
         tensor_->SetSize(op::CalcShapeBytes(tensor_->GetShapeSize(), dataType));
     }
+    InvalidateSignature();
 }
 
 void aclTensor::SetBoolData(const bool* value, uint64_t size, op::DataType dataType) { SetData(value, size, dataType); }
@@ -742,6 +815,7 @@ void aclTensor::SetHiFloat8Data(const op::HiFloat8* value, uint64_t size, op::Da
 
 ge::AscendString aclTensor::ToString() const
 {
+    op::internal::ResolvePendingShape(this);
     std::ostringstream oss;
     oss << GetData();
     std::string devicePtr = oss.str();
@@ -26,6 +26,8 @@
 #include "opdev/op_cache_container.h"
 #include "lock_free_queue.h"
 #include "bridge_dfx.h"
+#include "tensor_signature.h"
+#include "aclnn_trace.h"
 
 using namespace std;
 namespace op {
@@ -520,6 +522,16 @@ static void AddParamToBuf(const aclTensor* tensor, OpCacheThreadLocalData* tlsDa
     uint64_t& hashOffset = tlsData->hashOffset;
     AddAclTensorToCachedList(tensor, tlsData);
 
+    if (!IsCacheFullKeyEnable()) {
+        // the signature covers every field below, one word per tensor whatever its rank
+        if (CheckHashBufCapacity(hashOffset, sizeof(uint64_t)) == false) {
+            return;
+        }
+        uint64_t signature = tensor->GetSignature();
+        OpCacheAdd8Byte(&signature, hashBuf, hashOffset);
+        return;
+    }
+    (void)CheckTensorSignature(tensor);
     const op::Shape& viewShape = tensor->GetViewShape();
     const op::Strides& strides = tensor->GetViewStrides();
     const op::Shape& storageShape = tensor->GetStorageShape();
@@ -817,6 +829,7 @@ bool GetFromCache(aclOpExecutor** executor, uint64_t* workspaceSize)
         OpExecCacheWrap* cacheWrap = CreateCacheWrap(cache);
         *executor = reinterpret_cast<aclOpExecutor*>(cacheWrap);
         *workspaceSize = cache->GetWorkspaceSize();
+        TraceRecorder::SetResult(1);
         return true;
     }
     return false;
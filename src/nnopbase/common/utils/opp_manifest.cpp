@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "opp_manifest.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+#include "file_utils.h"
+
+namespace op {
+namespace internal {
+namespace {
+const std::string kManifestHeader = "aclnn_opp_manifest 1";
+constexpr char kDirTag = 'D';
+
+OppEntryType ToEntryType(unsigned char dType)
+{
+    if (dType == DT_REG) {
+        return OppEntryType::FILE;
+    }
+    if (dType == DT_DIR) {
+        return OppEntryType::DIR;
+    }
+    return OppEntryType::OTHER;
+}
+
+bool IsEntryType(char type)
+{
+    return type == static_cast<char>(OppEntryType::FILE) || type == static_cast<char>(OppEntryType::DIR) ||
+           type == static_cast<char>(OppEntryType::OTHER);
+}
+
+// an entry is a single name of the directory, a manifest must not lead a join out of it
+bool IsEntryName(const std::string& name)
+{
+    return !name.empty() && name != "." && name != ".." && name.find('/') == std::string::npos;
+}
+
+std::string JoinPath(const std::string& dir, const std::string& name)
+{
+    return (!dir.empty() && dir.back() == '/') ? (dir + name) : (dir + "/" + name);
+}
+} // namespace
+
+OppManifest& OppManifest::Instance()
+{
+    static OppManifest instance;
+    return instance;
+}
+
+OppManifest::OppManifest()
+{
+    char path[MMPA_MAX_PATH] = {};
+    if (mmGetEnv("ACLNN_OPP_MANIFEST", &path[0U], MMPA_MAX_PATH) == EN_OK) {
+        path_ = path;
+        OP_LOGI("list opp directories through manifest %s.", path_.c_str());
+    }
+}
+
+void OppManifest::Reset(const std::string& path)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    path_ = path;
+    dirs_.clear();
+    loaded_ = false;
+    dirty_ = false;
+}
+
+void OppManifest::Load()
+{
+    loaded_ = true;
+    std::ifstream ifs(path_);
+    if (!ifs.is_open()) {
+        OP_LOGI("opp manifest %s does not exist, it is generated after the directories are scanned.", path_.c_str());
+        return;
+    }
+    std::string line;
+    if (!std::getline(ifs, line) || line != kManifestHeader) {
+        OP_LOGW("opp manifest %s is of an unknown version, scan the directories instead.", path_.c_str());
+        dirty_ = true;
+        return;
+    }
+    bool broken = false;
+    while (!broken && std::getline(ifs, line)) {
+        std::istringstream dirLine(line);
+        char tag = '\0';
+        size_t entryNum = 0U;
+        DirRecord record;
+        std::string dir;
+        if (!(dirLine >> tag >> record.mtimeSec >> record.mtimeNsec >> entryNum) || tag != kDirTag ||
+            !std::getline(dirLine >> std::ws, dir) || dir.empty()) {
+            broken = true;
+            break;
+        }
+        record.entries.resize(entryNum);
+        for (auto& entry : record.entries) {
+            char type = '\0';
+            std::istringstream entryLine;
+            if (std::getline(ifs, line)) {
+                entryLine.str(line);
+            }
+            if (!(entryLine >> type >> entry.size >> entry.mtime) || !IsEntryType(type) ||
+                !std::getline(entryLine >> std::ws, entry.name) || !IsEntryName(entry.name)) {
+                broken = true;
+                break;
+            }
+            entry.type = static_cast<OppEntryType>(type);
+        }
+        if (!broken) {
+            dirs_[dir] = std::move(record);
+        }
+    }
+    if (broken) {
+        OP_LOGW("opp manifest %s is broken, scan the directories instead.", path_.c_str());
+        dirs_.clear();
+        dirty_ = true;
+        return;
+    }
+    OP_LOGI("load %zu directories from opp manifest %s.", dirs_.size(), path_.c_str());
+}
+
+bool OppManifest::ScanDir(const std::string& realDir, DirRecord& record) const
+{
+    DIR* dirp = opendir(realDir.c_str());
+    if (dirp == nullptr) {
+        return false;
+    }
+    struct dirent* dp = nullptr;
+    while ((dp = readdir(dirp)) != nullptr) {
+        OppManifestEntry entry;
+        entry.name = dp->d_name;
+        if (entry.name == "." || entry.name == "..") {
+            continue;
+        }
+        entry.type = ToEntryType(dp->d_type);
+        // sizes and mtimes are only recorded for the manifest, a plain listing needs no stat per file
+        if (IsEnabled() || dp->d_type == DT_UNKNOWN) {
+            struct stat st;
+            if (lstat(JoinPath(realDir, entry.name).c_str(), &st) == 0) {
+                entry.type = S_ISREG(st.st_mode) ? OppEntryType::FILE :
+                                                   (S_ISDIR(st.st_mode) ? OppEntryType::DIR : OppEntryType::OTHER);
+                entry.size = static_cast<uint64_t>(st.st_size);
+                entry.mtime = static_cast<int64_t>(st.st_mtim.tv_sec);
+            }
+        }
+        record.entries.emplace_back(std::move(entry));
+    }
+    closedir(dirp);
+    return true;
+}
+
+bool OppManifest::ListDir(const std::string& realDir, std::vector<OppManifestEntry>& entries)
+{
+    if (!IsEnabled()) {
+        DirRecord record;
+        if (!ScanDir(realDir, record)) {
+            return false;
+        }
+        entries = std::move(record.entries);
+        return true;
+    }
+
+    // the mtime is taken before the scan, a change during the scan makes the record stale rather than wrong
+    struct stat st;
+    if (stat(realDir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        return false;
+    }
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (!loaded_) {
+            Load();
+        }
+        const auto it = dirs_.find(realDir);
+        if (it != dirs_.end() && it->second.mtimeSec == static_cast<int64_t>(st.st_mtim.tv_sec) &&
+            it->second.mtimeNsec == static_cast<int64_t>(st.st_mtim.tv_nsec)) {
+            entries = it->second.entries;
+            return true;
+        }
+    }
+
+    DirRecord record;
+    record.mtimeSec = static_cast<int64_t>(st.st_mtim.tv_sec);
+    record.mtimeNsec = static_cast<int64_t>(st.st_mtim.tv_nsec);
+    if (!ScanDir(realDir, record)) {
+        return false;
+    }
+    entries = record.entries;
+    // names the text format can not hold are listed but never recorded
+    for (const auto& entry : record.entries) {
+        if (entry.name.find('\n') != std::string::npos || std::isspace(static_cast<unsigned char>(entry.name[0]))) {
+            return true;
+        }
+    }
+    OP_LOGD("opp directory %s is scanned, %zu entries.", realDir.c_str(), record.entries.size());
+    const std::lock_guard<std::mutex> lock(mutex_);
+    dirs_[realDir] = std::move(record);
+    dirty_ = true;
+    return true;
+}
+
+aclnnStatus OppManifest::Save()
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (!IsEnabled() || !dirty_) {
+        return ACLNN_SUCCESS;
+    }
+    // written aside and renamed, so that a concurrent process never reads a partial manifest
+    const std::string tmpPath = path_ + ".tmp." + std::to_string(getpid());
+    std::ofstream ofs(tmpPath, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+        OP_LOGW("failed to open %s, the opp manifest is not saved.", tmpPath.c_str());
+        return ACLNN_ERR_INNER;
+    }
+    ofs << kManifestHeader << "\n";
+    for (const auto& dir : dirs_) {
+        ofs << kDirTag << " " << dir.second.mtimeSec << " " << dir.second.mtimeNsec << " "
+            << dir.second.entries.size() << " " << dir.first << "\n";
+        for (const auto& entry : dir.second.entries) {
+            ofs << static_cast<char>(entry.type) << " " << entry.size << " " << entry.mtime << " " << entry.name
+                << "\n";
+        }
+    }
+    ofs.close();
+    if (ofs.fail() || rename(tmpPath.c_str(), path_.c_str()) != 0) {
+        OP_LOGW("failed to write opp manifest %s.", path_.c_str());
+        (void)remove(tmpPath.c_str());
+        return ACLNN_ERR_INNER;
+    }
+    dirty_ = false;
+    OP_LOGI("save %zu directories to opp manifest %s.", dirs_.size(), path_.c_str());
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus ListFilesBySuffix(const std::string& realDir, const std::string& suffix, std::vector<std::string>& names,
+                              std::vector<OppEntryType>* types)
+{
+    std::vector<OppManifestEntry> entries;
+    if (!OppManifest::Instance().ListDir(realDir, entries)) {
+        return ACLNN_ERR_INNER;
+    }
+    for (auto& entry : entries) {
+        const std::string& name = entry.name;
+        if (entry.type == OppEntryType::DIR || name.size() < suffix.size() ||
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        names.emplace_back(std::move(entry.name));
+        if (types != nullptr) {
+            types->push_back(entry.type);
+        }
+    }
+    return ACLNN_SUCCESS;
+}
+
+std::string RealEntryPath(const std::string& realDir, const std::string& name, OppEntryType type)
+{
+    if (!IsEntryName(name)) {
+        return "";
+    }
+    // entries of a real directory that are no links are real paths themselves
+    if (type == OppEntryType::OTHER) {
+        return RealPath(JoinPath(realDir, name));
+    }
+    return JoinPath(realDir, name);
+}
+
+} // namespace internal
+} // namespace op
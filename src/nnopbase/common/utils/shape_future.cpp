@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "shape_future.h"
+
+#include <cstring>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 8U;
+
+// the resolve callback writes shapes through the aclTensor getters, which must not re-enter the registry
+thread_local bool g_inShapeResolve = false;
+
+bool ReadDeferredShapeEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_AICPU_DEFERRED_SHAPE", &buf[0U], kEnvBufLen) != EN_OK) {
+        return false;
+    }
+    return strcmp(buf, "1") == 0;
+}
+
+std::atomic<bool> g_deferredShapeEnable{ReadDeferredShapeEnable()};
+} // namespace
+
+bool IsDeferredShapeEnable() { return g_deferredShapeEnable.load(std::memory_order_relaxed); }
+
+void SetDeferredShapeEnable(bool enable) { g_deferredShapeEnable.store(enable, std::memory_order_relaxed); }
+
+ShapeFuture::ShapeFuture(aclrtEvent event, const std::vector<aclTensor*>& tensors, ResolveFunc resolveFunc)
+    : event_(event), tensors_(tensors), detached_(tensors.size(), false), resolveFunc_(std::move(resolveFunc))
+{}
+
+ShapeFuture::~ShapeFuture()
+{
+    if (event_ != nullptr) {
+        (void)aclrtDestroyEvent(event_);
+        event_ = nullptr;
+    }
+}
+
+bool ShapeFuture::IsReady()
+{
+    if (IsResolved()) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (event_ == nullptr) {
+        return true;
+    }
+    aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+    if (aclrtQueryEventStatus(event_, &status) != ACL_SUCCESS) {
+        // let Wait() report the error
+        return true;
+    }
+    return status == ACL_EVENT_RECORDED_STATUS_COMPLETE;
+}
+
+aclnnStatus ShapeFuture::Wait()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (IsResolved()) {
+        return status_;
+    }
+    if (event_ != nullptr) {
+        const aclError ret = aclrtSynchronizeEvent(event_);
+        if (ret != ACL_SUCCESS) {
+            OP_LOGE(ACLNN_ERR_RUNTIME_ERROR, "synchronize shape event failed, ret %d.", ret);
+            status_ = ACLNN_ERR_RUNTIME_ERROR;
+        }
+        (void)aclrtDestroyEvent(event_);
+        event_ = nullptr;
+    }
+    if (status_ == ACLNN_SUCCESS && resolveFunc_ != nullptr) {
+        std::vector<aclTensor*> tensors(tensors_);
+        for (size_t i = 0U; i < tensors.size(); i++) {
+            if (detached_[i]) {
+                tensors[i] = nullptr;
+            }
+        }
+        g_inShapeResolve = true;
+        status_ = resolveFunc_(tensors);
+        g_inShapeResolve = false;
+    }
+    resolveFunc_ = nullptr;
+    resolved_.store(true, std::memory_order_release);
+    return status_;
+}
+
+void ShapeFuture::DetachTensor(const aclTensor* tensor)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0U; i < tensors_.size(); i++) {
+        if (tensors_[i] == tensor) {
+            detached_[i] = true;
+        }
+    }
+}
+
+ShapeFutureRegistry& ShapeFutureRegistry::Instance()
+{
+    static ShapeFutureRegistry registry;
+    return registry;
+}
+
+aclnnStatus ShapeFutureRegistry::Attach(const std::shared_ptr<ShapeFuture>& future)
+{
+    for (const auto tensor : future->GetTensors()) {
+        if (tensor != nullptr) {
+            CHECK_RET(Resolve(tensor) == ACLNN_SUCCESS, ACLNN_ERR_RUNTIME_ERROR);
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto tensor : future->GetTensors()) {
+        if (tensor != nullptr && futures_.emplace(tensor, future).second) {
+            pendingNum_.fetch_add(1U, std::memory_order_release);
+        }
+    }
+    return ACLNN_SUCCESS;
+}
+
+void ShapeFutureRegistry::Erase(const std::shared_ptr<ShapeFuture>& future)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto tensor : future->GetTensors()) {
+        auto it = futures_.find(tensor);
+        if (it != futures_.end() && it->second == future) {
+            futures_.erase(it);
+            pendingNum_.fetch_sub(1U, std::memory_order_release);
+        }
+    }
+}
+
+aclnnStatus ShapeFutureRegistry::Resolve(const aclTensor* tensor)
+{
+    if (g_inShapeResolve) {
+        return ACLNN_SUCCESS;
+    }
+    std::shared_ptr<ShapeFuture> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = futures_.find(tensor);
+        if (it == futures_.end()) {
+            return ACLNN_SUCCESS;
+        }
+        future = it->second;
+    }
+    // other tensors of the same launch stay registered until the shapes are written, so concurrent
+    // queries on them block in Wait() rather than reading stale shapes
+    const aclnnStatus ret = future->Wait();
+    Erase(future);
+    return ret;
+}
+
+size_t ShapeFutureRegistry::ResolveReady()
+{
+    std::vector<std::shared_ptr<ShapeFuture>> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& item : futures_) {
+            pending.push_back(item.second);
+        }
+    }
+    size_t resolved = 0U;
+    for (const auto& future : pending) {
+        if (future->IsResolved() || !future->IsReady()) {
+            continue;
+        }
+        (void)future->Wait();
+        Erase(future);
+        ++resolved;
+    }
+    return resolved;
+}
+
+aclnnStatus ShapeFutureRegistry::ResolveAll()
+{
+    std::vector<std::shared_ptr<ShapeFuture>> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& item : futures_) {
+            pending.push_back(item.second);
+        }
+    }
+    aclnnStatus ret = ACLNN_SUCCESS;
+    for (const auto& future : pending) {
+        const aclnnStatus status = future->Wait();
+        Erase(future);
+        if (status != ACLNN_SUCCESS) {
+            ret = status;
+        }
+    }
+    return ret;
+}
+
+void ShapeFutureRegistry::Detach(const aclTensor* tensor)
+{
+    // the resolve callback may write the shapes through the setters, which detach
+    if (g_inShapeResolve) {
+        return;
+    }
+    std::shared_ptr<ShapeFuture> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = futures_.find(tensor);
+        if (it == futures_.end()) {
+            return;
+        }
+        future = it->second;
+        futures_.erase(it);
+        pendingNum_.fetch_sub(1U, std::memory_order_release);
+    }
+    future->DetachTensor(tensor);
+}
+
+} // namespace internal
+} // namespace op
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "tensor_signature.h"
+
+#include <atomic>
+#include <cstring>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 8U;
+constexpr uint64_t kSignatureSeed = 0x9e3779b97f4a7c15ULL;
+constexpr uint64_t kMixMul1 = 0xff51afd7ed558ccdULL;
+constexpr uint64_t kMixMul2 = 0xc4ceb9fe1a85ec53ULL;
+constexpr uint32_t kMixShift = 33U;
+
+bool ReadCacheFullKeyEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_CACHE_FULL_KEY", &buf[0U], kEnvBufLen) != EN_OK) {
+        return false;
+    }
+    return strcmp(buf, "1") == 0;
+}
+
+std::atomic<bool> g_cacheFullKeyEnable{ReadCacheFullKeyEnable()};
+
+// finalizer of MurmurHash3, every input bit affects every output bit
+inline uint64_t Mix(uint64_t value)
+{
+    value ^= value >> kMixShift;
+    value *= kMixMul1;
+    value ^= value >> kMixShift;
+    value *= kMixMul2;
+    value ^= value >> kMixShift;
+    return value;
+}
+
+inline void Combine(uint64_t& hash, uint64_t value) { hash = Mix(hash ^ (value + kSignatureSeed)); }
+
+inline void CombineShape(uint64_t& hash, const op::Shape& shape)
+{
+    const size_t dimNum = shape.GetDimNum();
+    Combine(hash, dimNum);
+    for (size_t i = 0U; i < dimNum; i++) {
+        Combine(hash, static_cast<uint64_t>(shape.GetDim(i)));
+    }
+}
+} // namespace
+
+uint64_t CalcTensorSignature(const aclTensor* tensor)
+{
+    uint64_t hash = kSignatureSeed;
+    Combine(hash, static_cast<uint64_t>(tensor->GetDataType()));
+    CombineShape(hash, tensor->GetViewShape());
+    const op::Strides& strides = tensor->GetViewStrides();
+    Combine(hash, strides.size());
+    for (size_t i = 0U; i < strides.size(); i++) {
+        Combine(hash, static_cast<uint64_t>(strides[i]));
+    }
+    Combine(hash, static_cast<uint64_t>(tensor->GetViewOffset()));
+    Combine(hash, static_cast<uint64_t>(tensor->GetViewFormat()));
+    CombineShape(hash, tensor->GetStorageShape());
+    Combine(hash, static_cast<uint64_t>(tensor->GetStorageFormat()));
+    return (hash == kInvalidTensorSignature) ? kSignatureSeed : hash;
+}
+
+bool IsCacheFullKeyEnable() { return g_cacheFullKeyEnable.load(std::memory_order_relaxed); }
+
+void SetCacheFullKeyEnable(bool enable) { g_cacheFullKeyEnable.store(enable, std::memory_order_relaxed); }
+
+bool CheckTensorSignature(const aclTensor* tensor)
+{
+    const uint64_t cached = tensor->GetSignature();
+    const uint64_t actual = CalcTensorSignature(tensor);
+    if (cached == actual) {
+        return true;
+    }
+    OP_LOGW("aclTensor(%p) signature %lu is stale, actual %lu, tensor: %s", tensor, cached, actual,
+            tensor->ToString().GetString());
+    tensor->InvalidateSignature();
+    return false;
+}
+
+} // namespace internal
+} // namespace op
@@ -19,6 +19,62 @@ namespace op::internal {
 namespace {
 // Growth factor for capacity expansion (similar to std::vector)
 constexpr size_t GROWTH_FACTOR = 2;
+// Frame templates kept per thread, all of them are dropped when it is exceeded
+constexpr size_t MAX_FRAME_TEMPLATE_NUM = 64;
+constexpr size_t FRAME_HASH_SEED = 0x9e3779b9U;
+constexpr size_t NULL_ATTR_SIZE = static_cast<size_t>(-1);
+
+bool GetTensorInstanceNum(OpArg& arg, size_t& num)
+{
+    num = 0;
+    if (arg.type == OpArgType::OPARG_ACLTENSOR) {
+        num = (arg->pointer == nullptr) ? 0 : 1;
+        return true;
+    }
+    if (arg.type == OpArgType::OPARG_ACLTENSOR_LIST) {
+        auto* tensorList = reinterpret_cast<aclTensorList*>(arg->pointer);
+        if (tensorList != nullptr) {
+            for (size_t i = 0; i < tensorList->Size(); i++) {
+                num += ((*tensorList)[i] == nullptr) ? 0 : 1;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+// Size of the attr data that the layout depends on, 0 for the attrs of fixed size
+bool GetAttrLayoutSize(OpArg& arg, size_t& size)
+{
+    size = 0;
+    switch (arg.type) {
+        case OpArgType::OPARG_DATATYPE:
+        case OpArgType::OPARG_BOOL:
+        case OpArgType::OPARG_INT:
+        case OpArgType::OPARG_UINT:
+        case OpArgType::OPARG_IMPLMODE:
+        case OpArgType::OPARG_FLOAT:
+        case OpArgType::OPARG_DOUBLE:
+            return true;
+        case OpArgType::OPARG_STRING:
+            size = (arg->pointer == nullptr) ? NULL_ATTR_SIZE : strlen(static_cast<char*>(arg->pointer));
+            return true;
+        case OpArgType::OPARG_ACLSCALAR:
+            size = (arg->pointer == nullptr) ? NULL_ATTR_SIZE : static_cast<aclScalar*>(arg->pointer)->Size();
+            return true;
+        case OpArgType::OPARG_INT_LIST:
+            size = (arg->pointer == nullptr) ? 0 : static_cast<aclIntArray*>(arg->pointer)->Size();
+            return true;
+        case OpArgType::OPARG_FLOAT_LIST:
+            size = (arg->pointer == nullptr) ? 0 : static_cast<aclFloatArray*>(arg->pointer)->Size();
+            return true;
+        case OpArgType::OPARG_BOOL_LIST:
+            size = (arg->pointer == nullptr) ? 0 : static_cast<aclBoolArray*>(arg->pointer)->Size();
+            return true;
+        default:
+            return false;
+    }
+}
 } // anonymous namespace
 
 void KernelContextHolder::BuildComputeNodeInfo()
@@ -208,6 +264,14 @@ void KernelContextHolder::UpdateAttrDefOffset(size_t inoutNum, size_t attrNum)
 #endif
 }
 
+void KernelContextHolder::UpdateTensorSlot(size_t slot, const aclTensor* tensor)
+{
+    compileDesc_[slot].data_type_ = tensor->GetDataType();
+    compileDesc_[slot].storage_format_.SetOriginFormat(tensor->GetOriginalFormat());
+    compileDesc_[slot].storage_format_.SetStorageFormat(tensor->GetStorageFormat());
+    opInArg_[slot].data.pointer = tensor->GetTensor();
+}
+
 aclnnStatus KernelContextHolder::UpdateInputArg(size_t idx, const aclTensor* tensor)
 {
     if (tensor == nullptr) {
@@ -235,10 +299,7 @@ aclnnStatus KernelContextHolder::UpdateInputArg(size_t idx, const aclTensor* ten
 
     anchorInfo_[idx].instance_start_ = inputNum_;
     anchorInfo_[idx].instantiation_num_ = 1;
-    compileDesc_[inputNum_].data_type_ = tensor->GetDataType();
-    compileDesc_[inputNum_].storage_format_.SetOriginFormat(tensor->GetOriginalFormat());
-    compileDesc_[inputNum_].storage_format_.SetStorageFormat(tensor->GetStorageFormat());
-    opInArg_[inputNum_].data.pointer = tensor->GetTensor();
+    UpdateTensorSlot(inputNum_, tensor);
     inputNum_++;
     return ACLNN_SUCCESS;
 }
@@ -293,10 +354,7 @@ aclnnStatus KernelContextHolder::UpdateOutputArg(size_t idx, const aclTensor* te
 #ifdef DEBUG
     OP_LOGD("Update Output Arg Tensor: [%zu]. %s", idx, tensor->ToString().GetString());
 #endif
-    compileDesc_[inputNum_ + outputNum_].data_type_ = tensor->GetDataType();
-    compileDesc_[inputNum_ + outputNum_].storage_format_.SetOriginFormat(tensor->GetOriginalFormat());
-    compileDesc_[inputNum_ + outputNum_].storage_format_.SetStorageFormat(tensor->GetStorageFormat());
-    opInArg_[inputNum_ + outputNum_].data.pointer = tensor->GetTensor();
+    UpdateTensorSlot(inputNum_ + outputNum_, tensor);
     outputNum_++;
     return ACLNN_SUCCESS;
 }
@@ -385,6 +443,7 @@ void KernelContextHolder::ResetComputeNodeInfo(const char* opType, size_t irInpu
     attrNum_ = 0;
     irInputNum_ = irInputNum;
     irOutputNum_ = irOutputNum;
+    currentFrame_ = nullptr;
 }
 
 void KernelContextHolder::FinalizeComputeNodeInfo(size_t attrNum)
@@ -395,6 +454,126 @@ void KernelContextHolder::FinalizeComputeNodeInfo(size_t attrNum)
     UpdateAttrDefOffset(inputNum_ + outputNum_, attrNum_);
 }
 
+void KernelContextHolder::SetFrameTemplateEnable(bool enable)
+{
+    frameTemplateEnable_ = enable;
+    if (!enable) {
+        frameTemplates_.clear();
+        currentFrame_ = nullptr;
+    }
+}
+
+bool KernelContextHolder::BuildFrameSignature(const char* opType, OpArgList& input, OpArgList& output,
+                                              OpArgList& attr)
+{
+    frameSignature_.clear();
+    frameSignature_.push_back(reinterpret_cast<size_t>(opType));
+    frameSignature_.push_back(input.count);
+    frameSignature_.push_back(output.count);
+    frameSignature_.push_back(attr.count);
+    bool valid = true;
+    auto appendTensorNum = [this, &valid](size_t, OpArg& arg) {
+        size_t num = 0;
+        valid = valid && GetTensorInstanceNum(arg, num);
+        frameSignature_.push_back(num);
+    };
+    input.VisitByNoReturn(appendTensorNum);
+    output.VisitByNoReturn(appendTensorNum);
+    attr.VisitByNoReturn([this, &valid](size_t, OpArg& arg) {
+        size_t size = 0;
+        valid = valid && GetAttrLayoutSize(arg, size);
+        frameSignature_.push_back(static_cast<size_t>(arg.type));
+        frameSignature_.push_back(size);
+    });
+    if (!valid) {
+        // unsupported args are reported by the rebuild of the layout
+        return false;
+    }
+    frameKey_ = 0;
+    for (const size_t value : frameSignature_) {
+        frameKey_ ^= value + FRAME_HASH_SEED + (frameKey_ << 6) + (frameKey_ >> 2);
+    }
+    return true;
+}
+
+void KernelContextHolder::UpdateTensorSlots(OpArgList& args, size_t& slot)
+{
+    args.VisitByNoReturn([this, &slot](size_t, OpArg& arg) {
+        if (arg.type == OpArgType::OPARG_ACLTENSOR) {
+            if (arg->pointer != nullptr) {
+                UpdateTensorSlot(slot++, reinterpret_cast<aclTensor*>(arg->pointer));
+            }
+            return;
+        }
+        auto* tensorList = reinterpret_cast<aclTensorList*>(arg->pointer);
+        if (tensorList == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < tensorList->Size(); i++) {
+            if ((*tensorList)[i] != nullptr) {
+                UpdateTensorSlot(slot++, (*tensorList)[i]);
+            }
+        }
+    });
+}
+
+bool KernelContextHolder::StampFrame(const char* opType, OpArgList& input, OpArgList& output, OpArgList& attr)
+{
+    frameSignatureValid_ = BuildFrameSignature(opType, input, output, attr);
+    if (!frameSignatureValid_) {
+        return false;
+    }
+    auto iter = frameTemplates_.find(frameKey_);
+    if (iter == frameTemplates_.end() || iter->second.signature != frameSignature_) {
+        return false;
+    }
+    const FrameTemplate& frameTemplate = iter->second;
+    if (currentFrame_ != &frameTemplate) {
+        // buffers never shrink, so the frame recorded in this holder still fits
+        OP_CHECK(memcpy_s(computeNodeInfo_, computeNodeInfoSize_, frameTemplate.frame.data(),
+                          frameTemplate.frame.size()) == EOK,
+                 OP_LOGW("Failed to memcpy frame template of %s.", opType), return false);
+        currentFrame_ = &frameTemplate;
+    }
+    irInputNum_ = computeNodeInfo_->ir_inputs_num_;
+    irOutputNum_ = computeNodeInfo_->ir_outputs_num_;
+    inputNum_ = computeNodeInfo_->inputs_num_;
+    outputNum_ = computeNodeInfo_->outputs_num_;
+    attrNum_ = attr.count;
+    UpdateCompileDescOffset(irInputNum_);
+    UpdateAttrDefOffset(inputNum_ + outputNum_, attrNum_);
+    outputAnchorInfo_ = PtrCastTo<AnchorInstanceInfo>(PtrShift(attrDef_, computeNodeInfo_->attr_size_));
+
+    size_t slot = 0;
+    UpdateTensorSlots(input, slot);
+    UpdateTensorSlots(output, slot);
+    for (size_t idx = 0; idx < attr.count; idx++) {
+        void* attrPtr = PtrShift(attrDef_, attrDef_->offset[idx]);
+        if (UpdateAttrValue(idx, attr[idx], attrPtr) != ACLNN_SUCCESS) {
+            currentFrame_ = nullptr;
+            return false;
+        }
+    }
+    return true;
+}
+
+void KernelContextHolder::SaveFrame()
+{
+    if (!frameSignatureValid_) {
+        return;
+    }
+    frameSignatureValid_ = false;
+    if (frameTemplates_.size() >= MAX_FRAME_TEMPLATE_NUM && frameTemplates_.count(frameKey_) == 0) {
+        OP_LOGI("Frame templates exceed %zu, drop all of them.", MAX_FRAME_TEMPLATE_NUM);
+        frameTemplates_.clear();
+    }
+    FrameTemplate& frameTemplate = frameTemplates_[frameKey_];
+    frameTemplate.signature = frameSignature_;
+    const auto* frameStart = PtrCastTo<uint8_t>(computeNodeInfo_);
+    frameTemplate.frame.assign(frameStart, frameStart + PtrOffset(computeNodeInfo_, outputAnchorInfo_ + irOutputNum_));
+    currentFrame_ = &frameTemplate;
+}
+
 KernelContextHolder::~KernelContextHolder()
 {
     FREE(computeNodeInfo_);
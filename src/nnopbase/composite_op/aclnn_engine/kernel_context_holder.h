@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "exe_graph/runtime/kernel_run_context.h"
@@ -47,6 +48,9 @@ public:
 
     aclnnStatus UpdateComputeNodeInfo(const char* opType, OpArgList& input, OpArgList& output, OpArgList& attr)
     {
+        if (frameTemplateEnable_ && StampFrame(opType, input, output, attr)) {
+            return ACLNN_SUCCESS;
+        }
         ResetComputeNodeInfo(opType, input.count, output.count);
         UpdateCompileDescOffset(input.count);
         CHECK_RET_CODE(input.VisitBy([this](size_t idx, OpArg& arg) { return UpdateInputArg(idx, arg); }),
@@ -61,9 +65,17 @@ public:
         computeNodeInfo_->attr_size_ = PtrOffset(attrDef_, attrPtr);
         outputAnchorInfo_ = PtrCastTo<AnchorInstanceInfo>(attrPtr);
         UpdateOutputArgIr(output);
+        if (frameTemplateEnable_) {
+            SaveFrame();
+        }
         return ACLNN_SUCCESS;
     }
 
+    // Frame template mode: the layout of the compute node info built for an (op type, tensor instance num, attr
+    // size) signature is kept, a later call of the same signature copies it back and only rewrites the tensor
+    // descs, tensor addrs and attr values. On by default.
+    void SetFrameTemplateEnable(bool enable);
+
     void UpdateKernelExtendInfo(const char* kernelType, const char* kernelName);
     void ResetComputeNodeInfo(const char* opType, size_t irInputNum, size_t irOutputNum);
     void UpdateCompileDescOffset(size_t irInputNum);
@@ -105,6 +117,12 @@ private:
 
     void UpdateAttrDefOffset(size_t inoutNum, size_t attrNum);
 
+    bool BuildFrameSignature(const char* opType, OpArgList& input, OpArgList& output, OpArgList& attr);
+    bool StampFrame(const char* opType, OpArgList& input, OpArgList& output, OpArgList& attr);
+    void SaveFrame();
+    void UpdateTensorSlot(size_t slot, const aclTensor* tensor);
+    void UpdateTensorSlots(OpArgList& args, size_t& slot);
+
     aclnnStatus UpdateInputArg(size_t idx, OpArg& arg);
     aclnnStatus UpdateInputArg(size_t idx, const aclTensor* tensor);
     aclnnStatus UpdateInputArg(size_t idx, const aclTensorList* tensorList);
@@ -276,6 +294,11 @@ private:
         // 重新计算attrPtr(基于可能已经更新的attrDataStart_)
         attrPtr = PtrShift(attrDataStart_, currentOffset);
         attrDef_->offset[idx] = PtrOffset(attrDef_, attrPtr);
+        return UpdateAttrValue(idx, arg, attrPtr);
+    }
+
+    aclnnStatus UpdateAttrValue(size_t idx, OpArg& arg, void*& attrPtr)
+    {
         switch (arg.type) {
             case OpArgType::OPARG_DATATYPE:
                 return UpdateAttrArg(idx, static_cast<op::DataType>(arg->value), attrPtr);
@@ -318,6 +341,18 @@ private:
     CompileTimeTensorDesc* compileDesc_{nullptr};
     RuntimeAttrsDef* attrDef_{nullptr};
     size_t attrNum_{0};
+
+    struct FrameTemplate {
+        std::vector<size_t> signature;
+        std::vector<uint8_t> frame; // computeNodeInfo_ up to the end of the output anchors
+    };
+    bool frameTemplateEnable_{true};
+    bool frameSignatureValid_{false};
+    std::vector<size_t> frameSignature_;
+    size_t frameKey_{0};
+    std::unordered_map<size_t, FrameTemplate> frameTemplates_;
+    // template whose layout computeNodeInfo_ holds, reset by every rebuild of the layout
+    const FrameTemplate* currentFrame_{nullptr};
 };
 
 } // namespace op::internal
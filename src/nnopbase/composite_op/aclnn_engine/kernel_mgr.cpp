@@ -9,17 +9,18 @@
  */
 
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <system_error>
 #include <thread>
 #include <utility>
 #include <vector>
-#include <dirent.h>
 #include <nlohmann/json.hpp>
 
 #include "register/op_binary_resource_manager.h"
 
 #include "file_utils.h"
+#include "opp_manifest.h"
 #include "op_kernel_lib.h"
 #include "kernel_utils.h"
 #include "op_run_context.h"
@@ -97,13 +98,46 @@ aclnnStatus KernelMgr::LoadStaticBinJson()
     configJsonPath.append(STATIC_CONFIG_FILE_NAME);
     staticBinAndJsonDir_ = staticKernelBasePath;
     staticBinAndJsonDir_.append(STATIC_BIN_AND_JSON_DIR_PATH);
-    ifstream f(configJsonPath);
+
+    // the config is read once, its content keys the index and is parsed only if the index has to be rebuilt
+    string configContent;
+    {
+        ifstream f(configJsonPath, std::ios::binary);
+        if (f.is_open()) {
+            configContent.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+        }
+    }
+
+    // debug static kernels are merged into the same op, they keep selecting through the bin collector
+    staticKernelIndex_ = nullptr;
+    bool enableDebug = false;
+    (void)op::internal::systemConfig.GetEnableDebugKernelFlag(enableDebug);
+    const bool useIndex = !enableDebug && !configContent.empty();
+    const StaticKernelIndexSource source = StaticKernelIndex::GetSource(configContent, staticBinAndJsonDir_);
+    const string indexPath = useIndex ? StaticKernelIndex::GetCachePath(configJsonPath) : "";
+    if (!indexPath.empty()) {
+        staticKernelIndex_ = StaticKernelIndex::Load(indexPath, source);
+        if (staticKernelIndex_ != nullptr) {
+            OP_LOGI("Load static kernel index %s, %u static keys.", indexPath.c_str(),
+                    staticKernelIndex_->GetEntryNum());
+            return ACLNN_SUCCESS;
+        }
+    }
+
     try {
-        staticConfigJson_ = nlohmann::json::parse(f);
+        staticConfigJson_ = nlohmann::json::parse(configContent);
     } catch (nlohmann::json::exception& e) {
         OP_LOGW("Cannot parse static json for config file [%s] because %s.", configJsonPath.c_str(), e.what());
         return ACLNN_SUCCESS;
     }
+    if (useIndex) {
+        staticKernelIndex_ = BuildStaticKernelIndex(staticConfigJson_, staticBinAndJsonDir_, source);
+        if (staticKernelIndex_ != nullptr && !indexPath.empty() &&
+            staticKernelIndex_->Save(indexPath) != ACLNN_SUCCESS) {
+            // e.g. no writable cache dir, the index is still used by this process
+            OP_LOGI("Cannot save static kernel index %s.", indexPath.c_str());
+        }
+    }
     return ACLNN_SUCCESS;
 }
 
@@ -137,6 +171,13 @@ aclnnStatus KernelMgr::ParseStaticKernelConfig(uint32_t opType)
     auto& kernel = kernel_[opType];
     const string& opTypeStr = kernel.GetOpTypeStr();
     OP_LOGD("Parse kernel %s", opTypeStr.c_str());
+    bool enableDebug = false;
+    aclnnStatus ret = op::internal::systemConfig.GetEnableDebugKernelFlag(enableDebug);
+    if (staticKernelIndex_ != nullptr && ret == ACLNN_SUCCESS && !enableDebug) {
+        return kernel.SetStaticKernelIndex(staticKernelIndex_, staticBinAndJsonDir_);
+    }
+    (void)kernel.SetStaticKernelIndex(nullptr, staticBinAndJsonDir_);
+
     auto opIter = staticConfigJson_.find(opTypeStr);
     if (opIter == staticConfigJson_.end() || opIter->is_null()) {
         return ACLNN_SUCCESS;
@@ -144,8 +185,6 @@ aclnnStatus KernelMgr::ParseStaticKernelConfig(uint32_t opType)
 
     kernel.AppendStaticBin(*opIter, staticBinAndJsonDir_);
 
-    bool enableDebug = false;
-    aclnnStatus ret = op::internal::systemConfig.GetEnableDebugKernelFlag(enableDebug);
     if (ret != ACLNN_SUCCESS) {
         OP_LOGW("GetEnableDebugKernelFlag failed.");
         return ACLNN_SUCCESS;
@@ -351,30 +390,25 @@ void KernelMgr::GetConfigJsonOpsFolders()
     static std::once_flag foldersInitFlag;
     std::call_once(foldersInitFlag, [&]() {
         configJsonOpsFolders_.emplace_back("");
-        DIR* curDir = opendir(builtInConfigDir_.c_str());
-        if (curDir == nullptr) {
+        std::vector<OppManifestEntry> entries;
+        const std::string realConfigDir = RealPath(builtInConfigDir_);
+        if (realConfigDir.empty() || !OppManifest::Instance().ListDir(realConfigDir, entries)) {
             OP_LOGW("The built-in config dir [%s] is invalid.", builtInConfigDir_.c_str());
             return;
         }
-        struct dirent* entry;
         bool hasLegacyFold = false;
         const std::string legacyFolderName = "ops_legacy";
-        while ((entry = readdir(curDir)) != nullptr) {
-            std::string curEntryName = std::string(entry->d_name);
-            OP_LOGD("Entry d_name: %s, d_type: %d", entry->d_name, entry->d_type);
-            if (curEntryName == "." || curEntryName == "..") {
-                continue;
-            }
-            if (curEntryName == legacyFolderName) {
+        for (const auto& entry : entries) {
+            OP_LOGD("Entry name: %s, type: %c", entry.name.c_str(), static_cast<char>(entry.type));
+            if (entry.name == legacyFolderName) {
                 hasLegacyFold = true;
             } else {
-                configJsonOpsFolders_.emplace_back(curEntryName);
+                configJsonOpsFolders_.emplace_back(entry.name);
             }
         }
         if (hasLegacyFold) {
             configJsonOpsFolders_.emplace_back(legacyFolderName);
         }
-        closedir(curDir);
     });
     OP_LOGI("The built-in config dir: %s, print folders result: %d", builtInConfigDir_.c_str(),
             PrintConfigJsonOpsFolders(configJsonOpsFolders_));
@@ -388,6 +422,8 @@ aclnnStatus KernelMgr::Prepare()
     CHECK_COND(ret == ACLNN_SUCCESS, ret, "Initialize OpKernelLib failed.");
     GetDirPath();
     GetConfigJsonOpsFolders();
+    // the config directories are listed by now, keep their listings for the next process
+    (void)OppManifest::Instance().Save();
 
     bool enableDebug = false;
     ret = op::internal::systemConfig.GetEnableDebugKernelFlag(enableDebug);
@@ -0,0 +1,374 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "kernel_prewarm.h"
+
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include "nlohmann/json.hpp"
+#include "mmpa/mmpa_api.h"
+#include "aclnn/acl_meta.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "opdev/op_def.h"
+#include "opdev/op_log.h"
+#include "kernel_mgr.h"
+#include "thread_local_context.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 32U;
+constexpr int64_t kBucketDim = -1;
+
+size_t ReadPrewarmThreadNum()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_PREWARM_THREAD_NUM", &buf[0U], kEnvBufLen) != EN_OK || buf[0U] == '\0') {
+        return kPrewarmDefaultThreadNum;
+    }
+    char* end = nullptr;
+    const unsigned long threadNum = std::strtoul(&buf[0U], &end, 10);
+    if (end == &buf[0U] || *end != '\0' || threadNum == 0UL || threadNum > kPrewarmMaxThreadNum) {
+        OP_LOGW("Invalid ACLNN_PREWARM_THREAD_NUM %s, use the default %zu.", buf, kPrewarmDefaultThreadNum);
+        return kPrewarmDefaultThreadNum;
+    }
+    return static_cast<size_t>(threadNum);
+}
+
+// The tensors, arrays and OpArgs of one op of a prewarm list, built for one bucket and owned until the task has run.
+class PrewarmArgs {
+public:
+    PrewarmArgs() = default;
+    PrewarmArgs(const PrewarmArgs&) = delete;
+    PrewarmArgs& operator=(const PrewarmArgs&) = delete;
+
+    ~PrewarmArgs()
+    {
+        for (auto tensor : tensors_) {
+            (void)aclDestroyTensor(tensor);
+        }
+        for (auto tensorList : tensorLists_) {
+            (void)aclDestroyTensorList(tensorList);
+        }
+        for (auto array : intArrays_) {
+            (void)aclDestroyIntArray(array);
+        }
+        for (auto array : floatArrays_) {
+            (void)aclDestroyFloatArray(array);
+        }
+        for (auto array : boolArrays_) {
+            (void)aclDestroyBoolArray(array);
+        }
+    }
+
+    aclnnStatus Init(const nlohmann::json& opJson, int64_t bucket)
+    {
+        CHECK_RET_CODE(AppendTensors(opJson, "inputs", OP_INPUT_ARG, bucket), "Parse inputs failed.");
+        CHECK_RET_CODE(AppendTensors(opJson, "outputs", OP_OUTPUT_ARG, bucket), "Parse outputs failed.");
+        CHECK_RET_CODE(AppendAttrs(opJson), "Parse attrs failed.");
+        for (size_t i = 0U; i < args_.size(); i++) {
+            ctx_.argLists[i].args = args_[i].data();
+            ctx_.argLists[i].count = args_[i].size();
+            ctx_.argLists[i].argType = static_cast<int>(i);
+        }
+        return ACLNN_SUCCESS;
+    }
+
+    OpArgContext* GetContext() { return &ctx_; }
+
+private:
+    aclTensor* CreateTensor(const nlohmann::json& desc, int64_t bucket)
+    {
+        std::vector<int64_t> shape = desc.at("shape").get<std::vector<int64_t>>();
+        for (auto& dim : shape) {
+            if (dim == kBucketDim) {
+                dim = bucket;
+            }
+            if (dim < 0) {
+                OP_LOGW("Dim of tensor %s is left unknown.", desc.dump().c_str());
+                return nullptr;
+            }
+        }
+        const op::DataType dtype = op::ToDataType(desc.at("dtype").get<std::string>());
+        const op::Format format = op::ToFormat(desc.value("format", std::string("ND")));
+        if (dtype == op::DataType::DT_UNDEFINED || format == op::Format::FORMAT_RESERVED) {
+            OP_LOGW("Invalid dtype or format of tensor %s.", desc.dump().c_str());
+            return nullptr;
+        }
+        return aclCreateTensor(shape.data(), shape.size(), op::ToAclDataType(dtype), nullptr, 0,
+                               op::ToAclFormat(format), shape.data(), shape.size(), nullptr);
+    }
+
+    aclnnStatus AppendTensors(const nlohmann::json& opJson, const char* key, OpArgDef argDef, int64_t bucket)
+    {
+        if (!opJson.contains(key)) {
+            return ACLNN_SUCCESS;
+        }
+        for (const auto& desc : opJson.at(key)) {
+            OpArg arg;
+            if (desc.is_null()) {
+                arg.type = OpArgType::OPARG_ACLTENSOR;
+                arg.value = OpArgValue(static_cast<const aclTensor*>(nullptr));
+            } else if (desc.is_array()) {
+                std::vector<aclTensor*> tensors;
+                for (const auto& elem : desc) {
+                    tensors.push_back(CreateTensor(elem, bucket));
+                    if (tensors.back() == nullptr) {
+                        for (auto tensor : tensors) {
+                            (void)aclDestroyTensor(tensor);
+                        }
+                        return ACLNN_ERR_PARAM_INVALID;
+                    }
+                }
+                tensorLists_.push_back(aclCreateTensorList(tensors.data(), tensors.size()));
+                CHECK_COND(tensorLists_.back() != nullptr, ACLNN_ERR_INNER_NULLPTR, "Create tensor list failed.");
+                arg.type = OpArgType::OPARG_ACLTENSOR_LIST;
+                arg.value = OpArgValue(tensorLists_.back());
+            } else {
+                aclTensor* tensor = CreateTensor(desc, bucket);
+                CHECK_COND(tensor != nullptr, ACLNN_ERR_PARAM_INVALID, "Create tensor failed.");
+                tensors_.push_back(tensor);
+                arg.type = OpArgType::OPARG_ACLTENSOR;
+                arg.value = OpArgValue(tensor);
+            }
+            args_[argDef].push_back(arg);
+        }
+        return ACLNN_SUCCESS;
+    }
+
+    aclnnStatus AppendAttrs(const nlohmann::json& opJson)
+    {
+        if (!opJson.contains("attrs")) {
+            return ACLNN_SUCCESS;
+        }
+        for (const auto& attr : opJson.at("attrs")) {
+            const std::string type = attr.at("type").get<std::string>();
+            const auto& value = attr.at("value");
+            OpArg arg;
+            if (type == "int") {
+                arg.type = OpArgType::OPARG_INT;
+                arg.value = OpArgValue(value.get<int64_t>());
+            } else if (type == "float") {
+                arg.type = OpArgType::OPARG_FLOAT;
+                arg.value = OpArgValue(value.get<float>());
+            } else if (type == "bool") {
+                arg.type = OpArgType::OPARG_BOOL;
+                arg.value = OpArgValue(value.get<bool>());
+            } else if (type == "dtype") {
+                arg.type = OpArgType::OPARG_DATATYPE;
+                arg.value = OpArgValue(op::ToDataType(value.get<std::string>()));
+            } else if (type == "string") {
+                // kept here instead of the copy OpArgValue makes, which only DestroyOpArgContext frees
+                strings_.push_back(value.get<std::string>());
+                arg.type = OpArgType::OPARG_STRING;
+                arg.value.data.pointer = const_cast<char*>(strings_.back().c_str());
+            } else if (type == "int_list") {
+                const auto values = value.get<std::vector<int64_t>>();
+                intArrays_.push_back(aclCreateIntArray(values.data(), values.size()));
+                arg.type = OpArgType::OPARG_INT_LIST;
+                arg.value = OpArgValue(intArrays_.back());
+            } else if (type == "float_list") {
+                const auto values = value.get<std::vector<float>>();
+                floatArrays_.push_back(aclCreateFloatArray(values.data(), values.size()));
+                arg.type = OpArgType::OPARG_FLOAT_LIST;
+                arg.value = OpArgValue(floatArrays_.back());
+            } else if (type == "bool_list") {
+                const auto values = value.get<std::vector<bool>>();
+                std::unique_ptr<bool[]> data(new bool[values.size() + 1U]);
+                for (size_t i = 0U; i < values.size(); i++) {
+                    data[i] = values[i];
+                }
+                boolArrays_.push_back(aclCreateBoolArray(data.get(), values.size()));
+                arg.type = OpArgType::OPARG_BOOL_LIST;
+                arg.value = OpArgValue(boolArrays_.back());
+            } else {
+                OP_LOGW("Unsupported attr type %s.", type.c_str());
+                return ACLNN_ERR_PARAM_INVALID;
+            }
+            args_[OP_ATTR_ARG].push_back(arg);
+        }
+        return ACLNN_SUCCESS;
+    }
+
+    OpArgContext ctx_;
+    std::array<std::vector<OpArg>, OP_ARG_TYPE_NUM> args_;
+    std::vector<aclTensor*> tensors_;
+    std::vector<aclTensorList*> tensorLists_;
+    std::vector<aclIntArray*> intArrays_;
+    std::vector<aclFloatArray*> floatArrays_;
+    std::vector<aclBoolArray*> boolArrays_;
+    std::deque<std::string> strings_;
+};
+} // namespace
+
+KernelPrewarmer& KernelPrewarmer::Instance()
+{
+    // Intentionally leaked: the threads are stopped by the atexit hook, before the runtime is torn down.
+    static KernelPrewarmer* instance = []() {
+        KernelPrewarmer* prewarmer = new KernelPrewarmer();
+        (void)std::atexit([]() { KernelPrewarmer::Instance().Shutdown(); });
+        return prewarmer;
+    }();
+    return *instance;
+}
+
+aclnnStatus KernelPrewarmer::Submit(uint32_t opType, OpArgContext* args, bool runTiling)
+{
+    CHECK_COND(args != nullptr, ACLNN_ERR_PARAM_NULLPTR, "OpArgContext of op %u is nullptr.", opType);
+    std::shared_ptr<OpArgContext> ctx(args, [](OpArgContext* p) { DestroyOpArgContext(p); });
+    return Enqueue([opType, ctx, runTiling]() { return gKernelMgr.Prewarm(opType, ctx.get(), runTiling); });
+}
+
+aclnnStatus KernelPrewarmer::Submit(PrewarmFunc func)
+{
+    CHECK_COND(func != nullptr, ACLNN_ERR_PARAM_NULLPTR, "Prewarm function is empty.");
+    return Enqueue(std::move(func));
+}
+
+aclnnStatus KernelPrewarmer::SubmitFile(const std::string& path)
+{
+    std::ifstream ifs(path);
+    CHECK_COND(ifs.is_open(), ACLNN_ERR_PARAM_INVALID, "Open prewarm list %s failed.", path.c_str());
+    std::vector<std::pair<uint32_t, std::shared_ptr<PrewarmArgs>>> ops;
+    std::vector<bool> runTilings;
+    try {
+        const nlohmann::json listJson = nlohmann::json::parse(ifs);
+        for (const auto& opJson : listJson.at("ops")) {
+            const std::string opTypeStr = opJson.at("op_type").get<std::string>();
+            const uint32_t opType = op::OpTypeDict::ToOpType(opTypeStr);
+            // an op type not registered is 0
+            CHECK_COND(opType != 0U && opType < op::OpTypeDict::GetAllOpTypeSize(), ACLNN_ERR_PARAM_INVALID,
+                       "Unknown op type %s in prewarm list %s.", opTypeStr.c_str(), path.c_str());
+            const auto buckets = opJson.value("buckets", std::vector<int64_t>{kBucketDim});
+            for (const int64_t bucket : buckets) {
+                auto args = std::make_shared<PrewarmArgs>();
+                CHECK_RET_CODE(args->Init(opJson, bucket), "Parse op %s of prewarm list failed.", opTypeStr.c_str());
+                ops.emplace_back(opType, std::move(args));
+                runTilings.push_back(opJson.value("tiling", false));
+            }
+        }
+    } catch (const nlohmann::json::exception& e) {
+        OP_LOGE(ACLNN_ERR_PARAM_INVALID, "Parse prewarm list %s failed: %s.", path.c_str(), e.what());
+        return ACLNN_ERR_PARAM_INVALID;
+    }
+    OP_LOGI("Submit %zu prewarm tasks of %s.", ops.size(), path.c_str());
+    for (size_t i = 0U; i < ops.size(); i++) {
+        const uint32_t opType = ops[i].first;
+        const bool runTiling = runTilings[i];
+        auto args = std::move(ops[i].second);
+        CHECK_RET_CODE(Enqueue([opType, args, runTiling]() {
+                           return gKernelMgr.Prewarm(opType, args->GetContext(), runTiling);
+                       }),
+                       "Submit prewarm task failed.");
+    }
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus KernelPrewarmer::Enqueue(PrewarmFunc func)
+{
+    PrewarmTask task;
+    task.func = std::move(func);
+    if (aclrtGetCurrentContext(&task.context) != ACL_SUCCESS) {
+        task.context = nullptr;
+    }
+    task.opConfigInfo = GetThreadLocalContext().opConfigInfo_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+        progress_.submitted++;
+        progress_.pendingNum++;
+        StartWorkers();
+    }
+    queueCv_.notify_one();
+    return ACLNN_SUCCESS;
+}
+
+void KernelPrewarmer::StartWorkers()
+{
+    if (!workers_.empty()) {
+        return;
+    }
+    stop_ = false;
+    const size_t threadNum = ReadPrewarmThreadNum();
+    for (size_t i = 0U; i < threadNum; i++) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+    OP_LOGI("Start %zu prewarm threads.", threadNum);
+}
+
+void KernelPrewarmer::WorkerLoop()
+{
+    aclrtContext currContext = nullptr;
+    while (true) {
+        PrewarmTask task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queueCv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (stop_) {
+                break;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        aclnnStatus ret = ACLNN_SUCCESS;
+        if ((task.context != nullptr) && (task.context != currContext)) {
+            ret = (aclrtSetCurrentContext(task.context) == ACL_SUCCESS) ? ACLNN_SUCCESS : ACLNN_ERR_RUNTIME_ERROR;
+            currContext = (ret == ACLNN_SUCCESS) ? task.context : nullptr;
+        }
+        if (ret == ACLNN_SUCCESS) {
+            GetThreadLocalContext().opConfigInfo_ = task.opConfigInfo;
+            ret = task.func();
+        }
+        if (ret != ACLNN_SUCCESS) {
+            OP_LOGW("Prewarm task failed, ret %d.", ret);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            (ret == ACLNN_SUCCESS) ? progress_.done++ : progress_.failed++;
+            progress_.pendingNum--;
+        }
+        doneCv_.notify_all();
+    }
+}
+
+PrewarmProgress KernelPrewarmer::GetProgress() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return progress_;
+}
+
+void KernelPrewarmer::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCv_.wait(lock, [this]() { return progress_.pendingNum == 0U; });
+}
+
+void KernelPrewarmer::Shutdown()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        progress_.pendingNum -= queue_.size();
+        queue_.clear();
+        stop_ = true;
+        workers.swap(workers_);
+    }
+    queueCv_.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    doneCv_.notify_all();
+}
+
+} // namespace internal
+} // namespace op
@@ -28,6 +28,14 @@ aclnnStatus NonFiniteCheckOp::RunNonfiniteCheckOp([[maybe_unused]] NonFiniteChec
     dump = true;
     return ACLNN_SUCCESS;
 }
+
+aclnnStatus NonFiniteCheckOp::RunNonfiniteCheckOp(
+    [[maybe_unused]] NonFiniteCheckOpContext& nonFiniteCheckOpCtx,
+    [[maybe_unused]] std::unordered_map<op::DataType, std::vector<aclTensor*>>& dtype2Tensors, bool& dump)
+{
+    dump = true;
+    return ACLNN_SUCCESS;
+}
 #endif
 
 } // namespace internal
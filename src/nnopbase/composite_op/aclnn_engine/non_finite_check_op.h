@@ -141,7 +141,8 @@ public:
             auto rc = DoLaunch(res, stream, false, nonFiniteCheckOpArgs, tensorOffset);
             OP_CHECK(rc == ACLNN_SUCCESS, OP_LOGW("launch non finite check op failed, ret %d", rc), return rc);
         }
-        if (IsPrintFEnable()) {
+        // args is nullptr when the tensors of several launches are checked together
+        if (IsPrintFEnable() && args != nullptr) {
             DumpWorkspaceData(stream, args);
         }
         static uint64_t kernelLaunchId = GenKernelLauncherId("NonFiniteCheck");
@@ -149,8 +150,9 @@ public:
             ReportAdditionInfo(GetTaskInfo(*(res->tilingKey_)), kernelLaunchId, summaryId);
         }
         if (GetThreadLocalContext().cacheOpInfoSwitch_) {
-            TaskInfo taskInfo = GetTaskInfo(*(res->tilingKey_), args);
-            ReportCacheOpInfo(taskInfo, args, opType_);
+            OpArgContext* reportArgs = (args != nullptr) ? args : nonFiniteCheckOpArgs;
+            TaskInfo taskInfo = GetTaskInfo(*(res->tilingKey_), reportArgs);
+            ReportCacheOpInfo(taskInfo, reportArgs, opType_);
         }
         return ACLNN_SUCCESS;
     }
@@ -240,14 +242,25 @@ class NonFiniteCheckOp {
 public:
 #if defined(NNOPBASE_UT) || defined(NNOPBASE_ST)
     static aclnnStatus RunNonfiniteCheckOp([[maybe_unused]] NonFiniteCheckOpContext& nonFiniteCheckOpCtx, bool& dump);
+    static aclnnStatus RunNonfiniteCheckOp(
+        [[maybe_unused]] NonFiniteCheckOpContext& nonFiniteCheckOpCtx,
+        [[maybe_unused]] std::unordered_map<op::DataType, std::vector<aclTensor*>>& dtype2Tensors, bool& dump);
 #else
     static aclnnStatus RunNonfiniteCheckOp(NonFiniteCheckOpContext& nonFiniteCheckOpCtx, bool& dump)
+    {
+        std::unordered_map<op::DataType, std::vector<aclTensor*>> dtype2Tensors;
+        CollectNonFiniteCheckTensor(dtype2Tensors, nonFiniteCheckOpCtx.opArgCtx_);
+        return RunNonfiniteCheckOp(nonFiniteCheckOpCtx, dtype2Tensors, dump);
+    }
+
+    // Checks the collected tensors with one NonFiniteCheck launch per data type.
+    static aclnnStatus RunNonfiniteCheckOp(NonFiniteCheckOpContext& nonFiniteCheckOpCtx,
+                                           std::unordered_map<op::DataType, std::vector<aclTensor*>>& dtype2Tensors,
+                                           bool& dump)
     {
         static uint32_t opid = OpTypeDict::ToOpType("NonFiniteCheck");
         (void)gKernelMgr.AclOpKernelInit(opid);
 
-        std::unordered_map<op::DataType, std::vector<aclTensor*>> dtype2Tensors;
-        CollectNonFiniteCheckTensor(dtype2Tensors, nonFiniteCheckOpCtx.opArgCtx_);
         for (auto& dtypeTensorPair : dtype2Tensors) {
             OP_LOGI("there are %zu tensors with type %s to be checked", dtypeTensorPair.second.size(),
                     op::ToString(dtypeTensorPair.first).GetString());
@@ -289,6 +302,26 @@ public:
     }
 #endif
 
+    // Collects the float outputs of args to be checked, grouped by data type.
+    static void CollectNonFiniteCheckTensor(std::unordered_map<op::DataType, std::vector<aclTensor*>>& dtype2Tensors,
+                                            OpArgContext* args)
+    {
+        if (args->ContainsOpArgType(op::OP_OUTPUT_ARG)) {
+            OpArgList* outputs = args->GetOpArg(op::OP_OUTPUT_ARG);
+            outputs->VisitByNoReturn([&dtype2Tensors]([[maybe_unused]] size_t idx, OpArg& arg) {
+                if (arg.type == OpArgType::OPARG_ACLTENSOR) {
+                    aclTensor* tensor = reinterpret_cast<aclTensor*>(arg->pointer);
+                    CollectNonFiniteCheckTensor(dtype2Tensors, tensor);
+                } else if (arg.type == OpArgType::OPARG_ACLTENSOR_LIST) {
+                    aclTensorList* tensorList = reinterpret_cast<aclTensorList*>(arg->pointer);
+                    CollectNonFiniteCheckTensor(dtype2Tensors, tensorList);
+                } else {
+                    OP_LOGW("invalid output type %d for NonFiniteCheck kernel", static_cast<int>(arg.type));
+                }
+            });
+        }
+    }
+
 private:
     static aclnnStatus SelectNonFiniteCheckOpBin(OpKernelBin*& opBin, const uint32_t opid, op::DataType dtype)
     {
@@ -325,25 +358,6 @@ private:
         }
     }
 
-    static void CollectNonFiniteCheckTensor(std::unordered_map<op::DataType, std::vector<aclTensor*>>& dtype2Tensors,
-                                            OpArgContext* args)
-    {
-        if (args->ContainsOpArgType(op::OP_OUTPUT_ARG)) {
-            OpArgList* outputs = args->GetOpArg(op::OP_OUTPUT_ARG);
-            outputs->VisitByNoReturn([&dtype2Tensors]([[maybe_unused]] size_t idx, OpArg& arg) {
-                if (arg.type == OpArgType::OPARG_ACLTENSOR) {
-                    aclTensor* tensor = reinterpret_cast<aclTensor*>(arg->pointer);
-                    CollectNonFiniteCheckTensor(dtype2Tensors, tensor);
-                } else if (arg.type == OpArgType::OPARG_ACLTENSOR_LIST) {
-                    aclTensorList* tensorList = reinterpret_cast<aclTensorList*>(arg->pointer);
-                    CollectNonFiniteCheckTensor(dtype2Tensors, tensorList);
-                } else {
-                    OP_LOGW("invalid output type %d for NonFiniteCheck kernel", static_cast<int>(arg.type));
-                }
-            });
-        }
-    }
-
     static aclnnStatus PrepareNonFiniteCheckOpArgs(NonFiniteCheckOpContext& nonFiniteCheckOpCtx,
                                                    std::vector<aclTensor*>& checkTensors, OpArgList& tilingInputArgList,
                                                    OpArgContext& nonFiniteCheckOpArgCtx, OpArg*& nonFiniteCheckOpArg)
@@ -26,6 +26,8 @@
 #include "op_info_serialize.h"
 #include "kernel_launcher.h"
 #include "op_dfx_internal.h"
+#include "async_dump.h"
+#include "prof_report_cache.h"
 #include "non_finite_check_op.h"
 #include "utils/string_utils.h"
 #include "dlopen_api.h"
@@ -287,7 +289,10 @@ int32_t ProfilingCallBack(uint32_t type, VOID_PTR data, uint32_t len)
         return 0;
     }
 
+    // hash ids cached by the last session are not reused by the next one
+    ProfReportCache::Invalidate();
     if (handle->type == PROF_COMMANDHANDLE_TYPE_STOP) {
+        FlushAllProfReport();
         opProfilingSwitch.reportFlag = false;
         opProfilingSwitch.kernelLaunchFlag = false;
         opProfilingSwitch.additionInfoFlag = false;
@@ -361,9 +366,9 @@ void PrepareBasicInfo(MsprofCompactInfo& compactInfo, MsprofGeTaskType taskType,
         compactInfo.data.nodeBasicInfo.blockDim = 0 :
         compactInfo.data.nodeBasicInfo.blockDim = numBlocks;
     compactInfo.data.nodeBasicInfo.opFlag = 0;
-    auto res = MsprofReportCompactInfo(true, &compactInfo, sizeof(compactInfo));
-    OP_LOGI("PrepareBasicInfo, res = %d, compactInfo.timeStamp = %lu, nodeBasicInfo.taskType = %u.", res,
-            compactInfo.timeStamp, compactInfo.data.nodeBasicInfo.taskType);
+    ProfReportCompactInfo(compactInfo);
+    OP_LOGI("PrepareBasicInfo, compactInfo.timeStamp = %lu, nodeBasicInfo.taskType = %u.", compactInfo.timeStamp,
+            compactInfo.data.nodeBasicInfo.taskType);
 }
 
 void PrepareBasicInfo(MsprofCompactInfo& compactInfo, const TaskInfo& taskInfo, uint64_t id, uint64_t summaryId)
@@ -392,9 +397,9 @@ void PrepareBasicInfo(MsprofCompactInfo& compactInfo, const TaskInfo& taskInfo,
                                              static_cast<uint32_t>(OpExecMode::OP_EXEC_MODE_HF32)) != 0 ?
                                                 1 :
                                                 0;
-    auto res = MsprofReportCompactInfo(true, &compactInfo, sizeof(compactInfo));
-    OP_LOGI("PrepareBasicInfo, res = %d, compactInfo.timeStamp = %lu, nodeBasicInfo.taskType = %u.", res,
-            compactInfo.timeStamp, compactInfo.data.nodeBasicInfo.taskType);
+    ProfReportCompactInfo(compactInfo);
+    OP_LOGI("PrepareBasicInfo, compactInfo.timeStamp = %lu, nodeBasicInfo.taskType = %u.", compactInfo.timeStamp,
+            compactInfo.data.nodeBasicInfo.taskType);
 }
 
 void GetCacheOpInfoSwitch([[maybe_unused]] const aclrtStream& stream)
@@ -600,7 +605,7 @@ void ReportAdditionInfo(const TaskInfo& taskInfo, uint64_t id, uint64_t summaryI
     OP_CHECK(
         memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &emptyTensor, sizeof(MsprofTensorInfo)) == EOK,
         OP_LOGW("Failed to memcpy."), return);
-    MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+    ProfReportAdditionalInfo(additionInfo);
 }
 
 void ReportNodeContextIdInfo(uint64_t summaryId)
@@ -620,11 +625,12 @@ void ReportNodeContextIdInfo(uint64_t summaryId)
     OP_CHECK(memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &contextIdInfo,
                       sizeof(MsprofContextIdInfo)) == EOK,
              OP_LOGW("Failed to memcpy context info."), return);
-    MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+    ProfReportAdditionalInfo(additionInfo);
 }
 
-static void ReportTensorAdditionInfo(const FVector<const aclTensor*>& tensors, MsprofAdditionalInfo& additionInfo,
-                                     uint64_t summaryId, MsprofGeTensorType type)
+static void PrepareTensorAdditionInfo(const FVector<const aclTensor*>& tensors, MsprofAdditionalInfo& additionInfo,
+                                      uint64_t summaryId, MsprofGeTensorType type,
+                                      std::vector<MsprofAdditionalInfo>& additionInfos)
 {
     MsprofTensorInfo tensorInfo;
     uint32_t loop = tensors.size() / MSPROF_GE_TENSOR_DATA_NUM;
@@ -635,14 +641,14 @@ static void ReportTensorAdditionInfo(const FVector<const aclTensor*>& tensors, M
         OP_CHECK(memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &tensorInfo,
                           sizeof(MsprofTensorInfo)) == EOK,
                  OP_LOGW("Failed to memcpy tensor additional info."), return);
-        MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+        additionInfos.push_back(additionInfo);
     }
     if (tail != 0) {
         PrepareTensorInfo(tensors, tensorInfo, summaryId, type, tail, loop * MSPROF_GE_TENSOR_DATA_NUM);
         OP_CHECK(memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &tensorInfo,
                           sizeof(MsprofTensorInfo)) == EOK,
                  OP_LOGW("Failed to memcpy tensor tail additional info."), return);
-        MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+        additionInfos.push_back(additionInfo);
     }
 }
 
@@ -656,8 +662,33 @@ static void ReportAdditionInfoImpl(FVector<const aclTensor*>& inTensors, FVector
     }
     MsprofAdditionalInfo additionInfo;
     PrepareAdditionInfo(additionInfo);
-    ReportTensorAdditionInfo(inTensors, additionInfo, summaryId, MSPROF_GE_TENSOR_TYPE_INPUT);
-    ReportTensorAdditionInfo(outTensors, additionInfo, summaryId, MSPROF_GE_TENSOR_TYPE_OUTPUT);
+    thread_local std::vector<MsprofAdditionalInfo> uncachedInfos;
+    std::vector<MsprofAdditionalInfo>* additionInfos = &uncachedInfos;
+    bool cached = false;
+    if (ProfReportCache::IsEnabled()) {
+        // the records only differ in thread id and time stamp between launches with the same signature
+        ProfReportCache& cache = ProfReportCache::Instance();
+        std::string& signature = cache.Signature();
+        signature.assign(reinterpret_cast<const char*>(&summaryId), sizeof(summaryId));
+        AppendTensorSignature(inTensors, signature);
+        AppendTensorSignature(outTensors, signature);
+        additionInfos = cache.FindTensorInfo(signature);
+        cached = (additionInfos != nullptr);
+        if (!cached) {
+            additionInfos = &cache.AddTensorInfo(signature);
+        }
+    } else {
+        uncachedInfos.clear();
+    }
+    if (!cached) {
+        PrepareTensorAdditionInfo(inTensors, additionInfo, summaryId, MSPROF_GE_TENSOR_TYPE_INPUT, *additionInfos);
+        PrepareTensorAdditionInfo(outTensors, additionInfo, summaryId, MSPROF_GE_TENSOR_TYPE_OUTPUT, *additionInfos);
+    }
+    for (auto& info : *additionInfos) {
+        info.threadId = additionInfo.threadId;
+        info.timeStamp = additionInfo.timeStamp;
+        ProfReportAdditionalInfo(info);
+    }
 }
 
 void ReportAdditionInfo(FVector<const aclTensor*>& inTensors, FVector<const aclTensor*>& outTensors,
@@ -684,6 +715,11 @@ void ReportAttrInfo(std::string& attrStr, uint64_t summaryId)
 {
     uint64_t id = MsprofGetHashId(attrStr.c_str(), attrStr.size());
     OP_LOGI("GenAttrInfoId, attr str = %s, id = %lu, opName = %lu", attrStr.c_str(), id, summaryId);
+    ReportAttrInfo(id, summaryId);
+}
+
+void ReportAttrInfo(uint64_t id, uint64_t summaryId)
+{
     MsprofAttrInfo attrInfo;
     attrInfo.opName = summaryId;
     attrInfo.attrType = OP_ATTR;
@@ -698,8 +734,8 @@ void ReportAttrInfo(std::string& attrStr, uint64_t summaryId)
     compactInfo.timeStamp = op::internal::GetThreadLocalContext().kernelLauncherStartTime_;
     OP_CHECK(memcpy_s(compactInfo.data.info, MSPROF_COMPACT_INFO_DATA_LENGTH, &attrInfo, sizeof(MsprofAttrInfo)) == EOK,
              OP_LOGW("Failed to memcpy attr info."), return);
-    auto res = MsprofReportCompactInfo(true, &compactInfo, sizeof(compactInfo));
-    OP_LOGI("ReportAttrInfo, res = %d, compactInfo.timeStamp = %lu", res, compactInfo.timeStamp);
+    ProfReportCompactInfo(compactInfo);
+    OP_LOGI("ReportAttrInfo, id = %lu, compactInfo.timeStamp = %lu", id, compactInfo.timeStamp);
 }
 
 std::string GetLogApiInfo()
@@ -823,6 +859,9 @@ void DumpL2(const std::vector<const aclTensor*>& tensors, const OpLogInfo& opLog
         std::string l2Name = (opLogInfo.l2ApiName != nullptr) ? opLogInfo.l2ApiName : "L2DfxAbscent";
         l2Name += std::string("_") + std::to_string(opLogInfo.l2SequenceCounter) + std::string("_L2");
         std::string l2Type = (opLogInfo.l2ApiName != nullptr) ? opLogInfo.l2ApiName : "L2DfxAbscent";
+        if (op::internal::AsyncDumper::Instance().Submit(l2Name, l2Type, dumpTensors, stream)) {
+            return;
+        }
         auto res = Adx::AdumpDumpTensorV2(l2Name, l2Type, dumpTensors, stream);
         OP_LOGI("AdumpDumpTensor res = %d\n", res);
     }
@@ -1137,6 +1176,11 @@ void DumpL0(OpArgList& tensors, const OpLogInfo& opLogInfo, OpIOType ioType, acl
     std::string l2Name = (opLogInfo.l2ApiName != nullptr) ? opLogInfo.l2ApiName : "L2DfxAbscent";
     l2Name += std::string("_") + std::to_string(opLogInfo.l2SequenceCounter) + std::string("_L0");
     std::string l0Name = (opLogInfo.l0Name != nullptr) ? opLogInfo.l0Name : "L0DfxAbscent";
+    // the snapshot copies read the offset addresses, so they are recovered only after submitting
+    if (op::internal::AsyncDumper::Instance().Submit(l2Name, l0Name, dumpTensors, stream)) {
+        RecoverAclTensorAddr(record);
+        return;
+    }
     auto res = Adx::AdumpDumpTensorV2(l2Name, l0Name, dumpTensors, stream);
     RecoverAclTensorAddr(record);
     OP_LOGD("AdumpDumpTensor res = %d\n", res);
@@ -1151,6 +1195,11 @@ void DumpL0(OpArgList& inputTensors, OpArgList& outputTensors, const OpLogInfo&
     std::string l2Name = (opLogInfo.l2ApiName != nullptr) ? opLogInfo.l2ApiName : "L2DfxAbscent";
     l2Name += std::string("_") + std::to_string(opLogInfo.l2SequenceCounter) + std::string("_L0");
     std::string l0Name = (opLogInfo.l0Name != nullptr) ? opLogInfo.l0Name : "L0DfxAbscent";
+    // the snapshot copies read the offset addresses, so they are recovered only after submitting
+    if (op::internal::AsyncDumper::Instance().Submit(l2Name, l0Name, dumpTensors, stream)) {
+        RecoverAclTensorAddr(record);
+        return;
+    }
     auto res = Adx::AdumpDumpTensorV2(l2Name, l0Name, dumpTensors, stream);
     RecoverAclTensorAddr(record);
     OP_LOGD("AdumpDumpTensor res = %d\n", res);
@@ -1464,6 +1513,9 @@ OpDfxGuard::~OpDfxGuard()
         delete opDfxProfiler_;
     }
     if (profilingType_ == DfxProfilingType::DfxProfilingDefault) {
+        if (level_ == LevelTwo && op::internal::opTraceSwitch.recordFlag) {
+            EndL2Trace(funcName_);
+        }
         if (level_ == LevelZero) {
             op::internal::GetThreadLocalContext().logInfo_.InitLevelZero();
         } else if (level_ == LevelTwo) {
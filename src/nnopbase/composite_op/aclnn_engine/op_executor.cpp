@@ -21,6 +21,7 @@
 #include "bridge_graph.h"
 #include "bridge_pool.h"
 #include "dsa_task.h"
+#include "side_task_fusion.h"
 #include "opdev/tensor_view_utils.h"
 #include "kernel_workspace.h"
 #include "shape_inference.h"
@@ -29,6 +30,7 @@
 #include "thread_local_context.h"
 #include "op_dfx_internal.h"
 #include "dlopen_api.h"
+#include "aclnn_trace.h"
 
 using namespace op::internal;
 
@@ -580,6 +582,8 @@ aclnnStatus aclOpExecutor::Run()
     CHECK_RET(graph != nullptr, ACLNN_ERR_PARAM_NULLPTR);
     auto& sortedNodes = graph->GetSortedNodes();
     auto nodeCount = kernelLaunchObjList_.size();
+    std::vector<op::KernelLauncher*> launchers;
+    launchers.reserve(nodeCount);
     for (size_t i = 0; i < nodeCount; i++) {
         auto node = sortedNodes[i];
         OP_CHECK_NOTNULL(node);
@@ -588,17 +592,32 @@ aclnnStatus aclOpExecutor::Run()
                          "check node's original id failed, it should be less than %zu, but actually is %zu.", nodeCount,
                          node->GetOriginalId()),
                  return ACLNN_ERR_INNER);
-        auto& launcher = kernelLaunchObjList_[node->GetOriginalId()];
+        launchers.push_back(kernelLaunchObjList_[node->GetOriginalId()]);
+    }
+
+    op::internal::SideTaskFusion sideTaskFusion(this, GetStream());
+    sideTaskFusion.Prepare(launchers);
+    sideTaskFusion.LaunchFusedMemSet();
+    auto& threadLocalCtx = op::internal::GetThreadLocalContext();
+    for (size_t i = 0; i < nodeCount; i++) {
+        auto& launcher = launchers[i];
         launcher->UpdateThreadLocal();
         OP_LOGI("%zu start to Launch %s, original id:%ld.", i,
-                op::OpTypeDict::ToString(launcher->GetOpType()).GetString(), node->GetOriginalId());
+                op::OpTypeDict::ToString(launcher->GetOpType()).GetString(), sortedNodes[i]->GetOriginalId());
+        threadLocalCtx.memSetFused_ = sideTaskFusion.IsMemSetFused(i);
+        threadLocalCtx.overflowCheckDeferred_ = sideTaskFusion.IsCheckDeferred(i);
         status = launcher->Launch();
+        threadLocalCtx.memSetFused_ = false;
+        threadLocalCtx.overflowCheckDeferred_ = false;
         if (status != ACLNN_SUCCESS) {
             OP_LOGE(status, "launch failed for %s, errno:%d.",
                     op::OpTypeDict::ToString(launcher->GetOpType()).GetString(), status);
             break;
         }
     }
+    if (status == ACLNN_SUCCESS) {
+        sideTaskFusion.RunDeferredCheck();
+    }
 
     return status;
 }
@@ -958,6 +977,8 @@ static void DeleteExecutorForError(aclOpExecutor* executor)
 aclnnStatus CommonOpExecutorRun(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, aclrtStream stream)
 {
     static thread_local OpCacheGuard cacheGuard;
+    const op::internal::TraceScope traceScope(op::internal::TraceEvent::L2_RUN,
+                                              op::internal::GetThreadLocalContext().logInfo_.l2ApiName, stream);
     if (unlikely(executor == nullptr)) {
         OP_LOGE(ACLNN_ERR_PARAM_NULLPTR, "executor is nullptr.");
         return ACLNN_ERR_PARAM_NULLPTR;
@@ -26,6 +26,7 @@
 #include "opdev/shape_utils.h"
 #include "op_info_serialize.h"
 #include "nnopbase_error_msg.h"
+#include "executor/indv_executor.h"
 
 namespace op {
 namespace internal {
@@ -562,12 +563,24 @@ aclnnStatus OpKernelBin::InitTilingParseCtx()
     ThreadCoreNum key(GetThreadLocalContext().opConfigInfo_.aicNum_, GetThreadLocalContext().opConfigInfo_.aivNum_);
     auto f = [&ret, &key, this]() {
         auto p = std::make_unique<TilingParseCtxHolder>();
+        // the parse function sees the core num of the variant and may keep it in the compile info struct, so each
+        // variant parses its own struct, only the compile info json dumped for the first one is reused
+        std::shared_ptr<const std::string> compileInfoStr;
+        {
+            std::lock_guard<std::mutex> lock(mapMutex_);
+            compileInfoStr = compileInfoStr_;
+        }
         if (p->BuildTilingParseCtx(opType_, OpRunContextMgr::GetOpTilingFuncs(opType_), binJson_.GetVar(),
                                    SocContext::GetPlatformInfo(), keyAndDetail_.implMode,
-                                   aclnnOpInfoRecord::OpKernelInfo(binPath_, static_cast<int8_t>(binType_))) != OK) {
+                                   aclnnOpInfoRecord::OpKernelInfo(binPath_, static_cast<int8_t>(binType_)),
+                                   compileInfoStr) != OK) {
             ret = ACLNN_ERR_RUNTIME_ERROR;
             return;
         }
+        if (compileInfoStr == nullptr) {
+            std::lock_guard<std::mutex> lock(mapMutex_);
+            compileInfoStr_ = p->GetCompileInfoStr();
+        }
         tilingParseCtxHolder_[key] = std::move(p);
         ret = ACLNN_SUCCESS;
         return;
@@ -576,6 +589,30 @@ aclnnStatus OpKernelBin::InitTilingParseCtx()
     return ret;
 }
 
+aclnnStatus OpKernelBin::Prewarm(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs, bool runTiling)
+{
+    CHECK_RET_CODE(BinLoad(), "BinLoad failed");
+    if (binType_ != BinType::DYNAMIC_BIN) {
+        // the function handle of a static fat binary is only known after the static tiling of the launch
+        return isFatbin_ ? ACLNN_SUCCESS : InitFunctionHandle(false, 0U);
+    }
+    CHECK_RET_CODE(InitTilingParseCtx(), "InitTilingParseCtx failed");
+    if (!runTiling) {
+        return isFatbin_ ? ACLNN_SUCCESS : InitFunctionHandle(false, 0U);
+    }
+    auto res = OpRunContextMgr::Tiling(
+        opType_,
+        tilingParseCtxHolder_[ThreadCoreNum(GetThreadLocalContext().opConfigInfo_.aicNum_,
+                                            GetThreadLocalContext().opConfigInfo_.aivNum_)]
+            .get(),
+        inputs, outputs, attrs);
+    CHECK_COND(res != nullptr, ACLNN_ERR_INNER_NULLPTR, "Failed to execute tiling of op %s.",
+               op::OpTypeDict::ToString(opType_).GetString());
+    OP_LOGI("Prewarm op %s, bin %s, tiling key %lu.", op::OpTypeDict::ToString(opType_).GetString(), binPath_.c_str(),
+            *(res->tilingKey_));
+    return InitFunctionHandle(isFatbin_, *(res->tilingKey_));
+}
+
 static void GetParamtersValue(const nlohmann::json& elem, op::DataType& dtype, int64_t& valuei, float32_t& valuef)
 {
     if (elem["dtype"] == "float16") {
@@ -647,20 +684,50 @@ uint64_t OpKernelBin::GetAttrId(OpArgContext* args)
 {
     uint64_t aclGraphAttrId = 0;
     if (GetThreadLocalContext().cacheOpInfoSwitch_ && opKernel_ != nullptr) {
-        std::string attrStrId;
+        aclGraphAttrId = GenAttrHashId(args);
+    }
+    return aclGraphAttrId;
+}
+
+uint64_t OpKernelBin::GenAttrHashId(OpArgContext* args)
+{
+    // the attr string only depends on the kernel, the attr values and the host input contents
+    std::string* signature = nullptr;
+    if (ProfReportCache::IsEnabled()) {
+        ProfReportCache& cache = ProfReportCache::Instance();
+        signature = &cache.Signature();
+        signature->assign(reinterpret_cast<const char*>(&opKernel_), sizeof(opKernel_));
+        signature->append(1U, static_cast<char>(binType_));
+        bool cacheable = true;
         if (args->ContainsOpArgType(op::OP_ATTR_ARG)) {
-            op::internal::ReportAttrInfo(*args->GetOpArg(op::OP_ATTR_ARG), attrStrId,
-                                         static_cast<OpKernel*>(opKernel_)->attrInfos_);
-            OP_LOGI("attrStrId is %s after add attr value", attrStrId.c_str());
+            cacheable = AppendAttrSignature(*args->GetOpArg(op::OP_ATTR_ARG), *signature);
+        }
+        cacheable = cacheable && AppendHostInputSignature(*args->GetOpArg(op::OP_INPUT_ARG), *signature);
+        uint64_t attrId = 0;
+        if (!cacheable) {
+            signature = nullptr;
+        } else if (cache.FindAttrId(*signature, attrId)) {
+            return attrId;
         }
-        OpArgList input = *args->GetOpArg(op::OP_INPUT_ARG);
-        input.VisitByNoReturn([&attrStrId](size_t idx, OpArg& elem) { SummaryAttrArg(idx, elem, attrStrId); });
-        OP_LOGI("attrStrId is %s after add input tensor", attrStrId.c_str());
-        attrStrId += std::string("IsStaticKernel:") +
-                     (binType_ == BinType::STATIC_BIN ? std::string("true") : std::string("false"));
-        aclGraphAttrId = MsprofGetHashId(attrStrId.c_str(), attrStrId.size());
     }
-    return aclGraphAttrId;
+
+    std::string attrStr;
+    if (args->ContainsOpArgType(op::OP_ATTR_ARG)) {
+        op::internal::ReportAttrInfo(*args->GetOpArg(op::OP_ATTR_ARG), attrStr,
+                                     static_cast<OpKernel*>(opKernel_)->attrInfos_);
+        OP_LOGI("attrStr is %s after add attr value", attrStr.c_str());
+    }
+    OpArgList input = *args->GetOpArg(op::OP_INPUT_ARG);
+    input.VisitByNoReturn([&attrStr](size_t idx, OpArg& elem) { SummaryAttrArg(idx, elem, attrStr); });
+    OP_LOGI("attrStr is %s after add input tensor", attrStr.c_str());
+    attrStr += std::string("IsStaticKernel:") +
+               (binType_ == BinType::STATIC_BIN ? std::string("true") : std::string("false"));
+    uint64_t attrId = MsprofGetHashId(attrStr.c_str(), attrStr.size());
+    OP_LOGI("GenAttrInfoId, attr str = %s, id = %lu", attrStr.c_str(), attrId);
+    if (signature != nullptr) {
+        ProfReportCache::Instance().AddAttrId(*signature, attrId);
+    }
+    return attrId;
 }
 
 void ParseImplModeByJson(const nlohmann::json& singleBinJson, const std::string& jsonPath,
@@ -1536,6 +1603,97 @@ aclnnStatus OpKernel::AppendStaticBin(const nlohmann::json& opJson, const string
     return ACLNN_SUCCESS;
 }
 
+aclnnStatus OpKernel::SetStaticKernelIndex(const std::shared_ptr<const StaticKernelIndex>& index,
+                                           const string& binAndJsonDir)
+{
+    if (index == nullptr) {
+        staticIndexBinding_.store(nullptr, std::memory_order_release);
+        return ACLNN_SUCCESS;
+    }
+    // an op without static kernels is bound as well, it must not fall back to the bins of a former config
+    auto binding = std::make_unique<StaticIndexBinding>();
+    binding->index = index;
+    binding->op = index->FindOp(opTypeStr_);
+    const StaticKernelIndexOp* indexOp = binding->op;
+    if (indexOp != nullptr) {
+        index->GetValueDependIndex(*indexOp, valueDependIndex_);
+        for (uint32_t i = indexOp->entryBegin; i < indexOp->entryEnd; i++) {
+            const string binPath = index->GetBinPath(i);
+            KeyParams keyParams;
+            keyParams.binType = BinType::STATIC_BIN;
+            keyParams.keys.emplace_back();
+            keyParams.keys.back().key = binPath;
+            const auto pos = binPath.find(BIN_SUFFIX);
+            CHECK_COND(HashAndInsert(binAndJsonDir, binPath, pos, keyParams) == ACLNN_SUCCESS,
+                       ACLNN_ERR_INNER_KEY_CONFLICT, "HashAndInsert failed");
+        }
+        binding->bins.resize(indexOp->entryEnd - indexOp->entryBegin, nullptr);
+    }
+
+    const std::lock_guard<std::mutex> lock(staticKernelsMutex_);
+    for (size_t i = 0U; i < binding->bins.size(); i++) {
+        const string relativePath = index->GetBinPath(indexOp->entryBegin + i);
+        const string binPath = binAndJsonDir + relativePath.substr(0, relativePath.find(BIN_SUFFIX)) + BIN_SUFFIX;
+        auto iter = staticBins_.find(HashBinary(binPath.c_str(), binPath.size()));
+        if (iter != staticBins_.end()) {
+            binding->bins[i] = iter->second.get();
+        }
+    }
+    OP_LOGI("Bind static kernel index for op %s, %zu static keys.", opTypeStr_.c_str(), binding->bins.size());
+    staticIndexBinding_.store(binding.get(), std::memory_order_release);
+    staticIndexBindings_.emplace_back(std::move(binding));
+    return ACLNN_SUCCESS;
+}
+
+OpKernelBin* OpKernel::SelectStaticBinFromIndex(const StaticIndexBinding& binding, OpArgList& inputs,
+                                                OpArgList& outputs, OpArgList& attrs)
+{
+    if (binding.bins.empty()) {
+        return nullptr;
+    }
+    FVector<const aclTensor*> tensors;
+    FVector<int64_t> dynamicCount;
+    FVector<NnopbaseAttrAddr*> attrsVec;
+    int64_t entry = kStaticKernelIndexNotFound;
+    if (CollectStaticParam(inputs, outputs, attrs, tensors, dynamicCount, attrsVec) == ACLNN_SUCCESS) {
+        const auto& opConfigInfo = GetThreadLocalContext().opConfigInfo_;
+        const int64_t implMode = ToIndex(GetCurrentImplMode());
+        const int64_t determinConfig = opConfigInfo.isDeterministicOn_ ? 1 : 0;
+        NnopbaseStaticTensorNumInfo tensorNumInfo{
+            static_cast<int64_t>(tensors.size()), static_cast<int64_t>(dynamicCount.size()),
+            static_cast<int64_t>(attrsVec.size()), static_cast<int64_t>(valueDependIndex_.size())};
+        NnopbaseRegInfoKey regInfoKey;
+        regInfoKey.opType = opTypeStr_;
+        thread_local static NnopbaseUChar verbose[NNOPBASE_MAX_STATICKEY_LEN];
+        // same order as NnopbaseFindStaticKernel: the key with stride first, then without
+        for (const bool usingStride : {true, false}) {
+            const NnopbaseUChar* keyEnd = NnopbaseCollectorGenStaticKey(
+                verbose, &regInfoKey, &tensorNumInfo, tensors.data(),
+                const_cast<const NnopbaseAttrAddr**>(attrsVec.data()), implMode, determinConfig,
+                valueDependIndex_.data(), usingStride);
+            entry = binding.index->Find(*binding.op, verbose, static_cast<size_t>(keyEnd - verbose),
+                                        opConfigInfo.aicNum_, opConfigInfo.aivNum_,
+                                        static_cast<int8_t>(determinConfig));
+            if (entry != kStaticKernelIndexNotFound) {
+                break;
+            }
+        }
+    }
+    for (auto& attr : attrsVec) {
+        op::internal::BlockPool::Free(attr);
+    }
+
+    if (entry == kStaticKernelIndexNotFound) {
+        OP_LOGI("Cannot find static bin of op %s in static kernel index.", opTypeStr_.c_str());
+        return nullptr;
+    }
+    OpKernelBin* bin = binding.bins[static_cast<size_t>(entry) - binding.op->entryBegin];
+    if (bin != nullptr) {
+        OP_LOGI("Available static bin for op %s is %s.", opTypeStr_.c_str(), bin->binPath_.c_str());
+    }
+    return bin;
+}
+
 aclnnStatus OpKernel::AppendTensor(const aclTensor* tensor, FVector<const aclTensor*>& tensors,
                                    [[maybe_unused]] FVector<int64_t>& dynamicIndex,
                                    [[maybe_unused]] FVector<int64_t>& dynamicCount) const
@@ -1591,19 +1749,7 @@ void OpKernelBin::ReportOpAttrInfo(OpArgContext* args, uint64_t summaryId)
     if (opKernel_ == nullptr) {
         return;
     }
-
-    std::string attrStr;
-    if (args->ContainsOpArgType(op::OP_ATTR_ARG)) {
-        op::internal::ReportAttrInfo(*args->GetOpArg(op::OP_ATTR_ARG), attrStr,
-                                     static_cast<OpKernel*>(opKernel_)->attrInfos_);
-        OP_LOGI("attrStr is %s after add attr value", attrStr.c_str());
-    }
-    OpArgList input = *args->GetOpArg(op::OP_INPUT_ARG);
-    input.VisitByNoReturn([&attrStr](size_t idx, OpArg& elem) { SummaryAttrArg(idx, elem, attrStr); });
-    OP_LOGI("attrStr is %s after add input tensor", attrStr.c_str());
-    attrStr += std::string("IsStaticKernel:") +
-               (binType_ == BinType::STATIC_BIN ? std::string("true") : std::string("false"));
-    ReportAttrInfo(attrStr, summaryId);
+    ReportAttrInfo(GenAttrHashId(args), summaryId);
 }
 
 } // namespace internal
@@ -11,6 +11,7 @@
 #ifndef OP_API_COMMON_INC_OPDEV_INTERNAL_OP_KERNEL_H
 #define OP_API_COMMON_INC_OPDEV_INTERNAL_OP_KERNEL_H
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <map>
@@ -46,8 +47,10 @@
 #include "op_ctx_def.h"
 #include "op_cache_internal.h"
 #include "op_run_context.h"
+#include "prof_report_cache.h"
 #include "tiling_parse_ctx_holder.h"
 #include "outshape.h"
+#include "static_kernel_index.h"
 #include "tilingctx_builder.h"
 #include "rts_arg.h"
 #include "individual_op_internal.h"
@@ -257,8 +260,8 @@ public:
                 }
                 CacheTensorInfo(in, out);
                 if (isMemSet == false) {
-                    GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ = GenKernelLauncherId(
-                        op::OpTypeDict::ToString(opType_).GetString());
+                    GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ =
+                        ProfReportCache::Instance().GetKernelLauncherId(opType_);
                     GetThreadLocalContext().profilingInfoId_.summaryItemId_ = GenSummaryItemId(
                         GetThreadLocalContext().logInfo_.l2ApiName, GetThreadLocalContext().logInfo_.l0Name,
                         op::OpTypeDict::ToString(opType_).GetString());
@@ -318,8 +321,8 @@ public:
                 op::internal::ReportNodeContextIdInfo(GetThreadLocalContext().profilingInfoId_.summaryItemId_);
             }
             // only level1 profiling need to report addition info
-            op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ = GenKernelLauncherId(
-                op::OpTypeDict::ToString(opType_).GetString());
+            op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ =
+                ProfReportCache::Instance().GetKernelLauncherId(opType_);
             if (op::internal::opProfilingSwitch.additionInfoFlag) {
                 op::internal::ReportAdditionInfo(*args->GetOpArg(op::OP_INPUT_ARG), *args->GetOpArg(op::OP_OUTPUT_ARG),
                                                  taskInfo, GetThreadLocalContext().profilingInfoId_.summaryItemId_);
@@ -539,8 +542,8 @@ public:
                 MsprofGeTaskType taskType = MSPROF_GE_TASK_TYPE_AI_CORE;
                 // only level1 profiling need to report addition info
                 if (op::internal::opProfilingSwitch.additionInfoFlag) {
-                    op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ = GenKernelLauncherId(
-                        op::OpTypeDict::ToString(opType_).GetString());
+                    op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ =
+                        ProfReportCache::Instance().GetKernelLauncherId(opType_);
                     op::internal::ReportAdditionInfo(*args->GetOpArg(op::OP_INPUT_ARG),
                                                      *args->GetOpArg(op::OP_OUTPUT_ARG), taskType,
                                                      GetThreadLocalContext().profilingInfoId_.summaryItemId_);
@@ -596,8 +599,8 @@ public:
                 MsprofGeTaskType taskType = MSPROF_GE_TASK_TYPE_AIV;
                 // only level1 profiling need to report addition info
                 if (op::internal::opProfilingSwitch.additionInfoFlag) {
-                    op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ = GenKernelLauncherId(
-                        op::OpTypeDict::ToString(opType_).GetString());
+                    op::internal::GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ =
+                        ProfReportCache::Instance().GetKernelLauncherId(opType_);
                     op::internal::ReportAdditionInfo(*args->GetOpArg(op::OP_INPUT_ARG),
                                                      *args->GetOpArg(op::OP_OUTPUT_ARG), taskType,
                                                      GetThreadLocalContext().profilingInfoId_.summaryItemId_);
@@ -675,7 +678,8 @@ public:
             CHECK_COND(res != nullptr, ACLNN_ERR_INNER_NULLPTR, "Get static tiling context output failed.");
         }
 
-        if (!memSetValue_.empty()) {
+        // the executor has zeroed the regions already when the memset is fused into the one of the whole Run
+        if (!memSetValue_.empty() && !GetThreadLocalContext().memSetFused_) {
             CHECK_RET_CODE(MemsetOutputTensor(stream, args), "Memset Output Tensor failed");
         }
         OP_LOGW("Core type: %s.", coreType_.c_str());
@@ -833,6 +837,9 @@ public:
         return ACLNN_SUCCESS;
     }
 
+    // Loads the binary and prepares what its first launch would, without launching anything.
+    aclnnStatus Prewarm(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs, bool runTiling);
+
     aclnnStatus MemsetOutputTensor([[maybe_unused]] aclrtStream stream, OpArgContext* args)
     {
         OpKernelBin* memsetBin = nullptr;
@@ -869,6 +876,31 @@ public:
         return ACLNN_SUCCESS;
     }
 
+    // Collects the regions MemsetOutputTensor would zero for args without launching the memset, false if they can
+    // not be zeroed by one MemSetV2 launch of the executor, e.g. when the memset pads the regions.
+    bool CollectMemSetTensorInfo(OpArgContext* args, std::vector<MemSetTensorInfo>& memsetTensorInfo)
+    {
+        if (memSetValue_.empty() || hasDevPtrArg_) {
+            return false;
+        }
+        NpuArch npuArch = GetCurrentPlatformInfo().GetCurNpuArch();
+        if (npuArch != NpuArch::DAV_2201 && npuArch != NpuArch::DAV_3510) {
+            return false;
+        }
+        memSetValueCtx_ = memSetValue_;
+        size_t inputNum = GetAclTensorCount(*args->GetOpArg(op::OP_INPUT_ARG));
+        CollectMemSetTensor(args, inputNum, false, MemsetVersion::MEMSET_V2);
+        for (const auto& elem : memSetValueCtx_) {
+            // MemSetV2 only takes int values of int32 / uint32 tensors
+            bool isInt32 = (elem.dtype_ == op::DataType::DT_INT32 || elem.dtype_ == op::DataType::DT_UINT32);
+            if (elem.tensor_ == nullptr || (!isInt32 && elem.valueInt_ != 0)) {
+                return false;
+            }
+        }
+        memsetTensorInfo.insert(memsetTensorInfo.end(), memSetValueCtx_.begin(), memSetValueCtx_.end());
+        return true;
+    }
+
     void SetMemSetFlagFromJson();
 
     aclnnStatus GetBinJson(nlohmann::json& jsonObj);
@@ -881,6 +913,8 @@ public:
     const KeyAndDetail& GetKeyAndDetail() { return keyAndDetail_; }
 
     bool GetHasDevPtrArg() const { return hasDevPtrArg_; }
+    // the launches of the bin memset some outputs first, which CollectMemSetTensorInfo may hoist
+    bool HasFusibleMemSet() const { return !memSetValue_.empty() && !hasDevPtrArg_; }
 
     uint32_t GetStaticKernelDynUBufSize() const { return staticKernelDynUBufSize_; }
 
@@ -909,6 +943,7 @@ private:
     aclnnStatus JsonLoadImpl(nlohmann::json& jsonObj);
 
     uint64_t GetAttrId(OpArgContext* args);
+    uint64_t GenAttrHashId(OpArgContext* args);
 
     void CollectMemSetTensor(OpArgContext* args, size_t inputNum, bool needAlign, MemsetVersion memsetVersion)
     {
@@ -1207,6 +1242,8 @@ private:
 
     std::unordered_map<ThreadCoreNum, std::once_flag, ThreadCoreNum::Hash> tilingParseCtxInitFlag_;
     std::mutex mapMutex_;
+    // compile info json of the bin dumped once, shared by the tiling parse of every core-count variant
+    std::shared_ptr<const std::string> compileInfoStr_;
     std::once_flag& getFlagForKey(const ThreadCoreNum& key)
     {
         std::lock_guard<std::mutex> lock(mapMutex_);
@@ -1306,6 +1343,27 @@ public:
         return bin->GetWorkspace(size, num, inputs, outputs, attrs);
     }
 
+    aclnnStatus Prewarm(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs, bool runTiling)
+    {
+        if (bins_.empty()) {
+            OP_LOGW("Op %s does not has any binary.", op::OpTypeDict::ToString(opType_).GetString());
+            return ACLNN_ERR_INNER_OPP_KERNEL_PKG_NOT_FOUND;
+        }
+        auto bin = SelectBin(inputs, outputs, attrs);
+        if (bin == nullptr) {
+            OP_LOGW("Cannot find binary for op %s.", op::OpTypeDict::ToString(opType_).GetString());
+            return ACLNN_ERR_INNER;
+        }
+        CHECK_RET_CODE(bin->JsonLoad(), "JsonLoad failed");
+        if (runTiling && !valueDependIndex_.empty()) {
+            // the tiling would read the data of the value-depend inputs, which prewarm tensors do not have
+            OP_LOGI("Skip the prewarm tiling of op %s with %zu value-depend inputs.",
+                    op::OpTypeDict::ToString(opType_).GetString(), valueDependIndex_.size());
+            runTiling = false;
+        }
+        return bin->Prewarm(inputs, outputs, attrs, runTiling);
+    }
+
     template <typename CONTAINER>
     static std::string IntegerVecToString(const CONTAINER& integer_vec)
     {
@@ -1332,12 +1390,11 @@ public:
         return result;
     }
 
-    aclnnStatus GenerateStaticParam(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs, const char*& simpKey)
+    aclnnStatus CollectStaticParam(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs,
+                                   FVector<const aclTensor*>& tensors, FVector<int64_t>& dynamicCount,
+                                   FVector<NnopbaseAttrAddr*>& attrsVec)
     {
-        FVector<const aclTensor*> tensors;
         FVector<int64_t> dynamicIndex;
-        FVector<int64_t> dynamicCount;
-        FVector<NnopbaseAttrAddr*> attrsVec;
         CHECK_RET_CODE(inputs.VisitBy([&, this]([[maybe_unused]] size_t idx, OpArg& elem) {
             return AppendTensor(elem, tensors, dynamicIndex, dynamicCount);
         }),
@@ -1357,10 +1414,25 @@ public:
         CHECK_RET_CODE(
             attrs.VisitBy([&, this](size_t idx, OpArg& elem) { return AppendAttr(attrInfoSize, idx, elem, attrsVec); }),
             "Append attr failed.");
-
-        int64_t implMode = ToIndex(GetCurrentImplMode());
         OP_LOGD("tensor size %zu; dynamic index %s, dynamic count %s. Attr size %zu.", tensors.size(),
                 IntegerVecToString(dynamicIndex).c_str(), IntegerVecToString(dynamicCount).c_str(), attrsVec.size());
+        return ACLNN_SUCCESS;
+    }
+
+    aclnnStatus GenerateStaticParam(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs, const char*& simpKey)
+    {
+        FVector<const aclTensor*> tensors;
+        FVector<int64_t> dynamicCount;
+        FVector<NnopbaseAttrAddr*> attrsVec;
+        auto ret = CollectStaticParam(inputs, outputs, attrs, tensors, dynamicCount, attrsVec);
+        if (ret != ACLNN_SUCCESS) {
+            for (auto& attr : attrsVec) {
+                op::internal::BlockPool::Free(attr);
+            }
+            return ret;
+        }
+
+        int64_t implMode = ToIndex(GetCurrentImplMode());
         int64_t determinConfig = GetThreadLocalContext().opConfigInfo_.isDeterministicOn_ ? 1 : 0;
         OP_LOGD("implMode %ld, determin %ld. tensor size %zu, dynamic size %zu, attr size %zu, value depend size %zu.",
                 implMode, determinConfig, tensors.size(), dynamicCount.size(), attrsVec.size(),
@@ -1395,8 +1467,16 @@ public:
     /* Generate mapping of {simplified_key -> the path of json and bin} */
     aclnnStatus AppendDynBin(const std::string& jsonPath, const std::string& binAndJsonDir, bool debug);
 
+    /* Select static bins by the precompiled index instead of the bin collector; nullptr index unbinds it. */
+    aclnnStatus SetStaticKernelIndex(const std::shared_ptr<const StaticKernelIndex>& index,
+                                     const std::string& binAndJsonDir);
+
     OpKernelBin* SelectStaticBin(OpArgList& inputs, OpArgList& outputs, OpArgList& attrs)
     {
+        const auto binding = staticIndexBinding_.load(std::memory_order_acquire);
+        if (binding != nullptr) {
+            return SelectStaticBinFromIndex(*binding, inputs, outputs, attrs);
+        }
         const std::lock_guard<std::mutex> lock(staticKernelsMutex_);
         if (staticBins_.empty()) {
             return nullptr;
@@ -1480,6 +1560,15 @@ public:
     }
 
 private:
+    struct StaticIndexBinding {
+        std::shared_ptr<const StaticKernelIndex> index;
+        const StaticKernelIndexOp* op = nullptr;
+        std::vector<OpKernelBin*> bins; // indexed by entry - op->entryBegin
+    };
+
+    OpKernelBin* SelectStaticBinFromIndex(const StaticIndexBinding& binding, OpArgList& inputs, OpArgList& outputs,
+                                          OpArgList& attrs);
+
     aclnnStatus AppendTensor(const aclTensor* tensor, FVector<const aclTensor*>& tensors,
                              FVector<int64_t>& dynamicIndex, FVector<int64_t>& dynamicCount) const;
 
@@ -1772,6 +1861,9 @@ protected:
 
 private:
     std::mutex staticKernelsMutex_;
+    std::atomic<const StaticIndexBinding*> staticIndexBinding_{nullptr};
+    // replaced bindings stay alive, SelectStaticBin reads the binding without taking staticKernelsMutex_
+    std::vector<std::unique_ptr<StaticIndexBinding>> staticIndexBindings_;
 };
 
 ge::DataType GetDataType(const string& dataType);
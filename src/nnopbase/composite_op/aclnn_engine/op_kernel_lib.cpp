@@ -15,6 +15,7 @@
 
 #include "utils/string_utils.h"
 #include "file_utils.h"
+#include "opp_manifest.h"
 #include "opdev/op_log.h"
 #include "acl/acl_rt.h"
 #include "nnopbase_error_msg.h"
@@ -27,6 +28,17 @@ constexpr char const* VALUE = "value";
 constexpr char const* AICORE_IMPL_PATH_SUFFIX = "/built-in/op_impl/ai_core/tbe/";
 constexpr char const* CUSTOM_IMPL_PATH_SUFFIX = "/op_impl/ai_core/tbe/";
 constexpr char const* KERNEL_CONFIG_SUFFIX = "config/";
+
+void AppendRealFilePath(const std::string& realDir, const std::string& fileName, OppEntryType type,
+                        std::vector<std::string>& paths)
+{
+    const std::string realFilePath = RealEntryPath(realDir, fileName, type);
+    if (realFilePath.empty()) {
+        OP_LOGW("Skip file [%s] in [%s], real path is empty.", fileName.c_str(), realDir.c_str());
+        return;
+    }
+    paths.emplace_back(realFilePath);
+}
 } // namespace
 
 using namespace std;
@@ -257,32 +269,30 @@ const std::vector<std::string> OpKernelLib::GetBuiltInFilePaths()
 {
     std::vector<std::string> configFilePaths;
     std::vector<std::string> configFileNames;
-    std::vector<std::string> orderedConfigFileNames;
+    std::vector<OppEntryType> configFileTypes;
     std::string configFileDir = GetAiCoreImplPath();
     configFileDir.append(KERNEL_CONFIG_SUFFIX);
     configFileDir.append(GetSocPath());
-    OP_CHECK(ReadDirBySuffix(configFileDir, ".json", configFileNames) == ACLNN_SUCCESS,
+    const std::string realConfigFileDir = RealPath(configFileDir);
+    OP_CHECK(!realConfigFileDir.empty() &&
+                 ListFilesBySuffix(realConfigFileDir, ".json", configFileNames, &configFileTypes) == ACLNN_SUCCESS,
              OP_LOGW("Failed to read dir: %s", configFileDir.c_str()), return configFilePaths);
     OP_CHECK(!configFileNames.empty(), OP_LOGW("configFileNames is emtpy in %s", configFileDir.c_str()),
              return configFilePaths);
-    bool hasLegacyFile = false;
-    std::string lebacyFileName;
-    for (auto& fileName : configFileNames) {
-        if (fileName.find("ops-info-legacy") != std::string::npos) {
-            hasLegacyFile = true;
-            lebacyFileName = fileName;
-        } else {
-            orderedConfigFileNames.emplace_back(fileName);
+    size_t legacyIndex = configFileNames.size();
+    for (size_t i = 0U; i < configFileNames.size(); i++) {
+        if (configFileNames[i].find("ops-info-legacy") != std::string::npos) {
+            legacyIndex = i;
         }
     }
-    if (hasLegacyFile) {
-        orderedConfigFileNames.emplace_back(lebacyFileName);
+    for (size_t i = 0U; i < configFileNames.size(); i++) {
+        if (configFileNames[i].find("ops-info-legacy") == std::string::npos) {
+            AppendRealFilePath(realConfigFileDir, configFileNames[i], configFileTypes[i], configFilePaths);
+        }
     }
-
-    for (const std::string& fileName : orderedConfigFileNames) {
-        const std::string configFilePath = configFileDir + fileName;
-        const std::string realConfigFilePath = RealPath(configFilePath);
-        OP_CHECK_NO_RETURN(realConfigFilePath == "", configFilePaths.emplace_back(realConfigFilePath));
+    if (legacyIndex < configFileNames.size()) {
+        AppendRealFilePath(realConfigFileDir, configFileNames[legacyIndex], configFileTypes[legacyIndex],
+                           configFilePaths);
     }
 
     return configFilePaths;
@@ -301,21 +311,17 @@ const std::vector<std::string> OpKernelLib::GetOppVendorsFilePaths()
         const std::string customFileDir = oppPathStr + "/vendors/" + vendorName + CUSTOM_IMPL_PATH_SUFFIX +
                                           KERNEL_CONFIG_SUFFIX + GetSocPath();
         std::vector<std::string> customFileNames;
+        std::vector<OppEntryType> customFileTypes;
         std::string realCustomFileDir = RealPath(customFileDir);
         if (realCustomFileDir == "") {
             OP_LOGW("custom file dir [%s] is null, skip vendor [%s].", customFileDir.c_str(), vendorName.c_str());
             continue;
         }
-        OP_CHECK_NO_RETURN(ReadDirBySuffix(realCustomFileDir, ".json", customFileNames) == ACLNN_SUCCESS,
-                           OP_LOGW("Failed to read dir: %s", customFileDir.c_str()));
-        for (const auto& fileName : customFileNames) {
-            const std::string customFilePath = customFileDir + fileName;
-            const std::string realCustomFilePath = RealPath(customFilePath);
-            if (realCustomFilePath.empty()) {
-                OP_LOGW("Skip path [%s], real path is empty.", customFilePath.c_str());
-            } else {
-                oppVendorsFilePaths.emplace_back(realCustomFilePath);
-            }
+        OP_CHECK_NO_RETURN(
+            ListFilesBySuffix(realCustomFileDir, ".json", customFileNames, &customFileTypes) == ACLNN_SUCCESS,
+            OP_LOGW("Failed to read dir: %s", customFileDir.c_str()));
+        for (size_t i = 0U; i < customFileNames.size(); i++) {
+            AppendRealFilePath(realCustomFileDir, customFileNames[i], customFileTypes[i], oppVendorsFilePaths);
         }
     }
     return oppVendorsFilePaths;
@@ -335,16 +341,12 @@ const std::vector<std::string> OpKernelLib::GetCustomOppFilePaths()
             continue;
         }
         std::vector<std::string> customFileNames;
-        OP_CHECK_NO_RETURN(ReadDirBySuffix(realCustomFileDir, ".json", customFileNames) == ACLNN_SUCCESS,
-                           OP_LOGW("Failed to read dir: %s", customFileDir.c_str()));
-        for (const auto& fileName : customFileNames) {
-            const std::string customFilePath = customFileDir + fileName;
-            const std::string realCustomFilePath = RealPath(customFilePath);
-            if (realCustomFilePath.empty()) {
-                OP_LOGW("Skip path [%s], real path is empty.", customFilePath.c_str());
-            } else {
-                customOppFilePaths.emplace_back(realCustomFilePath);
-            }
+        std::vector<OppEntryType> customFileTypes;
+        OP_CHECK_NO_RETURN(
+            ListFilesBySuffix(realCustomFileDir, ".json", customFileNames, &customFileTypes) == ACLNN_SUCCESS,
+            OP_LOGW("Failed to read dir: %s", customFileDir.c_str()));
+        for (size_t i = 0U; i < customFileNames.size(); i++) {
+            AppendRealFilePath(realCustomFileDir, customFileNames[i], customFileTypes[i], customOppFilePaths);
         }
     }
     return customOppFilePaths;
@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "side_task_fusion.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "mmpa/mmpa_api.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_log.h"
+#include "bridge_dfx.h"
+#include "launcher_ctx.h"
+#include "memset_op.h"
+#include "non_finite_check_op.h"
+#include "op_kernel.h"
+
+namespace op::internal {
+namespace {
+constexpr size_t kEnvBufLen = 16U;
+
+bool ReadSideTaskFusionEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_FUSE_SIDE_TASKS", &buf[0U], kEnvBufLen) != EN_OK) {
+        return true;
+    }
+    return strcmp(buf, "0") != 0;
+}
+
+void AppendTensorRange(const aclTensor* tensor, std::vector<DevMemRange>& ranges)
+{
+    if (tensor == nullptr || tensor->GetPlacement() == gert::kOnHost || tensor->GetData() == nullptr) {
+        return;
+    }
+    // the storage size from the data address covers every element of a strided view
+    int64_t bytes = op::CalcShapeBytes(tensor->Size(), tensor->GetDataType(), true);
+    if (bytes <= 0) {
+        return;
+    }
+    uintptr_t begin = reinterpret_cast<uintptr_t>(tensor->GetData());
+    ranges.emplace_back(DevMemRange{begin, begin + static_cast<uintptr_t>(bytes)});
+}
+
+void AppendArgRanges(OpArgContext* args, OpArgDef argDef, std::vector<DevMemRange>& ranges)
+{
+    if (!args->ContainsOpArgType(argDef)) {
+        return;
+    }
+    args->GetOpArg(argDef)->VisitByNoReturn([&ranges]([[maybe_unused]] size_t idx, OpArg& arg) {
+        if (arg.type == OpArgType::OPARG_ACLTENSOR) {
+            AppendTensorRange(reinterpret_cast<const aclTensor*>(arg->pointer), ranges);
+        } else if (arg.type == OpArgType::OPARG_ACLTENSOR_LIST) {
+            auto tensorList = reinterpret_cast<const aclTensorList*>(arg->pointer);
+            for (uint64_t i = 0; tensorList != nullptr && i < tensorList->Size(); i++) {
+                AppendTensorRange((*tensorList)[i], ranges);
+            }
+        }
+    });
+}
+
+bool IsOverlapped(const std::vector<DevMemRange>& lhs, const std::vector<DevMemRange>& rhs)
+{
+    for (const auto& l : lhs) {
+        for (const auto& r : rhs) {
+            if (l.begin < r.end && r.begin < l.end) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void AppendRanges(const std::vector<DevMemRange>& src, std::vector<DevMemRange>& dst)
+{
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+} // namespace
+
+std::atomic<bool> SideTaskFusion::enabled_{ReadSideTaskFusionEnable()};
+
+void PlanSideTaskFusion(const std::vector<SideTaskLaunchInfo>& launchInfos, bool deferCheck,
+                        std::vector<bool>& memSetFused, std::vector<bool>& checkDeferred)
+{
+    size_t launchNum = launchInfos.size();
+    memSetFused.assign(launchNum, false);
+    checkDeferred.assign(launchNum, false);
+
+    // a hoisted memset runs before every earlier launch, which must neither read nor write the zeroed regions
+    std::vector<DevMemRange> touched;
+    size_t fusedNum = 0;
+    for (size_t i = 0; i < launchNum && launchInfos[i].visible; i++) {
+        const auto& info = launchInfos[i];
+        if (info.memSetFusible && !IsOverlapped(info.memSetRanges, touched)) {
+            memSetFused[i] = true;
+            fusedNum++;
+        }
+        AppendRanges(info.reads, touched);
+        AppendRanges(info.writes, touched);
+        AppendRanges(info.scratch, touched);
+    }
+    if (fusedNum < 2U) {
+        memSetFused.assign(launchNum, false);
+    }
+
+    if (!deferCheck) {
+        return;
+    }
+    // a deferred check reads the outputs and dumps the inputs after every later launch, which must not write them
+    std::vector<DevMemRange> written;
+    size_t deferredNum = 0;
+    for (size_t i = launchNum; i > 0 && launchInfos[i - 1].visible; i--) {
+        const auto& info = launchInfos[i - 1];
+        if (!IsOverlapped(info.reads, written) && !IsOverlapped(info.writes, written)) {
+            checkDeferred[i - 1] = true;
+            deferredNum++;
+        }
+        AppendRanges(info.writes, written);
+        AppendRanges(info.scratch, written);
+    }
+    if (deferredNum < 2U) {
+        checkDeferred.assign(launchNum, false);
+    }
+}
+
+bool SideTaskFusion::IsCheckDeferrable(aclrtStream stream)
+{
+    if (!IsOverflowDumpEnable()) {
+        return false;
+    }
+    // the saturation mode reads the overflow status of the last launch only
+    aclrtFloatOverflowMode floatOverflowMode = ACL_RT_OVERFLOW_MODE_SATURATION;
+    if (aclrtGetDeviceSatMode(&floatOverflowMode) != ACL_SUCCESS ||
+        floatOverflowMode != ACL_RT_OVERFLOW_MODE_INFNAN) {
+        return false;
+    }
+    aclmdlRICaptureStatus status;
+    aclmdlRI captureMdl;
+    if ((aclmdlRICaptureGetInfo(stream, &status, &captureMdl) == ACL_SUCCESS) &&
+        (status == ACL_MODEL_RI_CAPTURE_STATUS_ACTIVE)) {
+        return false;
+    }
+    return true;
+}
+
+void SideTaskFusion::Prepare(const std::vector<KernelLauncher*>& launchers)
+{
+    launchers_ = &launchers;
+    memSetFused_.clear();
+    checkDeferred_.clear();
+    fusedMemSetInfo_.clear();
+    size_t launchNum = launchers.size();
+    if (!IsEnabled() || launchNum < 2U || launchNum > kSideTaskFusionMaxLaunchers) {
+        return;
+    }
+    // most runs have neither two memsets to hoist nor an overflow check to defer, skip collecting the ranges
+    const bool deferCheck = IsCheckDeferrable(stream_);
+    if (!deferCheck) {
+        size_t memSetNum = 0U;
+        for (size_t i = 0; i < launchNum && memSetNum < 2U; i++) {
+            OpKernelBin* bin = launchers[i]->GetLaunchBin();
+            if (bin != nullptr && bin->HasFusibleMemSet()) {
+                memSetNum++;
+            }
+        }
+        if (memSetNum < 2U) {
+            return;
+        }
+    }
+
+    std::vector<SideTaskLaunchInfo> launchInfos(launchNum);
+    std::vector<std::vector<MemSetTensorInfo>> memSetInfos(launchNum);
+    for (size_t i = 0; i < launchNum; i++) {
+        OpArgContext* args = launchers[i]->GetLaunchArgs();
+        if (args == nullptr) {
+            continue;
+        }
+        auto& info = launchInfos[i];
+        info.visible = true;
+        AppendArgRanges(args, op::OP_INPUT_ARG, info.reads);
+        AppendArgRanges(args, op::OP_OUTPUT_ARG, info.writes);
+        AppendArgRanges(args, op::OP_OUTSHAPE_ARG, info.writes);
+        AppendArgRanges(args, op::OP_WORKSPACE_ARG, info.scratch);
+        OpKernelBin* bin = launchers[i]->GetLaunchBin();
+        if (bin != nullptr && bin->CollectMemSetTensorInfo(args, memSetInfos[i])) {
+            info.memSetFusible = true;
+            for (const auto& elem : memSetInfos[i]) {
+                AppendTensorRange(elem.tensor_, info.memSetRanges);
+            }
+        }
+    }
+
+    PlanSideTaskFusion(launchInfos, deferCheck, memSetFused_, checkDeferred_);
+    for (size_t i = 0; i < launchNum; i++) {
+        if (memSetFused_[i]) {
+            fusedMemSetInfo_.insert(fusedMemSetInfo_.end(), memSetInfos[i].begin(), memSetInfos[i].end());
+        }
+    }
+}
+
+void SideTaskFusion::LaunchFusedMemSet()
+{
+    if (fusedMemSetInfo_.empty()) {
+        return;
+    }
+    OP_LOGI("fuse memsets of %zu regions into one launch.", fusedMemSetInfo_.size());
+    OpKernelBin* memsetBin = nullptr;
+    aclnnStatus ret = SelectMemsetOpBin(MemsetVersion::MEMSET_V2, fusedMemSetInfo_.size(), memsetBin);
+#if !defined(NNOPBASE_UT) && !defined(NNOPBASE_ST)
+    if (ret == ACLNN_SUCCESS) {
+        ret = memsetBin->MemSetV2(stream_, fusedMemSetInfo_);
+    }
+#endif
+    if (ret != ACLNN_SUCCESS) {
+        OP_LOGW("fused memset failed, ret %d, memset before every launch instead.", ret);
+        memSetFused_.assign(memSetFused_.size(), false);
+    }
+    fusedMemSetInfo_.clear();
+}
+
+void SideTaskFusion::RunDeferredCheck()
+{
+    std::unordered_map<op::DataType, std::vector<aclTensor*>> dtype2Tensors;
+    size_t deferredNum = 0;
+    for (size_t i = 0; i < checkDeferred_.size(); i++) {
+        if (checkDeferred_[i]) {
+            NonFiniteCheckOp::CollectNonFiniteCheckTensor(dtype2Tensors, (*launchers_)[i]->GetLaunchArgs());
+            deferredNum++;
+        }
+    }
+    if (deferredNum == 0) {
+        return;
+    }
+    OP_LOGI("check the outputs of %zu launches for inf/nan at once.", deferredNum);
+    // the tiling result cached for the last launch must not be taken for the check
+    GetLauncherCtx().ClearTilingCache();
+    bool dump = false;
+    NonFiniteCheckOpContext nonFiniteCheckOpCtx(executor_, stream_, nullptr);
+    aclnnStatus ret = NonFiniteCheckOp::RunNonfiniteCheckOp(nonFiniteCheckOpCtx, dtype2Tensors, dump);
+    OP_CHECK_NO_RETURN(ret == ACLNN_SUCCESS, OP_LOGW("fused non finite check failed, ret %d", ret));
+    if (ret == ACLNN_SUCCESS && !dump) {
+        return;
+    }
+    // find and dump the launches that overflowed
+    for (size_t i = 0; i < checkDeferred_.size(); i++) {
+        if (checkDeferred_[i]) {
+            (*launchers_)[i]->UpdateThreadLocal();
+            (*launchers_)[i]->OverflowDump();
+        }
+    }
+}
+
+} // namespace op::internal
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_API_OP_API_COMMON_INC_OPDEV_SIDE_TASK_FUSION_H
+#define OP_API_OP_API_COMMON_INC_OPDEV_SIDE_TASK_FUSION_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "acl/acl_rt.h"
+#include "opdev/common_types.h"
+#include "opdev/op_arg_def.h"
+#include "kernel_launcher.h"
+#include "memset_ctx_holder.h"
+
+namespace op::internal {
+
+// runs with more launches are not fused, the planning is quadratic in the number of launches
+constexpr size_t kSideTaskFusionMaxLaunchers = 64U;
+
+struct DevMemRange {
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+// Device memory touched by one launch of a Run.
+struct SideTaskLaunchInfo {
+    // false if the args of the launch are unknown, the launch may touch any memory
+    bool visible{false};
+    // the memset before the launch can be done by MemSetV2
+    bool memSetFusible{false};
+    std::vector<DevMemRange> reads;   // inputs
+    std::vector<DevMemRange> writes;  // outputs and outshape
+    std::vector<DevMemRange> scratch; // workspace
+    std::vector<DevMemRange> memSetRanges;
+};
+
+/**
+ * Decides which side tasks of the launches of one Run are done once for the whole Run.
+ * The memset of a launch is hoisted into one memset at the start of the Run when no earlier launch touches the
+ * zeroed regions. The overflow check of a launch is deferred to one check at the end of the Run when no later
+ * launch writes the tensors the check reads or dumps. Nothing is fused across an invisible launch, and a side task
+ * is not fused when fewer than two launches would share it.
+ */
+void PlanSideTaskFusion(const std::vector<SideTaskLaunchInfo>& launchInfos, bool deferCheck,
+                        std::vector<bool>& memSetFused, std::vector<bool>& checkDeferred);
+
+/**
+ * Fuses the memsets and the inf/nan overflow checks of the launches of aclOpExecutor::Run, so that a composite op
+ * pays one memset launch and one NonFiniteCheck launch per data type instead of one of each per launch.
+ * The launches left out by PlanSideTaskFusion keep their own side tasks. ACLNN_FUSE_SIDE_TASKS=0 disables it.
+ */
+class SideTaskFusion {
+public:
+    SideTaskFusion(aclOpExecutor* executor, aclrtStream stream) : executor_(executor), stream_(stream) {}
+
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+    static void SetEnable(bool enable) { enabled_.store(enable, std::memory_order_relaxed); }
+
+    // launchers are in launch order and must outlive RunDeferredCheck
+    void Prepare(const std::vector<KernelLauncher*>& launchers);
+
+    bool IsMemSetFused(size_t idx) const { return idx < memSetFused_.size() && memSetFused_[idx]; }
+    bool IsCheckDeferred(size_t idx) const { return idx < checkDeferred_.size() && checkDeferred_[idx]; }
+
+    // Zeroes the regions of all hoisted memsets, every launch memsets for itself again if it fails.
+    void LaunchFusedMemSet();
+
+    // Checks the outputs of all deferred launches, and dumps the launches that overflowed.
+    void RunDeferredCheck();
+
+private:
+    static bool IsCheckDeferrable(aclrtStream stream);
+
+    static std::atomic<bool> enabled_;
+
+    aclOpExecutor* executor_;
+    aclrtStream stream_;
+    const std::vector<KernelLauncher*>* launchers_{nullptr};
+    std::vector<bool> memSetFused_;
+    std::vector<bool> checkDeferred_;
+    std::vector<MemSetTensorInfo> fusedMemSetInfo_;
+};
+
+} // namespace op::internal
+
+#endif
@@ -0,0 +1,514 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "static_kernel_index.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mmpa/mmpa_api.h"
+#include "opdev/op_errno.h"
+#include "opdev/op_log.h"
+#include "executor/indv_executor.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr char kIndexMagic[8] = {'A', 'C', 'L', 'N', 'N', 'S', 'K', 'I'};
+constexpr uint32_t kIndexVersion = 2U;
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+constexpr size_t kBinKeyMultiplier = 4U; // same buffer size the collector converts a simplified key with
+constexpr const char* kBinSuffix = ".o";
+constexpr const char* kJsonSuffix = ".json";
+constexpr const char* kStaticList = "staticList";
+constexpr const char* kValueDependIndex = "valueDependIndex";
+constexpr const char* kSimplifiedKey = "simplifiedKey";
+constexpr const char* kBinPath = "binPath";
+constexpr size_t kCacheEnvBufLen = 4096U;
+constexpr mode_t kCacheDirMode = 0700;
+
+uint64_t Fnv1a(uint64_t hash, const void* data, size_t len)
+{
+    const auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0U; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+std::string GetCacheRoot()
+{
+    char buf[kCacheEnvBufLen] = {};
+    if (mmGetEnv("ASCEND_CACHE_PATH", &buf[0U], kCacheEnvBufLen) == EN_OK && buf[0U] != '\0') {
+        return std::string(&buf[0U]) + "/";
+    }
+    if (mmGetEnv("XDG_CACHE_HOME", &buf[0U], kCacheEnvBufLen) == EN_OK && buf[0U] != '\0') {
+        return std::string(&buf[0U]) + "/";
+    }
+    if (mmGetEnv("HOME", &buf[0U], kCacheEnvBufLen) == EN_OK && buf[0U] != '\0') {
+        return std::string(&buf[0U]) + "/.cache/";
+    }
+    return "";
+}
+
+// mkdir -p of the dir part of path
+bool CreateParentDir(const std::string& path)
+{
+    for (size_t pos = path.find('/', 1U); pos != std::string::npos; pos = path.find('/', pos + 1U)) {
+        const std::string dir = path.substr(0U, pos);
+        if (mkdir(dir.c_str(), kCacheDirMode) != 0 && errno != EEXIST) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t CompareName(const uint8_t* name, uint32_t nameLen, const std::string& opType)
+{
+    const size_t len = std::min(static_cast<size_t>(nameLen), opType.size());
+    const int32_t ret = memcmp(name, opType.data(), len);
+    if (ret != 0) {
+        return ret;
+    }
+    if (nameLen == opType.size()) {
+        return 0;
+    }
+    return nameLen < opType.size() ? -1 : 1;
+}
+
+bool InRange(uint64_t offset, uint64_t len, uint64_t size) { return offset <= size && len <= size - offset; }
+
+uint32_t AppendBlob(std::string& blob, const void* data, size_t len)
+{
+    const auto offset = static_cast<uint32_t>(blob.size());
+    blob.append(static_cast<const char*>(data), len);
+    return offset;
+}
+bool GetSimplifiedKeys(const nlohmann::json& binInfo, std::vector<std::string>& keys)
+{
+    try {
+        const auto& simplifiedKey = binInfo.at(kSimplifiedKey);
+        if (simplifiedKey.is_array()) {
+            keys = simplifiedKey.get<std::vector<std::string>>();
+        } else {
+            keys = {simplifiedKey.get<std::string>()};
+        }
+    } catch (const nlohmann::json::exception& e) {
+        return false;
+    }
+    return true;
+}
+
+// the fields without which the bin collector skips a static kernel
+bool IsCollectableStaticBin(const nlohmann::json& binInfo)
+{
+    try {
+        (void)binInfo.at("coreType").get<int32_t>();
+        const auto& binDesc = binInfo.at("binDesc");
+        (void)binDesc.at("blockDim").get<uint32_t>();
+        (void)binDesc.at("kernelName").get<std::string>();
+        auto workspaceIter = binDesc.find("workspace");
+        return workspaceIter == binDesc.end() || workspaceIter->size() <= NNOPBASE_NORM_MAX_WORKSPACE_NUMS;
+    } catch (const nlohmann::json::exception& e) {
+        return false;
+    }
+}
+
+// Like the collector, the platform info of the previous kernel of the op is kept if the json of this one is missing.
+void UpdatePlatformInfo(const std::string& kernelJsonPath, StaticKernelIndexBuildEntry& platform)
+{
+    std::ifstream f(kernelJsonPath);
+    if (!f.is_open()) {
+        return;
+    }
+    nlohmann::json kernelJson;
+    try {
+        kernelJson = nlohmann::json::parse(f);
+    } catch (const nlohmann::json::exception& e) {
+        return;
+    }
+    try {
+        if (kernelJson.contains("platformInfo")) {
+            const auto& platformInfo = kernelJson["platformInfo"];
+            platform.hasPlatformInfo = true;
+            platform.deterministicLevel = -1;
+            platform.aicNum = platformInfo.at("cubeCoreCnt").get<uint32_t>();
+            platform.aivNum = platformInfo.at("vectorCoreCnt").get<uint32_t>();
+            if (platformInfo.contains("deterministicLevel")) {
+                platform.deterministicLevel = platformInfo["deterministicLevel"].get<int8_t>();
+            }
+        }
+    } catch (const nlohmann::json::exception& e) {
+        platform.hasPlatformInfo = false;
+        OP_LOGW("Failed to read platformInfo of %s, reason: %s", kernelJsonPath.c_str(), e.what());
+    }
+}
+} // namespace
+
+StaticKernelIndex::~StaticKernelIndex()
+{
+    if (mapped_ != nullptr) {
+        (void)munmap(mapped_, size_);
+        mapped_ = nullptr;
+    }
+}
+
+uint64_t StaticKernelIndex::HashKey(const uint8_t* key, size_t len)
+{
+    // the hash is persisted, so it must not depend on the std::hash of the running library
+    return Fnv1a(kFnvOffsetBasis, key, len);
+}
+
+StaticKernelIndexSource StaticKernelIndex::GetSource(const std::string& configContent, const std::string& binAndJsonDir)
+{
+    StaticKernelIndexSource source;
+    source.digest = Fnv1a(kFnvOffsetBasis, &kIndexVersion, sizeof(kIndexVersion));
+    source.digest = Fnv1a(source.digest, binAndJsonDir.c_str(), binAndJsonDir.size() + 1U);
+    source.digest = Fnv1a(source.digest, configContent.data(), configContent.size());
+    return source;
+}
+
+std::string StaticKernelIndex::GetCachePath(const std::string& configPath)
+{
+    const std::string cacheRoot = GetCacheRoot();
+    if (cacheRoot.empty()) {
+        return "";
+    }
+    // one file per config, the index of an upgraded package replaces the former one
+    char name[32] = {};
+    (void)snprintf(&name[0U], sizeof(name), "%016" PRIx64 ".bin",
+                   HashKey(reinterpret_cast<const uint8_t*>(configPath.data()), configPath.size()));
+    return cacheRoot + STATIC_KERNEL_INDEX_CACHE_DIR + name;
+}
+
+std::shared_ptr<const StaticKernelIndex> StaticKernelIndex::Build(
+    const std::vector<StaticKernelIndexBuildOp>& ops, const std::vector<StaticKernelIndexBuildEntry>& entries,
+    const StaticKernelIndexSource& source)
+{
+    std::map<std::string, const StaticKernelIndexBuildOp*> opMap;
+    for (const auto& op : ops) {
+        opMap.emplace(op.opType, &op);
+    }
+    std::map<std::string, std::vector<const StaticKernelIndexBuildEntry*>> entryMap;
+    for (const auto& entry : entries) {
+        entryMap[entry.opType].push_back(&entry);
+        opMap.emplace(entry.opType, nullptr);
+    }
+
+    std::string blob;
+    std::vector<StaticKernelIndexOp> opRecords;
+    std::vector<StaticKernelIndexEntry> entryRecords;
+    for (const auto& item : opMap) {
+        StaticKernelIndexOp opRecord{};
+        opRecord.nameOffset = AppendBlob(blob, item.first.data(), item.first.size());
+        opRecord.nameLen = static_cast<uint32_t>(item.first.size());
+        if (item.second != nullptr) {
+            const auto& valueDepend = item.second->valueDependIndex;
+            opRecord.valueDependOffset = AppendBlob(blob, valueDepend.data(), valueDepend.size() * sizeof(int64_t));
+            opRecord.valueDependNum = static_cast<uint32_t>(valueDepend.size());
+        }
+        opRecord.entryBegin = static_cast<uint32_t>(entryRecords.size());
+        auto& opEntries = entryMap[item.first];
+        std::vector<std::pair<uint64_t, const StaticKernelIndexBuildEntry*>> sorted;
+        for (const auto entry : opEntries) {
+            sorted.emplace_back(HashKey(entry->staticKey.data(), entry->staticKey.size()), entry);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        for (const auto& hashAndEntry : sorted) {
+            const auto entry = hashAndEntry.second;
+            StaticKernelIndexEntry record{};
+            record.keyHash = hashAndEntry.first;
+            record.keyOffset = AppendBlob(blob, entry->staticKey.data(), entry->staticKey.size());
+            record.keyLen = static_cast<uint32_t>(entry->staticKey.size());
+            record.pathOffset = AppendBlob(blob, entry->binPath.c_str(), entry->binPath.size() + 1U);
+            record.pathLen = static_cast<uint32_t>(entry->binPath.size());
+            record.aicNum = entry->aicNum;
+            record.aivNum = entry->aivNum;
+            record.deterministicLevel = entry->deterministicLevel;
+            record.hasPlatformInfo = entry->hasPlatformInfo ? 1U : 0U;
+            entryRecords.push_back(record);
+        }
+        opRecord.entryEnd = static_cast<uint32_t>(entryRecords.size());
+        opRecords.push_back(opRecord);
+    }
+    if (blob.size() >= UINT32_MAX) {
+        OP_LOGW("Static kernel index blob is too large, size %zu.", blob.size());
+        return nullptr;
+    }
+
+    StaticKernelIndexHeader header{};
+    (void)memcpy(header.magic, kIndexMagic, sizeof(header.magic));
+    header.version = kIndexVersion;
+    header.opNum = static_cast<uint32_t>(opRecords.size());
+    header.entryNum = static_cast<uint32_t>(entryRecords.size());
+    header.sourceDigest = source.digest;
+    header.opOffset = sizeof(header);
+    header.entryOffset = header.opOffset + opRecords.size() * sizeof(StaticKernelIndexOp);
+    header.blobOffset = header.entryOffset + entryRecords.size() * sizeof(StaticKernelIndexEntry);
+    header.blobSize = blob.size();
+
+    std::shared_ptr<StaticKernelIndex> index(new (std::nothrow) StaticKernelIndex());
+    if (index == nullptr) {
+        return nullptr;
+    }
+    auto& image = index->image_;
+    image.reserve(header.blobOffset + header.blobSize);
+    image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    image.append(reinterpret_cast<const char*>(opRecords.data()), opRecords.size() * sizeof(StaticKernelIndexOp));
+    image.append(reinterpret_cast<const char*>(entryRecords.data()),
+                 entryRecords.size() * sizeof(StaticKernelIndexEntry));
+    image.append(blob);
+    index->data_ = reinterpret_cast<const uint8_t*>(image.data());
+    index->size_ = image.size();
+    if (!index->Validate()) {
+        return nullptr;
+    }
+    return index;
+}
+
+std::shared_ptr<const StaticKernelIndex> StaticKernelIndex::Load(const std::string& path,
+                                                                 const StaticKernelIndexSource& source)
+{
+    const int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(StaticKernelIndexHeader))) {
+        (void)close(fd);
+        return nullptr;
+    }
+    const auto size = static_cast<size_t>(st.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED) {
+        OP_LOGW("Failed to map static kernel index %s.", path.c_str());
+        return nullptr;
+    }
+    std::shared_ptr<StaticKernelIndex> index(new (std::nothrow) StaticKernelIndex());
+    if (index == nullptr) {
+        (void)munmap(addr, size);
+        return nullptr;
+    }
+    index->mapped_ = addr;
+    index->data_ = static_cast<const uint8_t*>(addr);
+    index->size_ = size;
+    if (!index->Validate()) {
+        OP_LOGW("Static kernel index %s is invalid, ignore it.", path.c_str());
+        return nullptr;
+    }
+    if (index->header_->sourceDigest != source.digest) {
+        OP_LOGI("Static kernel index %s is out of date.", path.c_str());
+        return nullptr;
+    }
+    return index;
+}
+
+aclnnStatus StaticKernelIndex::Save(const std::string& path) const
+{
+    if (!CreateParentDir(path)) {
+        return ACLNN_ERR_INNER;
+    }
+    // write a private file and rename it, concurrent processes never see a partial index
+    const std::string tmpPath = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream f(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) {
+            return ACLNN_ERR_INNER;
+        }
+        f.write(reinterpret_cast<const char*>(data_), static_cast<std::streamsize>(size_));
+        if (!f.good()) {
+            f.close();
+            (void)remove(tmpPath.c_str());
+            return ACLNN_ERR_INNER;
+        }
+    }
+    if (rename(tmpPath.c_str(), path.c_str()) != 0) {
+        (void)remove(tmpPath.c_str());
+        return ACLNN_ERR_INNER;
+    }
+    return ACLNN_SUCCESS;
+}
+
+bool StaticKernelIndex::Validate() const
+{
+    if (size_ < sizeof(StaticKernelIndexHeader)) {
+        return false;
+    }
+    const auto header = reinterpret_cast<const StaticKernelIndexHeader*>(data_);
+    if (memcmp(header->magic, kIndexMagic, sizeof(kIndexMagic)) != 0 || header->version != kIndexVersion) {
+        return false;
+    }
+    if (!InRange(header->opOffset, static_cast<uint64_t>(header->opNum) * sizeof(StaticKernelIndexOp), size_) ||
+        !InRange(header->entryOffset, static_cast<uint64_t>(header->entryNum) * sizeof(StaticKernelIndexEntry),
+                 size_) ||
+        !InRange(header->blobOffset, header->blobSize, size_)) {
+        return false;
+    }
+    const auto ops = reinterpret_cast<const StaticKernelIndexOp*>(data_ + header->opOffset);
+    const auto entries = reinterpret_cast<const StaticKernelIndexEntry*>(data_ + header->entryOffset);
+    const uint8_t* blob = data_ + header->blobOffset;
+    for (uint32_t i = 0U; i < header->opNum; i++) {
+        const auto& op = ops[i];
+        if (!InRange(op.nameOffset, op.nameLen, header->blobSize) ||
+            !InRange(op.valueDependOffset, static_cast<uint64_t>(op.valueDependNum) * sizeof(int64_t),
+                     header->blobSize) ||
+            op.entryBegin > op.entryEnd || op.entryEnd > header->entryNum) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0U; i < header->entryNum; i++) {
+        const auto& entry = entries[i];
+        if (!InRange(entry.keyOffset, entry.keyLen, header->blobSize) ||
+            !InRange(entry.pathOffset, static_cast<uint64_t>(entry.pathLen) + 1U, header->blobSize) ||
+            blob[entry.pathOffset + entry.pathLen] != '\0') {
+            return false;
+        }
+    }
+    auto self = const_cast<StaticKernelIndex*>(this);
+    self->header_ = header;
+    self->ops_ = ops;
+    self->entries_ = entries;
+    self->blob_ = blob;
+    return true;
+}
+
+const StaticKernelIndexOp* StaticKernelIndex::FindOp(const std::string& opType) const
+{
+    const StaticKernelIndexOp* begin = ops_;
+    const StaticKernelIndexOp* end = ops_ + header_->opNum;
+    auto iter = std::lower_bound(begin, end, opType, [this](const StaticKernelIndexOp& op, const std::string& name) {
+        return CompareName(blob_ + op.nameOffset, op.nameLen, name) < 0;
+    });
+    if (iter == end || CompareName(blob_ + iter->nameOffset, iter->nameLen, opType) != 0) {
+        return nullptr;
+    }
+    return iter;
+}
+
+void StaticKernelIndex::GetValueDependIndex(const StaticKernelIndexOp& op, FVector<int64_t>& valueDependIndex) const
+{
+    valueDependIndex.clear();
+    for (uint32_t i = 0U; i < op.valueDependNum; i++) {
+        int64_t value = 0;
+        (void)memcpy(&value, blob_ + op.valueDependOffset + i * sizeof(int64_t), sizeof(int64_t));
+        valueDependIndex.push_back(value);
+    }
+}
+
+int64_t StaticKernelIndex::Find(const StaticKernelIndexOp& op, const uint8_t* key, size_t len, uint32_t aicNum,
+                                uint32_t aivNum, int8_t deterministicLevel) const
+{
+    const uint64_t hash = HashKey(key, len);
+    const StaticKernelIndexEntry* begin = entries_ + op.entryBegin;
+    const StaticKernelIndexEntry* end = entries_ + op.entryEnd;
+    auto iter = std::lower_bound(begin, end, hash,
+                                 [](const StaticKernelIndexEntry& entry, uint64_t h) { return entry.keyHash < h; });
+    for (; iter != end && iter->keyHash == hash; ++iter) {
+        if (iter->keyLen != len || memcmp(blob_ + iter->keyOffset, key, len) != 0) {
+            continue;
+        }
+        if (iter->hasPlatformInfo != 0U) {
+            const bool coreEqual = (iter->aicNum == aicNum) && (iter->aivNum == aivNum);
+            const bool deterministicEqual =
+                (iter->deterministicLevel == -1) || (iter->deterministicLevel == deterministicLevel);
+            if (!coreEqual || !deterministicEqual) {
+                continue;
+            }
+        }
+        return iter - entries_;
+    }
+    return kStaticKernelIndexNotFound;
+}
+
+const char* StaticKernelIndex::GetBinPath(size_t entryIndex) const
+{
+    if (entryIndex >= header_->entryNum) {
+        return nullptr;
+    }
+    return reinterpret_cast<const char*>(blob_ + entries_[entryIndex].pathOffset);
+}
+
+std::shared_ptr<const StaticKernelIndex> BuildStaticKernelIndex(const nlohmann::json& staticConfig,
+                                                                const std::string& binAndJsonDir,
+                                                                const StaticKernelIndexSource& source)
+{
+    if (!staticConfig.is_object()) {
+        return nullptr;
+    }
+    std::vector<StaticKernelIndexBuildOp> ops;
+    std::vector<StaticKernelIndexBuildEntry> entries;
+    std::vector<NnopbaseUChar> binKey;
+    for (auto opIter = staticConfig.begin(); opIter != staticConfig.end(); ++opIter) {
+        if (!opIter->is_object()) {
+            continue;
+        }
+        ops.emplace_back();
+        ops.back().opType = opIter.key();
+        auto valueDependIter = opIter->find(kValueDependIndex);
+        if (valueDependIter != opIter->end() && valueDependIter->is_array()) {
+            try {
+                ops.back().valueDependIndex = valueDependIter->get<FVector<int64_t>>();
+            } catch (const nlohmann::json::exception& e) {
+                OP_LOGW("Invalid valueDependIndex of op %s.", opIter.key().c_str());
+                return nullptr;
+            }
+        }
+        auto staticListIter = opIter->find(kStaticList);
+        if (staticListIter == opIter->end() || !staticListIter->is_array()) {
+            continue;
+        }
+
+        StaticKernelIndexBuildEntry platform;
+        for (const auto& binInfo : *staticListIter) {
+            std::vector<std::string> keys;
+            auto binPathIter = binInfo.find(kBinPath);
+            if (binPathIter == binInfo.end() || !binPathIter->is_string() || !GetSimplifiedKeys(binInfo, keys) ||
+                !IsCollectableStaticBin(binInfo)) {
+                continue;
+            }
+            const std::string& binPath = binPathIter->get<std::string>();
+            const auto pos = binPath.find(kBinSuffix);
+            if (pos == std::string::npos) {
+                continue;
+            }
+            UpdatePlatformInfo(binAndJsonDir + binPath.substr(0U, pos) + kJsonSuffix, platform);
+            for (const auto& key : keys) {
+                binKey.assign(key.size() * kBinKeyMultiplier, 0U);
+                uint32_t keySize = 0U;
+                if (NnopbaseCollectorConvertStaticVerbKey(key.c_str(), binKey.data(), &keySize) != OK) {
+                    OP_LOGW("Failed to convert simplified key %s of op %s.", key.c_str(), opIter.key().c_str());
+                    continue;
+                }
+                StaticKernelIndexBuildEntry entry = platform;
+                entry.opType = opIter.key();
+                entry.staticKey.assign(binKey.begin(), binKey.begin() + keySize);
+                entry.binPath = binPath;
+                entries.emplace_back(std::move(entry));
+            }
+        }
+    }
+    OP_LOGI("Build static kernel index of %zu ops, %zu static keys.", ops.size(), entries.size());
+    return StaticKernelIndex::Build(ops, entries, source);
+}
+
+} // namespace internal
+} // namespace op
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef __STATIC_KERNEL_INDEX_H__
+#define __STATIC_KERNEL_INDEX_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "nlohmann/json.hpp"
+#include "aclnn/aclnn_base.h"
+#include "opdev/fast_vector.h"
+
+namespace op {
+namespace internal {
+
+constexpr const char* STATIC_KERNEL_INDEX_CACHE_DIR = "aclnn/static_kernel_index/";
+constexpr int64_t kStaticKernelIndexNotFound = -1;
+
+// Digest of the inputs an index was built from, an index of another config content is rebuilt.
+struct StaticKernelIndexSource {
+    uint64_t digest = 0U;
+};
+
+struct StaticKernelIndexBuildOp {
+    std::string opType;
+    FVector<int64_t> valueDependIndex;
+};
+
+struct StaticKernelIndexBuildEntry {
+    std::string opType;
+    std::vector<uint8_t> staticKey; // verbose static key, same bytes as NnopbaseCollectorGenStaticKey generates
+    std::string binPath;            // relative to the static kernel dir, as written in the config json
+    bool hasPlatformInfo = false;
+    uint32_t aicNum = 0U;
+    uint32_t aivNum = 0U;
+    int8_t deterministicLevel = -1;
+};
+
+#pragma pack(push, 1)
+struct StaticKernelIndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t opNum;
+    uint32_t entryNum;
+    uint32_t reserved;
+    uint64_t sourceDigest;
+    uint64_t opOffset;
+    uint64_t entryOffset;
+    uint64_t blobOffset;
+    uint64_t blobSize;
+};
+
+// ops are sorted by name, the entries of one op are contiguous
+struct StaticKernelIndexOp {
+    uint32_t nameOffset;
+    uint32_t nameLen;
+    uint32_t entryBegin;
+    uint32_t entryEnd;
+    uint32_t valueDependOffset;
+    uint32_t valueDependNum;
+};
+
+// entries are sorted by key hash inside an op, equal keys keep the config order
+struct StaticKernelIndexEntry {
+    uint64_t keyHash;
+    uint32_t keyOffset;
+    uint32_t keyLen;
+    uint32_t pathOffset;
+    uint32_t pathLen;
+    uint32_t aicNum;
+    uint32_t aivNum;
+    int8_t deterministicLevel;
+    uint8_t hasPlatformInfo;
+    uint8_t reserved[6];
+};
+#pragma pack(pop)
+
+/**
+ * Read-only table from the normalized static key to the static kernel binary. It is built once from the static
+ * kernel config of an OPP package, stored in the user cache dir and mapped by later processes, so selecting a static
+ * kernel needs neither the json parse nor a lock. All lookups only read the image.
+ */
+class StaticKernelIndex {
+public:
+    ~StaticKernelIndex();
+
+    StaticKernelIndex(const StaticKernelIndex&) = delete;
+    StaticKernelIndex& operator=(const StaticKernelIndex&) = delete;
+
+    static std::shared_ptr<const StaticKernelIndex> Build(const std::vector<StaticKernelIndexBuildOp>& ops,
+                                                          const std::vector<StaticKernelIndexBuildEntry>& entries,
+                                                          const StaticKernelIndexSource& source);
+
+    // Returns nullptr if the file does not exist, is corrupted or was built from another config.
+    static std::shared_ptr<const StaticKernelIndex> Load(const std::string& path,
+                                                         const StaticKernelIndexSource& source);
+
+    // The digest covers the config content and the kernel dir the bin paths and platform info are read from.
+    static StaticKernelIndexSource GetSource(const std::string& configContent, const std::string& binAndJsonDir);
+
+    // Cache file of the config, empty if there is no writable cache dir. The cache dir is taken from
+    // ASCEND_CACHE_PATH, XDG_CACHE_HOME or HOME/.cache in turn, the OPP package itself may be read-only.
+    static std::string GetCachePath(const std::string& configPath);
+
+    static uint64_t HashKey(const uint8_t* key, size_t len);
+
+    aclnnStatus Save(const std::string& path) const;
+
+    const StaticKernelIndexOp* FindOp(const std::string& opType) const;
+
+    void GetValueDependIndex(const StaticKernelIndexOp& op, FVector<int64_t>& valueDependIndex) const;
+
+    // Same matching rule as the bin collector: exact key, then the platform the kernel was compiled for.
+    int64_t Find(const StaticKernelIndexOp& op, const uint8_t* key, size_t len, uint32_t aicNum, uint32_t aivNum,
+                 int8_t deterministicLevel) const;
+
+    const char* GetBinPath(size_t entryIndex) const;
+
+    uint32_t GetEntryNum() const { return header_->entryNum; }
+
+    size_t GetImageSize() const { return size_; }
+
+    bool IsMapped() const { return mapped_ != nullptr; }
+
+private:
+    StaticKernelIndex() = default;
+
+    bool Validate() const;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0U;
+    std::string image_;
+    void* mapped_ = nullptr;
+    const StaticKernelIndexHeader* header_ = nullptr;
+    const StaticKernelIndexOp* ops_ = nullptr;
+    const StaticKernelIndexEntry* entries_ = nullptr;
+    const uint8_t* blob_ = nullptr;
+};
+
+/**
+ * Build the index of binary_info_config.json under the static kernel dir. Only the kernels the bin collector accepts
+ * are indexed, the platform info is read from the json of each kernel the same way the collector does.
+ */
+std::shared_ptr<const StaticKernelIndex> BuildStaticKernelIndex(const nlohmann::json& staticConfig,
+                                                                const std::string& binAndJsonDir,
+                                                                const StaticKernelIndexSource& source);
+
+} // namespace internal
+} // namespace op
+
+#endif
@@ -143,18 +143,20 @@ aclnnStatus TilingParseCtxHolder::BuildTilingParseCtx(uint32_t opType,
                                                       const gert::OpImplKernelRegistry::OpImplFunctions* tilingFuncs,
                                                       const Json& opJson, fe::PlatFormInfos* platformInfo,
                                                       const std::string& opImplModeStr,
-                                                      const aclnnOpInfoRecord::OpKernelInfo& opKernelInfo)
+                                                      const aclnnOpInfoRecord::OpKernelInfo& opKernelInfo,
+                                                      const std::shared_ptr<const std::string>& compileInfoStr)
 {
     if (tilingFuncs == nullptr) {
         OP_LOGE_FOR_EXECUTION_TILING_ERROR("The tiling function does not exist");
         return ACLNN_ERR_RUNTIME_ERROR;
     }
-    if (!opJson.contains("compileInfo")) {
-        tilingParseInfo_.compileInfo_ = nullptr;
-    } else {
-        tilingParseInfo_.compileInfoStr_ = opJson["compileInfo"].dump();
-        tilingParseInfo_.compileInfo_ = tilingParseInfo_.compileInfoStr_.c_str();
+    if (compileInfoStr != nullptr) {
+        tilingParseInfo_.compileInfoStr_ = compileInfoStr;
+    } else if (opJson.contains("compileInfo")) {
+        tilingParseInfo_.compileInfoStr_ = std::make_shared<const std::string>(opJson["compileInfo"].dump());
     }
+    tilingParseInfo_.compileInfo_ =
+        (tilingParseInfo_.compileInfoStr_ == nullptr) ? nullptr : tilingParseInfo_.compileInfoStr_->c_str();
 
     if (opJson.contains("binFileName")) {
         kernelName_ = opJson["binFileName"];
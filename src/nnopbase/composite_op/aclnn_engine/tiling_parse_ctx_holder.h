@@ -13,6 +13,7 @@
 
 #include <array>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,8 @@ void UpdateThradLocalPlatformInfo(fe::PlatFormInfos* platformInfo, const uint32_
                                   const uint32_t& vectorCoreNum);
 void SetCoreNum(const nlohmann::json& opJson, fe::PlatFormInfos* platformInfo, uint32_t& coreNum);
 
+// Tiling parse context of one core-count variant of an op bin. The parse function and tiling may keep the core num
+// in the compile info struct, so every variant parses its own; only the compile info json is shared between them.
 class TilingParseCtxHolder {
 public:
     AsyncAnyValue* GetCompiledInfoStruct() const { return &tilingParseCtxValue_[kCompileInfoStruct]; }
@@ -43,7 +46,11 @@ public:
     aclnnStatus BuildTilingParseCtx(uint32_t opType, const gert::OpImplKernelRegistry::OpImplFunctions* tilingFuncs,
                                     const nlohmann::json& opJson, fe::PlatFormInfos* platformInfo,
                                     const std::string& opImplModeStr,
-                                    const aclnnOpInfoRecord::OpKernelInfo& opKernelInfo);
+                                    const aclnnOpInfoRecord::OpKernelInfo& opKernelInfo,
+                                    const std::shared_ptr<const std::string>& compileInfoStr = nullptr);
+
+    // compile info json dumped from the bin json, null when it has none; passed to the other variants of the bin
+    const std::shared_ptr<const std::string>& GetCompileInfoStr() const { return tilingParseInfo_.compileInfoStr_; }
 
     const std::string& GetOpImplModeStr() const;
 
@@ -74,7 +81,7 @@ private:
         fe::PlatFormInfos* platformInfo_;
         const char* opType_;
         void* compileInfoStruct_;
-        std::string compileInfoStr_;
+        std::shared_ptr<const std::string> compileInfoStr_;
     };
     TilingParseInfo tilingParseInfo_{};
     gert::OpImplRegisterV2::CompileInfoDeleterFunc tilingParseInfoDeleter{nullptr};
@@ -169,9 +169,15 @@ size_t TilingCtxHolder::ResetTilingCtx(const KernelContextHolder* kernelCtx)
     tilingOutput_.outputNum_ = opOutputNum;
 
     tilingCtx_->input_size = tilingInputNum;
-    for (size_t i = 0; i < tilingInputNum - TILING_INPUT_OTHER_NUM; i++) {
+    // the tensor values still pointing at the same opInArg_ are kept from the last call
+    size_t opArgNum = tilingInputNum - TILING_INPUT_OTHER_NUM;
+    size_t validNum = (boundOpInArg_ == kernelCtx->opInArg_) ? boundOpArgNum_ : 0;
+    for (size_t i = validNum; i < opArgNum; i++) {
         tilingCtx_->values[i] = &kernelCtx->opInArg_[i];
     }
+    // the values behind the tensors are overwritten by the other inputs and outputs
+    boundOpInArg_ = kernelCtx->opInArg_;
+    boundOpArgNum_ = opArgNum;
 
     return tilingInputNum;
 }
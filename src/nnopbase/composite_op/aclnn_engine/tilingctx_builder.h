@@ -202,6 +202,10 @@ private:
     // Dynamic capacity management
     // Initial capacity set to MAX_OP_ARG_NUM, expansion triggered only when exceeding this value
     size_t tilingCtxCapacity_{MAX_OP_ARG_NUM};
+
+    // opInArg_ whose first boundOpArgNum_ values are set in tilingCtx_
+    const AsyncAnyValue* boundOpInArg_{nullptr};
+    size_t boundOpArgNum_{0};
 };
 
 } // namespace internal
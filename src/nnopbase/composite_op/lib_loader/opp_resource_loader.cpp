@@ -21,6 +21,7 @@
 #include "op_tiling_loader.h"
 #include "opdev/op_log.h"
 #include "file_utils.h"
+#include "opp_manifest.h"
 
 using namespace std;
 namespace op {
@@ -78,6 +79,7 @@ aclnnStatus LoadOppResource()
     loadRet = LoadOpTiling(oppPath, ResourceHandlersManager::GetInstance().resourceHandlers_);
     OP_CHECK(loadRet == ACLNN_SUCCESS, OP_LOGI("Leaving func: LoadOppResource with status: %d", loadRet),
              return loadRet);
+    (void)internal::OppManifest::Instance().Save();
     return ACLNN_SUCCESS;
 }
 
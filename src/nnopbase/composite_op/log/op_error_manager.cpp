@@ -15,6 +15,7 @@
 #include "securec.h"
 #include "base/err_msg.h"
 #include "base/dlog_pub.h"
+#include "async_log.h"
 
 static const std::string g_errorInfoJson = R"(
 {
@@ -220,6 +221,16 @@ void DlogRecordInner(int32_t moduleId, int32_t level, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
+    auto& asyncLogger = op::internal::AsyncLogger::Instance();
+    if (asyncLogger.IsEnabled()) {
+        if (level == OP_LOG_ERROR) {
+            // keep the queued context ahead of the error and make sure it reaches the log before a possible abort
+            asyncLogger.Flush();
+        } else if (asyncLogger.Record(moduleId, level, fmt, args)) {
+            va_end(args);
+            return;
+        }
+    }
     DlogVaList(moduleId, level, fmt, args);
     va_end(args);
 }
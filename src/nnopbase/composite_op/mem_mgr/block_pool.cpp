@@ -10,36 +10,219 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <type_traits>
 #include <vector>
+#include <sys/mman.h>
 
+#include "mmpa/mmpa_api.h"
 #include "block_pool.h"
 
 std::atomic<std::int64_t> object_num = 0;
 
 namespace op {
 namespace internal {
+namespace {
+constexpr size_t kClassEnvBufLen = 4096U;
+constexpr size_t kBudgetEnvBufLen = 32U;
+constexpr unsigned long kMaxBudgetMb = 65536UL;
+constexpr size_t kMinStoreBlockNum = 16U;
+constexpr size_t kCacheMaxBlockNum = 4096U;
+constexpr size_t kCacheMaxBytes = 4U * 1024U * 1024U;
+constexpr size_t kCacheBatchBytes = 16U * 1024U;
+constexpr size_t kSpanCacheMaxBytes = 64U * 1024U * 1024U;
+constexpr size_t kDefaultPageSize = 4096U;
+} // namespace
+
+std::vector<BlockPool::BlockDesc> BlockPool::GetDefaultStoreIndex()
+{
+    return {BlockDesc(BLOCK_BASE_SIZE, 32768, 4096, 16),      // 64B 2MB, cache 256KB
+            BlockDesc(BLOCK_BASE_SIZE * 4, 16384, 2048, 8),   // 256B 4MB, cache 512KB
+            BlockDesc(BLOCK_BASE_SIZE * 16, 32768, 4096, 16), // 1KB 32MB, cache 4MB
+            BlockDesc(BLOCK_BASE_SIZE * 64, 8192, 1024, 4),   // 4KB 32MB, cache 4MB
+            BlockDesc(BLOCK_BASE_SIZE * 256, 2048, 256, 1),   // 16KB 32MB, cache 4MB
+            BlockDesc(BLOCK_MAX_SIZE, 512, 64, 1)};           // 64KB 32MB, cache 4MB
+}
 
 /**
- * @brief Initialize each BlockStore
+ * @brief Give each class its share of the budget by the bytes requested of it, the classes are the buckets of the
+ *        request size histogram up to BLOCK_MAX_SIZE, which are multiples of BLOCK_BASE_SIZE. A BLOCK_MAX_SIZE class
+ *        is always kept so that no request under it falls back to malloc.
  */
-bool BlockPool::Init()
+void BlockPool::DeriveStoreIndex(const std::vector<std::pair<size_t, uint64_t>>& histogram, size_t budget,
+                                 std::vector<BlockDesc>& stores)
 {
-    const uint16_t tag = DEFAULT_TAG;
-    hugeMemStart_ = nullptr;
-    hugeMemEnd_ = nullptr;
+    std::array<uint64_t, kAllocSizeBucketNum> nums{};
+    for (const auto& entry : histogram) {
+        if (entry.first > BLOCK_MAX_SIZE) {
+            continue;
+        }
+        nums[GetAllocSizeBucket(entry.first)] += entry.second;
+    }
+    const size_t maxBucket = GetAllocSizeBucket(BLOCK_MAX_SIZE);
+    double totalBytes = 0.0;
+    for (size_t bucket = 0U; bucket <= maxBucket; bucket++) {
+        totalBytes += static_cast<double>(nums[bucket]) * static_cast<double>(GetAllocSizeBucketLimit(bucket));
+    }
+
+    stores.clear();
+    for (size_t bucket = 0U; bucket <= maxBucket; bucket++) {
+        if (nums[bucket] == 0U && bucket != maxBucket) {
+            continue;
+        }
+        const size_t size = GetAllocSizeBucketLimit(bucket);
+        size_t count = kMinStoreBlockNum;
+        if (totalBytes > 0.0) {
+            const double share = static_cast<double>(budget) * static_cast<double>(nums[bucket]) / totalBytes;
+            count = std::max(count, static_cast<size_t>(share));
+        }
+        count = std::min(count, static_cast<size_t>(std::numeric_limits<BlockStore::BlockIdx>::max()));
+        const size_t cacheCount = std::min(kCacheMaxBlockNum, kCacheMaxBytes / size);
+        const size_t batch =
+            std::min(std::max(kCacheBatchBytes / size, static_cast<size_t>(1)), static_cast<size_t>(16));
+        stores.emplace_back(size, count, cacheCount, batch);
+    }
+}
+
+bool BlockPool::ParseStoreIndex(const std::string& config, size_t budget, std::vector<BlockDesc>& stores)
+{
+    std::vector<std::pair<size_t, uint64_t>> histogram;
+    if (config == "fine") {
+        // the same bytes for each class
+        for (size_t bucket = 0U; bucket <= GetAllocSizeBucket(BLOCK_MAX_SIZE); bucket++) {
+            histogram.emplace_back(GetAllocSizeBucketLimit(bucket), BLOCK_MAX_SIZE / GetAllocSizeBucketLimit(bucket));
+        }
+        DeriveStoreIndex(histogram, budget, stores);
+        return true;
+    }
 
-    for (size_t i = 0; i < StoreIndex.size(); i++) {
+    size_t pos = 0U;
+    while (pos < config.size()) {
+        size_t end = config.find(',', pos);
+        if (end == std::string::npos) {
+            end = config.size();
+        }
+        const std::string entry = config.substr(pos, end - pos);
+        const size_t colon = entry.find(':');
+        if (colon == std::string::npos || colon == 0U || colon + 1U == entry.size()) {
+            return false;
+        }
+        const std::string size = entry.substr(0U, colon);
+        const std::string num = entry.substr(colon + 1U);
+        if (size.find_first_not_of("0123456789") != std::string::npos ||
+            num.find_first_not_of("0123456789") != std::string::npos) {
+            return false;
+        }
+        histogram.emplace_back(std::strtoull(size.c_str(), nullptr, 10), std::strtoull(num.c_str(), nullptr, 10));
+        pos = end + 1U;
+    }
+    if (histogram.empty()) {
+        return false;
+    }
+    DeriveStoreIndex(histogram, budget, stores);
+    return true;
+}
+
+/**
+ * @brief Read ACLNN_BLOCK_POOL_CLASSES and ACLNN_BLOCK_POOL_MB, return false when the default classes are used
+ */
+bool BlockPool::LoadStoreIndex(std::vector<BlockDesc>& stores)
+{
+    stores = GetDefaultStoreIndex();
+    std::vector<char> config(kClassEnvBufLen, '\0');
+    if (mmGetEnv("ACLNN_BLOCK_POOL_CLASSES", config.data(), kClassEnvBufLen) != EN_OK || config[0U] == '\0') {
+        return false;
+    }
+
+    size_t budget = 0U;
+    for (const auto& desc : stores) {
+        budget += desc.size * desc.count;
+    }
+    char buf[kBudgetEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_BLOCK_POOL_MB", &buf[0U], kBudgetEnvBufLen) == EN_OK && buf[0U] != '\0') {
+        char* end = nullptr;
+        const unsigned long mb = std::strtoul(&buf[0U], &end, 10);
+        if (end == &buf[0U] || *end != '\0' || mb == 0UL || mb > kMaxBudgetMb) {
+            OP_LOGW("Invalid ACLNN_BLOCK_POOL_MB %s, use %zu bytes.", buf, budget);
+        } else {
+            budget = static_cast<size_t>(mb) * 1024U * 1024U;
+        }
+    }
+
+    std::vector<BlockDesc> configured;
+    if (!ParseStoreIndex(config.data(), budget, configured)) {
+        OP_LOGW("Invalid ACLNN_BLOCK_POOL_CLASSES %s, use the default size classes.", config.data());
+        return false;
+    }
+    stores = std::move(configured);
+    OP_LOGI("BlockPool uses %zu size classes from ACLNN_BLOCK_POOL_CLASSES, budget %zu bytes.", stores.size(),
+            budget);
+    return true;
+}
+
+/**
+ * @brief Initialize each BlockStore and the size lookup of the classes
+ */
+bool BlockPool::InitStores(const std::vector<BlockDesc>& stores)
+{
+    if (stores.empty() || stores.size() > static_cast<size_t>(MAX_STORE)) {
+        return false;
+    }
+    const uint16_t tag = DEFAULT_TAG;
+    storeNum_ = stores.size();
+    for (size_t i = 0; i < storeNum_; i++) {
+        StoreIndex[i] = stores[i];
         int rc = blockStoreArray_[i].Init(tag + i, StoreIndex[i].size, StoreIndex[i].count);
         if (rc != 0) {
             return false;
         }
     }
 
+    size_t cls = 0;
+    for (size_t i = 0; i < storeLookup_.size(); i++) {
+        const size_t size = (i + 1) * BLOCK_BASE_SIZE;
+        while (cls < storeNum_ && StoreIndex[cls].size < size) {
+            cls++;
+        }
+        storeLookup_[i] = cls < storeNum_ ? static_cast<int8_t>(cls) : static_cast<int8_t>(INVALID_STORE);
+    }
+
+    std::vector<size_t> classSizes;
+    for (size_t i = 0; i < storeNum_; i++) {
+        classSizes.push_back(StoreIndex[i].size);
+    }
+    AllocStats::SetClassSizes(classSizes);
+    return true;
+}
+
+/**
+ * @brief Initialize each BlockStore
+ */
+bool BlockPool::Init()
+{
+    hugeMemStart_ = nullptr;
+    hugeMemEnd_ = nullptr;
+
+    std::vector<BlockDesc> stores;
+    const bool configured = LoadStoreIndex(stores);
+    if (!InitStores(stores)) {
+        return false;
+    }
+    AllocStats::InitFromEnv();
+
+    if (configured) {
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        spanPageSize_ = pageSize > 0 ? static_cast<size_t>(pageSize) : kDefaultPageSize;
+        spanMaxSize_ = SPAN_MAX_SIZE;
+        spanCacheMaxBytes_ = kSpanCacheMaxBytes;
+        spanFreeList_.assign((sizeof(BlockStore::BlockHeader) + SPAN_MAX_SIZE) / spanPageSize_ + 2U, nullptr);
+    }
+
     auto* base = std::malloc(op::internal::kHugeBlockNum * op::internal::kHugeBlockSize);
     if (base == nullptr) {
         return false;
@@ -57,14 +240,111 @@ bool BlockPool::Init()
 
 void BlockPool::UnInit()
 {
-    for (size_t i = 0; i < StoreIndex.size(); i++) {
+    for (size_t i = 0; i < storeNum_; i++) {
         blockStoreArray_[i].UnInit();
     }
+    for (size_t pageNum = 0; pageNum < spanFreeList_.size(); pageNum++) {
+        BlockStore::BlockHeader* head = spanFreeList_[pageNum];
+        while (head != nullptr) {
+            BlockStore::BlockHeader* next = *reinterpret_cast<BlockStore::BlockHeader**>(head + 1);
+            (void)munmap(head, pageNum * spanPageSize_);
+            head = next;
+        }
+        spanFreeList_[pageNum] = nullptr;
+    }
+    spanCachedBytes_ = 0;
     if (hugeMemStart_) {
         std::free(hugeMemStart_);
     }
 }
 
+/**
+ * @brief Drop the pages of the free huge blocks, they are faulted in again as zero pages on the next use.
+ *        The page holding the block header is kept, a late free of an address of the block still reads the
+ *        invalid owner written when the block was given back.
+ */
+size_t BlockPool::TrimHugeBlocksImpl()
+{
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0) {
+        return 0;
+    }
+    const uintptr_t pageMask = static_cast<uintptr_t>(pageSize) - 1U;
+    size_t trimmed = 0;
+    const std::lock_guard<OpSpinlock> guard(guard_);
+    for (void* block : hugeMemArray_) {
+        const uintptr_t begin = (reinterpret_cast<uintptr_t>(block) + kHugeBlockDefaultOffset + pageMask) & ~pageMask;
+        const uintptr_t end = (reinterpret_cast<uintptr_t>(block) + kHugeBlockSize) & ~pageMask;
+        if (begin >= end) {
+            continue;
+        }
+        if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED) == 0) {
+            trimmed++;
+        }
+    }
+    return trimmed;
+}
+
+/**
+ * @brief Requests over BLOCK_MAX_SIZE are rounded up to whole pages, a freed span is kept for the next request of
+ *        the same page number until spanCacheMaxBytes_ are kept.
+ */
+void* BlockPool::SpanMalloc(size_t size)
+{
+    const size_t pageNum = (sizeof(BlockStore::BlockHeader) + size + spanPageSize_ - 1) / spanPageSize_;
+    BlockStore::BlockHeader* head = nullptr;
+    {
+        const std::lock_guard<OpSpinlock> guard(guard_);
+        head = spanFreeList_[pageNum];
+        if (head != nullptr) {
+            spanFreeList_[pageNum] = *reinterpret_cast<BlockStore::BlockHeader**>(head + 1);
+            spanCachedBytes_ -= pageNum * spanPageSize_;
+        }
+    }
+    if (head != nullptr) {
+        if (AllocStats::IsEnabled()) {
+            AllocStats::Add(AllocStatsItem::POOL_ALLOC, storeNum_);
+        }
+        return head + 1;
+    }
+
+    void* p = mmap(nullptr, pageNum * spanPageSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        return nullptr;
+    }
+    head = static_cast<BlockStore::BlockHeader*>(p);
+    new (head) BlockStore::BlockHeader;
+    head->userTag_ = SPAN_TAG;
+    head->blockIdx_ = static_cast<BlockStore::BlockIdx>(pageNum);
+    head->cacheExt_ = BlockStore::NOT_IN_CACHE;
+    if (AllocStats::IsEnabled()) {
+        AllocStats::Add(AllocStatsItem::MALLOC, storeNum_);
+        AllocStats::Add(AllocStatsItem::MALLOC_BYTES, storeNum_, pageNum * spanPageSize_);
+    }
+    return head + 1;
+}
+
+void BlockPool::SpanFree(void* block)
+{
+    BlockStore::BlockHeader* head = BlockStore::GetBlockHeader(block);
+    const size_t pageNum = static_cast<size_t>(head->blockIdx_);
+    const size_t bytes = pageNum * spanPageSize_;
+    {
+        const std::lock_guard<OpSpinlock> guard(guard_);
+        if (pageNum < spanFreeList_.size() && spanCachedBytes_ + bytes <= spanCacheMaxBytes_) {
+            *reinterpret_cast<BlockStore::BlockHeader**>(head + 1) = spanFreeList_[pageNum];
+            spanFreeList_[pageNum] = head;
+            spanCachedBytes_ += bytes;
+            head = nullptr;
+        }
+    }
+    if (head != nullptr) {
+        (void)munmap(head, bytes);
+    } else if (AllocStats::IsEnabled()) {
+        AllocStats::Add(AllocStatsItem::POOL_FREE, storeNum_);
+    }
+}
+
 BlockPool globalPoolImpl__ __attribute__((init_priority(200)));
 BlockPool& BlockPool::globalPool_ = globalPoolImpl__;
 
@@ -8,8 +8,12 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <mutex>
 #include <vector>
+#include "mmpa/mmpa_api.h"
 #include "thread_local_context.h"
 #include "opdev/op_log.h"
 #include "opdev/op_cache.h"
@@ -47,7 +51,6 @@ void ReleaseHugeMem([[maybe_unused]] void* arg, [[maybe_unused]] bool sync) { op
 namespace op {
 namespace internal {
 
-std::mutex g_hugeMemMutex;
 constexpr int32_t kMaxHugeMemPoolArryNum = 5;
 
 #if defined(NNOPBASE_UT) || defined(NNOPBASE_ST)
@@ -56,30 +59,162 @@ constexpr int32_t kMaxHugeMemObjectNum = 16;
 constexpr int32_t kMaxHugeMemObjectNum = 4096;
 #endif
 
-std::vector<int32_t> InitVecotr();
-std::vector<int32_t> gHugeMemPoolIndex = InitVecotr();
+constexpr size_t kHugeMemEnvBufLen = 32U;
+constexpr size_t kHugeMemBudgetUnit = 1024U * 1024U;
 
-std::vector<int32_t> InitVecotr()
+// Header at the beginning of each huge block, offset must stay the first member. The owner and its generation
+// are read by the threads freeing addresses of the block.
+struct HugeBlockHeader {
+    int64_t offset;
+    std::atomic<int32_t> poolIndex;
+    std::atomic<uint32_t> generation;
+};
+static_assert(sizeof(HugeBlockHeader) <= static_cast<size_t>(kHugeBlockDefaultOffset),
+              "huge block header exceeds the reserved offset");
+
+// Every address handed out by a huge block is preceded by a tag of the generation it was handed out in, a late free
+// of an address of a block that has since been given to another pool or generation does not match its header.
+constexpr size_t kHugeAddrTagSize = sizeof(uint64_t);
+constexpr uint64_t kHugeAddrTagMul = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t MakeHugeAddrTag(const uint32_t generation)
+{
+    return static_cast<uint64_t>(generation) * kHugeAddrTagMul;
+}
+
+// bytes a request takes in a block, the tag of the next address stays 8 bytes aligned
+static size_t GetHugeAllocSize(const size_t size)
+{
+    return kHugeAddrTagSize + ((size + kHugeAddrTagSize - 1U) & ~(kHugeAddrTagSize - 1U));
+}
+
+static size_t ReadHugeMemBudget()
 {
-    std::vector<int32_t> v;
-    for (int i = 0; i < kMaxHugeMemObjectNum; i++) {
-        v.push_back(i);
+    char buf[kHugeMemEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_HUGE_MEM_BUDGET", &buf[0U], kHugeMemEnvBufLen) != EN_OK || buf[0U] == '\0') {
+        return static_cast<size_t>(kHugeBlockNum);
     }
-    return v;
+    char* end = nullptr;
+    const unsigned long budgetMb = std::strtoul(&buf[0U], &end, 10);
+    if (end == &buf[0U] || *end != '\0' || budgetMb == 0UL) {
+        OP_LOGW("Invalid ACLNN_HUGE_MEM_BUDGET %s, use the whole huge region.", buf);
+        return static_cast<size_t>(kHugeBlockNum);
+    }
+    const size_t budgetBlockNum = std::min<size_t>(budgetMb, static_cast<size_t>(kHugeBlockNum)) *
+                                  kHugeMemBudgetUnit / static_cast<size_t>(kHugeBlockSize);
+    OP_LOGI("Hugemem trace: huge memory budget %lu MB, %zu blocks.", budgetMb, budgetBlockNum);
+    return std::max<size_t>(1U, std::min<size_t>(budgetBlockNum, static_cast<size_t>(kHugeBlockNum)));
 }
 
-static int32_t GetAvaiablePoolIndex()
+static void UpdatePeak(std::atomic<size_t>& peak, const size_t value)
+{
+    size_t cur = peak.load(std::memory_order_relaxed);
+    while (cur < value && !peak.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+}
+
+struct HugeMemState {
+    // 0 until the budget is read from the env on the first block acquired
+    std::atomic<size_t> budgetBlockNum{0};
+    std::atomic<size_t> usedBlockNum{0};
+    std::atomic<size_t> peakUsedBlockNum{0};
+    std::atomic<size_t> activePoolNum{0};
+    std::atomic<size_t> peakActivePoolNum{0};
+    std::atomic<size_t> peakPoolBlockNum{0};
+    std::atomic<uint64_t> fallbackNum{0};
+    std::atomic<uint64_t> fallbackBytes{0};
+    std::atomic<uint64_t> reclaimedPoolNum{0};
+    std::atomic<uint64_t> reclaimedBlockNum{0};
+    std::atomic<uint64_t> trimmedBlockNum{0};
+    // bumped whenever a pool drops its last live allocation, reclaim scans only when it moved
+    std::atomic<uint64_t> idleEpoch{0};
+    std::atomic<uint64_t> reclaimEpoch{0};
+    // the generations of all pools come from one counter, a block moved to another pool never keeps its generation
+    std::atomic<uint32_t> generation{0};
+};
+
+HugeMemState gHugeMemState;
+
+static uint32_t NextGeneration()
+{
+    uint32_t generation = 0U;
+    do {
+        generation = gHugeMemState.generation.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    } while (generation == 0U); // 0 is the generation of a header never written
+    return generation;
+}
+
+static size_t GetBudgetBlockNum()
 {
-    const std::lock_guard<std::mutex> lock(g_hugeMemMutex);
-    if (gHugeMemPoolIndex.empty()) {
-        return op::kInvalidHugeMemIndexId;
-    } else {
-        int32_t res = gHugeMemPoolIndex.back();
-        gHugeMemPoolIndex.pop_back();
-        return res;
+    size_t budget = gHugeMemState.budgetBlockNum.load(std::memory_order_relaxed);
+    if (budget == 0) {
+        size_t expected = 0;
+        budget = ReadHugeMemBudget();
+        if (!gHugeMemState.budgetBlockNum.compare_exchange_strong(expected, budget, std::memory_order_relaxed)) {
+            budget = expected;
+        }
     }
+    return budget;
 }
 
+/**
+ * @brief Lock free stack of the free pool indexes. The head packs an ABA tag in the high 32 bits
+ *        and index + 1 in the low 32 bits, 0 means empty.
+ */
+class PoolIndexStack {
+public:
+    PoolIndexStack()
+    {
+        // the last index is handed out first
+        for (int32_t i = 0; i < kMaxHugeMemObjectNum; i++) {
+            Push(i);
+        }
+    }
+
+    int32_t Pop()
+    {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        while (true) {
+            const int32_t id = static_cast<int32_t>(head & kIndexMask) - 1;
+            if (id < 0) {
+                return op::kInvalidHugeMemIndexId;
+            }
+            const int32_t next = next_[id].load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, Pack(head, next), std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+                return id;
+            }
+        }
+    }
+
+    void Push(const int32_t id)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        do {
+            next_[id].store(static_cast<int32_t>(head & kIndexMask) - 1, std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, Pack(head, id), std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+private:
+    static constexpr uint64_t kIndexMask = 0xFFFFFFFFULL;
+    static constexpr uint32_t kTagShift = 32U;
+
+    static uint64_t Pack(const uint64_t oldHead, const int32_t id)
+    {
+        const uint64_t tag = (oldHead >> kTagShift) + 1U;
+        return (tag << kTagShift) | static_cast<uint64_t>(static_cast<uint32_t>(id + 1));
+    }
+
+    std::atomic<uint64_t> head_{0};
+    std::atomic<int32_t> next_[kMaxHugeMemObjectNum];
+};
+
+PoolIndexStack gHugeMemPoolIndex;
+
+static void* AcquireHugeBlock(const int32_t owner, const uint32_t generation);
+static void ReleaseHugeBlock(void* block);
+
 struct BlockLink {
     BlockLink() { Init(); }
 
@@ -93,6 +228,12 @@ struct BlockLink {
     BlockLink* next_;
 };
 
+/**
+ * @brief Bump allocator of one thread. Only the owner thread allocates, so the blocks are touched without a lock as
+ *        long as the owner holds a live count: state_ packs the generation of the blocks in the high 32 bits, a
+ *        reclaiming flag and the live count in the low 32 bits. Reclaim flips the flag only when no address is live,
+ *        an allocation that finds the flag set waits for the reclaim under guard_.
+ */
 class HugeMemPool {
 public:
     HugeMemPool() { Init(false); }
@@ -107,6 +248,10 @@ public:
             current_ = rhs.current_;
             currentArrayIndex_ = rhs.currentArrayIndex_;
             poolIndex_ = rhs.poolIndex_;
+            blockNum_.store(rhs.blockNum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            peakBlockNum_.store(rhs.peakBlockNum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            usedBytes_.store(rhs.usedBytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            state_.store(rhs.state_.load(std::memory_order_relaxed), std::memory_order_relaxed);
             for (int32_t i = 0; i < kMaxHugeMemPoolArryNum; i++) {
                 baseArray_[i] = rhs.baseArray_[i];
             }
@@ -117,75 +262,168 @@ public:
     void Init(const bool syncFlag)
     {
         syncFlag_ = syncFlag;
+        poolIndex_ = op::kInvalidHugeMemIndexId;
+        peakBlockNum_.store(0, std::memory_order_relaxed);
+        ResetBlocks(false);
+    }
+
+    void UnInit(const bool syncFlag) { Init(syncFlag); }
+
+    void Assign(const int32_t id)
+    {
+        const std::lock_guard<OpSpinlock> lock(guard_);
+        poolIndex_ = id;
+    }
+
+    void* GetAddr(size_t size)
+    {
+        // 1. size is gt than kHugeMemorySize, pool can not provide memory, from libc to allocate.
+        if (size > kHugeBlockSize - kHugeBlockDefaultOffset - kHugeAddrTagSize) {
+            return op::internal::BlockPool::Malloc(size);
+        }
+        // the live count is taken first, reclaim leaves the blocks alone until it is given back
+        if ((state_.fetch_add(1U, std::memory_order_acquire) & kReclaimingBit) == 0U) {
+            return AllocOwned(size);
+        }
+        state_.fetch_sub(1U, std::memory_order_relaxed);
+        const std::lock_guard<OpSpinlock> lock(guard_);
+        state_.fetch_add(1U, std::memory_order_acquire);
+        return AllocOwned(size);
+    }
+
+    void ReleaseAllAddr()
+    {
+        const std::lock_guard<OpSpinlock> lock(guard_);
+        (void)FreeBlocks(false);
+    }
+
+    // called by the thread freeing an address of this pool, an address of an older generation is ignored and the
+    // count never drops below zero
+    void ReleaseOne(const uint32_t generation)
+    {
+        uint64_t state = state_.load(std::memory_order_relaxed);
+        do {
+            if (GetGeneration(state) != generation || (state & kReclaimingBit) != 0U || (state & kLiveMask) == 0U) {
+                return;
+            }
+        } while (!state_.compare_exchange_weak(state, state - 1U, std::memory_order_acq_rel,
+                                               std::memory_order_relaxed));
+        if ((state & kLiveMask) == 1U) {
+            gHugeMemState.idleEpoch.fetch_add(1U, std::memory_order_release);
+        }
+    }
+
+    // Take back the blocks of an idle pool for another pool, the pool keeps its index and
+    // acquires blocks again on the next allocation. Return the number of blocks taken back.
+    size_t TryReclaim()
+    {
+        if (blockNum_.load(std::memory_order_relaxed) == 0 || !guard_.try_lock()) {
+            return 0;
+        }
+        size_t blockNum = 0;
+        uint64_t state = state_.load(std::memory_order_acquire);
+        if ((state & (kLiveMask | kReclaimingBit)) == 0U &&
+            state_.compare_exchange_strong(state, state | kReclaimingBit, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+            blockNum = FreeBlocks(true);
+        }
+        guard_.unlock();
+        return blockNum;
+    }
+
+    bool GetStats(HugeMemPoolStats& stats)
+    {
+        const std::lock_guard<OpSpinlock> lock(guard_);
+        const size_t blockNum = blockNum_.load(std::memory_order_relaxed);
+        if (blockNum == 0) {
+            return false;
+        }
+        stats.poolIndex = poolIndex_;
+        stats.blockNum = blockNum;
+        stats.peakBlockNum = peakBlockNum_.load(std::memory_order_relaxed);
+        stats.usedBytes = usedBytes_.load(std::memory_order_relaxed);
+        stats.liveNum = static_cast<int64_t>(state_.load(std::memory_order_relaxed) & kLiveMask);
+        return true;
+    }
+
+    int32_t GetIndex() const { return currentArrayIndex_; }
+
+    const void* GetHead() const { return head_; }
+
+    const void* GetCurrent() const { return current_; }
+
+private:
+    static constexpr uint64_t kLiveMask = 0x7FFFFFFFULL;
+    static constexpr uint64_t kReclaimingBit = 0x80000000ULL;
+    static constexpr uint32_t kGenerationShift = 32U;
+
+    static uint32_t GetGeneration(const uint64_t state) { return static_cast<uint32_t>(state >> kGenerationShift); }
+
+    // The blocks start a new generation. keepLive keeps the counts the owner is taking back while a reclaim runs,
+    // otherwise the addresses of the old generation are dropped with their blocks.
+    void ResetBlocks(const bool keepLive)
+    {
         head_ = nullptr;
         current_ = nullptr;
         currentArrayIndex_ = 0;
-        poolIndex_ = op::kInvalidHugeMemIndexId;
+        blockNum_.store(0, std::memory_order_relaxed);
+        usedBytes_.store(0, std::memory_order_relaxed);
         for (int32_t i = 0; i < kMaxHugeMemPoolArryNum; i++) {
             baseArray_[i] = nullptr;
         }
+        const uint64_t generation = static_cast<uint64_t>(NextGeneration()) << kGenerationShift;
+        uint64_t state = state_.load(std::memory_order_relaxed);
+        while (!state_.compare_exchange_weak(state, generation | (keepLive ? (state & kLiveMask) : 0U),
+                                             std::memory_order_release, std::memory_order_relaxed)) {
+        }
     }
 
-    void UnInit(const bool syncFlag) { Init(syncFlag); }
-
-    void* AddOneHugeBlockToLinkList(size_t size)
+    size_t FreeBlocks(const bool keepLive)
     {
-        void* block = op::internal::BlockPool::GetOneHugeBlock();
-        if (block == nullptr) {
-            OP_LOGW("Hugemem trace: GetOneHugeBlock failed, use block cache to allocate memory!");
-            return op::internal::BlockCache::CacheAlloc(size);
+        for (int i = 0; i < kMaxHugeMemPoolArryNum; i++) {
+            ReleaseHugeBlock(baseArray_[i]);
         }
-        int64_t* offset = static_cast<int64_t*>(block);
-        offset[0] = op::internal::kHugeBlockDefaultOffset;
-        BlockLink* link = new (std::nothrow) BlockLink();
-        if (link == nullptr) {
-            return nullptr;
+
+        BlockLink* link = head_;
+        while (link != nullptr) {
+            ReleaseHugeBlock(link->block_);
+            link = link->next_;
         }
-        link->block_ = block;
-        if (head_ == nullptr) {
-            head_ = link;
-            current_ = head_;
-        } else {
-            current_->next_ = link;
-            current_ = link;
+
+        link = head_;
+        while (link != nullptr) {
+            const BlockLink* tmp = link;
+            link = link->next_;
+            delete tmp;
         }
-        auto* res = static_cast<void*>(static_cast<uint8_t*>(block) + offset[0]);
-        offset[0] += size;
-        return res;
+        const size_t blockNum = blockNum_.load(std::memory_order_relaxed);
+        ResetBlocks(keepLive);
+        return blockNum;
     }
 
-    void* GetAddr(size_t size)
+    // the owner holds one live count, it is given back when the address does not come from a block
+    void* AllocOwned(size_t size)
     {
-        // 1. size is gt than kHugeMemorySize, pool can not provide memory, from libc to allocate.
-        if (size > kHugeBlockSize - kHugeBlockDefaultOffset) {
-            return op::internal::BlockPool::Malloc(size);
-        }
-
+        const size_t allocSize = GetHugeAllocSize(size);
         // 2. Fast path, GetBlock from array
         do {
             if (currentArrayIndex_ >= kMaxHugeMemPoolArryNum) {
                 break; // array is full, goto Slow path
             }
             if (baseArray_[currentArrayIndex_] == nullptr) {
-                void* block = op::internal::BlockPool::GetOneHugeBlock();
+                void* block = AcquireBlock();
                 if (block == nullptr) {
                     OP_LOGW("Hugemem trace: current array index: %d, GetOneHugeBlock failed, use block cache to "
                             "allocate memory!",
                             currentArrayIndex_);
-                    return op::internal::BlockCache::CacheAlloc(size);
+                    return Unclaim(Fallback(size));
                 }
-                int64_t* offset = static_cast<int64_t*>(block);
-                offset[0] = op::internal::kHugeBlockDefaultOffset;
                 baseArray_[currentArrayIndex_] = block;
-                auto* res = static_cast<void*>(static_cast<uint8_t*>(block) + offset[0]);
-                offset[0] += size;
-                return res;
+                return Bump(block, size);
             } else {
                 int64_t* offset = (int64_t*)baseArray_[currentArrayIndex_];
-                if (offset[0] + size <= op::internal::kHugeBlockSize) {
-                    auto* res = static_cast<void*>(static_cast<uint8_t*>(baseArray_[currentArrayIndex_]) + offset[0]);
-                    offset[0] += size;
-                    return res;
+                if (offset[0] + allocSize <= op::internal::kHugeBlockSize) {
+                    return Bump(baseArray_[currentArrayIndex_], size);
                 }
                 currentArrayIndex_++;
             }
@@ -196,55 +434,177 @@ public:
             return AddOneHugeBlockToLinkList(size);
         } else {
             int64_t* offset = static_cast<int64_t*>(current_->block_);
-            if (offset[0] + size <= kHugeBlockSize) {
-                auto* res = static_cast<void*>(static_cast<uint8_t*>(current_->block_) + offset[0]);
-                offset[0] += size;
-                return res;
+            if (offset[0] + allocSize <= kHugeBlockSize) {
+                return Bump(current_->block_, size);
             } else {
                 return AddOneHugeBlockToLinkList(size);
             }
         }
     }
 
-    void ReleaseAllAddr()
+    void* Unclaim(void* addr)
     {
-        for (int i = 0; i < kMaxHugeMemPoolArryNum; i++) {
-            op::internal::BlockPool::FreeOneHugeBlock(baseArray_[i]);
-        }
-
-        BlockLink* link = head_;
-        while (link != nullptr) {
-            op::internal::BlockPool::FreeOneHugeBlock(link->block_);
-            link = link->next_;
+        if ((state_.fetch_sub(1U, std::memory_order_release) & kLiveMask) == 1U) {
+            gHugeMemState.idleEpoch.fetch_add(1U, std::memory_order_release);
         }
+        return addr;
+    }
 
-        link = head_;
-        while (link != nullptr) {
-            const BlockLink* tmp = link;
-            link = link->next_;
-            delete tmp;
+    void* AcquireBlock()
+    {
+        void* block = AcquireHugeBlock(poolIndex_, GetGeneration(state_.load(std::memory_order_relaxed)));
+        if (block != nullptr) {
+            const size_t blockNum = blockNum_.load(std::memory_order_relaxed) + 1U;
+            blockNum_.store(blockNum, std::memory_order_relaxed);
+            if (blockNum > peakBlockNum_.load(std::memory_order_relaxed)) {
+                peakBlockNum_.store(blockNum, std::memory_order_relaxed);
+            }
+            UpdatePeak(gHugeMemState.peakPoolBlockNum, blockNum);
         }
+        return block;
     }
 
-    int32_t GetIndex() const { return currentArrayIndex_; }
+    void* Bump(void* block, size_t size)
+    {
+        auto* header = static_cast<HugeBlockHeader*>(block);
+        auto* tag = reinterpret_cast<uint64_t*>(static_cast<uint8_t*>(block) + header->offset);
+        *tag = MakeHugeAddrTag(header->generation.load(std::memory_order_relaxed));
+        header->offset += static_cast<int64_t>(GetHugeAllocSize(size));
+        usedBytes_.store(usedBytes_.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        return tag + 1;
+    }
 
-    const void* GetHead() const { return head_; }
+    static void* Fallback(size_t size)
+    {
+        gHugeMemState.fallbackNum.fetch_add(1U, std::memory_order_relaxed);
+        gHugeMemState.fallbackBytes.fetch_add(size, std::memory_order_relaxed);
+        return op::internal::BlockCache::CacheAlloc(size);
+    }
 
-    const void* GetCurrent() const { return current_; }
+    void* AddOneHugeBlockToLinkList(size_t size)
+    {
+        void* block = AcquireBlock();
+        if (block == nullptr) {
+            OP_LOGW("Hugemem trace: GetOneHugeBlock failed, use block cache to allocate memory!");
+            return Unclaim(Fallback(size));
+        }
+        BlockLink* link = new (std::nothrow) BlockLink();
+        if (link == nullptr) {
+            ReleaseHugeBlock(block);
+            blockNum_.store(blockNum_.load(std::memory_order_relaxed) - 1U, std::memory_order_relaxed);
+            return Unclaim(nullptr);
+        }
+        link->block_ = block;
+        if (head_ == nullptr) {
+            head_ = link;
+            current_ = head_;
+        } else {
+            current_->next_ = link;
+            current_ = link;
+        }
+        return Bump(block, size);
+    }
 
-private:
     char reserved1[64]{0};
+    OpSpinlock guard_;
     void* baseArray_[kMaxHugeMemPoolArryNum];
     int32_t currentArrayIndex_;
     BlockLink* head_;
     BlockLink* current_;
     bool syncFlag_;
     int32_t poolIndex_;
+    // written by the owner only, atomic for the statistics and reclaim read by other threads
+    std::atomic<size_t> blockNum_{0};
+    std::atomic<size_t> peakBlockNum_{0};
+    std::atomic<size_t> usedBytes_{0};
+    std::atomic<uint64_t> state_{0};
     char reserved2[64]{0}; // avoid false sharing
 };
 
 HugeMemPool gHugeMemPool[kMaxHugeMemObjectNum];
 
+static int32_t GetAvaiablePoolIndex()
+{
+    const int32_t id = gHugeMemPoolIndex.Pop();
+    if (id != op::kInvalidHugeMemIndexId) {
+        gHugeMemPool[id].Assign(id);
+        const size_t activeNum = gHugeMemState.activePoolNum.fetch_add(1U, std::memory_order_relaxed) + 1U;
+        UpdatePeak(gHugeMemState.peakActivePoolNum, activeNum);
+    }
+    return id;
+}
+
+// skip is the pool asking for blocks, force scans even if no pool became idle since the last scan
+static size_t ReclaimIdlePools(const int32_t skip, const bool force)
+{
+    const uint64_t epoch = gHugeMemState.idleEpoch.load(std::memory_order_acquire);
+    if (!force && epoch == gHugeMemState.reclaimEpoch.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    gHugeMemState.reclaimEpoch.store(epoch, std::memory_order_relaxed);
+    size_t blockNum = 0;
+    for (int32_t i = 0; i < kMaxHugeMemObjectNum; i++) {
+        if (i == skip) {
+            continue;
+        }
+        const size_t num = gHugeMemPool[i].TryReclaim();
+        if (num > 0) {
+            blockNum += num;
+            gHugeMemState.reclaimedPoolNum.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+    gHugeMemState.reclaimedBlockNum.fetch_add(blockNum, std::memory_order_relaxed);
+    if (blockNum > 0) {
+        OP_LOGI("Hugemem trace: reclaim %zu blocks from idle pools.", blockNum);
+    }
+    return blockNum;
+}
+
+static bool ReserveHugeBlock()
+{
+    const size_t budget = GetBudgetBlockNum();
+    size_t used = gHugeMemState.usedBlockNum.load(std::memory_order_relaxed);
+    do {
+        if (used >= budget) {
+            return false;
+        }
+    } while (!gHugeMemState.usedBlockNum.compare_exchange_weak(used, used + 1U, std::memory_order_relaxed));
+    UpdatePeak(gHugeMemState.peakUsedBlockNum, used + 1U);
+    return true;
+}
+
+static void* AcquireHugeBlock(const int32_t owner, const uint32_t generation)
+{
+    if (!ReserveHugeBlock()) {
+        if (ReclaimIdlePools(owner, false) == 0 || !ReserveHugeBlock()) {
+            return nullptr;
+        }
+    }
+    void* block = op::internal::BlockPool::GetOneHugeBlock();
+    if (block == nullptr && ReclaimIdlePools(owner, false) > 0) {
+        block = op::internal::BlockPool::GetOneHugeBlock();
+    }
+    if (block == nullptr) {
+        gHugeMemState.usedBlockNum.fetch_sub(1U, std::memory_order_relaxed);
+        return nullptr;
+    }
+    auto* header = static_cast<HugeBlockHeader*>(block);
+    header->offset = op::internal::kHugeBlockDefaultOffset;
+    header->generation.store(generation, std::memory_order_relaxed);
+    header->poolIndex.store(owner, std::memory_order_release);
+    return block;
+}
+
+static void ReleaseHugeBlock(void* block)
+{
+    if (block == nullptr) {
+        return;
+    }
+    static_cast<HugeBlockHeader*>(block)->poolIndex.store(op::kInvalidHugeMemIndexId, std::memory_order_relaxed);
+    op::internal::BlockPool::FreeOneHugeBlock(block);
+    gHugeMemState.usedBlockNum.fetch_sub(1U, std::memory_order_relaxed);
+}
+
 void FreeHugeMem()
 {
     int32_t id = op::internal::GetThreadLocalContext().poolIndex_;
@@ -255,8 +615,8 @@ void FreeHugeMem()
     }
     gHugeMemPool[id].ReleaseAllAddr();
     gHugeMemPool[id].Init(false);
-    const std::lock_guard<std::mutex> lock(g_hugeMemMutex);
-    gHugeMemPoolIndex.push_back(id);
+    gHugeMemState.activePoolNum.fetch_sub(1U, std::memory_order_relaxed);
+    gHugeMemPoolIndex.Push(id);
 }
 
 void* GetAddr(const int32_t id, size_t size)
@@ -267,6 +627,68 @@ void* GetAddr(const int32_t id, size_t size)
     return gHugeMemPool[id].GetAddr(size);
 }
 
+void ReleaseHugeAddr(const void* addr)
+{
+    const auto* header = static_cast<const HugeBlockHeader*>(op::internal::BlockPool::GetHugeBlockBase(addr));
+    const int32_t id = header->poolIndex.load(std::memory_order_acquire);
+    if (id < 0 || id >= kMaxHugeMemObjectNum) {
+        return;
+    }
+    const uint32_t generation = header->generation.load(std::memory_order_relaxed);
+    if (static_cast<const uint64_t*>(addr)[-1] != MakeHugeAddrTag(generation)) {
+        OP_LOGD("Hugemem trace: address %p is not of the current owner of its block.", addr);
+        return;
+    }
+    gHugeMemPool[id].ReleaseOne(generation);
+}
+
+void GetHugeMemStats(HugeMemStats& stats)
+{
+    stats.blockSize = static_cast<size_t>(kHugeBlockSize);
+    stats.totalBlockNum = static_cast<size_t>(kHugeBlockNum);
+    stats.budgetBlockNum = GetBudgetBlockNum();
+    stats.usedBlockNum = gHugeMemState.usedBlockNum.load(std::memory_order_relaxed);
+    stats.peakUsedBlockNum = gHugeMemState.peakUsedBlockNum.load(std::memory_order_relaxed);
+    stats.activePoolNum = gHugeMemState.activePoolNum.load(std::memory_order_relaxed);
+    stats.peakActivePoolNum = gHugeMemState.peakActivePoolNum.load(std::memory_order_relaxed);
+    stats.peakPoolBlockNum = gHugeMemState.peakPoolBlockNum.load(std::memory_order_relaxed);
+    stats.fallbackNum = gHugeMemState.fallbackNum.load(std::memory_order_relaxed);
+    stats.fallbackBytes = gHugeMemState.fallbackBytes.load(std::memory_order_relaxed);
+    stats.reclaimedPoolNum = gHugeMemState.reclaimedPoolNum.load(std::memory_order_relaxed);
+    stats.reclaimedBlockNum = gHugeMemState.reclaimedBlockNum.load(std::memory_order_relaxed);
+    stats.trimmedBlockNum = gHugeMemState.trimmedBlockNum.load(std::memory_order_relaxed);
+}
+
+void GetHugeMemPoolStats(std::vector<HugeMemPoolStats>& pools)
+{
+    pools.clear();
+    for (int32_t i = 0; i < kMaxHugeMemObjectNum; i++) {
+        HugeMemPoolStats stats;
+        if (gHugeMemPool[i].GetStats(stats)) {
+            pools.push_back(stats);
+        }
+    }
+}
+
+void SetHugeMemBudget(size_t budgetBytes)
+{
+    size_t budgetBlockNum = budgetBytes / static_cast<size_t>(kHugeBlockSize);
+    if (budgetBlockNum == 0 || budgetBlockNum > static_cast<size_t>(kHugeBlockNum)) {
+        budgetBlockNum = static_cast<size_t>(kHugeBlockNum);
+    }
+    OP_LOGI("Hugemem trace: set huge memory budget to %zu blocks.", budgetBlockNum);
+    // blocks held beyond a lowered budget are given back when their pools are released or reclaimed
+    gHugeMemState.budgetBlockNum.store(budgetBlockNum, std::memory_order_relaxed);
+}
+
+size_t TrimHugeMem()
+{
+    (void)ReclaimIdlePools(op::kInvalidHugeMemIndexId, true);
+    const size_t trimmed = op::internal::BlockPool::TrimHugeBlocks();
+    gHugeMemState.trimmedBlockNum.fetch_add(trimmed, std::memory_order_relaxed);
+    return trimmed;
+}
+
 int32_t GetPoolCurrentArrayIndex(const int32_t id)
 {
     if (id >= kMaxHugeMemObjectNum) {
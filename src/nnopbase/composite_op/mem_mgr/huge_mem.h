@@ -11,11 +11,63 @@
 #ifndef OP_API_OP_API_COMMON_HUGE_MEM_H_
 #define OP_API_OP_API_COMMON_HUGE_MEM_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace op {
 namespace internal {
 
+/**
+ * @brief Global view of the huge memory pools. Block numbers count blocks of kHugeBlockSize bytes.
+ *        The budget is read from ACLNN_HUGE_MEM_BUDGET (MB) at startup and can be changed by SetHugeMemBudget.
+ */
+struct HugeMemStats {
+    size_t blockSize{0};
+    // blocks of the BlockPool huge region
+    size_t totalBlockNum{0};
+    // blocks the pools may hold at the same time
+    size_t budgetBlockNum{0};
+    // blocks held by the pools now
+    size_t usedBlockNum{0};
+    size_t peakUsedBlockNum{0};
+    // pool indexes handed out now
+    size_t activePoolNum{0};
+    size_t peakActivePoolNum{0};
+    // the most blocks a single pool has held
+    size_t peakPoolBlockNum{0};
+    // allocations served by the block cache because no huge block was available
+    uint64_t fallbackNum{0};
+    uint64_t fallbackBytes{0};
+    // idle pools whose blocks were taken back under pressure
+    uint64_t reclaimedPoolNum{0};
+    uint64_t reclaimedBlockNum{0};
+    // free blocks whose pages were given back to the OS
+    uint64_t trimmedBlockNum{0};
+};
+
+struct HugeMemPoolStats {
+    int32_t poolIndex{-1};
+    size_t blockNum{0};
+    size_t peakBlockNum{0};
+    // bytes handed out since the pool was last released
+    size_t usedBytes{0};
+    // allocations not deallocated yet
+    int64_t liveNum{0};
+};
+
+void GetHugeMemStats(HugeMemStats& stats);
+
+// stats of the pools holding blocks now
+void GetHugeMemPoolStats(std::vector<HugeMemPoolStats>& pools);
+
+// limit the bytes of huge blocks held by all pools, 0 means the whole huge region
+void SetHugeMemBudget(size_t budgetBytes);
+
+// take back the blocks of idle pools and give the pages of free blocks back to the OS, return the blocks trimmed
+size_t TrimHugeMem();
+
+
 int32_t GetPoolCurrentArrayIndex(const int32_t id);
 
 const void* GetPoolLinkHead(const int32_t id);
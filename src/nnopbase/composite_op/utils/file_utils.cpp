@@ -15,6 +15,7 @@
 #include <dirent.h>
 #include "mmpa/mmpa_api.h"
 #include "opdev/op_dfx.h"
+#include "opp_manifest.h"
 
 using namespace std;
 namespace op {
@@ -67,44 +68,13 @@ void GetFilesWithSuffix(const std::string& path, const std::string& suffix, std:
         return;
     }
 
-    if (!IsDir(realPath)) {
+    vector<string> names;
+    if (internal::ListFilesBySuffix(realPath, suffix, names) != ACLNN_SUCCESS) {
         return;
     }
-
-    struct dirent** entries = nullptr;
-    const auto fileNum = scandir(realPath.c_str(), &entries, nullptr, nullptr);
-    if (entries == nullptr) {
-        return;
-    }
-
-    if (fileNum < 0) {
-        free(entries);
-        return;
-    }
-
-    for (int i = 0; i < fileNum; ++i) {
-        const dirent* const dirEnt = entries[i];
-        const string name = string(dirEnt->d_name);
-        if ((strcmp(name.c_str(), ".") == 0) || (strcmp(name.c_str(), "..") == 0)) {
-            continue;
-        }
-
-        if (dirEnt->d_type == DT_DIR) {
-            continue;
-        }
-
-        if (name.size() < suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
-            continue;
-        }
-
-        const string fullName = realPath + "/" + name;
-        files.push_back(fullName);
-    }
-
-    for (int i = 0; i < fileNum; i++) {
-        free(entries[i]);
+    for (const auto& name : names) {
+        files.push_back(realPath + "/" + name);
     }
-    free(entries);
 }
 
 std::string RealPath(const std::string& path)
@@ -8,16 +8,22 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <map>
+#include <new>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <mutex>
-#include <dirent.h>
 #include <strings.h>
 #include "opdev/op_def.h"
 #include "opdev/op_log.h"
+#include "file_utils.h"
+#include "opp_manifest.h"
 
 namespace op {
 
@@ -33,6 +39,130 @@ std::vector<ge::AscendString> globalOpTypeName__ __attribute__((init_priority(20
 std::unordered_map<std::string, uint32_t>& OpTypeDict::opTypeName2Id_ = globalOpTypeName2Id__;
 std::vector<ge::AscendString>& OpTypeDict::opTypeName_ = globalOpTypeName__;
 
+/*
+ * The op type tables are read without lock. They are only appended to under opTypeMutex, and an entry is
+ * published before opTypeNum or the id index makes it visible. All of them are constant initialized, so that
+ * op types can be added by static initializers of any translation unit.
+ *
+ * Names live in fixed size chunks that never move. The name -> id index is an open addressing table, a full
+ * table is replaced by one of twice the size and intentionally leaked, as readers may still probe it.
+ */
+constexpr uint32_t OP_TYPE_NAME_CHUNK_SIZE = 256;
+constexpr uint32_t OP_TYPE_NAME_CHUNK_NUM = 256;
+constexpr size_t OP_TYPE_INDEX_INIT_CAPACITY = 1024;
+
+static std::atomic<ge::AscendString*> opTypeNameChunks[OP_TYPE_NAME_CHUNK_NUM];
+
+struct OpTypeIndexSlot {
+    std::atomic<size_t> hash;
+    std::atomic<uint32_t> id; // 0 is the id of BEGIN__, which is never looked up by name
+};
+
+struct OpTypeIndex {
+    size_t mask;
+    size_t size;
+    OpTypeIndexSlot* slots;
+};
+
+static std::atomic<OpTypeIndex*> opTypeIndex{nullptr};
+
+static const ge::AscendString& GetOpTypeName(uint32_t opType)
+{
+    ge::AscendString* chunk = opTypeNameChunks[opType / OP_TYPE_NAME_CHUNK_SIZE].load(std::memory_order_acquire);
+    return chunk[opType % OP_TYPE_NAME_CHUNK_SIZE];
+}
+
+static bool AddOpTypeName(uint32_t opType, const char* opName)
+{
+    uint32_t chunkIdx = opType / OP_TYPE_NAME_CHUNK_SIZE;
+    if (chunkIdx >= OP_TYPE_NAME_CHUNK_NUM) {
+        OP_LOGE(ACLNN_ERR_INNER, "Too many op types, op %s can not be added.", opName);
+        return false;
+    }
+    ge::AscendString* chunk = opTypeNameChunks[chunkIdx].load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = new (std::nothrow) ge::AscendString[OP_TYPE_NAME_CHUNK_SIZE];
+        if (chunk == nullptr) {
+            OP_LOGE(ACLNN_ERR_INNER, "Failed to allocate op type names, op %s can not be added.", opName);
+            return false;
+        }
+        opTypeNameChunks[chunkIdx].store(chunk, std::memory_order_release);
+    }
+    chunk[opType % OP_TYPE_NAME_CHUNK_SIZE] = ge::AscendString(opName);
+    return true;
+}
+
+static bool IsSameName(const ge::AscendString& name, const char* str, size_t len)
+{
+    return name.GetLength() == len && memcmp(name.GetString(), str, len) == 0;
+}
+
+static void InsertOpTypeIndex(OpTypeIndex* index, size_t hash, uint32_t id)
+{
+    size_t pos = hash & index->mask;
+    while (index->slots[pos].id.load(std::memory_order_relaxed) != 0) {
+        pos = (pos + 1) & index->mask;
+    }
+    index->slots[pos].hash.store(hash, std::memory_order_relaxed);
+    index->slots[pos].id.store(id, std::memory_order_release);
+    index->size++;
+}
+
+static OpTypeIndex* NewOpTypeIndex(size_t capacity)
+{
+    auto index = new (std::nothrow) OpTypeIndex{capacity - 1, 0, new (std::nothrow) OpTypeIndexSlot[capacity]()};
+    if (index != nullptr && index->slots == nullptr) {
+        delete index;
+        return nullptr;
+    }
+    return index;
+}
+
+// keeps the load factor at most 1/2, so that every probe of a reader ends at an empty slot
+static bool AddOpTypeIndex(const char* opName, uint32_t id)
+{
+    size_t hash = std::hash<std::string_view>{}(std::string_view(opName));
+    OpTypeIndex* index = opTypeIndex.load(std::memory_order_relaxed);
+    if (index == nullptr || (index->size + 1) * 2 > index->mask + 1) {
+        size_t capacity = (index == nullptr) ? OP_TYPE_INDEX_INIT_CAPACITY : (index->mask + 1) * 2;
+        OpTypeIndex* newIndex = NewOpTypeIndex(capacity);
+        if (newIndex == nullptr) {
+            OP_LOGE(ACLNN_ERR_INNER, "Failed to allocate op type index, op %s can not be added.", opName);
+            return false;
+        }
+        for (size_t i = 0; index != nullptr && i <= index->mask; i++) {
+            uint32_t oldId = index->slots[i].id.load(std::memory_order_relaxed);
+            if (oldId != 0) {
+                InsertOpTypeIndex(newIndex, index->slots[i].hash.load(std::memory_order_relaxed), oldId);
+            }
+        }
+        InsertOpTypeIndex(newIndex, hash, id);
+        opTypeIndex.store(newIndex, std::memory_order_release);
+        return true;
+    }
+    InsertOpTypeIndex(index, hash, id);
+    return true;
+}
+
+static uint32_t FindOpTypeIndex(const char* opName, size_t len)
+{
+    const OpTypeIndex* index = opTypeIndex.load(std::memory_order_acquire);
+    if (index == nullptr) {
+        return 0;
+    }
+    size_t hash = std::hash<std::string_view>{}(std::string_view(opName, len));
+    for (size_t pos = hash & index->mask;; pos = (pos + 1) & index->mask) {
+        uint32_t id = index->slots[pos].id.load(std::memory_order_acquire);
+        if (id == 0) {
+            return 0;
+        }
+        if (index->slots[pos].hash.load(std::memory_order_relaxed) == hash &&
+            IsSameName(GetOpTypeName(id), opName, len)) {
+            return id;
+        }
+    }
+}
+
 std::vector<std::vector<std::string>> BinConfigJsonDict::opConfigJsonPath_;
 std::unordered_map<std::string, uint32_t> BinConfigJsonDict::opConfigJsonPath2Id_;
 uint32_t BinConfigJsonDict::transDataId_ = INVALID_OP_TYPE_ID;
@@ -41,20 +171,19 @@ constexpr char const* TRANS_DATA = "TransData";
 aclnnStatus ReadDirBySuffix(const string& dir, const string& suffix, vector<string>& paths)
 {
     // GX
-    DIR* dirp = opendir(dir.c_str());
-    if (dirp == nullptr) {
+    vector<internal::OppManifestEntry> entries;
+    const string realDir = RealPath(dir);
+    if (realDir.empty() || !internal::OppManifest::Instance().ListDir(realDir, entries)) {
         OP_LOGW("Dir %s is invalid.", dir.c_str());
         return ACLNN_ERR_INNER;
     }
-    struct dirent* dp;
-    while ((dp = readdir(dirp)) != nullptr) {
-        const string& fn = string(dp->d_name);
+    for (const auto& entry : entries) {
+        const string& fn = entry.name;
         size_t fnlen = fn.size();
         if (fnlen >= suffix.size() && fn.substr(fnlen - suffix.size()) == suffix) {
             paths.emplace_back(fn);
         }
     }
-    closedir(dirp);
     return ACLNN_SUCCESS;
 }
 
@@ -115,28 +244,36 @@ static std::string GetConfigJsonName(const ge::AscendString& s)
 aclnnStatus OpTypeDict::Add(uint32_t& id, const char* opName)
 {
     const std::lock_guard<std::mutex> lock(opTypeMutex);
-    if (opTypeName2Id_.find(opName) != opTypeName2Id_.end()) {
-        id = opTypeName2Id_[opName];
+    uint32_t existId = FindOpTypeIndex(opName, strlen(opName));
+    if (existId != 0) {
+        id = existId;
         OP_LOGI("Op %s is already added, id is %u", opName, id);
         return ACLNN_SUCCESS;
     }
-    if (opTypeName_.empty()) {
-        opTypeName_.emplace_back(ge::AscendString("BEGIN__"));
+    if (opTypeNum == 0) {
+        if (!AddOpTypeName(0, "BEGIN__")) {
+            return ACLNN_ERR_INNER;
+        }
         std::vector<std::string> temp;
         temp.emplace_back();
         BinConfigJsonDict::opConfigJsonPath_.emplace_back(temp);
-        opTypeNum++;
+        opTypeName_.emplace_back(GetOpTypeName(0));
+        opTypeNum.store(1, std::memory_order_release);
     }
 
     // check duplicate
     id = opTypeNum;
-    opTypeName_.emplace_back(ge::AscendString(opName));
-    string opConfigFileStr(GetConfigJsonName(opTypeName_.back()));
-    OP_LOGI("Add op %s with id %u, config json name [%s].\n", opName, id, opConfigFileStr.c_str());
+    if (!AddOpTypeName(id, opName)) {
+        return ACLNN_ERR_INNER;
+    }
+    const ge::AscendString& opTypeName = GetOpTypeName(id);
+    opTypeName_.emplace_back(opTypeName);
     opTypeName2Id_[opName] = id;
+    string opConfigFileStr(GetConfigJsonName(opTypeName));
+    OP_LOGI("Add op %s with id %u, config json name [%s].\n", opName, id, opConfigFileStr.c_str());
 
     // compatible with the operator naming rules with old version
-    string opConfigFileStrOld(GetConfigJsonNameOld(opTypeName_.back()));
+    string opConfigFileStrOld(GetConfigJsonNameOld(opTypeName));
 
     // updata BinConfigJsonDict
     std::vector<std::string> configFiles;
@@ -150,31 +287,30 @@ aclnnStatus OpTypeDict::Add(uint32_t& id, const char* opName)
 
     /* Special operation for the following case:
      * Two */
-    if (BinConfigJsonDict::transDataId_ == INVALID_OP_TYPE_ID && opTypeName_.back() == ge::AscendString(TRANS_DATA)) {
+    if (BinConfigJsonDict::transDataId_ == INVALID_OP_TYPE_ID && opTypeName == ge::AscendString(TRANS_DATA)) {
         OP_LOGI("TransData id is %u. config json name [%s].\n", id, opConfigFileStr.c_str());
         BinConfigJsonDict::transDataId_ = id;
     }
-    opTypeNum++;
+    // publish the name to ToString before the id to ToOpType
+    opTypeNum.store(id + 1, std::memory_order_release);
+    if (!AddOpTypeIndex(opName, id)) {
+        return ACLNN_ERR_INNER;
+    }
     return ACLNN_SUCCESS;
 }
 
-uint32_t OpTypeDict::ToOpType(const std::string& opName)
-{
-    const std::lock_guard<std::mutex> lock(opTypeMutex);
-    auto iter = opTypeName2Id_.find(opName);
-    if (iter == opTypeName2Id_.end()) {
-        return 0;
-    }
-    return iter->second;
-}
+uint32_t OpTypeDict::ToOpType(const std::string& opName) { return FindOpTypeIndex(opName.c_str(), opName.size()); }
+
+const ge::AscendString OpTypeDict::ToString(uint32_t opType) { return ToStringRef(opType); }
 
-const ge::AscendString OpTypeDict::ToString(uint32_t opType)
+const ge::AscendString& OpTypeDict::ToStringRef(uint32_t opType)
 {
-    const std::lock_guard<std::mutex> lock(opTypeMutex);
-    if (opType >= opTypeNum) {
-        return opTypeName_[0];
+    static const ge::AscendString beginName("BEGIN__");
+    uint32_t num = opTypeNum.load(std::memory_order_acquire);
+    if (num == 0) {
+        return beginName;
     }
-    return opTypeName_[opType];
+    return GetOpTypeName(opType < num ? opType : 0);
 }
 
 size_t OpTypeDict::GetAllOpTypeSize() { return static_cast<size_t>(opTypeNum); }
@@ -200,7 +336,7 @@ void BinConfigJsonDict::UpdateConfigJsonPath(uint32_t opType, const std::string&
         }
         opConfigJsonPath_[opType].emplace_back(opFile);
         opConfigJsonPath2Id_[opFile] = opType;
-        OP_LOGD("opFile for op %u %s is %s.", opType, OpTypeDict::opTypeName_[opType].GetString(), opFile.c_str());
+        OP_LOGD("opFile for op %u %s is %s.", opType, OpTypeDict::ToString(opType).GetString(), opFile.c_str());
     }
 }
 
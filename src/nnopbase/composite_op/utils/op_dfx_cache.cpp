@@ -15,6 +15,7 @@
 #include "kernel_launcher.h"
 #include "op_dfx_internal.h"
 #include "op_cache_internal.h"
+#include "prof_report_cache.h"
 #include "opdev/op_def.h"
 #include "opdev/op_cache.h"
 #include "opdev/platform.h"
@@ -209,14 +210,14 @@ static void ReportCachedTensorAdditionInfo(const FVector<const TensorsCached*>&
         OP_CHECK(memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &tensorInfo,
                           sizeof(MsprofTensorInfo)) == EOK,
                  OP_LOGW("Failed to memcpy tensor additional info."), return);
-        MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+        ProfReportAdditionalInfo(additionInfo);
     }
     if (tail != 0) {
         PrepareTensorInfoFromCache(tensors, tensorInfo, summaryItemId, type, tail, loop * MSPROF_GE_TENSOR_DATA_NUM);
         OP_CHECK(memcpy_s(additionInfo.data, MSPROF_ADDTIONAL_INFO_DATA_LENGTH, &tensorInfo,
                           sizeof(MsprofTensorInfo)) == EOK,
                  OP_LOGW("Failed to memcpy tensor tail additional info."), return);
-        MsprofReportAdditionalInfo(true, (void*)(&additionInfo), sizeof(MsprofAdditionalInfo));
+        ProfReportAdditionalInfo(additionInfo);
     }
 }
 
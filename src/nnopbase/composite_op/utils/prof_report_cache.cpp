@@ -0,0 +1,418 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "prof_report_cache.h"
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include "mmpa/mmpa_api.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/op_def.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_log.h"
+
+namespace op {
+namespace internal {
+namespace {
+constexpr size_t kEnvBufLen = 16U;
+
+struct ProfReportBatch {
+    std::mutex mutex;
+    size_t num{0U};
+    std::array<ProfReportRecord, kProfReportBatchSize> records;
+};
+
+struct ProfReportBatchRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ProfReportBatch>> batches;
+};
+
+std::atomic<ProfReporter*> g_profReporter{nullptr};
+
+std::atomic<uint64_t> g_records{0U};
+std::atomic<uint64_t> g_batches{0U};
+std::atomic<uint64_t> g_tensorInfoHits{0U};
+std::atomic<uint64_t> g_tensorInfoMisses{0U};
+std::atomic<uint64_t> g_attrIdHits{0U};
+std::atomic<uint64_t> g_attrIdMisses{0U};
+
+bool ReadProfReportCacheEnable()
+{
+    char buf[kEnvBufLen] = {};
+    if (mmGetEnv("ACLNN_PROF_REPORT_CACHE", &buf[0U], kEnvBufLen) != EN_OK) {
+        return true;
+    }
+    return strcmp(buf, "0") != 0;
+}
+
+// Intentionally leaked: threads may still flush their batches while the process is exiting.
+ProfReportBatchRegistry& GetBatchRegistry()
+{
+    static ProfReportBatchRegistry* registry = new ProfReportBatchRegistry();
+    return *registry;
+}
+
+ProfReporter& GetProfReporter()
+{
+    static ProfReporter* defaultReporter = new ProfReporter();
+    ProfReporter* reporter = g_profReporter.load(std::memory_order_acquire);
+    return (reporter != nullptr) ? *reporter : *defaultReporter;
+}
+
+// The caller holds batch.mutex.
+void SubmitBatch(ProfReportBatch& batch)
+{
+    if (batch.num == 0U) {
+        return;
+    }
+    GetProfReporter().Report(batch.records.data(), batch.num);
+    g_records.fetch_add(batch.num, std::memory_order_relaxed);
+    g_batches.fetch_add(1U, std::memory_order_relaxed);
+    batch.num = 0U;
+}
+
+class ProfReportBatchHolder {
+public:
+    ProfReportBatchHolder() : batch_(std::make_shared<ProfReportBatch>())
+    {
+        auto& registry = GetBatchRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.batches.push_back(batch_);
+    }
+
+    ~ProfReportBatchHolder()
+    {
+        {
+            std::lock_guard<std::mutex> lock(batch_->mutex);
+            SubmitBatch(*batch_);
+        }
+        auto& registry = GetBatchRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto it = registry.batches.begin(); it != registry.batches.end(); ++it) {
+            if (*it == batch_) {
+                registry.batches.erase(it);
+                break;
+            }
+        }
+    }
+
+    ProfReportBatch& Get() { return *batch_; }
+
+private:
+    std::shared_ptr<ProfReportBatch> batch_;
+};
+
+ProfReportBatch& GetThreadBatch()
+{
+    thread_local ProfReportBatchHolder holder;
+    return holder.Get();
+}
+
+template <typename T>
+void AppendValue(std::string& signature, const T& value)
+{
+    signature.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void AppendBytes(std::string& signature, const void* data, size_t size)
+{
+    AppendValue(signature, static_cast<uint64_t>(size));
+    if (data != nullptr && size > 0U) {
+        signature.append(static_cast<const char*>(data), size);
+    }
+}
+
+template <typename T>
+void AppendArray(std::string& signature, const aclArray<T>* array)
+{
+    if (array == nullptr) {
+        AppendValue(signature, UINT64_MAX);
+        return;
+    }
+    AppendBytes(signature, array->GetData(), array->Size() * sizeof(T));
+}
+
+void AppendScalar(std::string& signature, const aclScalar* scalar)
+{
+    if (scalar == nullptr) {
+        AppendValue(signature, UINT64_MAX);
+        return;
+    }
+    const op::DataType dataType = scalar->GetDataType();
+    AppendValue(signature, static_cast<uint32_t>(dataType));
+    const size_t size = scalar->Size();
+    AppendBytes(signature, scalar->GetData(), (size < kDataTypeSizeBitOffset) ? size : 0U);
+}
+
+bool AppendHostTensor(size_t idx, size_t listIdx, const aclTensor* tensor, std::string& signature)
+{
+    if (tensor == nullptr || tensor->GetPlacement() != gert::TensorPlacement::kOnHost) {
+        return true;
+    }
+    const op::DataType dataType = tensor->GetDataType();
+    const size_t typeSize = op::TypeSize(dataType);
+    const size_t bytes = (typeSize < kDataTypeSizeBitOffset) ? typeSize * static_cast<size_t>(tensor->Size()) : 0U;
+    if (signature.size() + bytes > kProfAttrSignatureMaxBytes) {
+        return false;
+    }
+    AppendValue(signature, static_cast<uint32_t>(idx));
+    AppendValue(signature, static_cast<uint32_t>(listIdx));
+    AppendValue(signature, static_cast<uint32_t>(dataType));
+    AppendBytes(signature, tensor->GetData(), bytes);
+    return true;
+}
+} // namespace
+
+void ProfReporter::Report(const ProfReportRecord* records, size_t num)
+{
+    for (size_t i = 0U; i < num; i++) {
+        const ProfReportRecord& record = records[i];
+        int32_t res = 0;
+        if (record.type == ProfReportType::COMPACT) {
+            res = MsprofReportCompactInfo(true, const_cast<MsprofCompactInfo*>(&record.compactInfo),
+                                          sizeof(MsprofCompactInfo));
+        } else {
+            res = MsprofReportAdditionalInfo(true, const_cast<MsprofAdditionalInfo*>(&record.additionInfo),
+                                             sizeof(MsprofAdditionalInfo));
+        }
+        if (res != 0) {
+            OP_LOGW("Report profiling record type %u failed, res = %d.", static_cast<uint32_t>(record.type), res);
+        }
+    }
+}
+
+void SetProfReporter(ProfReporter* reporter)
+{
+    FlushAllProfReport();
+    g_profReporter.store(reporter, std::memory_order_release);
+}
+
+void ProfReportCompactInfo(const MsprofCompactInfo& compactInfo)
+{
+    ProfReportBatch& batch = GetThreadBatch();
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    ProfReportRecord& record = batch.records[batch.num++];
+    record.type = ProfReportType::COMPACT;
+    record.compactInfo = compactInfo;
+    if (batch.num == kProfReportBatchSize) {
+        SubmitBatch(batch);
+    }
+}
+
+void ProfReportAdditionalInfo(const MsprofAdditionalInfo& additionInfo)
+{
+    ProfReportBatch& batch = GetThreadBatch();
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    ProfReportRecord& record = batch.records[batch.num++];
+    record.type = ProfReportType::ADDITIONAL;
+    record.additionInfo = additionInfo;
+    if (batch.num == kProfReportBatchSize) {
+        SubmitBatch(batch);
+    }
+}
+
+void FlushProfReport()
+{
+    ProfReportBatch& batch = GetThreadBatch();
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    SubmitBatch(batch);
+}
+
+void FlushAllProfReport()
+{
+    auto& registry = GetBatchRegistry();
+    std::lock_guard<std::mutex> registryLock(registry.mutex);
+    for (const auto& batch : registry.batches) {
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        SubmitBatch(*batch);
+    }
+}
+
+std::atomic<bool> ProfReportCache::enabled_{ReadProfReportCacheEnable()};
+std::atomic<uint64_t> ProfReportCache::generation_{0U};
+
+ProfReportCache& ProfReportCache::Instance()
+{
+    thread_local ProfReportCache cache;
+    cache.CheckGeneration();
+    return cache;
+}
+
+void ProfReportCache::CheckGeneration()
+{
+    const uint64_t generation = generation_.load(std::memory_order_relaxed);
+    if (localGeneration_ == generation) {
+        return;
+    }
+    tensorInfos_.clear();
+    attrIds_.clear();
+    kernelLauncherIds_.clear();
+    localGeneration_ = generation;
+}
+
+ProfReportStats ProfReportCache::GetStats()
+{
+    ProfReportStats stats;
+    stats.records = g_records.load(std::memory_order_relaxed);
+    stats.batches = g_batches.load(std::memory_order_relaxed);
+    stats.tensorInfoHits = g_tensorInfoHits.load(std::memory_order_relaxed);
+    stats.tensorInfoMisses = g_tensorInfoMisses.load(std::memory_order_relaxed);
+    stats.attrIdHits = g_attrIdHits.load(std::memory_order_relaxed);
+    stats.attrIdMisses = g_attrIdMisses.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ProfReportCache::ResetStats()
+{
+    g_records.store(0U, std::memory_order_relaxed);
+    g_batches.store(0U, std::memory_order_relaxed);
+    g_tensorInfoHits.store(0U, std::memory_order_relaxed);
+    g_tensorInfoMisses.store(0U, std::memory_order_relaxed);
+    g_attrIdHits.store(0U, std::memory_order_relaxed);
+    g_attrIdMisses.store(0U, std::memory_order_relaxed);
+}
+
+std::vector<MsprofAdditionalInfo>* ProfReportCache::FindTensorInfo(const std::string& signature)
+{
+    const auto it = tensorInfos_.find(signature);
+    if (it == tensorInfos_.end()) {
+        g_tensorInfoMisses.fetch_add(1U, std::memory_order_relaxed);
+        return nullptr;
+    }
+    g_tensorInfoHits.fetch_add(1U, std::memory_order_relaxed);
+    return &it->second;
+}
+
+std::vector<MsprofAdditionalInfo>& ProfReportCache::AddTensorInfo(const std::string& signature)
+{
+    if (tensorInfos_.size() >= kProfReportCacheCapacity) {
+        OP_LOGI("Profiling tensor info cache is full, clear %zu entries.", tensorInfos_.size());
+        tensorInfos_.clear();
+    }
+    auto& infos = tensorInfos_[signature];
+    infos.clear();
+    return infos;
+}
+
+bool ProfReportCache::FindAttrId(const std::string& signature, uint64_t& attrId)
+{
+    const auto it = attrIds_.find(signature);
+    if (it == attrIds_.end()) {
+        g_attrIdMisses.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+    g_attrIdHits.fetch_add(1U, std::memory_order_relaxed);
+    attrId = it->second;
+    return true;
+}
+
+void ProfReportCache::AddAttrId(const std::string& signature, uint64_t attrId)
+{
+    if (attrIds_.size() >= kProfReportCacheCapacity) {
+        OP_LOGI("Profiling attr id cache is full, clear %zu entries.", attrIds_.size());
+        attrIds_.clear();
+    }
+    attrIds_[signature] = attrId;
+}
+
+uint64_t ProfReportCache::GetKernelLauncherId(uint32_t opType)
+{
+    if (!IsEnabled()) {
+        return GenKernelLauncherId(op::OpTypeDict::ToString(opType).GetString());
+    }
+    const auto it = kernelLauncherIds_.find(opType);
+    if (it != kernelLauncherIds_.end()) {
+        return it->second;
+    }
+    const uint64_t id = GenKernelLauncherId(op::OpTypeDict::ToString(opType).GetString());
+    kernelLauncherIds_[opType] = id;
+    return id;
+}
+
+void AppendTensorSignature(const FVector<const aclTensor*>& tensors, std::string& signature)
+{
+    AppendValue(signature, static_cast<uint32_t>(tensors.size()));
+    for (const aclTensor* tensor : tensors) {
+        AppendValue(signature, static_cast<uint32_t>(tensor->GetDataType()));
+        AppendValue(signature, static_cast<uint32_t>(tensor->GetStorageFormat()));
+        const auto& shape = tensor->GetStorageShape();
+        const size_t dimNum = shape.GetDimNum();
+        AppendValue(signature, static_cast<uint32_t>(dimNum));
+        for (size_t i = 0U; i < dimNum; i++) {
+            AppendValue(signature, static_cast<int64_t>(shape[i]));
+        }
+    }
+}
+
+bool AppendAttrSignature(OpArgList& attrs, std::string& signature)
+{
+    attrs.VisitByNoReturn([&signature]([[maybe_unused]] size_t idx, OpArg& value) {
+        AppendValue(signature, static_cast<uint32_t>(value.type));
+        switch (value.type) {
+            case OpArgType::OPARG_DATATYPE:
+            case OpArgType::OPARG_BOOL:
+            case OpArgType::OPARG_INT:
+            case OpArgType::OPARG_UINT:
+                AppendValue(signature, value->value);
+                break;
+            case OpArgType::OPARG_FLOAT:
+                AppendValue(signature, value->fvalue);
+                break;
+            case OpArgType::OPARG_DOUBLE:
+                AppendValue(signature, value->dvalue);
+                break;
+            case OpArgType::OPARG_STRING: {
+                const char* str = static_cast<const char*>(value->pointer);
+                AppendBytes(signature, str, (str == nullptr) ? 0U : strlen(str));
+                break;
+            }
+            case OpArgType::OPARG_ACLSCALAR:
+                AppendScalar(signature, static_cast<const aclScalar*>(value->pointer));
+                break;
+            case OpArgType::OPARG_INT_LIST:
+                AppendArray(signature, static_cast<const aclIntArray*>(value->pointer));
+                break;
+            case OpArgType::OPARG_FLOAT_LIST:
+                AppendArray(signature, static_cast<const aclFloatArray*>(value->pointer));
+                break;
+            default:
+                // not part of the attr string
+                break;
+        }
+    });
+    return signature.size() <= kProfAttrSignatureMaxBytes;
+}
+
+bool AppendHostInputSignature(OpArgList& inputs, std::string& signature)
+{
+    bool cacheable = true;
+    inputs.VisitByNoReturn([&signature, &cacheable](size_t idx, OpArg& value) {
+        if (!cacheable) {
+            return;
+        }
+        if (value.type == OpArgType::OPARG_ACLTENSOR) {
+            cacheable = AppendHostTensor(idx, 0U, static_cast<const aclTensor*>(value->pointer), signature);
+        } else if (value.type == OpArgType::OPARG_ACLTENSOR_LIST) {
+            const aclTensorList* tensorList = static_cast<const aclTensorList*>(value->pointer);
+            if (tensorList == nullptr) {
+                return;
+            }
+            for (uint64_t i = 0U; i < tensorList->Size() && cacheable; i++) {
+                cacheable = AppendHostTensor(idx, i, (*tensorList)[i], signature);
+            }
+        }
+    });
+    return cacheable;
+}
+
+} // namespace internal
+} // namespace op
@@ -30,6 +30,7 @@
 #include "opdev/platform.h"
 #include "op_dfx_internal.h"
 #include "nnopbase_error_msg.h"
+#include "aclnn_trace.h"
 
 void NnopbaseOpLogE(const aclnnStatus code, const NnopbaseChar* const expr) { OP_LOGE(code, "Check %s failed", expr); }
 using namespace op::internal;
@@ -328,6 +329,7 @@ void* NnopbaseGetExecutor(void* space, const NnopbaseChar* opType, NnopbaseChar*
             executor->ownArgs.keyLen = strlen(executor->opType);
             executor->ownArgs.remainKeyLen = NNOPBASE_MAX_ARGS_KEY_LEN - strlen(executor->opType);
             executor->ownArgs.inputKey.resize(NNOPBASE_MAX_ARGS_KEY_LEN);
+            op::internal::TraceRecorder::Begin(op::internal::TraceEvent::INDV_MATCH_ARGS, opType, executor);
             return executor;
         }
     }
@@ -354,6 +356,7 @@ void* NnopbaseGetExecutor(void* space, const NnopbaseChar* opType, NnopbaseChar*
         // 留出optype的偏移量后续生成key的时候用
         executor->ownArgs.keyLen = strlen(executor->opType);
         executor->ownArgs.remainKeyLen = NNOPBASE_MAX_ARGS_KEY_LEN - strlen(executor->opType);
+        op::internal::TraceRecorder::Begin(op::internal::TraceEvent::INDV_MATCH_ARGS, opType, executor);
     }
     OP_LOGI("Get op %s space %p executor addr %p.", opType, space, executor);
     return executor;
@@ -378,6 +381,7 @@ aclnnStatus NnopbaseRunWithWorkspace(void* executor, aclrtStream stream, void* w
     }
 
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
+    const op::internal::TraceScope traceScope(op::internal::TraceEvent::INDV_LAUNCH, nnopExecutor->opType, stream);
     RecordNnopbaseTime(nnopExecutor, NnopbaseTimeIdx::kRunWithWsStart);
     op::internal::GetThreadLocalContext().logInfo_.l2ApiName = nnopExecutor->opType;
     OP_LOGI("Run op %s with workspace len %lu bytes, executor addr %p, executor workspace len %lu bytes.",
@@ -396,6 +400,7 @@ aclnnStatus NnopbaseAddInput(void* executor, const aclTensor* tensor, const uint
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorInfo("AddInput", tensor, index);
+    op::internal::TraceRecorder::AddTensor(tensor, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -412,6 +417,7 @@ aclnnStatus NnopbaseAddIgnoreContinuesInput(void* executor, const aclTensor* ten
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorInfo("AddIgnoreContInput", tensor, index);
+    op::internal::TraceRecorder::AddTensor(tensor, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -429,6 +435,7 @@ aclnnStatus NnopbaseAddIntArrayInput(void* executor, const aclIntArray* array, c
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("IntArray", "AddValueDependInput", array, index);
+    op::AddArrayToTrace(array, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -452,6 +459,7 @@ aclnnStatus NnopbaseAddBoolArrayInput(void* executor, const aclBoolArray* array,
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("BoolArray", "AddValueDependInput", array, index);
+    op::AddArrayToTrace(array, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -475,6 +483,7 @@ aclnnStatus NnopbaseAddFloatArrayInput(void* executor, const aclFloatArray* arra
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("FloatArray", "AddValueDependInput", array, index);
+    op::AddArrayToTrace(array, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -498,6 +507,7 @@ aclnnStatus NnopbaseAddDynamicInput(void* executor, const aclTensorList* tensorL
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorListInfo("AddDynamicInput", tensorList, index);
+    op::AddTensorToTrace(tensorList, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -514,6 +524,7 @@ aclnnStatus NnopbaseAddIgnoreContiguousDynamicInput(void* executor, const aclTen
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorListInfo("AddIgnoreContDynInput", tensorList, index);
+    op::AddTensorToTrace(tensorList, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -530,6 +541,7 @@ aclnnStatus NnopbaseAddOutput(void* executor, const aclTensor* tensor, const uin
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorInfo("AddOutput", tensor, index);
+    op::internal::TraceRecorder::AddTensor(tensor, true);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.outputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -562,6 +574,7 @@ aclnnStatus NnopbaseAddDynamicOutput(void* executor, const aclTensorList* tensor
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogTensorListInfo("AddDynamicOutput", tensorList, index);
+    op::AddTensorToTrace(tensorList, true);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.outputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -599,6 +612,7 @@ aclnnStatus NnopbaseAddAttr(void* executor, void* attrAddr, const size_t attrLen
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(attrAddr);
     OP_LOGI("[DFX] AddAttr[%zu] dtype=Unknown, addr=%p, attrLen=%zu.", index, attrAddr, attrLen);
+    op::internal::TraceRecorder::AddBytes(attrAddr, attrLen, false);
     return NnopbaseExecutorAddAttr((NnopbaseExecutor*)executor, attrAddr, attrLen, index, 0U, kNnopbaseAttrEnd);
 }
 
@@ -608,6 +622,7 @@ aclnnStatus NnopbaseAddAttrWithDtype(void* executor, void* attrAddr, const size_
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(attrAddr);
     NnopbaseLogAttrValueInfo(dtype, attrAddr, attrLen, index);
+    op::internal::TraceRecorder::AddBytes(attrAddr, attrLen, false);
     return NnopbaseExecutorAddAttr((NnopbaseExecutor*)executor, attrAddr, attrLen, index, 0U, dtype);
 }
 
@@ -616,6 +631,7 @@ aclnnStatus NnopbaseAddIntArrayAttr(void* executor, const aclIntArray* array, co
     NNOPBASE_ASSERT_NOTNULL_RETVAL(array);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("IntArray", "AddAttr", array, index);
+    op::AddArrayToTrace(array, false);
     return NnopbaseExecutorAddAttr(PtrCastTo<NnopbaseExecutor>(executor), (PtrCastTo<const void>(array->GetData())),
                                    array->Size() * sizeof(int64_t), index, sizeof(int64_t), kNnopbaseInt);
 }
@@ -625,6 +641,7 @@ aclnnStatus NnopbaseAddBoolArrayAttr(void* executor, const aclBoolArray* array,
     NNOPBASE_ASSERT_NOTNULL_RETVAL(array);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("BoolArray", "AddAttr", array, index);
+    op::AddArrayToTrace(array, false);
     return NnopbaseExecutorAddAttr(PtrCastTo<NnopbaseExecutor>(executor), PtrCastTo<const void>(array->GetData()),
                                    array->Size() * sizeof(bool), index, sizeof(bool), kNnopbaseBool);
 }
@@ -634,6 +651,7 @@ aclnnStatus NnopbaseAddFloatArrayAttr(void* executor, const aclFloatArray* array
     NNOPBASE_ASSERT_NOTNULL_RETVAL(array);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogArrayInfo("FloatArray", "AddAttr", array, index);
+    op::AddArrayToTrace(array, false);
     return NnopbaseExecutorAddAttr(PtrCastTo<NnopbaseExecutor>(executor), PtrCastTo<const void>(array->GetData()),
                                    array->Size() * sizeof(float), index, sizeof(float), kNnopbaseFloat);
 }
@@ -644,6 +662,7 @@ aclnnStatus NnopbaseAddArrayAttr(void* executor, void* array, const size_t len,
     NNOPBASE_ASSERT_NOTNULL_RETVAL(array);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     OP_LOGI("[DFX] AddAttr[%zu] dtype=Unknown, len=%zu, elementSize=%zu.", index, len, elementSize);
+    op::internal::TraceRecorder::AddBytes(array, len * elementSize, false);
     return NnopbaseExecutorAddAttr((NnopbaseExecutor*)executor, array, len * elementSize, index, elementSize,
                                    kNnopbaseAttrEnd);
 }
@@ -654,6 +673,7 @@ aclnnStatus NnopbaseAddArrayAttrWithDtype(void* executor, void* array, const siz
     NNOPBASE_ASSERT_NOTNULL_RETVAL(array);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogRawArrayAttrInfo(dtype, array, len, index);
+    op::internal::TraceRecorder::AddBytes(array, len * elementSize, false);
     return NnopbaseExecutorAddAttr((NnopbaseExecutor*)executor, array, len * elementSize, index, elementSize, dtype);
 }
 
@@ -1076,6 +1096,7 @@ aclnnStatus NnopbaseAddScalarInput(void* executor, const aclScalar* scalar, cons
     OP_LOGD("NnopbaseAddScalarInput Start.");
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NnopbaseLogScalarInfo("AddScalarInput", scalar, index);
+    op::internal::TraceRecorder::AddScalar(scalar, false);
     NnopbaseExecutor* nnopExecutor = PtrCastTo<NnopbaseExecutor>(executor);
     const auto tensors = &nnopExecutor->ownArgs.inputs;
     if (NnopbaseIsV2CacheKeyEnabled(nnopExecutor)) {
@@ -1277,7 +1298,7 @@ void NnopbaseSetMatchArgsFlag(void* executor)
     ((NnopbaseExecutor*)executor)->matchArgsV2 = true;
 }
 
-bool NnopbaseMatchArgs(void* executor, uint64_t* workspaceLen)
+static bool NnopbaseMatchArgsImpl(void* executor, uint64_t* workspaceLen)
 {
     NNOPBASE_ASSERT_NOTNULL_RETVAL(executor);
     NNOPBASE_ASSERT_NOTNULL_RETVAL(workspaceLen);
@@ -1325,6 +1346,16 @@ bool NnopbaseMatchArgs(void* executor, uint64_t* workspaceLen)
     return false;
 }
 
+bool NnopbaseMatchArgs(void* executor, uint64_t* workspaceLen)
+{
+    const bool matched = NnopbaseMatchArgsImpl(executor, workspaceLen);
+    if (op::internal::TraceRecorder::IsEnabled()) {
+        op::internal::TraceRecorder::SetResult(matched ? 1 : 0);
+        op::internal::TraceRecorder::End(executor);
+    }
+    return matched;
+}
+
 bool NnopbaseSupportTensorV2() { return true; }
 
 #ifdef __cplusplus
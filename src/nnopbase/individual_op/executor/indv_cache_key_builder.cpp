@@ -9,12 +9,16 @@
  */
 
 #include "indv_cache_key_builder.h"
+#include "tensor_signature.h"
 #include "utils/indv_hash.h"
 #include "utils/thread_var_container.h"
 
 namespace {
 inline bool CompareTensor(const aclTensor* tensor, const aclTensor* prev)
 {
+    if (!op::internal::IsCacheFullKeyEnable()) {
+        return tensor->GetSignature() == prev->GetSignature();
+    }
     return (tensor->GetDataType() == prev->GetDataType()) && (tensor->GetViewShape() == prev->GetViewShape()) &&
            (tensor->GetStorageFormat() == prev->GetStorageFormat()) &&
            (tensor->GetViewStrides() == prev->GetViewStrides()) && (tensor->GetViewOffset() == prev->GetViewOffset());
@@ -150,6 +154,16 @@ void CacheKeyBuilder::EnsureCapacity(NnopbaseExecutorArgs* args, size_t len)
 
 NnopbaseUChar* CacheKeyBuilder::AppendShapeInfo(NnopbaseExecutorArgs* args, const aclTensor* tensor)
 {
+    if (!op::internal::IsCacheFullKeyEnable()) {
+        // the signature covers every field below, one word per tensor whatever its rank
+        EnsureCapacity(args, SIGNATURE_BYTES);
+        NnopbaseUChar* key = op::internal::PtrCastTo<NnopbaseUChar>(args->inputKey.data()) + args->keyLen;
+        key = NnopbaseAppend8Byte(key, tensor->GetSignature());
+        args->remainKeyLen -= SIGNATURE_BYTES;
+        args->keyLen += SIGNATURE_BYTES;
+        return key;
+    }
+    (void)op::internal::CheckTensorSignature(tensor);
     const op::Shape& shape = tensor->GetViewShape();
     const size_t dimNum = shape.GetDimNum();
     const auto& strides = tensor->GetViewStrides();
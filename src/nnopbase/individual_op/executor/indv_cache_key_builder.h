@@ -42,6 +42,7 @@ private:
     static constexpr size_t SHAPE_BYTES = 8U;
     static constexpr size_t OFFSET_BYTES = 8U;
     static constexpr size_t STRIDE_NUM_BYTES = 1U;
+    static constexpr size_t SIGNATURE_BYTES = 8U;
 };
 
 } // namespace Indv
@@ -14,7 +14,6 @@
 #include <algorithm>
 #include <fstream>
 #include <mutex>
-#include <dirent.h>
 #include "securec.h"
 #include "mmpa/mmpa_api.h"
 #include "mmpa/sub_inc/mmpa_linux.h"
@@ -27,6 +26,7 @@
 #include "indv_executor.h"
 #include "opdev/data_type_utils.h"
 #include "op_dfx_util.h"
+#include "opp_manifest.h"
 #include "register/op_binary_resource_manager.h"
 
 using namespace std;
@@ -113,34 +113,14 @@ std::string GetBuiltInBasePath(gert::OppImplVersionTag& oppImplVersion)
 
 void GetFilesWithSuffix(const std::string& path, const std::string& suffix, std::vector<std::string>& files)
 {
-    struct dirent** entries = nullptr;
-    const auto fileNum = scandir(path.c_str(), &entries, nullptr, nullptr);
-    if (entries == nullptr) {
+    std::vector<std::string> names;
+    if (op::internal::ListFilesBySuffix(path, suffix, names) != ACLNN_SUCCESS) {
         return;
     }
-    if (fileNum <= 0) {
-        free(entries);
-        return;
-    }
-    for (int i = 0; i < fileNum; ++i) {
-        const dirent* const dirEnt = entries[i];
-        const string name = string(dirEnt->d_name);
-        if ((strcmp(name.c_str(), ".") == 0) || (strcmp(name.c_str(), "..") == 0)) {
-            continue;
-        }
-        if (dirEnt->d_type == DT_DIR) {
-            continue;
-        }
-        if (name.size() < suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
-            continue;
-        }
+    for (const auto& name : names) {
         const string fullName = path + "/" + name;
         files.push_back(fullName);
     }
-    for (int i = 0; i < fileNum; i++) {
-        free(entries[i]);
-    }
-    free(entries);
 }
 
 std::string GetOpSoPackageName(const std::string& path)
@@ -535,6 +515,7 @@ aclnnStatus NnopbaseLoadTilingSo(std::vector<std::pair<std::string, gert::OppImp
             }
         }
     }
+    (void)op::internal::OppManifest::Instance().Save();
     if (openSoSuccess) {
         return OK;
     }
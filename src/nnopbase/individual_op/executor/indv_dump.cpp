@@ -23,6 +23,7 @@
 #include "acl/acl_rt.h"
 #include "runtime/runtime/rts/rts_kernel.h"
 #include "dump/adump_api.h"
+#include "async_dump.h"
 
 using namespace op::internal;
 namespace {
@@ -146,6 +147,9 @@ inline void NnopbaseDumpTensors(NnopbaseExecutor* executor, Adx::TensorType ioTy
 
     std::string l2Name = std::string("L2DfxAbscent_") + std::to_string(op::internal::OpGetLogSequence());
     std::string l0Name = std::string("_L0") + std::string(opType);
+    if (op::internal::AsyncDumper::Instance().Submit(l2Name, l0Name, dumpTensors, stream)) {
+        return;
+    }
     const auto res = Adx::AdumpDumpTensorV2(l2Name, l0Name, dumpTensors, stream);
     OP_LOGI("AdumpDumpTensorV2 res = %d.", res);
 }
@@ -497,6 +497,60 @@ uint64_t GetBlockSplitFactor(BroadcastTilingData& broadcastTilingData, ubSplitIn
     return fusedProduct;
 }
 
+/**
+ *  查询调优结果表获取ub切分，命中且校验通过时返回true
+ * @param broadcastTilingParams tiling参数
+ * @param computeParams compute参数
+ * @param broadcastTilingData 临时tilingData缓存
+ * @param ubInfo ub切分结果
+ * @param maxElemNum ub内最大元素个数
+ * @param fusedProduct ub外轴乘积
+ *
+ * @return
+ */
+static bool GetTunedBlockSplitFactor(const BroadcastTilingParams& broadcastTilingParams,
+                                     const BroadcastComputeParams& computeParams,
+                                     BroadcastTilingData& broadcastTilingData, ubSplitInfo& ubInfo,
+                                     uint64_t maxElemNum, uint64_t& fusedProduct)
+{
+    TilingTuneTable& table = TilingTuneTable::Instance();
+    if (broadcastTilingParams.autoTuner == nullptr && table.Empty()) {
+        return false;
+    }
+    const std::vector<int64_t>& outDims = broadcastTilingData.dims.back();
+    TilingTuneProblem problem;
+    problem.kind = TilingTuneKind::BROADCAST;
+    problem.dims.assign(outDims.begin(), outDims.end());
+    problem.axisIsA.assign(outDims.size(), true);
+    problem.dtypeBytes = std::max<int64_t>(computeParams.maxDtypeBits / BROADCAST_BITS_NUM, 1);
+    // 尾轴切分按UBBlock对齐
+    problem.alignElems = std::max<uint64_t>(GetUbBlockSize<gert::TilingContext>(nullptr) / problem.dtypeBytes, 1);
+    problem.tileCapacity = maxElemNum;
+    problem.coreNum = static_cast<uint64_t>(broadcastTilingParams.coreNum);
+    problem.cacheLineSize = CACHE_LINE;
+    if (broadcastTilingParams.autoTuner != nullptr) {
+        TilingTuneResult result = broadcastTilingParams.autoTuner->TuneAndRecord(problem, table);
+        OP_LOGI("Broadcast", "autotune key:%s, candidates:%zu, found:%d, cost:%lf, measured:%lf",
+                TilingTuneTable::MakeKey(problem).c_str(), result.evaluated, result.found ? 1 : 0, result.cost,
+                result.measured);
+    }
+
+    TilingCandidate candidate;
+    TilingTuneFeature feature;
+    if (!table.Find(problem, candidate) || !EvaluateTilingCandidate(problem, candidate, feature)) {
+        return false;
+    }
+    int64_t splitDim = outDims[candidate.axisA];
+    ubInfo.ubSplitAxis = candidate.axisA;
+    ubInfo.ubFormer = static_cast<int64_t>(candidate.factorA);
+    ubInfo.ubOuter = (splitDim + ubInfo.ubFormer - 1) / ubInfo.ubFormer;
+    ubInfo.ubTail = splitDim - (ubInfo.ubOuter - 1) * ubInfo.ubFormer;
+    fusedProduct = feature.outerA;
+    OP_LOGI("Broadcast", "use tuned tiling ubSplitAxis: %ld ubFormer: %ld usedCore: %lu", ubInfo.ubSplitAxis,
+            ubInfo.ubFormer, feature.usedCoreNum);
+    return true;
+}
+
 ge::graphStatus DoBrodcastTiling(const BroadcastTilingParams& broadcastTilingParams,
                                  BroadcastTilingData& broadcastTilingData)
 {
@@ -523,12 +577,18 @@ ge::graphStatus DoBrodcastTiling(const BroadcastTilingParams& broadcastTilingPar
     OP_CHECK_IF((maxElemNum == 0), OP_LOGE("BroadcastTiling", "maxElemNum can not be 0"), return ge::GRAPH_FAILED);
 
     ubSplitInfo ubInfo;
-    uint64_t fusedProduct = GetBlockSplitFactor(broadcastTilingData, ubInfo, maxElemNum);
+    uint64_t fusedProduct = 0;
+    bool tuned = GetTunedBlockSplitFactor(broadcastTilingParams, computeParams, broadcastTilingData, ubInfo,
+                                          maxElemNum, fusedProduct);
+    if (!tuned) {
+        fusedProduct = GetBlockSplitFactor(broadcastTilingData, ubInfo, maxElemNum);
+    }
     uint64_t blockFormer = (fusedProduct + broadcastTilingParams.coreNum - 1) / broadcastTilingParams.coreNum;
     uint64_t blockNum = (fusedProduct + blockFormer - 1) / blockFormer;
 
-    // 当preferMultiCore为true且当前使用的核数少于总核数，尝试降低UB分块以充分利用更多核心
-    if (broadcastTilingParams.preferMultiCore && blockNum < static_cast<uint64_t>(broadcastTilingParams.coreNum)) {
+    // 当preferMultiCore为true且当前使用的核数少于总核数，尝试降低UB分块以充分利用更多核心，调优结果已考虑分核不再调整
+    if (!tuned && broadcastTilingParams.preferMultiCore &&
+        blockNum < static_cast<uint64_t>(broadcastTilingParams.coreNum)) {
         // dstFusedProduct为尽量切多核时的理想多核切分因子
         uint64_t dstFusedProduct = blockFormer * broadcastTilingParams.coreNum;
         uint64_t tmpFusedProduct = fusedProduct;
@@ -906,6 +906,72 @@ void ReduceOpTiling::ComputeProgressUnitA(const uint64_t* shape)
     AssembleUnit(unitA_, iA, innerA, outerA, step);
 }
 
+template <class Pattern>
+void ReduceOpTiling::MakeTuneProblem(const uint64_t* shape, TilingTuneProblem& problem)
+{
+    uint64_t dSize = ge::GetSizeByDataType(opInput_.inputDtype);
+    // 尾轴为A时按最小字节数的UBBlock对齐，与ComputeUnitA一致
+    uint64_t alignBytes = Pattern::TailA ? opDag_.minInputBytes : dSize;
+    problem.kind = TilingTuneKind::REDUCE;
+    problem.dims.assign(shape, shape + Pattern::Dim);
+    problem.axisIsA.resize(Pattern::Dim);
+    for (int32_t i = 0; i < Pattern::Dim; i++) {
+        problem.axisIsA[i] = IsAxisA<Pattern>(i);
+    }
+    problem.dtypeBytes = dSize;
+    problem.tileCapacity = basicBlock_ * Ratio() / opDag_.maxInputBytes;
+    problem.alignElems = compileInfo_->ubBlockSize / alignBytes;
+    // R轴切分时UB间reduce缓存限制A轴大小，R轴全载时上限为reduce后的输出buffer
+    problem.maxInnerA = Pattern::ID == PATTERN_A ? 0 : MAX_INNER_A / opDag_.maxInputBytes;
+    problem.maxInnerAWithRFull = Pattern::ID == PATTERN_A ? 0 : resultBlock_ / opDag_.maxInputBytes;
+    problem.coreNum = compileInfo_->vectorCoreNum;
+    problem.cacheLineSize = compileInfo_->cacheLineSize;
+}
+
+/*
+ * 查询调优结果表，命中且校验通过时直接设置unitA_、unitR_
+ * 非连续场景存在slice切分时不参与调优，返回false走启发式切分
+ */
+template <class Pattern>
+bool ReduceOpTiling::ApplyTunedTiling(const uint64_t* shape)
+{
+    TilingTuneTable& table = TilingTuneTable::Instance();
+    if (autoTuner_ == nullptr && table.Empty()) {
+        return false;
+    }
+    for (int32_t i = 0; i < Pattern::Dim; i++) {
+        if (sliceNum_[i] != 1UL || sliceShape_[i] != shape[i]) {
+            return false;
+        }
+    }
+    TilingTuneProblem problem;
+    MakeTuneProblem<Pattern>(shape, problem);
+    if (autoTuner_ != nullptr) {
+        TilingTuneResult result = autoTuner_->TuneAndRecord(problem, table);
+        OP_LOGI(context_, "autotune key:%s, candidates:%zu, found:%d, cost:%lf, measured:%lf",
+                TilingTuneTable::MakeKey(problem).c_str(), result.evaluated, result.found ? 1 : 0, result.cost,
+                result.measured);
+    }
+
+    TilingCandidate candidate;
+    TilingTuneFeature feature;
+    if (!table.Find(problem, candidate)) {
+        return false;
+    }
+    if (!EvaluateTilingCandidate(problem, candidate, feature)) {
+        OP_LOGD(context_, "tuned tiling axisA:%d, factorA:%lu, axisR:%d, factorR:%lu is invalid for current shape",
+                candidate.axisA, candidate.factorA, candidate.axisR, candidate.factorR);
+        return false;
+    }
+    AssembleUnit(unitA_, candidate.axisA, feature.innerA, feature.outerA, candidate.factorA);
+    AssembleUnit(unitR_, candidate.axisR, feature.innerR, feature.outerR,
+                 candidate.axisR < 0 ? 1UL : candidate.factorR);
+    OP_LOGI(context_, "use tuned tiling axisA:%d, factorA:%lu, axisR:%d, factorR:%lu, usedCore:%lu, ubUtil:%lf",
+            candidate.axisA, candidate.factorA, candidate.axisR, candidate.factorR, feature.usedCoreNum,
+            feature.ubUtilization);
+    return true;
+}
+
 template <class Pattern>
 uint64_t ReduceOpTiling::TryGetReduceBlock(const uint64_t* shape, uint64_t preInputBufferNum, uint64_t preRestBufferNum,
                                            uint64_t postBufferNum)
@@ -1025,6 +1091,7 @@ ge::graphStatus ReduceOpTiling::ComputeTiling(uint64_t* shape)
     // 3. 计算UB内A轴的切分大小，最大512B或者按A轴分核低于85%
     // 4. 根据BasicBlock大小和UB内A轴的切分大小，计算UB内R轴的切分大小
     // 5. 可选，针对R轴过小，UB内R轴全载，BasicBlock不能满载是，调整UB内A轴切分，上限为UB内二分缓存大小
+    // 连续场景下调优结果表命中时，用表中的切分替代3~5步
     dimNum_ = Pattern::Dim;
     OP_CHECK_IF((CalcBasicBlock<Pattern>(shape) == ge::GRAPH_FAILED),
                 OP_LOGE(context_, "calc basic block failed, maybe unsupport ubsize"), return ge::GRAPH_FAILED);
@@ -1041,9 +1108,11 @@ ge::graphStatus ReduceOpTiling::ComputeTiling(uint64_t* shape)
         SetTilingDataBatchInvariant<Pattern>(shape);
     } else {
         ComputeCacheLineBlockAndUnit<Pattern>(shape);
-        ComputeUnitA<Pattern>(shape);
-        ComputeUnitR<Pattern>(shape);
-        ComputeProgressUnitA<Pattern>(shape);
+        if (!ApplyTunedTiling<Pattern>(shape)) {
+            ComputeUnitA<Pattern>(shape);
+            ComputeUnitR<Pattern>(shape);
+            ComputeProgressUnitA<Pattern>(shape);
+        }
         SetTilingData<Pattern>(shape);
     }
 
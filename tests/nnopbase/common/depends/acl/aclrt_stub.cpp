@@ -164,6 +164,30 @@ aclError aclrtMallocWithCfg(void** devPtr, size_t size, aclrtMemMallocPolicy pol
 EXTERN_C
 aclError aclrtRecordEvent(aclrtEvent event, aclrtStream stream) { return ACL_SUCCESS; }
 
+EXTERN_C
+aclError aclrtSynchronizeEvent(aclrtEvent event) { return AclrtStub::GetInstance()->aclrtSynchronizeEvent(event); }
+
+EXTERN_C
+aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus* status)
+{
+    return AclrtStub::GetInstance()->aclrtQueryEventStatus(event, status);
+}
+
+EXTERN_C
+aclError aclrtMallocHost(void** hostPtr, size_t size)
+{
+    *hostPtr = new uint8_t[size];
+    memset_s(*hostPtr, size, 0, size);
+    return ACL_SUCCESS;
+}
+
+EXTERN_C
+aclError aclrtFreeHost(void* hostPtr)
+{
+    delete[] static_cast<uint8_t*>(hostPtr);
+    return ACL_SUCCESS;
+}
+
 EXTERN_C
 aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event) { return ACL_SUCCESS; }
 
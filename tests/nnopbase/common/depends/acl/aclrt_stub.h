@@ -96,6 +96,14 @@ public:
         return ACL_SUCCESS;
     }
 
+    virtual aclError aclrtSynchronizeEvent(aclrtEvent event) { return ACL_SUCCESS; }
+
+    virtual aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus* status)
+    {
+        *status = ACL_EVENT_RECORDED_STATUS_COMPLETE;
+        return ACL_SUCCESS;
+    }
+
 private:
     thread_local static std::shared_ptr<AclrtStub> aclrtInstance_;
     thread_local static AclrtStub* fakeAclrtInstance_;
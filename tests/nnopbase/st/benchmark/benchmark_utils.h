@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef NNOPBASE_ST_BENCHMARK_UTILS_H_
+#define NNOPBASE_ST_BENCHMARK_UTILS_H_
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "depends/acl/aclrt_stub.h"
+
+namespace op {
+namespace benchmark {
+
+// ============================================================================
+// nnopbase 基准测试公共工具
+// 每个用例输出一行 JSON 到标准输出, 设置 NNOPBASE_BENCHMARK_OUTPUT 时追加写入该文件
+// ============================================================================
+
+constexpr size_t kPercentile50 = 50U;
+constexpr size_t kPercentile99 = 99U;
+constexpr size_t kPercentileBase = 100U;
+
+struct LatencyStats {
+    double avgNs{0.0};
+    double p50Ns{0.0};
+    double p99Ns{0.0};
+};
+
+// 读取正整数环境变量, 未设置或非法时返回默认值
+inline size_t GetEnvSize(const char* name, const size_t defaultValue)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    const long long num = std::atoll(value);
+    return num > 0 ? static_cast<size_t>(num) : defaultValue;
+}
+
+// 对耗时排序后统计均值与分位数, costs 为空时结果全为 0
+inline LatencyStats Summarize(std::vector<double>& costs)
+{
+    LatencyStats stats;
+    if (costs.empty()) {
+        return stats;
+    }
+    std::sort(costs.begin(), costs.end());
+    double sum = 0.0;
+    for (const auto c : costs) {
+        sum += c;
+    }
+    stats.avgNs = sum / static_cast<double>(costs.size());
+    stats.p50Ns = costs[costs.size() * kPercentile50 / kPercentileBase];
+    stats.p99Ns = costs[costs.size() * kPercentile99 / kPercentileBase];
+    return stats;
+}
+
+// 输出一行 JSON 结果, tag 用于打开输出文件失败时的日志前缀
+inline void ReportLine(const char* tag, const char* line)
+{
+    printf("%s\n", line);
+    const char* output = std::getenv("NNOPBASE_BENCHMARK_OUTPUT");
+    if (output == nullptr) {
+        return;
+    }
+    FILE* fp = fopen(output, "a");
+    if (fp == nullptr) {
+        printf("[%s] open %s failed\n", tag, output);
+        return;
+    }
+    (void)fprintf(fp, "%s\n", line);
+    (void)fclose(fp);
+}
+
+// 桩 runtime: 所有下发接口直接返回成功, 且不做参数校验, 避免把校验开销计入框架
+class BenchmarkAclrtStub : public AclrtStub {
+public:
+    aclError aclrtBinaryGetFunction(const aclrtBinHandle binHandle, const char* kernelName,
+                                    aclrtFuncHandle* funcHandle) override
+    {
+        *funcHandle = (void*)0x43214321;
+        return ACL_SUCCESS;
+    }
+
+    aclError aclrtBinaryLoadFromFile(const char* binPath, aclrtBinaryLoadOptions* options,
+                                     aclrtBinHandle* binHandle) override
+    {
+        *binHandle = (void*)0x12121212;
+        return ACL_SUCCESS;
+    }
+};
+
+} // namespace benchmark
+} // namespace op
+
+#endif // NNOPBASE_ST_BENCHMARK_UTILS_H_
@@ -0,0 +1,365 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "aclnn/acl_meta.h"
+#include "aclnn/aclnn_base.h"
+#include "individual_op_api.h"
+#include "opdev/aicpu/aicpu_task.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_dfx.h"
+#include "opdev/op_executor.h"
+#include "op_cache_internal.h"
+#include "thread_local_context.h"
+#include "depends/acl/aclrt_stub.h"
+#include "depends/op/aclnn_mul_stub.h"
+#include "utils/file_faker.h"
+#include "benchmark_utils.h"
+
+using namespace op;
+
+OP_TYPE_REGISTER(Gelu);
+
+namespace {
+aclnnStatus AicpuGeluStub(const aclTensor* self, aclTensor* out, aclOpExecutor* executor)
+{
+    L0_DFX(AicpuGeluStub, self, out);
+    static op::internal::AicpuTaskSpace space("Gelu", ge::DEPEND_IN_SHAPE, false);
+    return ADD_TO_LAUNCHER_LIST_AICPU(Gelu, OP_ATTR_NAMES(), OP_INPUT(self), OP_OUTPUT(out));
+}
+
+aclnnStatus aclnnAicpuGeluStubGetWorkspaceSize(const aclTensor* self, aclTensor* out, uint64_t* workspaceSize,
+                                               aclOpExecutor** executor)
+{
+    L2_DFX_PHASE_1(aclnnAicpuGeluStub, DFX_IN(self), DFX_OUT(out));
+    auto uniqueExecutor = CREATE_EXECUTOR();
+    CHECK_RET(uniqueExecutor.get() != nullptr, ACLNN_ERR_INNER_CREATE_EXECUTOR);
+    CHECK_RET(AicpuGeluStub(self, out, uniqueExecutor.get()) == ACLNN_SUCCESS, ACLNN_ERR_INNER);
+    *workspaceSize = uniqueExecutor->GetWorkspaceSize();
+    uniqueExecutor.ReleaseTo(executor);
+    return ACLNN_SUCCESS;
+}
+
+aclnnStatus aclnnAicpuGeluStub(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                               const aclrtStream stream)
+{
+    L2_DFX_PHASE_2(aclnnAicpuGeluStub);
+    return CommonOpExecutorRun(workspace, workspaceSize, executor, stream);
+}
+
+// 与生成的单算子 aclnn 接口一致: 先 NnopbaseMatchArgs 命中参数缓存, 未命中再走 RunForWorkspace
+aclnnStatus IndvBninferenceGetWorkspaceSize(const aclTensor* x1, const aclTensor* x2, const aclTensor* x3,
+                                            const aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    static void* executorSpace = []() {
+        void* space = nullptr;
+        (void)NnopbaseCreateExecutorSpace(&space);
+        return space;
+    }();
+    const char* opType = "bninference_d_kernel";
+    char inputDesc[] = {1, 1, 1};
+    char outputDesc[] = {1};
+    char attrDesc[] = {};
+    void* nnopExecutor = NnopbaseGetExecutor(executorSpace, opType, inputDesc, sizeof(inputDesc) / sizeof(char),
+                                             outputDesc, sizeof(outputDesc) / sizeof(char), attrDesc,
+                                             sizeof(attrDesc) / sizeof(char));
+    if (nnopExecutor == nullptr) {
+        return ACLNN_ERR_INNER_NULLPTR;
+    }
+    *executor = reinterpret_cast<aclOpExecutor*>(nnopExecutor);
+    NnopbaseSetMatchArgsFlag(nnopExecutor);
+    (void)NnopbaseAddInput(nnopExecutor, x1, 0);
+    (void)NnopbaseAddInput(nnopExecutor, x2, 1);
+    (void)NnopbaseAddInput(nnopExecutor, x3, 2);
+    (void)NnopbaseAddOutput(nnopExecutor, out, 0);
+    if (NnopbaseMatchArgs(nnopExecutor, workspaceSize)) {
+        return ACLNN_SUCCESS;
+    }
+    return NnopbaseRunForWorkspace(nnopExecutor, workspaceSize);
+}
+} // namespace
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// aclnn 调用的 host 侧开销基准测试
+// runtime/ACL 全部打桩, 测得的是框架本身的开销: 单算子 MatchArgs→下发、
+// 组合算子 GetWorkspaceSize+Run (cache 命中/未命中)、AICPU 任务下发
+//
+// NNOPBASE_BENCHMARK_ITERATIONS: 每个线程的调用次数, 默认 2000
+// NNOPBASE_BENCHMARK_THREADS: 吞吐用例的线程数, 默认 4
+// ============================================================================
+
+constexpr size_t kDefaultIterations = 2000U;
+constexpr size_t kDefaultThreads = 4U;
+constexpr size_t kWarmupIterations = 16U;
+
+struct HostOverheadResult {
+    std::string caseName;
+    size_t threads{0U};
+    size_t iterations{0U};
+    size_t failed{0U};
+    double avgNs{0.0};
+    double p50Ns{0.0};
+    double p99Ns{0.0};
+    double callsPerSec{0.0};
+};
+
+static void ReportResult(const HostOverheadResult& result)
+{
+    char line[512] = {};
+    (void)snprintf(line, sizeof(line),
+                   "{\"suite\":\"nnopbase_host_overhead\",\"case\":\"%s\",\"threads\":%zu,\"iterations\":%zu,"
+                   "\"failed\":%zu,\"avg_ns\":%.1f,\"p50_ns\":%.1f,\"p99_ns\":%.1f,\"calls_per_sec\":%.1f}",
+                   result.caseName.c_str(), result.threads, result.iterations, result.failed, result.avgNs,
+                   result.p50Ns, result.p99Ns, result.callsPerSec);
+    ReportLine("HostOverheadBenchmark", line);
+}
+
+// 每个线程独立的一组输入/输出 tensor
+struct BenchmarkTensors {
+    explicit BenchmarkTensors(aclDataType dataType)
+    {
+        std::vector<int64_t> shape = {1, 1, 1, 1, 1};
+        for (size_t i = 0U; i < kTensorNum; ++i) {
+            tensors[i] = aclCreateTensor(shape.data(), shape.size(), dataType, nullptr, 0, aclFormat::ACL_FORMAT_ND,
+                                         shape.data(), shape.size(), &data[i]);
+        }
+    }
+
+    ~BenchmarkTensors()
+    {
+        for (size_t i = 0U; i < kTensorNum; ++i) {
+            aclDestroyTensor(tensors[i]);
+        }
+    }
+
+    static constexpr size_t kTensorNum = 4U;
+    int64_t data[kTensorNum] = {1, 2, 3, 4};
+    aclTensor* tensors[kTensorNum] = {};
+};
+
+class HostOverheadCase {
+public:
+    virtual ~HostOverheadCase() = default;
+    virtual const char* Name() const = 0;
+    virtual aclDataType DataType() const { return aclDataType::ACL_FLOAT16; }
+    // 在每个执行用例的线程上调用, 用于设置线程局部状态
+    virtual void ThreadSetUp() {}
+    virtual void ThreadTearDown() {}
+    virtual aclnnStatus RunOnce(BenchmarkTensors& t) = 0;
+};
+
+class IndividualOpCase : public HostOverheadCase {
+public:
+    const char* Name() const override { return "individual_op_match_args"; }
+    aclDataType DataType() const override { return aclDataType::ACL_FLOAT; }
+
+    aclnnStatus RunOnce(BenchmarkTensors& t) override
+    {
+        uint64_t workspaceSize = 0U;
+        aclOpExecutor* executor = nullptr;
+        auto ret = IndvBninferenceGetWorkspaceSize(t.tensors[0], t.tensors[1], t.tensors[2], t.tensors[3],
+                                                   &workspaceSize, &executor);
+        if (ret != ACLNN_SUCCESS) {
+            return ret;
+        }
+        thread_local static uint8_t workspace[kWorkspaceSize] = {};
+        return NnopbaseRunWithWorkspace(executor, nullptr, workspace, workspaceSize);
+    }
+
+private:
+    static constexpr size_t kWorkspaceSize = 4096U;
+};
+
+class CompositeOpCase : public HostOverheadCase {
+public:
+    explicit CompositeOpCase(bool cacheHit) : cacheHit_(cacheHit) {}
+
+    const char* Name() const override { return cacheHit_ ? "composite_op_cache_hit" : "composite_op_cache_miss"; }
+
+    void ThreadSetUp() override
+    {
+        cacheHasFull_ = GetThreadLocalContext().cacheHasFull_;
+        // cacheHasFull_ 为 true 时执行器不会创建 OpExecCache, 每次都完整走一遍 L2/L0 流程
+        GetThreadLocalContext().cacheHasFull_ = !cacheHit_;
+    }
+
+    void ThreadTearDown() override { GetThreadLocalContext().cacheHasFull_ = cacheHasFull_; }
+
+    aclnnStatus RunOnce(BenchmarkTensors& t) override
+    {
+        uint64_t workspaceSize = 0U;
+        aclOpExecutor* executor = nullptr;
+        auto ret = aclnnMulStubGetWorkspaceSize(t.tensors[0], t.tensors[1], t.tensors[2], &workspaceSize, &executor);
+        if (ret != ACLNN_SUCCESS) {
+            return ret;
+        }
+        return aclnnMulStub(nullptr, workspaceSize, executor, nullptr);
+    }
+
+private:
+    bool cacheHit_;
+    thread_local static bool cacheHasFull_;
+};
+
+thread_local bool CompositeOpCase::cacheHasFull_ = false;
+
+class AicpuOpCase : public HostOverheadCase {
+public:
+    const char* Name() const override { return "aicpu_task_launch"; }
+
+    aclnnStatus RunOnce(BenchmarkTensors& t) override
+    {
+        uint64_t workspaceSize = 0U;
+        aclOpExecutor* executor = nullptr;
+        auto ret = aclnnAicpuGeluStubGetWorkspaceSize(t.tensors[0], t.tensors[1], &workspaceSize, &executor);
+        if (ret != ACLNN_SUCCESS) {
+            return ret;
+        }
+        return aclnnAicpuGeluStub(nullptr, workspaceSize, executor, nullptr);
+    }
+};
+
+class HostOverheadBenchmark : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        setenv("ASCEND_C", "1", 1);
+        NnopbaseSetStubFiles(OP_API_COMMON_UT_SRC_DIR);
+    }
+
+    static void TearDownTestCase()
+    {
+        unsetenv("ASCEND_C");
+        NnopbaseUnsetEnvAndClearFolder();
+        setenv("ASCEND_OPP_PATH", OP_API_COMMON_UT_SRC_DIR, 1);
+    }
+
+    static void RunOnThread(HostOverheadCase& benchCase, const size_t iterations, std::vector<double>& costs,
+                            size_t& failed)
+    {
+        BenchmarkAclrtStub aclrtStub;
+        AclrtStub::GetInstance()->Install(&aclrtStub);
+        benchCase.ThreadSetUp();
+        BenchmarkTensors tensors(benchCase.DataType());
+        for (size_t i = 0U; i < kWarmupIterations; ++i) {
+            (void)benchCase.RunOnce(tensors);
+        }
+        costs.reserve(iterations);
+        for (size_t i = 0U; i < iterations; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto ret = benchCase.RunOnce(tensors);
+            const auto end = std::chrono::steady_clock::now();
+            costs.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            if (ret != ACLNN_SUCCESS) {
+                ++failed;
+            }
+        }
+        benchCase.ThreadTearDown();
+        AclrtStub::GetInstance()->UnInstall();
+    }
+
+    static HostOverheadResult Run(HostOverheadCase& benchCase, const size_t threadNum)
+    {
+        const size_t iterations = GetEnvSize("NNOPBASE_BENCHMARK_ITERATIONS", kDefaultIterations);
+        std::vector<std::vector<double>> costs(threadNum);
+        std::vector<size_t> failed(threadNum, 0U);
+
+        const auto start = std::chrono::steady_clock::now();
+        if (threadNum == 1U) {
+            RunOnThread(benchCase, iterations, costs[0], failed[0]);
+        } else {
+            std::vector<std::thread> workers;
+            for (size_t i = 0U; i < threadNum; ++i) {
+                workers.emplace_back(RunOnThread, std::ref(benchCase), iterations, std::ref(costs[i]),
+                                     std::ref(failed[i]));
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+        const double wallNs =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> all;
+        for (const auto& c : costs) {
+            all.insert(all.end(), c.begin(), c.end());
+        }
+
+        HostOverheadResult result;
+        result.caseName = benchCase.Name();
+        result.threads = threadNum;
+        result.iterations = iterations;
+        for (const auto f : failed) {
+            result.failed += f;
+        }
+        const LatencyStats stats = Summarize(all);
+        result.avgNs = stats.avgNs;
+        result.p50Ns = stats.p50Ns;
+        result.p99Ns = stats.p99Ns;
+        if (!all.empty()) {
+            // 吞吐包含预热调用和线程创建, 以墙钟时间计
+            result.callsPerSec = static_cast<double>(all.size()) * 1e9 / wallNs;
+        }
+        ReportResult(result);
+        return result;
+    }
+
+    static void RunLatencyAndThroughput(HostOverheadCase& benchCase)
+    {
+        auto latency = Run(benchCase, 1U);
+        EXPECT_EQ(latency.failed, 0U);
+        EXPECT_GT(latency.avgNs, 0.0);
+
+        auto throughput = Run(benchCase, GetEnvSize("NNOPBASE_BENCHMARK_THREADS", kDefaultThreads));
+        EXPECT_EQ(throughput.failed, 0U);
+        EXPECT_GT(throughput.callsPerSec, 0.0);
+    }
+};
+
+TEST_F(HostOverheadBenchmark, IndividualOpMatchArgs)
+{
+    IndividualOpCase benchCase;
+    RunLatencyAndThroughput(benchCase);
+}
+
+TEST_F(HostOverheadBenchmark, CompositeOpCacheMiss)
+{
+    CompositeOpCase benchCase(false);
+    RunLatencyAndThroughput(benchCase);
+}
+
+TEST_F(HostOverheadBenchmark, CompositeOpCacheHit)
+{
+    // 其他用例可能已经占满 cache, 先清空以保证预热后能命中
+    ReinitOpCacheManager();
+    CompositeOpCase benchCase(true);
+    RunLatencyAndThroughput(benchCase);
+}
+
+TEST_F(HostOverheadBenchmark, AicpuTaskLaunch)
+{
+    AicpuOpCase benchCase;
+    RunLatencyAndThroughput(benchCase);
+}
+
+} // namespace benchmark
+} // namespace op
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "aclnn/acl_meta.h"
+#include "aclnn/aclnn_base.h"
+#include "opdev/make_op_executor.h"
+#include "opdev/op_dfx.h"
+#include "op_run_context.h"
+#include "benchmark_utils.h"
+
+OP_TYPE_REGISTER(TilingCtxBench);
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// tiling context 构造开销基准测试
+// 只测 UpdateComputeNodeInfo + TilingCtxHolder 的构造, 不执行 tiling 函数
+// frame: 开启 frame 模板, 同签名的调用拷贝模板后只刷新 tensor 与 attr 取值
+// rebuild: 关闭 frame 模板, 每次重建 compute node info 与 attr 布局
+// alternating: 两种 attr 签名交替调用, 模板需要整帧拷贝
+//
+// NNOPBASE_BENCHMARK_ITERATIONS: 调用次数, 默认 20000
+// ============================================================================
+
+constexpr size_t kDefaultIterations = 20000U;
+constexpr size_t kWarmupIterations = 16U;
+constexpr size_t kTensorNum = 4U;
+
+struct TilingCtxResult {
+    std::string caseName;
+    size_t iterations{0U};
+    size_t failed{0U};
+    double avgNs{0.0};
+    double p50Ns{0.0};
+    double p99Ns{0.0};
+};
+
+static void ReportResult(const TilingCtxResult& result)
+{
+    char line[512] = {};
+    (void)snprintf(line, sizeof(line),
+                   "{\"suite\":\"nnopbase_tiling_ctx\",\"case\":\"%s\",\"iterations\":%zu,\"failed\":%zu,"
+                   "\"avg_ns\":%.1f,\"p50_ns\":%.1f,\"p99_ns\":%.1f}",
+                   result.caseName.c_str(), result.iterations, result.failed, result.avgNs, result.p50Ns,
+                   result.p99Ns);
+    ReportLine("TilingCtxBenchmark", line);
+}
+
+// 一组算子参数: 3 输入 1 输出, attr 覆盖定长与变长类型, listSize 决定 attr 签名
+class TilingCtxArgs {
+public:
+    explicit TilingCtxArgs(size_t listSize)
+    {
+        std::vector<int64_t> shape = {8, 16, 32, 64};
+        for (size_t i = 0U; i < kTensorNum; ++i) {
+            tensors_[i] = aclCreateTensor(shape.data(), shape.size(), aclDataType::ACL_FLOAT16, nullptr, 0,
+                                          aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(), &data_[i]);
+        }
+        std::vector<int64_t> list(listSize, 1);
+        intArray_ = aclCreateIntArray(list.data(), list.size());
+        ctx_ = op::MakeOpArgContext(OP_INPUT(tensors_[0], tensors_[1], tensors_[2]), OP_OUTPUT(tensors_[3]),
+                                    OP_ATTR(int64_t(1), 0.5F, true, format_, intArray_));
+    }
+
+    ~TilingCtxArgs()
+    {
+        op::DestroyOpArgContext(ctx_);
+        (void)aclDestroyIntArray(intArray_);
+        for (size_t i = 0U; i < kTensorNum; ++i) {
+            (void)aclDestroyTensor(tensors_[i]);
+        }
+    }
+
+    aclnnStatus BuildTilingCtx() const
+    {
+        auto* tilingCtx = OpRunContextMgr::opRunCtx_.UpdateTilingCtx(
+            TilingCtxBenchOpTypeId(), *ctx_->GetOpArg(op::OpArgDef::OP_INPUT_ARG),
+            *ctx_->GetOpArg(op::OpArgDef::OP_OUTPUT_ARG), *ctx_->GetOpArg(op::OpArgDef::OP_ATTR_ARG));
+        return tilingCtx == nullptr ? ACLNN_ERR_INNER : ACLNN_SUCCESS;
+    }
+
+private:
+    int64_t data_[kTensorNum] = {1, 2, 3, 4};
+    aclTensor* tensors_[kTensorNum] = {};
+    const char* format_ = "NCHW";
+    aclIntArray* intArray_{nullptr};
+    op::OpArgContext* ctx_{nullptr};
+};
+
+class TilingCtxBenchmark : public testing::Test {
+protected:
+    static void TearDownTestCase() { OpRunContextMgr::opRunCtx_.kernelCtx_.SetFrameTemplateEnable(true); }
+
+    static TilingCtxResult Run(const char* caseName, bool frameTemplate, bool alternating)
+    {
+        OpRunContextMgr::opRunCtx_.kernelCtx_.SetFrameTemplateEnable(frameTemplate);
+        const TilingCtxArgs argsA(2U);
+        const TilingCtxArgs argsB(3U);
+        for (size_t i = 0U; i < kWarmupIterations; ++i) {
+            (void)argsA.BuildTilingCtx();
+            (void)argsB.BuildTilingCtx();
+        }
+
+        TilingCtxResult result;
+        result.caseName = caseName;
+        result.iterations = GetEnvSize("NNOPBASE_BENCHMARK_ITERATIONS", kDefaultIterations);
+        std::vector<double> costs;
+        costs.reserve(result.iterations);
+        for (size_t i = 0U; i < result.iterations; ++i) {
+            const TilingCtxArgs& args = (alternating && (i % 2U == 1U)) ? argsB : argsA;
+            const auto start = std::chrono::steady_clock::now();
+            const auto ret = args.BuildTilingCtx();
+            const auto end = std::chrono::steady_clock::now();
+            costs.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            if (ret != ACLNN_SUCCESS) {
+                ++result.failed;
+            }
+        }
+        const LatencyStats stats = Summarize(costs);
+        result.avgNs = stats.avgNs;
+        result.p50Ns = stats.p50Ns;
+        result.p99Ns = stats.p99Ns;
+        ReportResult(result);
+        return result;
+    }
+};
+
+TEST_F(TilingCtxBenchmark, TilingCtxSetup)
+{
+    auto rebuild = Run("tiling_ctx_setup_rebuild", false, false);
+    auto frame = Run("tiling_ctx_setup_frame", true, false);
+    auto rebuildAlternating = Run("tiling_ctx_setup_rebuild_alternating", false, true);
+    auto frameAlternating = Run("tiling_ctx_setup_frame_alternating", true, true);
+    for (const auto& result : {rebuild, frame, rebuildAlternating, frameAlternating}) {
+        EXPECT_EQ(result.failed, 0U);
+        EXPECT_GT(result.avgNs, 0.0);
+    }
+}
+
+} // namespace benchmark
+} // namespace op
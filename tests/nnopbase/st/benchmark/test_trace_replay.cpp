@@ -0,0 +1,355 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "aclnn/acl_meta.h"
+#include "aclnn/aclnn_base.h"
+#include "aclnn_trace.h"
+#include "individual_op_api.h"
+#include "opdev/data_type_utils.h"
+#include "opdev/format_utils.h"
+#include "depends/acl/aclrt_stub.h"
+#include "depends/op/aclnn_mul_stub.h"
+#include "utils/file_faker.h"
+#include "benchmark_utils.h"
+
+namespace {
+// 与生成的单算子 aclnn 接口一致: 先 NnopbaseMatchArgs 命中参数缓存, 未命中再走 RunForWorkspace
+aclnnStatus ReplayBninferenceGetWorkspaceSize(const aclTensor* x1, const aclTensor* x2, const aclTensor* x3,
+                                              const aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor)
+{
+    static void* executorSpace = []() {
+        void* space = nullptr;
+        (void)NnopbaseCreateExecutorSpace(&space);
+        return space;
+    }();
+    const char* opType = "bninference_d_kernel";
+    char inputDesc[] = {1, 1, 1};
+    char outputDesc[] = {1};
+    char attrDesc[] = {};
+    void* nnopExecutor = NnopbaseGetExecutor(executorSpace, opType, inputDesc, sizeof(inputDesc) / sizeof(char),
+                                             outputDesc, sizeof(outputDesc) / sizeof(char), attrDesc,
+                                             sizeof(attrDesc) / sizeof(char));
+    if (nnopExecutor == nullptr) {
+        return ACLNN_ERR_INNER_NULLPTR;
+    }
+    *executor = reinterpret_cast<aclOpExecutor*>(nnopExecutor);
+    NnopbaseSetMatchArgsFlag(nnopExecutor);
+    (void)NnopbaseAddInput(nnopExecutor, x1, 0);
+    (void)NnopbaseAddInput(nnopExecutor, x2, 1);
+    (void)NnopbaseAddInput(nnopExecutor, x3, 2);
+    (void)NnopbaseAddOutput(nnopExecutor, out, 0);
+    if (NnopbaseMatchArgs(nnopExecutor, workspaceSize)) {
+        return ACLNN_SUCCESS;
+    }
+    return NnopbaseRunForWorkspace(nnopExecutor, workspaceSize);
+}
+} // namespace
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// aclnn 调用轨迹回放
+// 生产进程设置 ACLNN_TRACE_FILE 录制调用轨迹, 这里按录制时的线程划分, 在桩 runtime 上
+// 重新下发, 对比每个阶段 (GetWorkspaceSize/Run/MatchArgs/下发) 录制与回放的 host 耗时,
+// 用于在没有硬件的环境复现 cache 颠簸、锁竞争等问题
+//
+// NNOPBASE_TRACE_REPLAY_FILE: 待回放的轨迹文件, 未设置时先用桩算子录制一份
+// 只回放注册了处理函数的算子, 其余记录计入 skipped
+// ============================================================================
+
+constexpr size_t kRecordThreads = 4U;
+constexpr size_t kRecordIterations = 500U;
+constexpr size_t kWorkspaceSize = 4096U;
+
+struct PhaseCost {
+    std::vector<double> recorded;
+    std::vector<double> replayed;
+    size_t failed{0U};
+};
+
+using PhaseKey = std::pair<TraceEvent, std::string>;
+using PhaseCosts = std::map<PhaseKey, PhaseCost>;
+
+static const char* PhaseName(TraceEvent event)
+{
+    switch (event) {
+        case TraceEvent::L2_GET_WORKSPACE:
+            return "l2_get_workspace";
+        case TraceEvent::L2_RUN:
+            return "l2_run";
+        case TraceEvent::INDV_MATCH_ARGS:
+            return "indv_match_args";
+        case TraceEvent::INDV_LAUNCH:
+            return "indv_launch";
+        default:
+            return "unknown";
+    }
+}
+
+static void ReportPhase(const PhaseKey& key, PhaseCost& cost)
+{
+    const LatencyStats recorded = Summarize(cost.recorded);
+    const LatencyStats replayed = Summarize(cost.replayed);
+    char line[512] = {};
+    (void)snprintf(line, sizeof(line),
+                   "{\"suite\":\"nnopbase_trace_replay\",\"phase\":\"%s\",\"op\":\"%s\",\"calls\":%zu,"
+                   "\"failed\":%zu,\"recorded_avg_ns\":%.1f,\"recorded_p99_ns\":%.1f,\"replayed_avg_ns\":%.1f,"
+                   "\"replayed_p99_ns\":%.1f}",
+                   PhaseName(key.first), key.second.c_str(), cost.replayed.size(), cost.failed, recorded.avgNs,
+                   recorded.p99Ns, replayed.avgNs, replayed.p99Ns);
+    ReportLine("TraceReplay", line);
+}
+
+// 按录制的 tensor 描述重建一次调用的入参, 数据地址指向同一块占位内存
+class ReplayArgs {
+public:
+    explicit ReplayArgs(const TraceRecord& record)
+    {
+        for (const auto& arg : record.args) {
+            for (const auto& desc : arg.tensors) {
+                tensors_.push_back(aclCreateTensor(
+                    desc.viewShape.data(), desc.viewShape.size(), ToAclDataType(static_cast<DataType>(desc.dtype)),
+                    desc.strides.data(), desc.offset, ToAclFormat(static_cast<Format>(desc.format)),
+                    desc.storageShape.data(), desc.storageShape.size(), &data_[0]));
+            }
+        }
+    }
+
+    ~ReplayArgs()
+    {
+        for (auto tensor : tensors_) {
+            aclDestroyTensor(tensor);
+        }
+    }
+
+    aclTensor* Tensor(size_t index) const { return index < tensors_.size() ? tensors_[index] : nullptr; }
+    size_t Size() const { return tensors_.size(); }
+
+private:
+    std::vector<aclTensor*> tensors_;
+    int64_t data_[8] = {};
+};
+
+// 一个回放线程的状态, GetWorkspaceSize/MatchArgs 得到的执行器留给同线程随后的 Run/下发
+struct ReplayContext {
+    std::unique_ptr<ReplayArgs> args;
+    aclOpExecutor* executor{nullptr};
+    uint64_t workspaceSize{0U};
+};
+
+using ReplayHandler = std::function<aclnnStatus(const TraceRecord&, ReplayContext&)>;
+
+static std::map<PhaseKey, ReplayHandler>& GetReplayHandlers()
+{
+    static std::map<PhaseKey, ReplayHandler> handlers = {
+        {{TraceEvent::L2_GET_WORKSPACE, "aclnnMulStub"},
+         [](const TraceRecord& record, ReplayContext& ctx) {
+             ctx.args = std::make_unique<ReplayArgs>(record);
+             if (ctx.args->Size() < 3U) {
+                 return ACLNN_ERR_PARAM_INVALID;
+             }
+             return aclnnMulStubGetWorkspaceSize(ctx.args->Tensor(0U), ctx.args->Tensor(1U), ctx.args->Tensor(2U),
+                                                 &ctx.workspaceSize, &ctx.executor);
+         }},
+        {{TraceEvent::L2_RUN, "aclnnMulStub"},
+         [](const TraceRecord& record, ReplayContext& ctx) {
+             (void)record;
+             return aclnnMulStub(nullptr, ctx.workspaceSize, ctx.executor, nullptr);
+         }},
+        {{TraceEvent::INDV_MATCH_ARGS, "bninference_d_kernel"},
+         [](const TraceRecord& record, ReplayContext& ctx) {
+             ctx.args = std::make_unique<ReplayArgs>(record);
+             if (ctx.args->Size() < 4U) {
+                 return ACLNN_ERR_PARAM_INVALID;
+             }
+             return ReplayBninferenceGetWorkspaceSize(ctx.args->Tensor(0U), ctx.args->Tensor(1U),
+                                                      ctx.args->Tensor(2U), ctx.args->Tensor(3U),
+                                                      &ctx.workspaceSize, &ctx.executor);
+         }},
+        {{TraceEvent::INDV_LAUNCH, "bninference_d_kernel"},
+         [](const TraceRecord& record, ReplayContext& ctx) {
+             (void)record;
+             thread_local static uint8_t workspace[kWorkspaceSize] = {};
+             return NnopbaseRunWithWorkspace(ctx.executor, nullptr, workspace, ctx.workspaceSize);
+         }},
+    };
+    return handlers;
+}
+
+class TraceReplay : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        setenv("ASCEND_C", "1", 1);
+        NnopbaseSetStubFiles(OP_API_COMMON_UT_SRC_DIR);
+    }
+
+    static void TearDownTestCase()
+    {
+        unsetenv("ASCEND_C");
+        NnopbaseUnsetEnvAndClearFolder();
+        setenv("ASCEND_OPP_PATH", OP_API_COMMON_UT_SRC_DIR, 1);
+    }
+
+    // 没有外部轨迹时, 多线程调用桩算子录制一份
+    static void RecordWorkload(const std::string& path)
+    {
+        TraceRecorder::Instance().Reset(path);
+        std::vector<std::thread> workers;
+        for (size_t i = 0U; i < kRecordThreads; ++i) {
+            workers.emplace_back([]() {
+                BenchmarkAclrtStub aclrtStub;
+                AclrtStub::GetInstance()->Install(&aclrtStub);
+                std::vector<int64_t> shape = {1, 1, 1, 1, 1};
+                int64_t data[4] = {1, 2, 3, 4};
+                aclTensor* f16[3] = {};
+                aclTensor* f32[4] = {};
+                for (size_t j = 0U; j < 4U; ++j) {
+                    if (j < 3U) {
+                        f16[j] = aclCreateTensor(shape.data(), shape.size(), ACL_FLOAT16, nullptr, 0, ACL_FORMAT_ND,
+                                                 shape.data(), shape.size(), &data[j]);
+                    }
+                    f32[j] = aclCreateTensor(shape.data(), shape.size(), ACL_FLOAT, nullptr, 0, ACL_FORMAT_ND,
+                                             shape.data(), shape.size(), &data[j]);
+                }
+                uint8_t workspace[kWorkspaceSize] = {};
+                for (size_t j = 0U; j < kRecordIterations; ++j) {
+                    uint64_t workspaceSize = 0U;
+                    aclOpExecutor* executor = nullptr;
+                    if (aclnnMulStubGetWorkspaceSize(f16[0], f16[1], f16[2], &workspaceSize, &executor) ==
+                        ACLNN_SUCCESS) {
+                        (void)aclnnMulStub(nullptr, workspaceSize, executor, nullptr);
+                    }
+                    if (ReplayBninferenceGetWorkspaceSize(f32[0], f32[1], f32[2], f32[3], &workspaceSize,
+                                                          &executor) == ACLNN_SUCCESS) {
+                        (void)NnopbaseRunWithWorkspace(executor, nullptr, workspace, workspaceSize);
+                    }
+                }
+                for (auto tensor : f16) {
+                    aclDestroyTensor(tensor);
+                }
+                for (auto tensor : f32) {
+                    aclDestroyTensor(tensor);
+                }
+                AclrtStub::GetInstance()->UnInstall();
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        // 关闭录制, 回放时的调用不再写入轨迹
+        TraceRecorder::Instance().Reset("");
+    }
+
+    static void ReplayThread(const std::vector<const TraceRecord*>& records, PhaseCosts& costs, size_t& skipped)
+    {
+        BenchmarkAclrtStub aclrtStub;
+        AclrtStub::GetInstance()->Install(&aclrtStub);
+        ReplayContext ctx;
+        const auto& handlers = GetReplayHandlers();
+        for (const auto record : records) {
+            const PhaseKey key(record->event, record->name);
+            const auto iter = handlers.find(key);
+            if (iter == handlers.end()) {
+                ++skipped;
+                continue;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            const auto ret = iter->second(*record, ctx);
+            const auto end = std::chrono::steady_clock::now();
+            PhaseCost& cost = costs[key];
+            cost.recorded.push_back(static_cast<double>(record->durationNs));
+            cost.replayed.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            if (ret != ACLNN_SUCCESS) {
+                ++cost.failed;
+            }
+        }
+        AclrtStub::GetInstance()->UnInstall();
+    }
+};
+
+TEST_F(TraceReplay, ReplayTrace)
+{
+    std::string path;
+    const char* replayFile = std::getenv("NNOPBASE_TRACE_REPLAY_FILE");
+    const bool recordLocally = (replayFile == nullptr);
+    if (recordLocally) {
+        path = (std::filesystem::temp_directory_path() / "nnopbase_trace_replay.bin").string();
+        RecordWorkload(path);
+    } else {
+        path = replayFile;
+    }
+
+    std::vector<TraceRecord> records;
+    ASSERT_EQ(ReadTraceFile(path, records), ACLNN_SUCCESS);
+    ASSERT_FALSE(records.empty());
+
+    // 录制时的每个线程各用一个线程回放, 线程内保持调用顺序
+    std::map<uint32_t, std::vector<const TraceRecord*>> threadRecords;
+    for (const auto& record : records) {
+        threadRecords[record.threadIndex].push_back(&record);
+    }
+    std::vector<PhaseCosts> costs(threadRecords.size());
+    std::vector<size_t> skipped(threadRecords.size(), 0U);
+    std::vector<std::thread> workers;
+    size_t index = 0U;
+    for (const auto& item : threadRecords) {
+        workers.emplace_back(ReplayThread, std::cref(item.second), std::ref(costs[index]), std::ref(skipped[index]));
+        ++index;
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    PhaseCosts merged;
+    size_t skippedNum = 0U;
+    for (size_t i = 0U; i < costs.size(); ++i) {
+        skippedNum += skipped[i];
+        for (auto& item : costs[i]) {
+            PhaseCost& cost = merged[item.first];
+            cost.recorded.insert(cost.recorded.end(), item.second.recorded.begin(), item.second.recorded.end());
+            cost.replayed.insert(cost.replayed.end(), item.second.replayed.begin(), item.second.replayed.end());
+            cost.failed += item.second.failed;
+        }
+    }
+    for (auto& item : merged) {
+        ReportPhase(item.first, item.second);
+    }
+    printf("[TraceReplay] %zu records from %zu threads, %zu skipped\n", records.size(), threadRecords.size(),
+           skippedNum);
+
+    if (recordLocally) {
+        // 桩算子录制的轨迹每个阶段都应完整回放
+        EXPECT_EQ(skippedNum, 0U);
+        EXPECT_EQ(merged.size(), GetReplayHandlers().size());
+        for (const auto& item : merged) {
+            EXPECT_EQ(item.second.replayed.size(), kRecordThreads * kRecordIterations);
+            EXPECT_EQ(item.second.failed, 0U);
+        }
+        std::filesystem::remove(path);
+    }
+}
+
+} // namespace benchmark
+} // namespace op
@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "aclnn/acl_meta.h"
+#include "aclnn_trace.h"
+#include "thread_local_context.h"
+
+using namespace op::internal;
+
+class AclnnTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        tracePath_ = (std::filesystem::temp_directory_path() / "aclnn_trace_ut.bin").string();
+        TraceRecorder::Instance().Reset(tracePath_);
+        std::vector<int64_t> shape = {2, 3};
+        std::vector<int64_t> strides = {3, 1};
+        tensor_ = aclCreateTensor(shape.data(), shape.size(), ACL_FLOAT16, strides.data(), 0, ACL_FORMAT_ND,
+                                  shape.data(), shape.size(), nullptr);
+    }
+
+    void TearDown() override
+    {
+        (void)aclDestroyTensor(tensor_);
+        TraceRecorder::Instance().Reset("");
+        std::filesystem::remove(tracePath_);
+    }
+
+    std::vector<TraceRecord> ReadBack() const
+    {
+        TraceRecorder::Instance().Flush();
+        std::vector<TraceRecord> records;
+        EXPECT_EQ(ReadTraceFile(tracePath_, records), ACLNN_SUCCESS);
+        return records;
+    }
+
+    std::string tracePath_;
+    aclTensor* tensor_{nullptr};
+};
+
+TEST_F(AclnnTraceTest, RecordAndRead)
+{
+    int owner = 0;
+    TraceRecorder::Begin(TraceEvent::INDV_MATCH_ARGS, "AddCustom", &owner);
+    TraceRecorder::AddTensor(tensor_, false);
+    TraceRecorder::AddTensor(nullptr, false);
+    const aclTensor* list[] = {tensor_, nullptr};
+    TraceRecorder::AddTensorList(list, 2U, true);
+    const int64_t ints[] = {1, -2};
+    TraceRecorder::AddIntList(ints, 2U, false);
+    const float floats[] = {0.5F};
+    TraceRecorder::AddFloatList(floats, 1U, false);
+    const int32_t attr = 42;
+    TraceRecorder::AddBytes(&attr, sizeof(attr), false);
+    TraceRecorder::AddString("mode", false);
+    TraceRecorder::SetResult(1);
+    TraceRecorder::End(&owner);
+
+    // args outside of a record and the end of another owner are ignored
+    TraceRecorder::AddInt(1, false);
+    TraceRecorder::End(&owner);
+
+    const auto records = ReadBack();
+    ASSERT_EQ(records.size(), 1U);
+    const TraceRecord& record = records[0];
+    EXPECT_EQ(record.event, TraceEvent::INDV_MATCH_ARGS);
+    EXPECT_EQ(record.name, "AddCustom");
+    EXPECT_EQ(record.result, 1);
+    EXPECT_EQ(record.streamId, -1);
+    ASSERT_EQ(record.args.size(), 7U);
+
+    ASSERT_EQ(record.args[0].kind, TraceArgKind::TENSOR);
+    const TraceTensorDesc& desc = record.args[0].tensors[0];
+    EXPECT_EQ(desc.dtype, static_cast<int32_t>(op::DataType::DT_FLOAT16));
+    EXPECT_EQ(desc.viewShape, (std::vector<int64_t>{2, 3}));
+    EXPECT_EQ(desc.strides, (std::vector<int64_t>{3, 1}));
+    EXPECT_EQ(desc.storageShape, (std::vector<int64_t>{2, 3}));
+
+    EXPECT_EQ(record.args[1].kind, TraceArgKind::NULL_ARG);
+    ASSERT_EQ(record.args[2].kind, TraceArgKind::TENSOR_LIST);
+    EXPECT_TRUE(record.args[2].isOutput);
+    EXPECT_EQ(record.args[2].present, (std::vector<bool>{true, false}));
+    EXPECT_EQ(record.args[2].tensors.size(), 1U);
+    EXPECT_EQ(record.args[3].ints, (std::vector<int64_t>{1, -2}));
+    EXPECT_EQ(record.args[4].floats, (std::vector<double>{0.5}));
+    ASSERT_EQ(record.args[5].bytes.size(), sizeof(attr));
+    EXPECT_EQ(*reinterpret_cast<const int32_t*>(record.args[5].bytes.data()), attr);
+    EXPECT_EQ(record.args[6].bytes, "mode");
+}
+
+TEST_F(AclnnTraceTest, RecordL2Args)
+{
+    GetThreadLocalContext().logInfo_.l2ApiName = "aclnnTraceStub";
+    const char* funcName = "aclnnTraceStubGetWorkspaceSize";
+    op::BeginL2Trace(funcName);
+    const aclTensor* self = tensor_;
+    op::AddArgsToTrace(std::make_tuple(self, int64_t(3), true, 1.5F, ACL_FLOAT, nullptr), false);
+    op::AddArgsToTrace(std::make_tuple(tensor_), true);
+    // a nested L2 call does not replace the outer record
+    op::BeginL2Trace("aclnnInnerGetWorkspaceSize");
+    op::EndL2Trace("aclnnInnerGetWorkspaceSize");
+    op::EndL2Trace(funcName);
+
+    const auto records = ReadBack();
+    ASSERT_EQ(records.size(), 1U);
+    EXPECT_EQ(records[0].event, TraceEvent::L2_GET_WORKSPACE);
+    EXPECT_EQ(records[0].name, "aclnnTraceStub");
+    const auto& args = records[0].args;
+    ASSERT_EQ(args.size(), 7U);
+    EXPECT_EQ(args[0].kind, TraceArgKind::TENSOR);
+    EXPECT_EQ(args[1].kind, TraceArgKind::INT);
+    EXPECT_EQ(args[1].ints[0], 3);
+    EXPECT_EQ(args[2].kind, TraceArgKind::BOOL);
+    EXPECT_EQ(args[3].kind, TraceArgKind::FLOAT);
+    EXPECT_EQ(args[3].floats[0], 1.5);
+    EXPECT_EQ(args[4].kind, TraceArgKind::INT);
+    EXPECT_EQ(args[4].ints[0], static_cast<int64_t>(ACL_FLOAT));
+    EXPECT_EQ(args[5].kind, TraceArgKind::UNKNOWN);
+    EXPECT_EQ(args[6].kind, TraceArgKind::TENSOR);
+    EXPECT_TRUE(args[6].isOutput);
+}
+
+TEST_F(AclnnTraceTest, RecordOnThreads)
+{
+    constexpr size_t threadNum = 4U;
+    constexpr size_t callNum = 2000U;
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < threadNum; i++) {
+        threads.emplace_back([this]() {
+            for (size_t j = 0U; j < callNum; j++) {
+                const TraceScope scope(TraceEvent::L2_RUN, "aclnnTraceStub", nullptr);
+                TraceRecorder::AddTensor(tensor_, false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto records = ReadBack();
+    ASSERT_EQ(records.size(), threadNum * callNum);
+    std::map<uint32_t, uint64_t> lastBegin;
+    for (const auto& record : records) {
+        EXPECT_EQ(record.event, TraceEvent::L2_RUN);
+        // records of a thread are in call order
+        EXPECT_GE(record.beginNs, lastBegin[record.threadIndex]);
+        lastBegin[record.threadIndex] = record.beginNs;
+    }
+    EXPECT_EQ(lastBegin.size(), threadNum);
+}
+
+TEST_F(AclnnTraceTest, DisabledAndBrokenTrace)
+{
+    TraceRecorder::Instance().Reset("");
+    EXPECT_FALSE(TraceRecorder::IsEnabled());
+    int owner = 0;
+    TraceRecorder::Begin(TraceEvent::L2_RUN, "aclnnTraceStub", &owner);
+    TraceRecorder::End(&owner);
+    TraceRecorder::Instance().Flush();
+    EXPECT_FALSE(std::filesystem::exists(tracePath_));
+
+    std::vector<TraceRecord> records;
+    EXPECT_EQ(ReadTraceFile(tracePath_, records), ACLNN_ERR_PARAM_INVALID);
+    std::ofstream(tracePath_) << "not a trace";
+    EXPECT_EQ(ReadTraceFile(tracePath_, records), ACLNN_ERR_PARAM_INVALID);
+
+    TraceRecorder::Instance().Reset(tracePath_);
+    TraceRecorder::Begin(TraceEvent::L2_RUN, "aclnnTraceStub", &owner);
+    TraceRecorder::End(&owner);
+    TraceRecorder::Instance().Flush();
+    std::filesystem::resize_file(tracePath_, std::filesystem::file_size(tracePath_) - 1U);
+    EXPECT_EQ(ReadTraceFile(tracePath_, records), ACLNN_ERR_PARAM_INVALID);
+}
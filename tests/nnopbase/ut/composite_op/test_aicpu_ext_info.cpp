@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opdev/aicpu/aicpu_ext_info_handle.h"
+#include "opdev/aicpu/aicpu_task.h"
+
+using namespace op::internal;
+
+class AicpuExtInfoUt : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        op::Shape inShape{2, 3, 4};
+        op::Shape outShape{6, 4};
+        input_ = std::make_unique<aclTensor>(inShape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+        output_ = std::make_unique<aclTensor>(outShape, op::DataType::DT_INT32, op::Format::FORMAT_ND, nullptr);
+        inputs_ = {input_.get(), nullptr};
+        outputs_ = {output_.get()};
+    }
+
+    static void ClearKernelId(std::vector<uint8_t>& buf, size_t offset)
+    {
+        reinterpret_cast<AicpuSessionInfo*>(buf.data() + offset)->kernelId = 0U;
+    }
+
+    std::unique_ptr<aclTensor> input_;
+    std::unique_ptr<aclTensor> output_;
+    op::FVector<const aclTensor*> inputs_;
+    op::FVector<aclTensor*> outputs_;
+};
+
+TEST_F(AicpuExtInfoUt, CCLayoutMatchesGeneratedBuffer)
+{
+    AicpuExtInfoHandler genHandler("ExtInfoLayoutCC", 2, 1, ge::DEPEND_SHAPE_RANGE);
+    std::string extInfo;
+    ASSERT_EQ(genHandler.GenCCExtBuffer(inputs_, outputs_, extInfo), ACLNN_SUCCESS);
+    std::vector<uint8_t> expect(extInfo.size());
+    ASSERT_EQ(genHandler.Parse(extInfo, expect.data()), ACLNN_SUCCESS);
+
+    AicpuExtInfoHandler layoutHandler("ExtInfoLayoutCC", 2, 1, ge::DEPEND_SHAPE_RANGE);
+    std::shared_ptr<const AicpuExtInfoLayout> layout;
+    ASSERT_EQ(layoutHandler.GetExtInfoLayout(false, layout), ACLNN_SUCCESS);
+    ASSERT_NE(layout, nullptr);
+    ASSERT_EQ(layout->image.size(), extInfo.size());
+    ASSERT_NE(layout->sessionInfoOffset, kInvalidExtInfoOffset);
+    std::vector<uint8_t> actual(layout->image.size());
+    ASSERT_EQ(layoutHandler.ApplyExtInfoLayout(*layout, inputs_, outputs_, false, actual.data()), ACLNN_SUCCESS);
+
+    // kernel id 每个任务独立生成, 其余字节应完全一致
+    EXPECT_NE(reinterpret_cast<AicpuSessionInfo*>(actual.data() + layout->sessionInfoOffset)->kernelId, 0U);
+    ClearKernelId(expect, layout->sessionInfoOffset);
+    ClearKernelId(actual, layout->sessionInfoOffset);
+    EXPECT_EQ(expect, actual);
+
+    // 同一个 key 复用同一份 layout
+    AicpuExtInfoHandler otherHandler("ExtInfoLayoutCC", 2, 1, ge::DEPEND_SHAPE_RANGE);
+    std::shared_ptr<const AicpuExtInfoLayout> cached;
+    ASSERT_EQ(otherHandler.GetExtInfoLayout(false, cached), ACLNN_SUCCESS);
+    EXPECT_EQ(cached.get(), layout.get());
+}
+
+TEST_F(AicpuExtInfoUt, UpdateShapeAfterApplyLayout)
+{
+    AicpuExtInfoHandler genHandler("ExtInfoLayoutUpdate", 2, 1, ge::DEPEND_IN_SHAPE);
+    std::string extInfo;
+    ASSERT_EQ(genHandler.GenCCExtBuffer(inputs_, outputs_, extInfo), ACLNN_SUCCESS);
+    std::vector<uint8_t> expect(extInfo.size());
+    ASSERT_EQ(genHandler.Parse(extInfo, expect.data()), ACLNN_SUCCESS);
+
+    AicpuExtInfoHandler layoutHandler("ExtInfoLayoutUpdate", 2, 1, ge::DEPEND_IN_SHAPE);
+    std::shared_ptr<const AicpuExtInfoLayout> layout;
+    ASSERT_EQ(layoutHandler.GetExtInfoLayout(false, layout), ACLNN_SUCCESS);
+    std::vector<uint8_t> actual(layout->image.size());
+    ASSERT_EQ(layoutHandler.ApplyExtInfoLayout(*layout, inputs_, outputs_, false, actual.data()), ACLNN_SUCCESS);
+
+    op::Shape newInShape{8, 1};
+    op::Shape newOutShape{8};
+    ASSERT_EQ(genHandler.UpdateInputShape(1, newInShape), ACLNN_SUCCESS);
+    ASSERT_EQ(genHandler.UpdateOutputShape(0, newOutShape), ACLNN_SUCCESS);
+    ASSERT_EQ(layoutHandler.UpdateInputShape(1, newInShape), ACLNN_SUCCESS);
+    ASSERT_EQ(layoutHandler.UpdateOutputShape(0, newOutShape), ACLNN_SUCCESS);
+
+    uint64_t oldKernelId = reinterpret_cast<AicpuSessionInfo*>(actual.data() + layout->sessionInfoOffset)->kernelId;
+    ASSERT_EQ(layoutHandler.UpdateKernelId(), ACLNN_SUCCESS);
+    EXPECT_NE(reinterpret_cast<AicpuSessionInfo*>(actual.data() + layout->sessionInfoOffset)->kernelId, oldKernelId);
+
+    ClearKernelId(expect, layout->sessionInfoOffset);
+    ClearKernelId(actual, layout->sessionInfoOffset);
+    EXPECT_EQ(expect, actual);
+}
+
+TEST_F(AicpuExtInfoUt, TfLayoutMatchesGeneratedBuffer)
+{
+    AicpuTaskSpace space("ExtInfoLayoutTf", ge::DEPEND_IN_SHAPE, true);
+    AicpuExtInfoHandler genHandler("ExtInfoLayoutTf", 2, 1, ge::DEPEND_IN_SHAPE);
+    genHandler.SetSpace(&space);
+    std::string extInfo;
+    ASSERT_EQ(genHandler.GenTfExtBuffer(inputs_, outputs_, extInfo), ACLNN_SUCCESS);
+    std::vector<uint8_t> expect(extInfo.size());
+    ASSERT_EQ(genHandler.Parse(extInfo, expect.data()), ACLNN_SUCCESS);
+
+    AicpuExtInfoHandler layoutHandler("ExtInfoLayoutTf", 2, 1, ge::DEPEND_IN_SHAPE);
+    layoutHandler.SetSpace(&space);
+    std::shared_ptr<const AicpuExtInfoLayout> layout;
+    ASSERT_EQ(layoutHandler.GetExtInfoLayout(true, layout), ACLNN_SUCCESS);
+    EXPECT_EQ(layout->sessionInfoOffset, kInvalidExtInfoOffset);
+    std::vector<uint8_t> actual(layout->image.size());
+    ASSERT_EQ(layoutHandler.ApplyExtInfoLayout(*layout, inputs_, outputs_, true, actual.data()), ACLNN_SUCCESS);
+    EXPECT_EQ(expect, actual);
+}
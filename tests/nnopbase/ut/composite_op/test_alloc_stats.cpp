@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mmpa/mmpa_api.h"
+#include "alloc_stats.h"
+#include "block_pool.h"
+
+using namespace op::internal;
+
+namespace {
+constexpr size_t kSmallSize = 100U;   // 256B class
+constexpr size_t kMiddleSize = 1000U; // 1KB class
+constexpr size_t kLargeSize = 100U * 1024U;
+
+AllocStatsSnapshot GetSnapshot()
+{
+    AllocStatsSnapshot snapshot;
+    GetAllocStats(snapshot);
+    return snapshot;
+}
+
+const AllocThreadStats* FindThread(const AllocStatsSnapshot& snapshot, uint64_t tid)
+{
+    for (const auto& thread : snapshot.threads) {
+        if (thread.tid == tid) {
+            return &thread;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+class AllocStatsUt : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetAllocStatsEnable(true);
+        AllocStats::Reset();
+    }
+
+    void TearDown() override { SetAllocStatsEnable(false); }
+};
+
+TEST_F(AllocStatsUt, ClassTable)
+{
+    const auto snapshot = GetSnapshot();
+    const size_t storeNum = BlockPool::get_instance().storeNum_;
+    EXPECT_TRUE(snapshot.enabled);
+    ASSERT_EQ(snapshot.classes.size(), storeNum + 1U);
+    EXPECT_EQ(snapshot.classes[0].blockSize, static_cast<size_t>(BlockPool::BLOCK_BASE_SIZE));
+    EXPECT_EQ(snapshot.classes[storeNum - 1U].blockSize, static_cast<size_t>(BlockPool::BLOCK_MAX_SIZE));
+    EXPECT_EQ(snapshot.classes.back().blockSize, 0U);
+}
+
+TEST_F(AllocStatsUt, CacheAndPoolCounters)
+{
+    const size_t smallClass = static_cast<size_t>(BlockPool::GetStoreIndex(kSmallSize));
+    const size_t middleClass = static_cast<size_t>(BlockPool::GetStoreIndex(kMiddleSize));
+    const size_t largeClass = BlockPool::get_instance().storeNum_;
+    AllocThreadStats threadStats;
+    std::thread([&threadStats]() {
+        // a new thread starts with an empty block cache
+        void* small1 = BlockCache::CacheAlloc(kSmallSize);
+        void* small2 = BlockCache::CacheAlloc(kSmallSize);
+        void* large = BlockCache::CacheAlloc(kLargeSize);
+        void* middle = BlockPool::Malloc(kMiddleSize);
+        BlockCache::CacheFree(small1);
+        BlockCache::CacheFree(small2);
+        BlockCache::CacheFree(large);
+        BlockPool::Free(middle);
+        const auto snapshot = GetSnapshot();
+        const auto* stats = FindThread(snapshot, static_cast<uint64_t>(mmGetTid()));
+        ASSERT_NE(stats, nullptr);
+        threadStats = *stats;
+    }).join();
+
+    EXPECT_EQ(threadStats.allocNum, 4U);
+    EXPECT_EQ(threadStats.freeNum, 4U);
+    EXPECT_EQ(threadStats.liveBytes, 0);
+
+    const auto snapshot = GetSnapshot();
+    const auto& small = snapshot.classes[smallClass];
+    EXPECT_GE(small.Get(AllocStatsItem::ALLOC), 2U);
+    EXPECT_GE(small.Get(AllocStatsItem::FREE), 2U);
+    EXPECT_GE(small.Get(AllocStatsItem::CACHE_REFILL), 1U);
+    EXPECT_GE(small.Get(AllocStatsItem::CACHE_REFILL_BLOCK), 2U);
+    EXPECT_GE(small.Get(AllocStatsItem::CACHE_HIT), 1U);
+
+    const auto& middle = snapshot.classes[middleClass];
+    EXPECT_GE(middle.Get(AllocStatsItem::POOL_ALLOC), 1U);
+    EXPECT_GE(middle.Get(AllocStatsItem::POOL_FREE), 1U);
+
+    const auto& large = snapshot.classes[largeClass];
+    EXPECT_GE(large.Get(AllocStatsItem::MALLOC), 1U);
+    EXPECT_GE(large.Get(AllocStatsItem::MALLOC_BYTES), kLargeSize);
+    EXPECT_EQ(snapshot.exitedThreads.liveBytes, 0);
+    EXPECT_GE(snapshot.exitedThreads.allocNum, 4U);
+    EXPECT_GE(snapshot.sizes[GetAllocSizeBucket(kSmallSize)], 2U);
+    EXPECT_GE(snapshot.sizes[GetAllocSizeBucket(kMiddleSize)], 1U);
+    EXPECT_GE(snapshot.sizes[GetAllocSizeBucket(kLargeSize)], 1U);
+}
+
+TEST_F(AllocStatsUt, SizeBuckets)
+{
+    EXPECT_EQ(GetAllocSizeBucket(1U), 0U);
+    EXPECT_EQ(GetAllocSizeBucket(64U), 0U);
+    EXPECT_EQ(GetAllocSizeBucket(65U), 1U);
+    EXPECT_EQ(GetAllocSizeBucketLimit(GetAllocSizeBucket(257U)), 320U);
+    EXPECT_EQ(GetAllocSizeBucketLimit(GetAllocSizeBucket(512U)), 512U);
+    EXPECT_EQ(GetAllocSizeBucketLimit(GetAllocSizeBucket(513U)), 640U);
+    EXPECT_EQ(GetAllocSizeBucketLimit(GetAllocSizeBucket(1024U * 1024U)), 1024U * 1024U);
+    EXPECT_EQ(GetAllocSizeBucket(1024U * 1024U + 1U), kAllocSizeBucketNum - 1U);
+    EXPECT_EQ(GetAllocSizeBucketLimit(kAllocSizeBucketNum - 1U), 0U);
+    for (size_t bucket = 0U; bucket + 1U < kAllocSizeBucketNum; bucket++) {
+        const size_t limit = GetAllocSizeBucketLimit(bucket);
+        EXPECT_EQ(GetAllocSizeBucket(limit), bucket);
+        EXPECT_EQ(GetAllocSizeBucket(limit + 1U), bucket + 1U);
+    }
+}
+
+TEST_F(AllocStatsUt, LiveBytesAcrossThreads)
+{
+    void* block = nullptr;
+    std::thread([&block]() { block = BlockPool::Malloc(kMiddleSize); }).join();
+    ASSERT_NE(block, nullptr);
+    const auto before = GetSnapshot();
+    EXPECT_GE(before.exitedThreads.liveBytes, static_cast<int64_t>(kMiddleSize));
+
+    BlockPool::Free(block);
+    const auto after = GetSnapshot();
+    const auto* self = FindThread(after, static_cast<uint64_t>(mmGetTid()));
+    ASSERT_NE(self, nullptr);
+    EXPECT_LT(self->liveBytes, 0);
+    EXPECT_EQ(self->liveBytes + after.exitedThreads.liveBytes, 0);
+}
+
+TEST_F(AllocStatsUt, SpinlockWait)
+{
+    OpSpinlock lock;
+    lock.lock();
+    std::thread waiter([&lock]() {
+        lock.lock();
+        lock.unlock();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    lock.unlock();
+    waiter.join();
+
+    const auto snapshot = GetSnapshot();
+    EXPECT_GE(snapshot.lockContendedNum, 1U);
+    EXPECT_GT(snapshot.lockWaitNs, 0U);
+}
+
+TEST_F(AllocStatsUt, DisabledAndReset)
+{
+    void* block = BlockPool::Malloc(kMiddleSize);
+    BlockPool::Free(block);
+    const auto enabled = GetSnapshot();
+    const auto* self = FindThread(enabled, static_cast<uint64_t>(mmGetTid()));
+    ASSERT_NE(self, nullptr);
+    EXPECT_GT(self->allocNum, 0U);
+
+    AllocStats::Reset();
+    SetAllocStatsEnable(false);
+    block = BlockPool::Malloc(kMiddleSize);
+    BlockPool::Free(block);
+    const auto snapshot = GetSnapshot();
+    EXPECT_FALSE(snapshot.enabled);
+    for (const auto& cls : snapshot.classes) {
+        EXPECT_EQ(cls.Get(AllocStatsItem::ALLOC), 0U);
+        EXPECT_EQ(cls.Get(AllocStatsItem::POOL_ALLOC), 0U);
+    }
+    AllocStats::DumpToLog();
+}
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "async_dump.h"
+#include "exe_graph/runtime/tensor.h"
+
+using namespace op::internal;
+
+namespace {
+constexpr size_t kTensorSize = 1024U;
+// the snapshot arena is allocated at the budget size
+constexpr size_t kTestBudget = 64U * kTensorSize;
+
+std::vector<Adx::TensorInfoV2> MakeTensors(std::vector<int64_t>& data, gert::TensorPlacement placement)
+{
+    Adx::TensorInfoV2 info;
+    info.type = Adx::TensorType::INPUT;
+    info.addrType = Adx::AddressType::TRADITIONAL;
+    info.dataType = ge::DT_INT64;
+    info.format = ge::FORMAT_ND;
+    info.placement = placement;
+    info.tensorAddr = data.data();
+    info.tensorSize = data.size() * sizeof(int64_t);
+    info.shape.push_back(static_cast<int64_t>(data.size()));
+    info.originShape.push_back(static_cast<int64_t>(data.size()));
+    return {info};
+}
+} // namespace
+
+class AsyncDumpTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        AsyncDumper::Instance().SetMemoryBudget(kTestBudget);
+        AsyncDumper::Instance().ResetStats();
+    }
+    void TearDown() override
+    {
+        AsyncDumper::Instance().SetEnable(false);
+        AsyncDumper::Instance().SetMemoryBudget(kTestBudget);
+    }
+};
+
+TEST_F(AsyncDumpTest, DisabledFallsBackToSyncDump)
+{
+    AsyncDumper::Instance().SetEnable(false);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    EXPECT_FALSE(AsyncDumper::Instance().Submit("Add", "Add_1", tensors, nullptr));
+    EXPECT_EQ(AsyncDumper::Instance().GetStats().submitted, 0U);
+}
+
+TEST_F(AsyncDumpTest, HostTensorFallsBackToSyncDump)
+{
+    AsyncDumper::Instance().SetEnable(true);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnHost);
+    EXPECT_FALSE(AsyncDumper::Instance().Submit("Add", "Add_1", tensors, nullptr));
+    EXPECT_EQ(AsyncDumper::Instance().GetStats().submitted, 0U);
+}
+
+TEST_F(AsyncDumpTest, SubmitAndFlush)
+{
+    AsyncDumper::Instance().SetEnable(true);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    constexpr uint64_t requestNum = 100U;
+    for (uint64_t i = 0U; i < requestNum; i++) {
+        EXPECT_TRUE(AsyncDumper::Instance().Submit("Add", "Add_" + std::to_string(i), tensors, nullptr));
+    }
+    AsyncDumper::Instance().Flush();
+
+    const auto stats = AsyncDumper::Instance().GetStats();
+    EXPECT_EQ(stats.submitted, requestNum);
+    EXPECT_EQ(stats.dumped + stats.failed, requestNum);
+    EXPECT_EQ(stats.dropped, 0U);
+    EXPECT_GE(stats.batches, 1U);
+    EXPECT_LE(stats.batches, requestNum);
+    EXPECT_EQ(stats.pendingNum, 0U);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+    EXPECT_GE(stats.peakPendingBytes, kTensorSize);
+}
+
+TEST_F(AsyncDumpTest, DropOverMemoryBudget)
+{
+    AsyncDumper::Instance().SetEnable(true);
+    AsyncDumper::Instance().SetMemoryBudget(kTensorSize / 2U);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    EXPECT_TRUE(AsyncDumper::Instance().Submit("Add", "Add_1", tensors, nullptr));
+    AsyncDumper::Instance().Flush();
+
+    const auto stats = AsyncDumper::Instance().GetStats();
+    EXPECT_EQ(stats.submitted, 0U);
+    EXPECT_EQ(stats.dropped, 1U);
+    EXPECT_EQ(stats.droppedBytes, kTensorSize);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+}
+
+TEST_F(AsyncDumpTest, DisableDrainsPendingRequests)
+{
+    AsyncDumper::Instance().SetEnable(true);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    for (uint64_t i = 0U; i < kAsyncDumpMaxBatchSize; i++) {
+        EXPECT_TRUE(AsyncDumper::Instance().Submit("Add", "Add_" + std::to_string(i), tensors, nullptr));
+    }
+    AsyncDumper::Instance().SetEnable(false);
+
+    const auto stats = AsyncDumper::Instance().GetStats();
+    EXPECT_EQ(stats.dumped + stats.failed, kAsyncDumpMaxBatchSize);
+    EXPECT_EQ(stats.pendingNum, 0U);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+}
+
+TEST_F(AsyncDumpTest, ArenaBoundsPendingSnapshots)
+{
+    // the arena holds 3 snapshots, released slots are handed out again
+    AsyncDumper::Instance().SetMemoryBudget(3U * kTensorSize + kTensorSize / 2U);
+    AsyncDumper::Instance().SetEnable(true);
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    constexpr uint64_t requestNum = 200U;
+    for (uint64_t i = 0U; i < requestNum; i++) {
+        EXPECT_TRUE(AsyncDumper::Instance().Submit("Add", "Add_" + std::to_string(i), tensors, nullptr));
+    }
+    AsyncDumper::Instance().Flush();
+
+    const auto stats = AsyncDumper::Instance().GetStats();
+    EXPECT_EQ(stats.submitted + stats.dropped, requestNum);
+    EXPECT_EQ(stats.dumped + stats.failed, stats.submitted);
+    EXPECT_GE(stats.submitted, 3U);
+    EXPECT_LE(stats.peakPendingBytes, 3U * kTensorSize);
+    EXPECT_EQ(stats.pendingNum, 0U);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+}
+
+TEST_F(AsyncDumpTest, DisableWhileSubmitting)
+{
+    std::vector<int64_t> data(kTensorSize / sizeof(int64_t), 1);
+    auto tensors = MakeTensors(data, gert::kOnDeviceHbm);
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> taken(0U);
+    std::vector<std::thread> submitters;
+    for (int32_t t = 0; t < 4; t++) {
+        submitters.emplace_back([&]() {
+            while (!stop.load()) {
+                if (AsyncDumper::Instance().Submit("Add", "Add", tensors, nullptr)) {
+                    taken.fetch_add(1U);
+                }
+            }
+        });
+    }
+    for (int32_t i = 0; i < 50; i++) {
+        AsyncDumper::Instance().SetEnable(true);
+        std::this_thread::yield();
+        AsyncDumper::Instance().SetEnable(false);
+    }
+    stop.store(true);
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+
+    // a request the stopped dump thread would never see is refused and dumped in place by the caller
+    const auto stats = AsyncDumper::Instance().GetStats();
+    EXPECT_EQ(stats.submitted + stats.dropped, taken.load());
+    EXPECT_EQ(stats.dumped + stats.failed, stats.submitted);
+    EXPECT_EQ(stats.pendingNum, 0U);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+}
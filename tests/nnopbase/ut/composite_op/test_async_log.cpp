@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opdev/op_log.h"
+#include "async_log.h"
+
+using namespace op::internal;
+
+namespace {
+std::string CaptureAndFormat(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    AsyncLogRecord record;
+    (void)CaptureAsyncLogRecord(record, OP_ID, OP_LOG_INFO, fmt, args);
+    va_end(args);
+    char buf[kAsyncLogLineSize];
+    (void)FormatAsyncLogRecord(record, buf, kAsyncLogLineSize);
+    return std::string(buf);
+}
+
+std::string Expected(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char buf[kAsyncLogLineSize];
+    (void)vsnprintf(buf, kAsyncLogLineSize, fmt, args);
+    va_end(args);
+    return std::string(buf);
+}
+
+bool RecordAsync(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    const bool ret = AsyncLogger::Instance().Record(OP_ID, OP_LOG_INFO, fmt, args);
+    va_end(args);
+    return ret;
+}
+} // namespace
+
+class AsyncLogTest : public testing::Test {
+protected:
+    void SetUp() override { AsyncLogger::Instance().ResetStats(); }
+    void TearDown() override { AsyncLogger::Instance().SetMode(AsyncLogMode::DISABLE); }
+};
+
+TEST_F(AsyncLogTest, FormatDeferredMatchesPrintf)
+{
+    std::string opName = "OpName:[Add] ";
+    EXPECT_EQ(CaptureAndFormat("[%s:%d][%s][%lu] %sHugemem trace: update pool index: %d", "bridge_pool.cpp", 45,
+                               "NNOP", 12345UL, opName.c_str(), 7),
+              Expected("[%s:%d][%s][%lu] %sHugemem trace: update pool index: %d", "bridge_pool.cpp", 45, "NNOP",
+                       12345UL, opName.c_str(), 7));
+    EXPECT_EQ(CaptureAndFormat("%5.2f|%-6s|%x|%c|%zu|%lld|%p|%%", 3.14159, "ab", 255U, 'z', size_t(9), -5LL,
+                               reinterpret_cast<void*>(0x10)),
+              Expected("%5.2f|%-6s|%x|%c|%zu|%lld|%p|%%", 3.14159, "ab", 255U, 'z', size_t(9), -5LL,
+                       reinterpret_cast<void*>(0x10)));
+    EXPECT_EQ(CaptureAndFormat("%*d|%-*.*s|", 6, 42, 5, 2, "xyz"), Expected("%*d|%-*.*s|", 6, 42, 5, 2, "xyz"));
+}
+
+TEST_F(AsyncLogTest, CaptureCopiesTemporaryString)
+{
+    AsyncLogRecord record;
+    char buf[kAsyncLogLineSize];
+    {
+        std::string temp = "temporary";
+        auto capture = [&record](const char* fmt, ...) {
+            va_list args;
+            va_start(args, fmt);
+            (void)CaptureAsyncLogRecord(record, OP_ID, OP_LOG_INFO, fmt, args);
+            va_end(args);
+        };
+        capture("value %s", temp.c_str());
+        temp.assign(temp.size(), 'x');
+    }
+    (void)FormatAsyncLogRecord(record, buf, kAsyncLogLineSize);
+    EXPECT_STREQ(buf, "value temporary");
+}
+
+TEST_F(AsyncLogTest, CaptureCopiesFormat)
+{
+    // the format of an unloaded op .so is gone when the record is written
+    AsyncLogRecord record;
+    char buf[kAsyncLogLineSize];
+    {
+        std::string fmt = "op %s run %d times";
+        auto capture = [&record](const char* fmt, ...) {
+            va_list args;
+            va_start(args, fmt);
+            (void)CaptureAsyncLogRecord(record, OP_ID, OP_LOG_INFO, fmt, args);
+            va_end(args);
+        };
+        capture(fmt.c_str(), "Add", 3);
+        fmt.assign(fmt.size(), '%');
+    }
+    (void)FormatAsyncLogRecord(record, buf, kAsyncLogLineSize);
+    EXPECT_STREQ(buf, "op Add run 3 times");
+
+    // a format too long to keep next to its arguments is formatted on the caller thread
+    const std::string longFmt = std::string(kAsyncLogStrPoolSize, 'a') + " %d";
+    const std::string longText = CaptureAndFormat(longFmt.c_str(), 5);
+    EXPECT_EQ(longText.size(), kAsyncLogStrPoolSize - 1U);
+    EXPECT_EQ(longText, std::string(kAsyncLogStrPoolSize - 1U, 'a'));
+}
+
+TEST_F(AsyncLogTest, UnsupportedFormatIsPreformatted)
+{
+    EXPECT_EQ(CaptureAndFormat("long double %Lf %s", static_cast<long double>(1.5), "tail"),
+              Expected("long double %Lf %s", static_cast<long double>(1.5), "tail"));
+}
+
+TEST_F(AsyncLogTest, DisabledModeFallsBackToSync)
+{
+    AsyncLogger::Instance().SetMode(AsyncLogMode::DISABLE);
+    EXPECT_FALSE(RecordAsync("sync %d", 1));
+    DlogRecordInner(OP_ID, OP_LOG_INFO, "[%s:%d] sync %d", "test", 1, 2);
+    EXPECT_EQ(AsyncLogger::Instance().GetStats().recorded, 0U);
+}
+
+TEST_F(AsyncLogTest, FlushWritesAllRecords)
+{
+    AsyncLogger::Instance().SetMode(AsyncLogMode::BLOCK);
+    constexpr size_t threadNum = 4U;
+    constexpr size_t logNum = kAsyncLogRingCapacity * 4U;
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < threadNum; ++i) {
+        threads.emplace_back([]() {
+            for (size_t j = 0U; j < logNum; ++j) {
+                EXPECT_TRUE(RecordAsync("[%s] async %zu", "NNOP", j));
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    AsyncLogger::Instance().Flush();
+    const auto stats = AsyncLogger::Instance().GetStats();
+    EXPECT_EQ(stats.recorded, threadNum * logNum);
+    EXPECT_EQ(stats.written, threadNum * logNum);
+    EXPECT_EQ(stats.dropped, 0U);
+}
+
+TEST_F(AsyncLogTest, DropModeCountsOverflow)
+{
+    AsyncLogger::Instance().SetMode(AsyncLogMode::DROP);
+    constexpr size_t logNum = kAsyncLogRingCapacity * 8U;
+    for (size_t i = 0U; i < logNum; ++i) {
+        EXPECT_TRUE(RecordAsync("drop %zu", i));
+    }
+    AsyncLogger::Instance().Flush();
+    const auto stats = AsyncLogger::Instance().GetStats();
+    EXPECT_EQ(stats.recorded + stats.dropped, logNum);
+    EXPECT_EQ(stats.written, stats.recorded);
+}
+
+TEST_F(AsyncLogTest, ErrorLogFlushesQueue)
+{
+    AsyncLogger::Instance().SetMode(AsyncLogMode::DROP);
+    for (size_t i = 0U; i < 8U; ++i) {
+        DlogRecordInner(OP_ID, OP_LOG_INFO, "[%s:%d] before error %zu", "test", 1, i);
+    }
+    DlogRecordInner(OP_ID, OP_LOG_ERROR, "[%s:%d] error", "test", 1);
+    const auto stats = AsyncLogger::Instance().GetStats();
+    EXPECT_EQ(stats.written, stats.recorded);
+}
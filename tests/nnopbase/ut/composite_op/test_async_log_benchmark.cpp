@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "gtest/gtest.h"
+
+#include "opdev/op_log.h"
+#include "async_log.h"
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// 同步/异步日志单次调用耗时对比
+// 使用与 OP_LOGI 展开后相同的格式串和参数，测量调用线程上的耗时
+// ============================================================================
+
+class AsyncLogBenchmark : public testing::Test {
+protected:
+    void TearDown() override { AsyncLogger::Instance().SetMode(AsyncLogMode::DISABLE); }
+
+    static double RunLogLoop(const size_t loop)
+    {
+        const std::string opName = "OpName:[Add] ";
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0U; i < loop; ++i) {
+            DlogRecordInner(OP_ID, OP_LOG_INFO, "[%s:%d][%s][%s][%lu] %sHugemem trace: update pool index: %zu",
+                            "bridge_pool.cpp", 45, OPAPI_SUBMOD_NAME, "UpdateHugeMemIndex", 12345UL,
+                            opName.c_str(), i);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(loop);
+    }
+};
+
+TEST_F(AsyncLogBenchmark, SyncVsAsyncCostPerCall)
+{
+    // 单个 burst 不超过 ring 容量, 衡量的是调用线程上的开销而非写线程吞吐
+    constexpr size_t loop = kAsyncLogRingCapacity / 2U;
+    constexpr size_t round = 16U;
+
+    double syncNs = 0.0;
+    AsyncLogger::Instance().SetMode(AsyncLogMode::DISABLE);
+    for (size_t i = 0U; i < round; ++i) {
+        syncNs += RunLogLoop(loop);
+    }
+
+    double asyncNs = 0.0;
+    AsyncLogger::Instance().SetMode(AsyncLogMode::BLOCK);
+    for (size_t i = 0U; i < round; ++i) {
+        asyncNs += RunLogLoop(loop);
+        AsyncLogger::Instance().Flush();
+    }
+
+    syncNs /= static_cast<double>(round);
+    asyncNs /= static_cast<double>(round);
+    printf("[AsyncLogBenchmark] sync: %.1f ns/call, async: %.1f ns/call\n", syncNs, asyncNs);
+    const auto stats = AsyncLogger::Instance().GetStats();
+    EXPECT_EQ(stats.written, stats.recorded);
+    EXPECT_GT(syncNs, 0.0);
+    EXPECT_GT(asyncNs, 0.0);
+}
+
+} // namespace benchmark
+} // namespace op
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "alloc_stats.h"
+#include "block_pool.h"
+
+using namespace op::internal;
+
+namespace {
+constexpr size_t kBudget = 64U * 1024U * 1024U;
+
+// size class of the fixed power of 4 table
+int GetDefaultStoreIndex(size_t size)
+{
+    if (size == 0U || size > BlockPool::BLOCK_MAX_SIZE) {
+        return BlockPool::INVALID_STORE;
+    }
+    int idx = 0;
+    size_t limit = BlockPool::BLOCK_BASE_SIZE;
+    while (size > limit) {
+        limit *= 4U;
+        idx++;
+    }
+    return idx;
+}
+
+size_t GetBytes(const std::vector<BlockPool::BlockDesc>& stores)
+{
+    size_t bytes = 0U;
+    for (const auto& desc : stores) {
+        bytes += desc.size * desc.count;
+    }
+    return bytes;
+}
+} // namespace
+
+class BlockPoolClassesUt : public testing::Test {
+protected:
+    void TearDown() override
+    {
+        unsetenv("ACLNN_BLOCK_POOL_CLASSES");
+        unsetenv("ACLNN_BLOCK_POOL_MB");
+        // a local pool sets the classes of the statistics, give them back to the global pool
+        const BlockPool& global = BlockPool::get_instance();
+        std::vector<size_t> sizes;
+        for (size_t i = 0U; i < global.storeNum_; i++) {
+            sizes.push_back(global.StoreIndex[i].size);
+        }
+        AllocStats::SetClassSizes(sizes);
+    }
+};
+
+TEST_F(BlockPoolClassesUt, DefaultTable)
+{
+    const BlockPool& pool = BlockPool::get_instance();
+    ASSERT_EQ(pool.storeNum_, 6U);
+    EXPECT_EQ(pool.spanMaxSize_, 0U);
+    for (size_t size = 0U; size <= BlockPool::BLOCK_MAX_SIZE + 1U; size++) {
+        ASSERT_EQ(BlockPool::GetStoreIndex(size), GetDefaultStoreIndex(size)) << size;
+    }
+}
+
+TEST_F(BlockPoolClassesUt, FineClasses)
+{
+    std::vector<BlockPool::BlockDesc> stores;
+    ASSERT_TRUE(BlockPool::ParseStoreIndex("fine", kBudget, stores));
+    ASSERT_EQ(stores.size(), static_cast<size_t>(BlockPool::MAX_STORE));
+    EXPECT_EQ(stores.front().size, static_cast<size_t>(BlockPool::BLOCK_BASE_SIZE));
+    EXPECT_EQ(stores.back().size, static_cast<size_t>(BlockPool::BLOCK_MAX_SIZE));
+    for (size_t i = 1U; i < stores.size(); i++) {
+        EXPECT_GT(stores[i].size, stores[i - 1U].size);
+        EXPECT_EQ(stores[i].size % BlockPool::BLOCK_BASE_SIZE, 0U);
+        // 4 classes per power of two, a request over 256B wastes less than a quarter of its block
+        if (stores[i - 1U].size >= 256U) {
+            EXPECT_LE(stores[i].size * 4U, (stores[i - 1U].size + 1U) * 5U);
+        }
+        EXPECT_GE(stores[i].batch, 1U);
+        EXPECT_LE(stores[i].batch, static_cast<size_t>(ADDR_LIST_LARGEST_SIZE));
+    }
+    EXPECT_LE(GetBytes(stores), kBudget);
+    EXPECT_GE(GetBytes(stores), kBudget / 2U);
+}
+
+TEST_F(BlockPoolClassesUt, HistogramClasses)
+{
+    std::vector<BlockPool::BlockDesc> stores;
+    ASSERT_TRUE(BlockPool::ParseStoreIndex("100:1000,3000:10,3072:30,200000:5", kBudget, stores));
+    ASSERT_EQ(stores.size(), 3U);
+    EXPECT_EQ(stores[0].size, 128U);
+    EXPECT_EQ(stores[1].size, 3072U);
+    EXPECT_EQ(stores[2].size, static_cast<size_t>(BlockPool::BLOCK_MAX_SIZE));
+    // the budget is shared by the bytes requested: 128000 and 122880
+    EXPECT_GT(stores[0].count, stores[1].count);
+    EXPECT_NEAR(static_cast<double>(stores[0].size * stores[0].count) / (stores[1].size * stores[1].count),
+                128000.0 / 122880.0, 0.01);
+    EXPECT_EQ(stores[2].count, 16U);
+    EXPECT_LE(GetBytes(stores), kBudget + stores[2].size * stores[2].count);
+}
+
+TEST_F(BlockPoolClassesUt, InvalidConfig)
+{
+    std::vector<BlockPool::BlockDesc> stores;
+    EXPECT_FALSE(BlockPool::ParseStoreIndex("coarse", kBudget, stores));
+    EXPECT_FALSE(BlockPool::ParseStoreIndex("100", kBudget, stores));
+    EXPECT_FALSE(BlockPool::ParseStoreIndex("100:", kBudget, stores));
+    EXPECT_FALSE(BlockPool::ParseStoreIndex(":100", kBudget, stores));
+    EXPECT_FALSE(BlockPool::ParseStoreIndex("100:1,-5:1", kBudget, stores));
+    EXPECT_FALSE(BlockPool::ParseStoreIndex("100:1x", kBudget, stores));
+
+    setenv("ACLNN_BLOCK_POOL_CLASSES", "100:x", 1);
+    EXPECT_FALSE(BlockPool::LoadStoreIndex(stores));
+    EXPECT_EQ(stores.size(), 6U);
+}
+
+TEST_F(BlockPoolClassesUt, ConfiguredPool)
+{
+    setenv("ACLNN_BLOCK_POOL_CLASSES", "fine", 1);
+    setenv("ACLNN_BLOCK_POOL_MB", "16", 1);
+    auto pool = std::make_unique<BlockPool>();
+    ASSERT_EQ(pool->storeNum_, static_cast<size_t>(BlockPool::MAX_STORE));
+    // every class keeps at least 16 blocks over its share of the budget
+    size_t minBytes = 0U;
+    for (size_t i = 0U; i < pool->storeNum_; i++) {
+        EXPECT_GE(pool->StoreIndex[i].count, 16U);
+        minBytes += pool->StoreIndex[i].size * 16U;
+    }
+    EXPECT_LE(GetBytes(std::vector<BlockPool::BlockDesc>(pool->StoreIndex.begin(), pool->StoreIndex.end())),
+              16U * 1024U * 1024U + minBytes);
+
+    // 1100B takes the 1280B class instead of the 4KB one
+    void* block = pool->MallocImpl(1100U);
+    ASSERT_NE(block, nullptr);
+    const BlockStore::BlockHeader* head = BlockStore::GetBlockHeader(block);
+    const size_t cls = static_cast<size_t>(head->userTag_ - BlockPool::DEFAULT_TAG);
+    ASSERT_LT(cls, pool->storeNum_);
+    EXPECT_EQ(pool->StoreIndex[cls].size, 1280U);
+    pool->FreeImpl(block);
+
+    // requests over 64KB are page granular spans, a freed span serves the next request of its page number
+    void* span = pool->MallocImpl(100U * 1024U);
+    ASSERT_NE(span, nullptr);
+    EXPECT_EQ(BlockStore::GetBlockTag(span), static_cast<uint16_t>(BlockPool::SPAN_TAG));
+    EXPECT_EQ(BlockStore::GetBlockHeader(span)->cacheExt_, BlockStore::NOT_IN_CACHE);
+    memset(span, 0x5a, 100U * 1024U);
+    pool->FreeImpl(span);
+    EXPECT_GT(pool->spanCachedBytes_, 0U);
+    void* again = pool->MallocImpl(100U * 1024U + 16U);
+    EXPECT_EQ(again, span);
+    EXPECT_EQ(pool->spanCachedBytes_, 0U);
+    void* other = pool->MallocImpl(200U * 1024U);
+    EXPECT_NE(other, span);
+    pool->FreeImpl(again);
+    pool->FreeImpl(other);
+
+    // over SPAN_MAX_SIZE still falls back to malloc
+    void* large = pool->MallocImpl(BlockPool::SPAN_MAX_SIZE + 1U);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(BlockStore::GetBlockTag(large), static_cast<uint16_t>(BlockPool::SYS_TAG));
+    pool->FreeImpl(large);
+    pool.reset();
+}
@@ -16,6 +16,7 @@
 #include "opdev/op_dfx.h"
 #include "thread_local_context.h"
 #include "bridge_pool.h"
+#include "tensor_signature.h"
 
 using namespace op;
 using namespace std;
@@ -1277,3 +1278,57 @@ TEST_F(CommonTypesTest, aclTensorSetData)
     float intArr[5] = {1., 2., 3., 4., 5.};
     floatTensor->SetData(intArr, 5, op::DataType::DT_QINT16);
 }
+
+TEST_F(CommonTypesTest, TensorSignature)
+{
+    aclTensor tensor({2, 3, 4}, DataType::DT_FLOAT, Format::FORMAT_ND, nullptr);
+    aclTensor same({2, 3, 4}, DataType::DT_FLOAT, Format::FORMAT_ND, nullptr);
+    const uint64_t signature = tensor.GetSignature();
+    EXPECT_NE(signature, op::internal::kInvalidTensorSignature);
+    EXPECT_EQ(signature, same.GetSignature());
+
+    tensor.SetViewShape({2, 12});
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetViewShape({2, 3, 4});
+    EXPECT_EQ(tensor.GetSignature(), signature);
+
+    tensor.SetViewStrides(op::Strides{12, 1, 3});
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetViewStrides(op::Strides{12, 4, 1});
+    tensor.SetViewOffset(4);
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetViewOffset(0);
+    tensor.SetDataType(DataType::DT_FLOAT16);
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetDataType(DataType::DT_FLOAT);
+    tensor.SetStorageShape({24});
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetStorageShape({2, 3, 4});
+    tensor.SetStorageFormat(Format::FORMAT_NCHW);
+    EXPECT_NE(tensor.GetSignature(), signature);
+    tensor.SetStorageFormat(Format::FORMAT_ND);
+    EXPECT_EQ(tensor.GetSignature(), signature);
+
+    const int64_t dims[] = {4, 6};
+    tensor.InitTensor(dims, 2, ACL_FLOAT, nullptr, 0, ACL_FORMAT_ND, dims, 2, nullptr);
+    EXPECT_NE(tensor.GetSignature(), signature);
+    EXPECT_EQ(tensor.GetSignature(), op::internal::CalcTensorSignature(&tensor));
+}
+
+TEST_F(CommonTypesTest, TensorSignatureCheckDetectsStaleSignature)
+{
+    aclTensor tensor({2, 3, 4}, DataType::DT_FLOAT, Format::FORMAT_ND, nullptr);
+    const uint64_t signature = tensor.GetSignature();
+    EXPECT_TRUE(op::internal::CheckTensorSignature(&tensor));
+
+    // writes behind the setters leave the cached signature stale until it is checked or dropped
+    const_cast<op::Shape&>(tensor.GetViewShape()).SetDim(0, 8);
+    EXPECT_EQ(tensor.GetSignature(), signature);
+    EXPECT_FALSE(op::internal::CheckTensorSignature(&tensor));
+    EXPECT_NE(tensor.GetSignature(), signature);
+    EXPECT_TRUE(op::internal::CheckTensorSignature(&tensor));
+
+    const_cast<op::Shape&>(tensor.GetStorageShape()).SetDim(0, 8);
+    tensor.InvalidateSignature();
+    EXPECT_EQ(tensor.GetSignature(), op::internal::CalcTensorSignature(&tensor));
+}
@@ -0,0 +1,308 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "block_pool.h"
+#include "bridge_pool.h"
+#include "mem_mgr/huge_mem.h"
+#include "thread_local_context.h"
+
+using namespace op::internal;
+
+namespace {
+constexpr size_t kHalfBlock = kHugeBlockSize / 2;
+
+HugeMemStats GetStats()
+{
+    HugeMemStats stats;
+    GetHugeMemStats(stats);
+    return stats;
+}
+
+bool GetPoolStats(int32_t id, HugeMemPoolStats& stats)
+{
+    std::vector<HugeMemPoolStats> pools;
+    GetHugeMemPoolStats(pools);
+    for (const auto& pool : pools) {
+        if (pool.poolIndex == id) {
+            stats = pool;
+            return true;
+        }
+    }
+    return false;
+}
+
+// budget of the blocks held now plus extra blocks
+void SetExtraBudget(size_t extraBlockNum)
+{
+    SetHugeMemBudget((GetStats().usedBlockNum + extraBlockNum) * kHugeBlockSize);
+}
+} // namespace
+
+class HugeMemUt : public testing::Test {
+protected:
+    void TearDown() override
+    {
+        SetHugeMemBudget(0);
+        UpdateHugeMemIndex(op::kInvalidHugeMemIndexId);
+    }
+};
+
+TEST_F(HugeMemUt, PoolStats)
+{
+    const HugeMemStats base = GetStats();
+    EXPECT_EQ(base.blockSize, static_cast<size_t>(kHugeBlockSize));
+    EXPECT_EQ(base.totalBlockNum, static_cast<size_t>(kHugeBlockNum));
+    EXPECT_EQ(base.budgetBlockNum, static_cast<size_t>(kHugeBlockNum));
+
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t id = GetPoolIndex();
+    ASSERT_NE(id, op::kInvalidHugeMemIndexId);
+    EXPECT_EQ(GetStats().activePoolNum, base.activePoolNum + 1U);
+
+    std::vector<void*> addrs;
+    for (size_t i = 0U; i < 3U; i++) {
+        addrs.push_back(Allocate(kHalfBlock));
+        ASSERT_TRUE(BlockPool::InHugeMemRange(addrs.back()));
+    }
+    HugeMemPoolStats pool;
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.blockNum, 3U);
+    EXPECT_EQ(pool.peakBlockNum, 3U);
+    EXPECT_EQ(pool.usedBytes, 3U * kHalfBlock);
+    EXPECT_EQ(pool.liveNum, 3);
+    EXPECT_EQ(GetStats().usedBlockNum, base.usedBlockNum + 3U);
+    EXPECT_GE(GetStats().peakPoolBlockNum, 3U);
+
+    DeAllocate(addrs[0]);
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.liveNum, 2);
+
+    ReleaseHugeMem(nullptr, false);
+    EXPECT_FALSE(GetPoolStats(id, pool));
+    const HugeMemStats after = GetStats();
+    EXPECT_EQ(after.usedBlockNum, base.usedBlockNum);
+    EXPECT_EQ(after.activePoolNum, base.activePoolNum);
+    EXPECT_GE(after.peakUsedBlockNum, base.usedBlockNum + 3U);
+}
+
+TEST_F(HugeMemUt, BudgetFallback)
+{
+    InitHugeMemThreadLocal(nullptr, false);
+    SetExtraBudget(2U);
+    const HugeMemStats base = GetStats();
+
+    void* addr1 = Allocate(kHalfBlock);
+    void* addr2 = Allocate(kHalfBlock);
+    void* addr3 = Allocate(kHalfBlock);
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr1));
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr2));
+    ASSERT_NE(addr3, nullptr);
+    EXPECT_FALSE(BlockPool::InHugeMemRange(addr3));
+
+    const HugeMemStats stats = GetStats();
+    EXPECT_EQ(stats.usedBlockNum, stats.budgetBlockNum);
+    EXPECT_EQ(stats.fallbackNum, base.fallbackNum + 1U);
+    EXPECT_EQ(stats.fallbackBytes, base.fallbackBytes + kHalfBlock);
+
+    DeAllocate(addr3);
+    ReleaseHugeMem(nullptr, false);
+}
+
+TEST_F(HugeMemUt, ReclaimIdlePool)
+{
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t idle = GetPoolIndex();
+    void* addr1 = Allocate(kHalfBlock);
+    void* addr2 = Allocate(kHalfBlock);
+    DeAllocate(addr1);
+    DeAllocate(addr2);
+
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t busy = GetPoolIndex();
+    ASSERT_NE(idle, busy);
+    SetExtraBudget(0U);
+    const HugeMemStats base = GetStats();
+
+    // no block left in the budget, the blocks of the idle pool are taken back
+    addr1 = Allocate(kHalfBlock);
+    addr2 = Allocate(kHalfBlock);
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr1));
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr2));
+    const HugeMemStats stats = GetStats();
+    EXPECT_EQ(stats.reclaimedPoolNum, base.reclaimedPoolNum + 1U);
+    EXPECT_EQ(stats.reclaimedBlockNum, base.reclaimedBlockNum + 2U);
+    EXPECT_EQ(stats.fallbackNum, base.fallbackNum);
+    HugeMemPoolStats pool;
+    EXPECT_FALSE(GetPoolStats(idle, pool));
+
+    // a pool with live allocations is never reclaimed
+    void* addr3 = Allocate(kHalfBlock);
+    ASSERT_NE(addr3, nullptr);
+    EXPECT_FALSE(BlockPool::InHugeMemRange(addr3));
+    DeAllocate(addr3);
+    ReleaseHugeMem(nullptr, false);
+
+    // the reclaimed pool keeps its index and allocates again
+    UpdateHugeMemIndex(idle);
+    SetExtraBudget(1U);
+    addr1 = Allocate(kHalfBlock);
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr1));
+    ReleaseHugeMem(nullptr, false);
+}
+
+TEST_F(HugeMemUt, PoolIndexOnThreads)
+{
+    constexpr size_t threadNum = 8U;
+    constexpr size_t loopNum = 2000U;
+    const size_t baseActive = GetStats().activePoolNum;
+    std::vector<std::atomic<int32_t>> owners(static_cast<size_t>(kHugeBlockNum) * 4U);
+    std::atomic<size_t> conflicts{0U};
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < threadNum; i++) {
+        threads.emplace_back([&owners, &conflicts]() {
+            for (size_t j = 0U; j < loopNum; j++) {
+                InitHugeMemThreadLocal(nullptr, false);
+                const int32_t id = GetPoolIndex();
+                if (id == op::kInvalidHugeMemIndexId) {
+                    continue;
+                }
+                if (owners[id].exchange(1) != 0) {
+                    conflicts++;
+                }
+                void* addr = Allocate(kHalfBlock / 4U);
+                DeAllocate(addr);
+                owners[id].store(0);
+                ReleaseHugeMem(nullptr, false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(conflicts.load(), 0U);
+    EXPECT_EQ(GetStats().activePoolNum, baseActive);
+}
+
+TEST_F(HugeMemUt, TrimFreeBlocks)
+{
+    const HugeMemStats base = GetStats();
+    const size_t trimmed = TrimHugeMem();
+    EXPECT_GT(trimmed, 0U);
+    EXPECT_EQ(GetStats().trimmedBlockNum, base.trimmedBlockNum + trimmed);
+
+    // trimmed blocks come back zeroed and still serve allocations
+    InitHugeMemThreadLocal(nullptr, false);
+    void* addr1 = Allocate(kHalfBlock);
+    void* addr2 = Allocate(kHalfBlock / 2U);
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr1));
+    EXPECT_TRUE(BlockPool::InHugeMemRange(addr2));
+    EXPECT_EQ(BlockPool::GetHugeBlockBase(addr1), BlockPool::GetHugeBlockBase(addr2));
+    ReleaseHugeMem(nullptr, false);
+}
+
+// the address freed late sits in the middle of the address handed out by the new owner of its block
+TEST_F(HugeMemUt, StaleFreeIgnored)
+{
+    InitHugeMemThreadLocal(nullptr, false);
+    (void)Allocate(kHalfBlock / 4U);
+    void* stale = Allocate(kHalfBlock / 4U);
+    ASSERT_TRUE(BlockPool::InHugeMemRange(stale));
+    ReleaseHugeMem(nullptr, false);
+
+    // the block given back is handed out first to the next pool
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t id = GetPoolIndex();
+    void* addr = Allocate(kHalfBlock);
+    ASSERT_EQ(BlockPool::GetHugeBlockBase(addr), BlockPool::GetHugeBlockBase(stale));
+    memset(addr, 0x5a, kHalfBlock);
+    HugeMemPoolStats pool;
+    DeAllocate(stale);
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.liveNum, 1);
+
+    // a free of the generation before a reclaim does not count against the blocks acquired after it
+    DeAllocate(addr);
+    stale = Allocate(kHalfBlock / 4U);
+    DeAllocate(stale);
+    SetExtraBudget(0U);
+    InitHugeMemThreadLocal(nullptr, false);
+    addr = Allocate(kHalfBlock);
+    ASSERT_TRUE(BlockPool::InHugeMemRange(addr));
+    HugeMemPoolStats reclaimed;
+    EXPECT_FALSE(GetPoolStats(id, reclaimed));
+    ReleaseHugeMem(nullptr, false);
+    UpdateHugeMemIndex(id);
+    SetExtraBudget(1U);
+    addr = Allocate(kHalfBlock);
+    ASSERT_EQ(BlockPool::GetHugeBlockBase(addr), BlockPool::GetHugeBlockBase(stale));
+    DeAllocate(stale);
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.liveNum, 1);
+    DeAllocate(addr);
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.liveNum, 0);
+    ReleaseHugeMem(nullptr, false);
+}
+
+TEST_F(HugeMemUt, TrimKeepsHeader)
+{
+    InitHugeMemThreadLocal(nullptr, false);
+    (void)Allocate(kHalfBlock / 4U);
+    void* stale = Allocate(kHalfBlock / 4U);
+    ASSERT_TRUE(BlockPool::InHugeMemRange(stale));
+    ReleaseHugeMem(nullptr, false);
+    EXPECT_GT(TrimHugeMem(), 0U);
+
+    // the owner follows the offset at the start of the header
+    const auto* base = static_cast<const char*>(BlockPool::GetHugeBlockBase(stale));
+    EXPECT_EQ(*reinterpret_cast<const int32_t*>(base + sizeof(int64_t)), op::kInvalidHugeMemIndexId);
+    DeAllocate(stale);
+
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t id = GetPoolIndex();
+    void* addr = Allocate(kHalfBlock);
+    ASSERT_EQ(BlockPool::GetHugeBlockBase(addr), BlockPool::GetHugeBlockBase(stale));
+    DeAllocate(stale);
+    HugeMemPoolStats pool;
+    ASSERT_TRUE(GetPoolStats(id, pool));
+    EXPECT_EQ(pool.liveNum, 1);
+    ReleaseHugeMem(nullptr, false);
+}
+
+// the owner allocates without the lock while other threads reclaim its blocks whenever it is idle
+TEST_F(HugeMemUt, ReclaimWhileAllocating)
+{
+    std::atomic<bool> stop{false};
+    std::thread reclaimer([&stop]() {
+        while (!stop.load()) {
+            (void)TrimHugeMem();
+        }
+    });
+    InitHugeMemThreadLocal(nullptr, false);
+    const int32_t id = GetPoolIndex();
+    for (size_t i = 0U; i < 20000U; i++) {
+        auto* addr = static_cast<char*>(Allocate(kHalfBlock / 4U));
+        ASSERT_NE(addr, nullptr);
+        memset(addr, 0x5a, kHalfBlock / 4U);
+        DeAllocate(addr);
+    }
+    stop.store(true);
+    reclaimer.join();
+    HugeMemPoolStats pool;
+    if (GetPoolStats(id, pool)) {
+        EXPECT_EQ(pool.liveNum, 0);
+    }
+    ReleaseHugeMem(nullptr, false);
+}
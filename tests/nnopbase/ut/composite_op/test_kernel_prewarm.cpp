@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "gtest/gtest.h"
+#include "aclnn/acl_meta.h"
+#include "kernel_prewarm.h"
+#include "thread_local_context.h"
+
+using namespace op::internal;
+
+class KernelPrewarmTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        KernelPrewarmer::Instance().Shutdown();
+        base_ = KernelPrewarmer::Instance().GetProgress();
+        listPath_ = (std::filesystem::temp_directory_path() / "kernel_prewarm_ut.json").string();
+    }
+
+    void TearDown() override
+    {
+        KernelPrewarmer::Instance().Shutdown();
+        std::filesystem::remove(listPath_);
+    }
+
+    void WriteList(const std::string& content) const
+    {
+        std::ofstream(listPath_) << content;
+    }
+
+    PrewarmProgress base_;
+    std::string listPath_;
+};
+
+TEST_F(KernelPrewarmTest, RunSubmittedFuncs)
+{
+    constexpr size_t taskNum = 16U;
+    std::atomic<size_t> runNum{0U};
+    for (size_t i = 0U; i < taskNum; i++) {
+        ASSERT_EQ(KernelPrewarmer::Instance().Submit([&runNum, i]() {
+            runNum++;
+            return (i % 4U == 0U) ? ACLNN_ERR_INNER : ACLNN_SUCCESS;
+        }),
+                  ACLNN_SUCCESS);
+    }
+    EXPECT_EQ(aclnnWaitPrewarm(), ACLNN_SUCCESS);
+    EXPECT_EQ(runNum.load(), taskNum);
+
+    uint64_t totalNum = 0U;
+    uint64_t doneNum = 0U;
+    uint64_t failedNum = 0U;
+    ASSERT_EQ(aclnnGetPrewarmProgress(&totalNum, &doneNum, &failedNum), ACLNN_SUCCESS);
+    EXPECT_EQ(totalNum - base_.submitted, taskNum);
+    EXPECT_EQ(doneNum - base_.done, 12U);
+    EXPECT_EQ(failedNum - base_.failed, 4U);
+    EXPECT_EQ(KernelPrewarmer::Instance().GetProgress().pendingNum, 0U);
+}
+
+TEST_F(KernelPrewarmTest, FuncRunsWithSubmitterConfig)
+{
+    auto& opConfigInfo = GetThreadLocalContext().opConfigInfo_;
+    const op::OpConfigInfo saved = opConfigInfo;
+    opConfigInfo.aicNum_ = 7U;
+    uint32_t seenAicNum = 0U;
+    ASSERT_EQ(KernelPrewarmer::Instance().Submit([&seenAicNum]() {
+        seenAicNum = GetThreadLocalContext().opConfigInfo_.aicNum_;
+        return ACLNN_SUCCESS;
+    }),
+              ACLNN_SUCCESS);
+    KernelPrewarmer::Instance().Wait();
+    EXPECT_EQ(seenAicNum, 7U);
+    opConfigInfo = saved;
+}
+
+TEST_F(KernelPrewarmTest, SubmitAfterShutdown)
+{
+    KernelPrewarmer::Instance().Shutdown();
+    std::atomic<bool> ran{false};
+    ASSERT_EQ(KernelPrewarmer::Instance().Submit([&ran]() {
+        ran = true;
+        return ACLNN_SUCCESS;
+    }),
+              ACLNN_SUCCESS);
+    KernelPrewarmer::Instance().Wait();
+    EXPECT_TRUE(ran.load());
+}
+
+TEST_F(KernelPrewarmTest, InvalidInput)
+{
+    EXPECT_EQ(KernelPrewarmer::Instance().Submit(KernelPrewarmer::PrewarmFunc()), ACLNN_ERR_PARAM_NULLPTR);
+    EXPECT_EQ(KernelPrewarmer::Instance().Submit(0U, nullptr), ACLNN_ERR_PARAM_NULLPTR);
+    EXPECT_EQ(aclnnPrewarmKernels(nullptr), ACLNN_ERR_PARAM_NULLPTR);
+    EXPECT_EQ(aclnnPrewarmKernels("/not/exist/prewarm.json"), ACLNN_ERR_PARAM_INVALID);
+
+    uint64_t num = 0U;
+    EXPECT_EQ(aclnnGetPrewarmProgress(nullptr, &num, &num), ACLNN_ERR_PARAM_NULLPTR);
+    EXPECT_EQ(aclnnGetPrewarmProgress(&num, nullptr, &num), ACLNN_ERR_PARAM_NULLPTR);
+    EXPECT_EQ(aclnnGetPrewarmProgress(&num, &num, nullptr), ACLNN_ERR_PARAM_NULLPTR);
+}
+
+TEST_F(KernelPrewarmTest, InvalidPrewarmList)
+{
+    WriteList("{\"ops\": [");
+    EXPECT_EQ(aclnnPrewarmKernels(listPath_.c_str()), ACLNN_ERR_PARAM_INVALID);
+
+    WriteList("{\"ops\": [{\"op_type\": \"NotRegisteredPrewarmOp\"}]}");
+    EXPECT_EQ(aclnnPrewarmKernels(listPath_.c_str()), ACLNN_ERR_PARAM_INVALID);
+
+    WriteList("{\"kernels\": []}");
+    EXPECT_EQ(aclnnPrewarmKernels(listPath_.c_str()), ACLNN_ERR_PARAM_INVALID);
+
+    WriteList("{\"ops\": []}");
+    EXPECT_EQ(aclnnPrewarmKernels(listPath_.c_str()), ACLNN_SUCCESS);
+    EXPECT_EQ(KernelPrewarmer::Instance().GetProgress().submitted, base_.submitted);
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "opdev/op_def.h"
+
+namespace op {
+namespace benchmark {
+
+// ============================================================================
+// OpTypeDict 多线程并发查询耗时
+// N 个读线程循环执行 ToOpType + ToStringRef, 同时一个写线程不断 Add 新的 op type,
+// 衡量的是读线程单次查询的平均耗时随线程数的变化
+// ============================================================================
+
+class OpTypeDictBenchmark : public testing::Test {
+protected:
+    static constexpr size_t kOpNum = 64U;
+    static constexpr size_t kLoop = 20000U;
+
+    void SetUp() override
+    {
+        for (size_t i = 0U; i < kOpNum; ++i) {
+            names_.emplace_back("OpTypeDictBenchOp" + std::to_string(i));
+            uint32_t id = 0U;
+            ASSERT_EQ(OpTypeDict::Add(id, names_.back().c_str()), ACLNN_SUCCESS);
+            ids_.push_back(id);
+        }
+    }
+
+    double RunReaders(size_t readerNum)
+    {
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> mismatch{0U};
+        std::thread writer([&stop, readerNum]() {
+            for (size_t i = 0U; !stop.load(std::memory_order_relaxed); ++i) {
+                uint32_t id = 0U;
+                std::string name = "OpTypeDictBenchNew" + std::to_string(readerNum) + "_" + std::to_string(i);
+                (void)OpTypeDict::Add(id, name.c_str());
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        });
+
+        std::vector<double> costs(readerNum, 0.0);
+        std::vector<std::thread> readers;
+        for (size_t t = 0U; t < readerNum; ++t) {
+            readers.emplace_back([this, t, &costs, &mismatch]() {
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0U; i < kLoop; ++i) {
+                    const size_t idx = (i + t) % kOpNum;
+                    uint32_t id = OpTypeDict::ToOpType(names_[idx]);
+                    if (id != ids_[idx] || OpTypeDict::ToStringRef(id).GetLength() != names_[idx].size()) {
+                        mismatch++;
+                    }
+                }
+                const auto end = std::chrono::steady_clock::now();
+                costs[t] = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(kLoop);
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        stop = true;
+        writer.join();
+        EXPECT_EQ(mismatch.load(), 0U);
+
+        double total = 0.0;
+        for (double cost : costs) {
+            total += cost;
+        }
+        return total / static_cast<double>(readerNum);
+    }
+
+    std::vector<std::string> names_;
+    std::vector<uint32_t> ids_;
+};
+
+TEST_F(OpTypeDictBenchmark, ConcurrentLookupCost)
+{
+    for (size_t readerNum : {1U, 2U, 4U, 8U}) {
+        double ns = RunReaders(readerNum);
+        printf("[OpTypeDictBenchmark] readers: %zu, ToOpType + ToStringRef: %.1f ns/lookup\n", readerNum, ns);
+        EXPECT_GT(ns, 0.0);
+    }
+}
+
+} // namespace benchmark
+} // namespace op
@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include "gtest/gtest.h"
+#include "file_utils.h"
+#include "opp_manifest.h"
+
+using namespace op::internal;
+
+class OppManifestTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        root_ = std::filesystem::canonical(std::filesystem::temp_directory_path()) / "opp_manifest_ut";
+        std::filesystem::remove_all(root_);
+        configDir_ = root_ / "config";
+        std::filesystem::create_directories(configDir_ / "ops_nn");
+        std::ofstream(configDir_ / "a.json") << "{}";
+        std::ofstream(configDir_ / "b.so") << "so";
+        manifestPath_ = (root_ / "opp.manifest").string();
+        OppManifest::Instance().Reset(manifestPath_);
+    }
+
+    void TearDown() override
+    {
+        OppManifest::Instance().Reset("");
+        std::filesystem::remove_all(root_);
+    }
+
+    // writes a manifest listing configDir_ with a single entry ghost.json, mtimeDelta shifts the recorded dir mtime
+    void WriteManifest(int64_t mtimeDelta) const
+    {
+        struct stat st;
+        ASSERT_EQ(stat(configDir_.c_str(), &st), 0);
+        std::ofstream ofs(manifestPath_);
+        ofs << "aclnn_opp_manifest 1\n";
+        ofs << "D " << (st.st_mtim.tv_sec + mtimeDelta) << " " << st.st_mtim.tv_nsec << " 1 " << configDir_.string()
+            << "\n";
+        ofs << "f 2 0 ghost.json\n";
+    }
+
+    std::vector<std::string> ListJson() const
+    {
+        std::vector<std::string> names;
+        EXPECT_EQ(ListFilesBySuffix(configDir_.string(), ".json", names), ACLNN_SUCCESS);
+        return names;
+    }
+
+    std::filesystem::path root_;
+    std::filesystem::path configDir_;
+    std::string manifestPath_;
+};
+
+TEST_F(OppManifestTest, ScanAndSave)
+{
+    std::vector<OppManifestEntry> entries;
+    ASSERT_TRUE(OppManifest::Instance().ListDir(configDir_.string(), entries));
+    EXPECT_EQ(entries.size(), 3U);
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+    EXPECT_FALSE(std::filesystem::exists(manifestPath_));
+
+    EXPECT_EQ(OppManifest::Instance().Save(), ACLNN_SUCCESS);
+    std::ifstream ifs(manifestPath_);
+    std::string header;
+    ASSERT_TRUE(std::getline(ifs, header));
+    EXPECT_EQ(header, "aclnn_opp_manifest 1");
+
+    // a fresh instance lists the same entries from the saved file
+    OppManifest::Instance().Reset(manifestPath_);
+    std::vector<OppManifestEntry> loaded;
+    ASSERT_TRUE(OppManifest::Instance().ListDir(configDir_.string(), loaded));
+    ASSERT_EQ(loaded.size(), entries.size());
+    for (size_t i = 0U; i < loaded.size(); i++) {
+        EXPECT_EQ(loaded[i].name, entries[i].name);
+        EXPECT_EQ(loaded[i].type, entries[i].type);
+        EXPECT_EQ(loaded[i].size, entries[i].size);
+    }
+    const auto dir = std::find_if(loaded.begin(), loaded.end(), [](const auto& e) { return e.name == "ops_nn"; });
+    ASSERT_NE(dir, loaded.end());
+    EXPECT_EQ(dir->type, OppEntryType::DIR);
+}
+
+TEST_F(OppManifestTest, ListFromManifestWithoutScan)
+{
+    WriteManifest(0);
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"ghost.json"});
+}
+
+TEST_F(OppManifestTest, RescanWhenDirMtimeChanged)
+{
+    WriteManifest(-1);
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+    EXPECT_EQ(OppManifest::Instance().Save(), ACLNN_SUCCESS);
+
+    OppManifest::Instance().Reset(manifestPath_);
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+}
+
+TEST_F(OppManifestTest, RescanWhenManifestBroken)
+{
+    {
+        std::ofstream ofs(manifestPath_);
+        ofs << "aclnn_opp_manifest 1\n";
+        ofs << "D 1 2 5 " << configDir_.string() << "\n";
+        ofs << "f 2 0 ghost.json\n";
+    }
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+
+    {
+        std::ofstream ofs(manifestPath_);
+        ofs << "aclnn_opp_manifest 0\n";
+    }
+    OppManifest::Instance().Reset(manifestPath_);
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+
+    // an entry that is a path rather than a name breaks the manifest
+    struct stat st;
+    ASSERT_EQ(stat(configDir_.c_str(), &st), 0);
+    for (const std::string name : {"../a.json", "sub/a.json", "..", "."}) {
+        {
+            std::ofstream ofs(manifestPath_);
+            ofs << "aclnn_opp_manifest 1\n";
+            ofs << "D " << st.st_mtim.tv_sec << " " << st.st_mtim.tv_nsec << " 1 " << configDir_.string() << "\n";
+            ofs << "f 2 0 " << name << "\n";
+        }
+        OppManifest::Instance().Reset(manifestPath_);
+        EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"}) << name;
+    }
+}
+
+TEST_F(OppManifestTest, ScanWhenDisabled)
+{
+    WriteManifest(0);
+    OppManifest::Instance().Reset("");
+    EXPECT_FALSE(OppManifest::Instance().IsEnabled());
+    EXPECT_EQ(ListJson(), std::vector<std::string>{"a.json"});
+    std::filesystem::remove(manifestPath_);
+    EXPECT_EQ(OppManifest::Instance().Save(), ACLNN_SUCCESS);
+    EXPECT_FALSE(std::filesystem::exists(manifestPath_));
+}
+
+TEST_F(OppManifestTest, InvalidDir)
+{
+    std::vector<std::string> names;
+    EXPECT_EQ(ListFilesBySuffix((root_ / "not_exist").string(), ".json", names), ACLNN_ERR_INNER);
+    EXPECT_TRUE(names.empty());
+}
+
+TEST_F(OppManifestTest, RealEntryPath)
+{
+    std::filesystem::create_symlink(configDir_ / "a.json", configDir_ / "link.json");
+    std::vector<std::string> names;
+    std::vector<OppEntryType> types;
+    ASSERT_EQ(ListFilesBySuffix(configDir_.string(), ".json", names, &types), ACLNN_SUCCESS);
+    ASSERT_EQ(names.size(), 2U);
+    for (size_t i = 0U; i < names.size(); i++) {
+        EXPECT_EQ(RealEntryPath(configDir_.string(), names[i], types[i]), (configDir_ / "a.json").string());
+    }
+    EXPECT_EQ(RealEntryPath(configDir_.string() + "/", "a.json", OppEntryType::FILE),
+              (configDir_ / "a.json").string());
+    EXPECT_EQ(RealEntryPath(configDir_.string(), "../config/a.json", OppEntryType::FILE), "");
+    EXPECT_EQ(RealEntryPath(configDir_.string(), "..", OppEntryType::OTHER), "");
+
+    std::vector<std::string> files;
+    op::GetFilesWithSuffix(configDir_.string(), ".so", files);
+    EXPECT_EQ(files, std::vector<std::string>{(configDir_ / "b.so").string()});
+}
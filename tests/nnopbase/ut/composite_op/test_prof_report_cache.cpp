@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "opdev/common_types.h"
+#include "op_dfx_internal.h"
+#include "prof_report_cache.h"
+#include "thread_local_context.h"
+
+using namespace op;
+using namespace op::internal;
+
+namespace op {
+namespace internal {
+int32_t ProfilingCallBack(uint32_t type, VOID_PTR data, uint32_t len);
+} // namespace internal
+} // namespace op
+
+namespace {
+class RecordingProfReporter : public ProfReporter {
+public:
+    void Report(const ProfReportRecord* records, size_t num) override
+    {
+        batchSizes.push_back(num);
+        records_.insert(records_.end(), records, records + num);
+    }
+
+    std::vector<size_t> batchSizes;
+    std::vector<ProfReportRecord> records_;
+};
+} // namespace
+
+class ProfReportCacheUt : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        FlushAllProfReport();
+        SetProfReporter(&reporter_);
+        ProfReportCache::SetEnable(true);
+        ProfReportCache::Invalidate();
+        ProfReportCache::ResetStats();
+    }
+
+    void TearDown() override
+    {
+        SetProfReporter(nullptr);
+        ProfReportCache::SetEnable(true);
+    }
+
+    RecordingProfReporter reporter_;
+};
+
+TEST_F(ProfReportCacheUt, BatchKeepsReportOrder)
+{
+    constexpr size_t recordNum = kProfReportBatchSize * 2U + 3U;
+    MsprofCompactInfo compactInfo;
+    memset(&compactInfo, 0, sizeof(compactInfo));
+    for (size_t i = 0U; i < recordNum; i++) {
+        compactInfo.timeStamp = i;
+        ProfReportCompactInfo(compactInfo);
+    }
+    ASSERT_EQ(reporter_.batchSizes.size(), 2U);
+    EXPECT_EQ(reporter_.batchSizes[0], kProfReportBatchSize);
+    FlushProfReport();
+    ASSERT_EQ(reporter_.records_.size(), recordNum);
+    for (size_t i = 0U; i < recordNum; i++) {
+        EXPECT_EQ(reporter_.records_[i].type, ProfReportType::COMPACT);
+        EXPECT_EQ(reporter_.records_[i].compactInfo.timeStamp, i);
+    }
+    EXPECT_EQ(ProfReportCache::GetStats().records, recordNum);
+}
+
+TEST_F(ProfReportCacheUt, FlushAllCollectsOtherThreads)
+{
+    std::thread worker([]() {
+        MsprofAdditionalInfo additionInfo;
+        memset(&additionInfo, 0, sizeof(additionInfo));
+        ProfReportAdditionalInfo(additionInfo);
+        ProfReportAdditionalInfo(additionInfo);
+        FlushAllProfReport();
+    });
+    worker.join();
+    EXPECT_EQ(reporter_.records_.size(), 2U);
+    EXPECT_EQ(reporter_.records_[0].type, ProfReportType::ADDITIONAL);
+}
+
+TEST_F(ProfReportCacheUt, ProfilingStopFlushesRecords)
+{
+    MsprofCompactInfo compactInfo;
+    memset(&compactInfo, 0, sizeof(compactInfo));
+    ProfReportCompactInfo(compactInfo);
+    EXPECT_TRUE(reporter_.records_.empty());
+
+    MsprofCommandHandle handleStop;
+    handleStop.type = PROF_COMMANDHANDLE_TYPE_STOP;
+    EXPECT_EQ(ProfilingCallBack(PROF_CTRL_SWITCH, &handleStop, sizeof(MsprofCommandHandle)), 0);
+    EXPECT_EQ(reporter_.records_.size(), 1U);
+}
+
+TEST_F(ProfReportCacheUt, TensorInfoReusedForSameShape)
+{
+    op::Shape shape{2, 3, 4};
+    aclTensor in1(shape, op::DataType::DT_FLOAT, ge::FORMAT_ND, nullptr);
+    aclTensor in2(shape, op::DataType::DT_FLOAT, ge::FORMAT_ND, nullptr);
+    aclTensor out(shape, op::DataType::DT_FLOAT, ge::FORMAT_ND, nullptr);
+    FVector<const aclTensor*> inTensors{&in1, &in2};
+    FVector<const aclTensor*> outTensors{&out};
+    TaskInfo taskInfo;
+    taskInfo.type = MSPROF_GE_TASK_TYPE_AI_CORE;
+    taskInfo.ration = 0U;
+    constexpr uint64_t summaryId = 1234U;
+
+    GetThreadLocalContext().kernelLauncherStartTime_ = 100U;
+    ReportAdditionInfo(inTensors, outTensors, taskInfo, summaryId);
+    GetThreadLocalContext().kernelLauncherStartTime_ = 200U;
+    ReportAdditionInfo(inTensors, outTensors, taskInfo, summaryId);
+    FlushProfReport();
+
+    auto stats = ProfReportCache::GetStats();
+    EXPECT_EQ(stats.tensorInfoMisses, 1U);
+    EXPECT_EQ(stats.tensorInfoHits, 1U);
+    // basic info and one tensor info record per launch
+    ASSERT_EQ(reporter_.records_.size(), 4U);
+    const auto& first = reporter_.records_[1].additionInfo;
+    const auto& second = reporter_.records_[3].additionInfo;
+    EXPECT_EQ(first.timeStamp, 100U);
+    EXPECT_EQ(second.timeStamp, 200U);
+    EXPECT_EQ(memcmp(first.data, second.data, sizeof(first.data)), 0);
+
+    op::Shape otherShape{2, 3, 5};
+    aclTensor other(otherShape, op::DataType::DT_FLOAT, ge::FORMAT_ND, nullptr);
+    FVector<const aclTensor*> otherTensors{&other, &in2};
+    ReportAdditionInfo(otherTensors, outTensors, taskInfo, summaryId);
+    FlushProfReport();
+    stats = ProfReportCache::GetStats();
+    EXPECT_EQ(stats.tensorInfoMisses, 2U);
+    EXPECT_NE(memcmp(reporter_.records_[5].additionInfo.data, first.data, sizeof(first.data)), 0);
+}
+
+TEST_F(ProfReportCacheUt, AttrSignatureFollowsValues)
+{
+    int64_t intValues[] = {3, 4, 5};
+    aclIntArray* intArr = aclCreateIntArray(intValues, sizeof(intValues) / sizeof(intValues[0]));
+    std::string signature;
+    std::string sameSignature;
+    std::string otherSignature;
+    {
+        OpArg args[2];
+        args[0].type = OpArgType::OPARG_INT_LIST;
+        args[0]->pointer = intArr;
+        args[1].type = OpArgType::OPARG_FLOAT;
+        args[1]->value = 0U;
+        args[1]->fvalue = 1.5f;
+        OpArgList attrs(args, 2U);
+        EXPECT_TRUE(AppendAttrSignature(attrs, signature));
+        EXPECT_TRUE(AppendAttrSignature(attrs, sameSignature));
+        args[1]->fvalue = 2.5f;
+        EXPECT_TRUE(AppendAttrSignature(attrs, otherSignature));
+    }
+    EXPECT_EQ(signature, sameSignature);
+    EXPECT_NE(signature, otherSignature);
+
+    ProfReportCache& cache = ProfReportCache::Instance();
+    uint64_t attrId = 0U;
+    EXPECT_FALSE(cache.FindAttrId(signature, attrId));
+    cache.AddAttrId(signature, 42U);
+    EXPECT_TRUE(cache.FindAttrId(signature, attrId));
+    EXPECT_EQ(attrId, 42U);
+    ProfReportCache::Invalidate();
+    EXPECT_FALSE(ProfReportCache::Instance().FindAttrId(signature, attrId));
+    aclDestroyIntArray(intArr);
+}
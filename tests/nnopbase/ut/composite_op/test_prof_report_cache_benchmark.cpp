@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "opdev/common_types.h"
+#include "op_dfx_internal.h"
+#include "prof_report_cache.h"
+#include "thread_local_context.h"
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// 带缓存/不带缓存的 profiling 上报单次 launch 耗时对比
+// 按 OpKernelBin 的 launch 流程上报 kernel launcher id、basic/tensor info 和 attr info,
+// reporter 替换为只计数的桩, 衡量的是调用线程上组装上报数据的开销
+// ============================================================================
+
+class CountingProfReporter : public ProfReporter {
+public:
+    void Report([[maybe_unused]] const ProfReportRecord* records, size_t num) override { reported += num; }
+
+    size_t reported{0U};
+};
+
+class ProfReportCacheBenchmark : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        FlushAllProfReport();
+        SetProfReporter(&reporter_);
+        ProfReportCache::Invalidate();
+        ProfReportCache::ResetStats();
+    }
+
+    void TearDown() override
+    {
+        SetProfReporter(nullptr);
+        ProfReportCache::SetEnable(true);
+    }
+
+    // same steps as OpKernelBin::GenAttrHashId
+    static uint64_t GenAttrHashId(OpArgList& attrs, OpArgList& inputs, std::vector<AttrInfo>& attrInfos)
+    {
+        std::string* signature = nullptr;
+        if (ProfReportCache::IsEnabled()) {
+            ProfReportCache& cache = ProfReportCache::Instance();
+            signature = &cache.Signature();
+            signature->clear();
+            uint64_t attrId = 0U;
+            if (!AppendAttrSignature(attrs, *signature) || !AppendHostInputSignature(inputs, *signature)) {
+                signature = nullptr;
+            } else if (cache.FindAttrId(*signature, attrId)) {
+                return attrId;
+            }
+        }
+        std::string attrStr;
+        ReportAttrInfo(attrs, attrStr, attrInfos);
+        inputs.VisitByNoReturn([&attrStr](size_t idx, OpArg& elem) { SummaryAttrArg(idx, elem, attrStr); });
+        attrStr += "IsStaticKernel:false";
+        const uint64_t attrId = MsprofGetHashId(attrStr.c_str(), attrStr.size());
+        if (signature != nullptr) {
+            ProfReportCache::Instance().AddAttrId(*signature, attrId);
+        }
+        return attrId;
+    }
+
+    double RunLaunchLoop(size_t loop)
+    {
+        op::Shape shape{16, 32, 64, 128};
+        aclTensor x1(shape, op::DataType::DT_FLOAT16, ge::FORMAT_ND, nullptr);
+        aclTensor x2(shape, op::DataType::DT_FLOAT16, ge::FORMAT_ND, nullptr);
+        aclTensor y(shape, op::DataType::DT_FLOAT16, ge::FORMAT_ND, nullptr);
+        FVector<const aclTensor*> inTensors{&x1, &x2};
+        FVector<const aclTensor*> outTensors{&y};
+        OpArg inputArgs[2];
+        inputArgs[0].type = OpArgType::OPARG_ACLTENSOR;
+        inputArgs[0]->pointer = &x1;
+        inputArgs[1].type = OpArgType::OPARG_ACLTENSOR;
+        inputArgs[1]->pointer = &x2;
+        OpArgList inputs(inputArgs, 2U);
+
+        int64_t axes[] = {0, 2, 3};
+        aclIntArray* axesArr = aclCreateIntArray(axes, sizeof(axes) / sizeof(axes[0]));
+        char mode[] = "high_precision";
+        OpArg attrArgs[4];
+        attrArgs[0].type = OpArgType::OPARG_INT_LIST;
+        attrArgs[0]->pointer = axesArr;
+        attrArgs[1].type = OpArgType::OPARG_FLOAT;
+        attrArgs[1]->value = 0U;
+        attrArgs[1]->fvalue = 0.125f;
+        attrArgs[2].type = OpArgType::OPARG_BOOL;
+        attrArgs[2]->value = 1U;
+        attrArgs[3].type = OpArgType::OPARG_STRING;
+        attrArgs[3]->pointer = mode;
+        OpArgList attrs(attrArgs, 4U);
+        std::vector<AttrInfo> attrInfos(4U);
+        attrInfos[0].attrName = "axes";
+        attrInfos[1].attrName = "epsilon";
+        attrInfos[2].attrName = "keep_dims";
+        attrInfos[3].attrName = "mode";
+
+        TaskInfo taskInfo;
+        taskInfo.type = MSPROF_GE_TASK_TYPE_AI_CORE;
+        taskInfo.ration = 0U;
+        constexpr uint64_t summaryId = 4321U;
+        constexpr uint32_t opType = 1U;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0U; i < loop; ++i) {
+            GetThreadLocalContext().kernelLauncherStartTime_ = i;
+            GetThreadLocalContext().profilingInfoId_.kernelLauncherId_ =
+                ProfReportCache::Instance().GetKernelLauncherId(opType);
+            ReportAdditionInfo(inTensors, outTensors, taskInfo, summaryId);
+            ReportAttrInfo(GenAttrHashId(attrs, inputs, attrInfos), summaryId);
+        }
+        FlushProfReport();
+        const auto end = std::chrono::steady_clock::now();
+        aclDestroyIntArray(axesArr);
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(loop);
+    }
+
+    CountingProfReporter reporter_;
+};
+
+TEST_F(ProfReportCacheBenchmark, UncachedVsCachedCostPerLaunch)
+{
+    constexpr size_t loop = 4096U;
+    constexpr size_t round = 8U;
+
+    double uncachedNs = 0.0;
+    ProfReportCache::SetEnable(false);
+    for (size_t i = 0U; i < round; ++i) {
+        uncachedNs += RunLaunchLoop(loop);
+    }
+    const size_t uncachedReported = reporter_.reported;
+
+    double cachedNs = 0.0;
+    ProfReportCache::SetEnable(true);
+    for (size_t i = 0U; i < round; ++i) {
+        cachedNs += RunLaunchLoop(loop);
+    }
+
+    uncachedNs /= static_cast<double>(round);
+    cachedNs /= static_cast<double>(round);
+    const auto stats = ProfReportCache::GetStats();
+    printf("[ProfReportCacheBenchmark] uncached: %.1f ns/launch, cached: %.1f ns/launch, batches: %lu\n", uncachedNs,
+           cachedNs, stats.batches);
+    // both modes report the same records
+    EXPECT_EQ(reporter_.reported, uncachedReported * 2U);
+    EXPECT_EQ(stats.tensorInfoMisses, 1U);
+    EXPECT_EQ(stats.attrIdMisses, 1U);
+    EXPECT_GT(uncachedNs, 0.0);
+    EXPECT_GT(cachedNs, 0.0);
+}
+
+} // namespace benchmark
+} // namespace op
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "depends/acl/aclrt_stub.h"
+#include "opdev/aicpu/aicpu_ext_info_handle.h"
+#include "opdev/common_types.h"
+#include "shape_future.h"
+
+using namespace op::internal;
+
+namespace {
+// 事件只有在测试显式完成或被同步时才算完成, 用于模拟乱序完成
+class OutOfOrderEventStub : public AclrtStub {
+public:
+    aclError aclrtSynchronizeEvent(aclrtEvent event) override
+    {
+        synced_.push_back(event);
+        completed_.insert(event);
+        return ACL_SUCCESS;
+    }
+
+    aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus* status) override
+    {
+        *status = completed_.count(event) > 0U ? ACL_EVENT_RECORDED_STATUS_COMPLETE :
+                                                 ACL_EVENT_RECORDED_STATUS_NOT_READY;
+        return ACL_SUCCESS;
+    }
+
+    void Complete(aclrtEvent event) { completed_.insert(event); }
+
+    std::set<aclrtEvent> completed_;
+    std::vector<aclrtEvent> synced_;
+};
+} // namespace
+
+class ShapeFutureUt : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        AclrtStub::GetInstance()->Install(&stub_);
+        for (size_t i = 0U; i < kLaunchNum; i++) {
+            tensors_.emplace_back(std::make_unique<aclTensor>(op::Shape{1}, op::DataType::DT_FLOAT,
+                                                              op::Format::FORMAT_ND, nullptr));
+        }
+    }
+
+    void TearDown() override
+    {
+        (void)ShapeFutureRegistry::Instance().ResolveAll();
+        tensors_.clear();
+        AclrtStub::GetInstance()->UnInstall();
+    }
+
+    std::shared_ptr<ShapeFuture> Launch(size_t index, int64_t dim)
+    {
+        aclrtEvent event = nullptr;
+        EXPECT_EQ(aclrtCreateEventExWithFlag(&event, ACL_EVENT_SYNC), ACL_SUCCESS);
+        events_.push_back(event);
+        auto future = std::make_shared<ShapeFuture>(
+            event, std::vector<aclTensor*>{tensors_[index].get()},
+            [this, dim](const std::vector<aclTensor*>& targets) {
+                for (auto tensor : targets) {
+                    if (tensor != nullptr) {
+                        tensor->SetViewShape(op::Shape{dim, 2});
+                    }
+                }
+                resolved_.push_back(dim);
+                return ACLNN_SUCCESS;
+            });
+        EXPECT_EQ(ShapeFutureRegistry::Instance().Attach(future), ACLNN_SUCCESS);
+        return future;
+    }
+
+    static constexpr size_t kLaunchNum = 3U;
+    OutOfOrderEventStub stub_;
+    std::vector<std::unique_ptr<aclTensor>> tensors_;
+    std::vector<aclrtEvent> events_;
+    std::vector<int64_t> resolved_;
+};
+
+TEST_F(ShapeFutureUt, ResolveOnlyOnHostQuery)
+{
+    auto first = Launch(0U, 10);
+    auto second = Launch(1U, 20);
+    auto third = Launch(2U, 30);
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), kLaunchNum);
+
+    // 设备地址不依赖 shape, 不触发同步
+    EXPECT_EQ(tensors_[1]->GetData(), nullptr);
+    EXPECT_TRUE(stub_.synced_.empty());
+
+    // 第三个先完成, 第一个最后完成; 只查询第二个
+    stub_.Complete(events_[2U]);
+    EXPECT_EQ(tensors_[1]->GetViewShape(), op::Shape({20, 2}));
+    ASSERT_EQ(stub_.synced_.size(), 1U);
+    EXPECT_EQ(stub_.synced_[0U], events_[1U]);
+    EXPECT_TRUE(second->IsResolved());
+    EXPECT_FALSE(first->IsResolved());
+    EXPECT_FALSE(third->IsResolved());
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 2U);
+
+    // 非阻塞收割只处理已完成的事件
+    EXPECT_TRUE(third->IsReady());
+    EXPECT_FALSE(first->IsReady());
+    EXPECT_EQ(ShapeFutureRegistry::Instance().ResolveReady(), 1U);
+    EXPECT_TRUE(third->IsResolved());
+    EXPECT_FALSE(first->IsResolved());
+    EXPECT_EQ(tensors_[2]->GetViewShape(), op::Shape({30, 2}));
+
+    int64_t* dims = nullptr;
+    uint64_t dimNum = 0U;
+    ASSERT_EQ(aclGetViewShape(tensors_[0].get(), &dims, &dimNum), ACLNN_SUCCESS);
+    ASSERT_EQ(dimNum, 2U);
+    EXPECT_EQ(dims[0], 10);
+    delete[] dims;
+    EXPECT_EQ(resolved_, std::vector<int64_t>({20, 30, 10}));
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 0U);
+}
+
+TEST_F(ShapeFutureUt, ReattachResolvesPreviousFuture)
+{
+    auto first = Launch(0U, 10);
+    auto second = Launch(0U, 11);
+    EXPECT_TRUE(first->IsResolved());
+    EXPECT_FALSE(second->IsResolved());
+    EXPECT_EQ(tensors_[0]->GetViewShape(), op::Shape({11, 2}));
+    EXPECT_EQ(resolved_, std::vector<int64_t>({10, 11}));
+}
+
+TEST_F(ShapeFutureUt, DestroyedTensorIsSkipped)
+{
+    auto first = Launch(0U, 10);
+    tensors_[0].reset();
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 0U);
+    EXPECT_EQ(first->Wait(), ACLNN_SUCCESS);
+    EXPECT_EQ(resolved_, std::vector<int64_t>({10}));
+}
+
+TEST_F(ShapeFutureUt, SetShapeAfterDefer)
+{
+    // 显式设置的 shape 不会被之后完成的延迟更新覆盖
+    auto first = Launch(0U, 10);
+    auto second = Launch(1U, 20);
+    auto third = Launch(2U, 30);
+    tensors_[0]->SetViewShape(op::Shape{7});
+    tensors_[1]->SetStorageShape(op::Shape{8});
+    tensors_[2]->SetOriginalShape(op::Shape{9});
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 0U);
+    EXPECT_TRUE(stub_.synced_.empty());
+
+    EXPECT_EQ(ShapeFutureRegistry::Instance().ResolveAll(), ACLNN_SUCCESS);
+    EXPECT_EQ(first->Wait(), ACLNN_SUCCESS);
+    EXPECT_EQ(second->Wait(), ACLNN_SUCCESS);
+    EXPECT_EQ(third->Wait(), ACLNN_SUCCESS);
+    EXPECT_EQ(resolved_, std::vector<int64_t>({10, 20, 30}));
+    EXPECT_EQ(tensors_[0]->GetViewShape(), op::Shape({7}));
+    EXPECT_EQ(tensors_[1]->GetStorageShape(), op::Shape({8}));
+    EXPECT_EQ(tensors_[1]->GetViewShape(), op::Shape({1}));
+    EXPECT_EQ(tensors_[2]->GetOriginalShape(), op::Shape({9}));
+    EXPECT_EQ(tensors_[2]->GetViewShape(), op::Shape({1}));
+
+    // 其余查询接口同样先解析
+    auto fourth = Launch(0U, 0);
+    EXPECT_TRUE(tensors_[0]->IsEmpty());
+    EXPECT_TRUE(fourth->IsResolved());
+    auto fifth = Launch(0U, 40);
+    EXPECT_EQ(tensors_[0]->GetViewStrides().size(), 2U);
+    EXPECT_TRUE(fifth->IsResolved());
+    auto sixth = Launch(0U, 50);
+    EXPECT_NE(std::string(tensors_[0]->ToString().GetString()).find("50"), std::string::npos);
+    EXPECT_TRUE(sixth->IsResolved());
+}
+
+TEST_F(ShapeFutureUt, AicpuDeferOutputShape)
+{
+    op::FVector<const aclTensor*> inputs = {tensors_[0].get()};
+    op::FVector<aclTensor*> outputs = {tensors_[1].get(), tensors_[2].get()};
+    AicpuExtInfoHandler handler("DeferredShapeOp", 1, 2, ge::DEPEND_SHAPE_RANGE);
+    std::string extInfo;
+    ASSERT_EQ(handler.GenCCExtBuffer(inputs, outputs, extInfo), ACLNN_SUCCESS);
+    std::vector<uint8_t> hostExtInfo(extInfo.size());
+    ASSERT_EQ(handler.Parse(extInfo, hostExtInfo.data()), ACLNN_SUCCESS);
+    std::vector<uint8_t> deviceExtInfo(extInfo.size());
+    handler.deviceExtInfo_ = deviceExtInfo.data();
+
+    ASSERT_EQ(handler.DeferOutputShapeFromExtInfo(outputs, nullptr), ACLNN_SUCCESS);
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 2U);
+    EXPECT_TRUE(stub_.synced_.empty());
+
+    // 两个输出共用一次同步
+    (void)tensors_[2]->GetStorageShape();
+    (void)tensors_[1]->GetViewShape();
+    EXPECT_EQ(stub_.synced_.size(), 1U);
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 0U);
+
+    // 再次下发前若上一次未解析, 先解析上一次
+    ASSERT_EQ(handler.DeferOutputShapeFromExtInfo(outputs, nullptr), ACLNN_SUCCESS);
+    ASSERT_EQ(handler.DeferOutputShapeFromExtInfo(outputs, nullptr), ACLNN_SUCCESS);
+    EXPECT_EQ(stub_.synced_.size(), 2U);
+    EXPECT_EQ(ShapeFutureRegistry::Instance().PendingNum(), 2U);
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <vector>
+
+#include "side_task_fusion.h"
+
+using namespace op;
+using namespace op::internal;
+
+namespace {
+constexpr uintptr_t kBase = 0x10000U;
+constexpr uintptr_t kBlock = 0x1000U;
+
+DevMemRange Block(size_t idx) { return DevMemRange{kBase + idx * kBlock, kBase + (idx + 1U) * kBlock}; }
+
+// launch reading block in, writing block out and zeroing it before the launch
+SideTaskLaunchInfo AtomicLaunch(size_t in, size_t out)
+{
+    SideTaskLaunchInfo info;
+    info.visible = true;
+    info.memSetFusible = true;
+    info.reads.push_back(Block(in));
+    info.writes.push_back(Block(out));
+    info.memSetRanges.push_back(Block(out));
+    return info;
+}
+
+class OpaqueKernelLauncher : public KernelLauncher {
+public:
+    OpaqueKernelLauncher() : KernelLauncher(0, op::AI_CORE, nullptr, ProfilingInfoId()) {}
+    aclnnStatus Launch() override { return ACLNN_SUCCESS; }
+    OpKernelBin* GetBin() override { return nullptr; }
+    bool CheckRepeatable(const std::unordered_map<const aclStorage*, const aclStorage*>&,
+                         const std::vector<const aclStorage*>&) override
+    {
+        return false;
+    }
+};
+} // namespace
+
+class SideTaskFusionUt : public testing::Test {};
+
+TEST_F(SideTaskFusionUt, HoistDisjointMemSets)
+{
+    std::vector<SideTaskLaunchInfo> infos{AtomicLaunch(0, 1), AtomicLaunch(1, 2), AtomicLaunch(2, 3)};
+    std::vector<bool> memSetFused;
+    std::vector<bool> checkDeferred;
+    PlanSideTaskFusion(infos, false, memSetFused, checkDeferred);
+    EXPECT_EQ(memSetFused, std::vector<bool>({true, true, true}));
+    EXPECT_EQ(checkDeferred, std::vector<bool>({false, false, false}));
+}
+
+TEST_F(SideTaskFusionUt, KeepMemSetOfRegionTouchedEarlier)
+{
+    // launch 2 zeroes block 1, which launch 0 writes and launch 1 reads
+    std::vector<SideTaskLaunchInfo> infos{AtomicLaunch(0, 1), AtomicLaunch(1, 2), AtomicLaunch(3, 1),
+                                          AtomicLaunch(4, 5)};
+    std::vector<bool> memSetFused;
+    std::vector<bool> checkDeferred;
+    PlanSideTaskFusion(infos, false, memSetFused, checkDeferred);
+    EXPECT_EQ(memSetFused, std::vector<bool>({true, true, false, true}));
+
+    // reused workspace counts as touched as well
+    infos[1].scratch.push_back(Block(5));
+    PlanSideTaskFusion(infos, false, memSetFused, checkDeferred);
+    EXPECT_EQ(memSetFused, std::vector<bool>({true, true, false, false}));
+}
+
+TEST_F(SideTaskFusionUt, NothingFusedAcrossInvisibleLaunch)
+{
+    std::vector<SideTaskLaunchInfo> infos{AtomicLaunch(0, 1), SideTaskLaunchInfo(), AtomicLaunch(2, 3),
+                                          AtomicLaunch(3, 4)};
+    std::vector<bool> memSetFused;
+    std::vector<bool> checkDeferred;
+    PlanSideTaskFusion(infos, true, memSetFused, checkDeferred);
+    // a single hoisted memset saves no launch
+    EXPECT_EQ(memSetFused, std::vector<bool>({false, false, false, false}));
+    EXPECT_EQ(checkDeferred, std::vector<bool>({false, false, true, true}));
+}
+
+TEST_F(SideTaskFusionUt, KeepCheckOfTensorWrittenLater)
+{
+    std::vector<SideTaskLaunchInfo> infos{AtomicLaunch(0, 1), AtomicLaunch(1, 2), AtomicLaunch(2, 3)};
+    // launch 2 reuses the input of launch 0 as workspace, the dump of launch 0 must run before launch 2
+    infos[2].scratch.push_back(Block(0));
+    std::vector<bool> memSetFused;
+    std::vector<bool> checkDeferred;
+    PlanSideTaskFusion(infos, true, memSetFused, checkDeferred);
+    EXPECT_EQ(checkDeferred, std::vector<bool>({false, true, true}));
+
+    // launch 2 overwrites the output of launch 1 as well, a single deferred check saves nothing
+    infos[2].writes.push_back(Block(2));
+    PlanSideTaskFusion(infos, true, memSetFused, checkDeferred);
+    EXPECT_EQ(checkDeferred, std::vector<bool>({false, false, false}));
+}
+
+TEST_F(SideTaskFusionUt, OpaqueLaunchersKeepSideTasks)
+{
+    OpaqueKernelLauncher launcher1;
+    OpaqueKernelLauncher launcher2;
+    std::vector<KernelLauncher*> launchers{&launcher1, &launcher2};
+    SideTaskFusion fusion(nullptr, nullptr);
+    fusion.Prepare(launchers);
+    fusion.LaunchFusedMemSet();
+    fusion.RunDeferredCheck();
+    EXPECT_FALSE(fusion.IsMemSetFused(0));
+    EXPECT_FALSE(fusion.IsCheckDeferred(1));
+    EXPECT_FALSE(fusion.IsMemSetFused(2));
+}
+
+TEST_F(SideTaskFusionUt, DisabledFusionKeepsSideTasks)
+{
+    EXPECT_TRUE(SideTaskFusion::IsEnabled());
+    SideTaskFusion::SetEnable(false);
+    std::vector<KernelLauncher*> launchers;
+    SideTaskFusion fusion(nullptr, nullptr);
+    fusion.Prepare(launchers);
+    EXPECT_FALSE(fusion.IsMemSetFused(0));
+    SideTaskFusion::SetEnable(true);
+}
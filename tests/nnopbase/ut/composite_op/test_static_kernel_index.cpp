@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <nlohmann/json.hpp>
+
+#include "static_kernel_index.h"
+#include "executor/indv_executor.h"
+
+using namespace op::internal;
+
+namespace {
+constexpr const char* kIndexFile = "static_kernel_index.bin";
+
+StaticKernelIndexBuildEntry MakeEntry(const std::string& opType, const std::string& key, const std::string& binPath)
+{
+    StaticKernelIndexBuildEntry entry;
+    entry.opType = opType;
+    entry.staticKey.assign(key.begin(), key.end());
+    entry.binPath = binPath;
+    return entry;
+}
+
+int64_t FindKey(const StaticKernelIndex& index, const StaticKernelIndexOp& op, const std::string& key,
+                uint32_t aicNum = 24U, uint32_t aivNum = 48U, int8_t deterministicLevel = 0)
+{
+    return index.Find(op, reinterpret_cast<const uint8_t*>(key.data()), key.size(), aicNum, aivNum,
+                      deterministicLevel);
+}
+} // namespace
+
+class StaticKernelIndexUt : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        char dir[] = "/tmp/static_kernel_index_XXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_ = dir;
+        dir_ += "/";
+
+        StaticKernelIndexBuildOp add;
+        add.opType = "Add";
+        add.valueDependIndex = {1, 2};
+        ops_.push_back(add);
+        entries_.push_back(MakeEntry("Mul", "Mul/key0", "mul/mul_0.o"));
+        entries_.push_back(MakeEntry("Add", "Add/key0", "add/add_0.o"));
+        auto withPlatform = MakeEntry("Add", "Add/key1", "add/add_24.o");
+        withPlatform.hasPlatformInfo = true;
+        withPlatform.aicNum = 24U;
+        withPlatform.aivNum = 48U;
+        withPlatform.deterministicLevel = 1;
+        entries_.push_back(withPlatform);
+        entries_.push_back(MakeEntry("Add", "Add/key1", "add/add_any.o"));
+    }
+
+    void TearDown() override
+    {
+        (void)remove((dir_ + kIndexFile).c_str());
+        (void)remove((dir_ + "add/add_0.json").c_str());
+        (void)rmdir((dir_ + "add").c_str());
+        (void)rmdir(dir_.c_str());
+    }
+
+    std::string dir_;
+    std::vector<StaticKernelIndexBuildOp> ops_;
+    std::vector<StaticKernelIndexBuildEntry> entries_;
+    StaticKernelIndexSource source_{0x123456789ULL};
+};
+
+TEST_F(StaticKernelIndexUt, BuildSaveAndLoad)
+{
+    auto index = StaticKernelIndex::Build(ops_, entries_, source_);
+    ASSERT_NE(index, nullptr);
+    EXPECT_FALSE(index->IsMapped());
+    EXPECT_EQ(index->GetEntryNum(), entries_.size());
+
+    const std::string path = dir_ + kIndexFile;
+    ASSERT_EQ(index->Save(path), ACLNN_SUCCESS);
+    auto loaded = StaticKernelIndex::Load(path, source_);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->IsMapped());
+    EXPECT_EQ(loaded->GetImageSize(), index->GetImageSize());
+
+    // 按算子名二分查找, 未配置 valueDependIndex 的算子也可查到
+    EXPECT_EQ(loaded->FindOp("Sub"), nullptr);
+    const auto mulOp = loaded->FindOp("Mul");
+    ASSERT_NE(mulOp, nullptr);
+    const auto addOp = loaded->FindOp("Add");
+    ASSERT_NE(addOp, nullptr);
+    op::FVector<int64_t> valueDependIndex;
+    loaded->GetValueDependIndex(*addOp, valueDependIndex);
+    EXPECT_EQ(valueDependIndex.size(), 2U);
+    EXPECT_EQ(valueDependIndex[1], 2);
+    loaded->GetValueDependIndex(*mulOp, valueDependIndex);
+    EXPECT_TRUE(valueDependIndex.empty());
+
+    auto entry = FindKey(*loaded, *addOp, "Add/key0");
+    ASSERT_NE(entry, kStaticKernelIndexNotFound);
+    EXPECT_STREQ(loaded->GetBinPath(entry), "add/add_0.o");
+    // key 只在本算子范围内查找
+    EXPECT_EQ(FindKey(*loaded, *addOp, "Mul/key0"), kStaticKernelIndexNotFound);
+    EXPECT_EQ(FindKey(*loaded, *addOp, "Add/key"), kStaticKernelIndexNotFound);
+}
+
+TEST_F(StaticKernelIndexUt, MatchPlatformInConfigOrder)
+{
+    auto index = StaticKernelIndex::Build(ops_, entries_, source_);
+    ASSERT_NE(index, nullptr);
+    const auto addOp = index->FindOp("Add");
+    ASSERT_NE(addOp, nullptr);
+
+    // 相同 key 按配置顺序优先, 与 bin collector 一致
+    auto entry = FindKey(*index, *addOp, "Add/key1", 24U, 48U, 1);
+    EXPECT_STREQ(index->GetBinPath(entry), "add/add_24.o");
+    // 核数或确定性不匹配时跳过带平台信息的 kernel
+    entry = FindKey(*index, *addOp, "Add/key1", 20U, 40U, 1);
+    EXPECT_STREQ(index->GetBinPath(entry), "add/add_any.o");
+    entry = FindKey(*index, *addOp, "Add/key1", 24U, 48U, 0);
+    EXPECT_STREQ(index->GetBinPath(entry), "add/add_any.o");
+    EXPECT_EQ(index->GetBinPath(index->GetEntryNum()), nullptr);
+}
+
+TEST_F(StaticKernelIndexUt, RejectStaleOrCorruptedFile)
+{
+    auto index = StaticKernelIndex::Build(ops_, entries_, source_);
+    ASSERT_NE(index, nullptr);
+    const std::string path = dir_ + kIndexFile;
+    EXPECT_EQ(StaticKernelIndex::Load(path, source_), nullptr);
+    ASSERT_EQ(index->Save(path), ACLNN_SUCCESS);
+
+    StaticKernelIndexSource modified = source_;
+    modified.digest++;
+    EXPECT_EQ(StaticKernelIndex::Load(path, modified), nullptr);
+
+    // 截断的文件
+    ASSERT_EQ(truncate(path.c_str(), static_cast<off_t>(index->GetImageSize() - 1U)), 0);
+    EXPECT_EQ(StaticKernelIndex::Load(path, source_), nullptr);
+
+    // 魔数被改写
+    ASSERT_EQ(index->Save(path), ACLNN_SUCCESS);
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(0);
+        f.put('X');
+    }
+    EXPECT_EQ(StaticKernelIndex::Load(path, source_), nullptr);
+}
+
+TEST_F(StaticKernelIndexUt, BuildFromStaticConfig)
+{
+    const nlohmann::json config = nlohmann::json::parse(R"json({
+        "Add": {
+            "valueDependIndex": [1],
+            "staticList": [
+                {
+                    "binDesc": {"blockDim": 16, "kernelName": "Add_0"},
+                    "coreType": 1,
+                    "binPath": "add/add_0.o",
+                    "simplifiedKey": "Add/d=0,p=1/0,2,(5)/0,2,(5)"
+                },
+                {
+                    "binDesc": {"blockDim": 16, "kernelName": "Add_1"},
+                    "binPath": "add/add_1.o",
+                    "simplifiedKey": "Add/d=0,p=1/0,2,(6)/0,2,(6)"
+                },
+                {
+                    "binDesc": {"blockDim": 16, "kernelName": "Add_2", "workspace": [100]},
+                    "coreType": 0,
+                    "binPath": "add/add_2.o",
+                    "simplifiedKey": ["Add/d=0,p=1/0,2,(7)/0,2,(7)", "Add/d=0,p=1/0,2,(8)/_"]
+                }
+            ]
+        },
+        "Mul": {"dynamicRankSupport": true}
+    })json");
+    ASSERT_EQ(mkdir((dir_ + "add").c_str(), S_IRWXU), 0);
+    {
+        std::ofstream f(dir_ + "add/add_0.json");
+        f << R"({"platformInfo": {"cubeCoreCnt": 24, "vectorCoreCnt": 48, "deterministicLevel": 1}})";
+    }
+
+    auto index = BuildStaticKernelIndex(config, dir_, source_);
+    ASSERT_NE(index, nullptr);
+    // 缺少 coreType 的 kernel 不会被 bin collector 收集, 同样不进索引
+    EXPECT_EQ(index->GetEntryNum(), 3U);
+    EXPECT_NE(index->FindOp("Mul"), nullptr);
+    const auto addOp = index->FindOp("Add");
+    ASSERT_NE(addOp, nullptr);
+    op::FVector<int64_t> valueDependIndex;
+    index->GetValueDependIndex(*addOp, valueDependIndex);
+    ASSERT_EQ(valueDependIndex.size(), 1U);
+    EXPECT_EQ(valueDependIndex[0], 1);
+
+    auto findSimplifiedKey = [&index, &addOp](const std::string& key, uint32_t aicNum, int8_t deterministicLevel) {
+        std::vector<NnopbaseUChar> binKey(key.size() * 4U, 0U);
+        uint32_t keySize = 0U;
+        EXPECT_EQ(NnopbaseCollectorConvertStaticVerbKey(key.c_str(), binKey.data(), &keySize), OK);
+        return index->Find(*addOp, binKey.data(), keySize, aicNum, 48U, deterministicLevel);
+    };
+    auto entry = findSimplifiedKey("Add/d=0,p=1/0,2,(5)/0,2,(5)", 24U, 1);
+    EXPECT_STREQ(index->GetBinPath(entry), "add/add_0.o");
+    EXPECT_EQ(findSimplifiedKey("Add/d=0,p=1/0,2,(5)/0,2,(5)", 20U, 1), kStaticKernelIndexNotFound);
+    EXPECT_EQ(findSimplifiedKey("Add/d=0,p=1/0,2,(6)/0,2,(6)", 24U, 1), kStaticKernelIndexNotFound);
+    // add_2 没有 json, 沿用上一个 kernel 的平台信息
+    entry = findSimplifiedKey("Add/d=0,p=1/0,2,(8)/_", 24U, 1);
+    EXPECT_STREQ(index->GetBinPath(entry), "add/add_2.o");
+    EXPECT_EQ(findSimplifiedKey("Add/d=0,p=1/0,2,(7)/0,2,(7)", 24U, 0), kStaticKernelIndexNotFound);
+}
+
+TEST_F(StaticKernelIndexUt, SourceDigestFollowsContent)
+{
+    const std::string config = R"({"Add": {"staticList": []}})";
+    const auto source = StaticKernelIndex::GetSource(config, dir_);
+    EXPECT_EQ(StaticKernelIndex::GetSource(config, dir_).digest, source.digest);
+    // 内容或 kernel 目录变化时索引失效, 与文件的 size/mtime 无关
+    EXPECT_NE(StaticKernelIndex::GetSource(R"({"Add": {"staticList": [1]}})", dir_).digest, source.digest);
+    EXPECT_NE(StaticKernelIndex::GetSource(config, dir_ + "other/").digest, source.digest);
+}
+
+TEST_F(StaticKernelIndexUt, SaveToUserCacheDir)
+{
+    const char* oldCachePath = getenv("ASCEND_CACHE_PATH");
+    const std::string savedCachePath = oldCachePath == nullptr ? "" : oldCachePath;
+    ASSERT_EQ(setenv("ASCEND_CACHE_PATH", (dir_ + "cache").c_str(), 1), 0);
+    const std::string path = StaticKernelIndex::GetCachePath("/opp/static_kernel/binary_info_config.json");
+    EXPECT_EQ(path.find(dir_ + "cache/" + STATIC_KERNEL_INDEX_CACHE_DIR), 0U);
+    EXPECT_NE(path, StaticKernelIndex::GetCachePath("/custom/static_kernel/binary_info_config.json"));
+
+    // 缓存目录不存在时逐级创建
+    auto index = StaticKernelIndex::Build(ops_, entries_, source_);
+    ASSERT_NE(index, nullptr);
+    ASSERT_EQ(index->Save(path), ACLNN_SUCCESS);
+    auto loaded = StaticKernelIndex::Load(path, source_);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->GetEntryNum(), entries_.size());
+
+    (void)remove(path.c_str());
+    (void)rmdir((dir_ + "cache/aclnn/static_kernel_index").c_str());
+    (void)rmdir((dir_ + "cache/aclnn").c_str());
+    (void)rmdir((dir_ + "cache").c_str());
+    if (oldCachePath == nullptr) {
+        (void)unsetenv("ASCEND_CACHE_PATH");
+    } else {
+        (void)setenv("ASCEND_CACHE_PATH", savedCachePath.c_str(), 1);
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "aclnn/acl_meta.h"
+#include "opdev/op_cache.h"
+#include "op_cache_internal.h"
+#include "tensor_signature.h"
+
+namespace op {
+namespace benchmark {
+using namespace op::internal;
+
+// ============================================================================
+// 完整字段/签名两种模式下 op cache key 的组装耗时对比
+// 对一个高维 tensor list 反复执行 AddParamToBuf, 衡量的是每次组装 key 的平均耗时,
+// 签名模式下每个 tensor 只写入一个 8 字节签名
+// ============================================================================
+
+class TensorSignatureBenchmark : public testing::Test {
+protected:
+    static constexpr size_t kTensorNum = 32U;
+    static constexpr size_t kLoop = 20000U;
+
+    void SetUp() override
+    {
+        std::vector<int64_t> shape{2, 3, 4, 5, 6, 7, 8, 9};
+        for (size_t i = 0U; i < kTensorNum; ++i) {
+            shape[0] = static_cast<int64_t>(i + 1U);
+            tensors_.push_back(aclCreateTensor(shape.data(), shape.size(), aclDataType::ACL_FLOAT16, nullptr, 0,
+                                               aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(), nullptr));
+        }
+        tensorList_ = aclCreateTensorList(tensors_.data(), tensors_.size());
+    }
+
+    void TearDown() override
+    {
+        SetCacheFullKeyEnable(false);
+        aclDestroyTensorList(tensorList_);
+    }
+
+    double RunKeyBuild(uint64_t& keyLen)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0U; i < kLoop; ++i) {
+            ResetCacheThreadLocal();
+            AddParamToBuf(tensorList_);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        keyLen = g_hashOffset;
+        ResetCacheThreadLocal();
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(kLoop);
+    }
+
+    std::vector<const aclTensor*> tensors_;
+    aclTensorList* tensorList_{nullptr};
+};
+
+TEST_F(TensorSignatureBenchmark, FullKeyVsSignatureKeyBuildCost)
+{
+    uint64_t fullKeyLen = 0U;
+    SetCacheFullKeyEnable(true);
+    const double fullNs = RunKeyBuild(fullKeyLen);
+
+    uint64_t signatureKeyLen = 0U;
+    SetCacheFullKeyEnable(false);
+    const double signatureNs = RunKeyBuild(signatureKeyLen);
+
+    printf("[TensorSignatureBenchmark] %zu tensors of rank 8, full key: %.1f ns/key (%lu bytes), "
+           "signature key: %.1f ns/key (%lu bytes)\n",
+           kTensorNum, fullNs, fullKeyLen, signatureNs, signatureKeyLen);
+    EXPECT_LT(signatureKeyLen, fullKeyLen);
+    EXPECT_LT(fullKeyLen, K_HASH_BUF_SIZE);
+    EXPECT_GT(fullNs, 0.0);
+    EXPECT_GT(signatureNs, 0.0);
+}
+
+} // namespace benchmark
+} // namespace op
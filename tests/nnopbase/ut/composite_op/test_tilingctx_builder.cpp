@@ -712,6 +712,43 @@ TEST_F(TilingCtxBuildUT, TilingCtxMultiThreadTest2)
     delete fakeBin;
 }
 
+TEST_F(TilingCtxBuildUT, TilingParseCtxPerCoreNumVariant)
+{
+    op::internal::OpKernelBin* fakeBin = CreateFakeOpKernelBin();
+    auto& cfg = op::internal::GetThreadLocalContext().opConfigInfo_;
+    uint32_t oldAic = cfg.aicNum_;
+    uint32_t oldAiv = cfg.aivNum_;
+
+    // 同一个 bin 的不同核数变体各自解析 compile info, 只共享 dump 出的 compile info json
+    const std::vector<std::pair<uint32_t, uint32_t>> coreNums = {{8U, 16U}, {4U, 8U}, {2U, 4U}};
+    for (const auto& [aic, aiv] : coreNums) {
+        cfg.aicNum_ = aic;
+        cfg.aivNum_ = aiv;
+        EXPECT_EQ(fakeBin->InitTilingParseCtx(), ACLNN_SUCCESS);
+    }
+    ASSERT_EQ(fakeBin->tilingParseCtxHolder_.size(), coreNums.size());
+    const auto& first = fakeBin->tilingParseCtxHolder_[op::internal::ThreadCoreNum(8U, 16U)];
+    ASSERT_NE(first, nullptr);
+    for (const auto& [aic, aiv] : coreNums) {
+        const auto& holder = fakeBin->tilingParseCtxHolder_[op::internal::ThreadCoreNum(aic, aiv)];
+        ASSERT_NE(holder, nullptr);
+        EXPECT_EQ(holder->GetCoreNum(), aic);
+        EXPECT_EQ(holder->GetCompileInfoStr(), fakeBin->compileInfoStr_);
+        if (holder != first) {
+            EXPECT_NE(holder->GetCompiledInfoStruct()->data.pointer, first->GetCompiledInfoStruct()->data.pointer);
+        }
+    }
+
+    for (auto& [key, value] : fakeBin->tilingParseCtxHolder_) {
+        if (value.get()) {
+            value.get()->ReleaseTilingParse();
+        }
+    }
+    cfg.aicNum_ = oldAic;
+    cfg.aivNum_ = oldAiv;
+    delete fakeBin;
+}
+
 TEST_F(TilingCtxBuildUT, TilingCtxMultiThreadTest3)
 {
     op::internal::OpKernelBin* fakeBin = CreateFakeOpKernelBin();
@@ -984,3 +1021,92 @@ TEST_F(TilingCtxBuildUT, UpdateTilingCtxWithOpJsonMultiThreadTest)
         threadVec[i].join();
     }
 }
+
+// 比较两个 KernelContextHolder 构造出的 compute node info 与 tensor 地址 (reserved 字段除外)
+static void ExpectSameComputeNodeInfo(const op::internal::KernelContextHolder& lhs,
+                                      const op::internal::KernelContextHolder& rhs)
+{
+    const auto* lInfo = lhs.computeNodeInfo_;
+    const auto* rInfo = rhs.computeNodeInfo_;
+    EXPECT_EQ(lInfo->node_type_, rInfo->node_type_);
+    EXPECT_EQ(lInfo->ir_inputs_num_, rInfo->ir_inputs_num_);
+    EXPECT_EQ(lInfo->inputs_num_, rInfo->inputs_num_);
+    EXPECT_EQ(lInfo->outputs_num_, rInfo->outputs_num_);
+    EXPECT_EQ(lInfo->ir_outputs_num_, rInfo->ir_outputs_num_);
+    ASSERT_EQ(lInfo->attr_size_, rInfo->attr_size_);
+    for (size_t i = 0; i < lInfo->ir_inputs_num_; i++) {
+        EXPECT_EQ(lhs.anchorInfo_[i].instance_start_, rhs.anchorInfo_[i].instance_start_);
+        EXPECT_EQ(lhs.anchorInfo_[i].instantiation_num_, rhs.anchorInfo_[i].instantiation_num_);
+    }
+    for (size_t i = 0; i < lInfo->ir_outputs_num_; i++) {
+        EXPECT_EQ(lhs.outputAnchorInfo_[i].instance_start_, rhs.outputAnchorInfo_[i].instance_start_);
+        EXPECT_EQ(lhs.outputAnchorInfo_[i].instantiation_num_, rhs.outputAnchorInfo_[i].instantiation_num_);
+    }
+    for (size_t i = 0; i < lInfo->inputs_num_ + lInfo->outputs_num_; i++) {
+        EXPECT_EQ(lhs.compileDesc_[i].data_type_, rhs.compileDesc_[i].data_type_);
+        EXPECT_EQ(memcmp(&lhs.compileDesc_[i].storage_format_, &rhs.compileDesc_[i].storage_format_,
+                         sizeof(gert::StorageFormat)),
+                  0);
+        EXPECT_EQ(lhs.opInArg_[i].data.pointer, rhs.opInArg_[i].data.pointer);
+    }
+    ASSERT_EQ(lhs.attrDef_->attr_num, rhs.attrDef_->attr_num);
+    for (size_t i = 0; i < lhs.attrDef_->attr_num; i++) {
+        EXPECT_EQ(lhs.attrDef_->offset[i], rhs.attrDef_->offset[i]);
+    }
+    // attr 数据紧密排列, 字符串长度取 8 的倍数减 1 避免对齐填充
+    EXPECT_EQ(memcmp(lhs.attrDataStart_, rhs.attrDataStart_, op::internal::PtrOffset(lhs.attrDataStart_,
+                                                                                       lhs.outputAnchorInfo_)),
+              0);
+}
+
+TEST_F(TilingCtxBuildUT, FrameTemplateMatchesRebuild)
+{
+    op::Shape shape{4, 8, 16};
+    auto x1 = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+    auto x2 = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT16, op::Format::FORMAT_NCHW, nullptr);
+    auto x3 = std::make_unique<aclTensor>(shape, op::DataType::DT_INT32, op::Format::FORMAT_ND, nullptr);
+    auto out = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+    const aclTensor* listData[] = {x1.get(), nullptr, x2.get()};
+    aclTensorList tensorList(listData, 3);
+    int64_t intArrData[] = {1, 2, 3};
+    aclIntArray shortArr(intArrData, 2);
+    aclIntArray longArr(intArrData, 3);
+    const char* strA = "abcdefg";
+    const char* strB = "hijklmn";
+
+    const char* opType = "FrameTemplateOp";
+    auto ctxA = op::MakeOpArgContext(OP_INPUT(x1.get(), &tensorList, nullptr), OP_OUTPUT(out.get()),
+                                     OP_ATTR(int64_t(1), 0.5F, strA, &shortArr));
+    auto ctxB = op::MakeOpArgContext(OP_INPUT(x3.get(), &tensorList, nullptr), OP_OUTPUT(out.get()),
+                                     OP_ATTR(int64_t(2), 1.5F, strB, &shortArr));
+    auto ctxC = op::MakeOpArgContext(OP_INPUT(x1.get(), &tensorList, x2.get()), OP_OUTPUT(out.get()),
+                                     OP_ATTR(int64_t(3), 2.5F, strA, &longArr));
+
+    op::internal::KernelContextHolder frameHolder;
+    op::internal::KernelContextHolder rebuildHolder;
+    rebuildHolder.SetFrameTemplateEnable(false);
+    op::internal::TilingCtxHolder tilingCtx;
+    // A 建模板, B 同签名复用当前帧, C 换签名, 再回到 B 时整帧拷贝模板
+    for (auto* ctx : {ctxA, ctxB, ctxC, ctxB, ctxC}) {
+        auto& input = *ctx->GetOpArg(op::OpArgDef::OP_INPUT_ARG);
+        auto& output = *ctx->GetOpArg(op::OpArgDef::OP_OUTPUT_ARG);
+        auto& attr = *ctx->GetOpArg(op::OpArgDef::OP_ATTR_ARG);
+        ASSERT_EQ(frameHolder.UpdateComputeNodeInfo(opType, input, output, attr), ACLNN_SUCCESS);
+        ASSERT_EQ(rebuildHolder.UpdateComputeNodeInfo(opType, input, output, attr), ACLNN_SUCCESS);
+        ExpectSameComputeNodeInfo(frameHolder, rebuildHolder);
+
+        // 两个 holder 交替构造 tiling ctx, 输入值必须指向当前 holder 的 opInArg_
+        for (const auto* kernelCtx : {&frameHolder, &rebuildHolder, &frameHolder}) {
+            ASSERT_EQ(tilingCtx.UpdateTilingCtx(kernelCtx), ACLNN_SUCCESS);
+            for (size_t i = 0; i < kernelCtx->inputNum_ + kernelCtx->outputNum_; i++) {
+                EXPECT_EQ(tilingCtx.tilingCtx_->values[i], &kernelCtx->opInArg_[i]);
+            }
+        }
+    }
+    EXPECT_EQ(frameHolder.frameTemplates_.size(), 2U);
+    EXPECT_TRUE(rebuildHolder.frameTemplates_.empty());
+
+    op::DestroyOpArgContext(ctxA);
+    op::DestroyOpArgContext(ctxB);
+    op::DestroyOpArgContext(ctxC);
+}
@@ -19,6 +19,7 @@
 #include "individual_op_api.h"
 #include "individual_op_internal.h"
 #include "op_cache_internal.h"
+#include "tensor_signature.h"
 #include "depends/op/op_stub.h"
 #include "depends/dump/dump_stub.h"
 #include "depends/mmpa/mmpa_stub.h"
@@ -324,6 +325,11 @@ NnopbaseUChar* AppendV2OpType(NnopbaseUChar* key, const char* opType)
 }
 
 NnopbaseUChar* AppendV2TensorShapeInfo(NnopbaseUChar* key, const aclTensor* tensor)
+{
+    return NnopbaseAppend8Byte(key, tensor->GetSignature());
+}
+
+NnopbaseUChar* AppendV2TensorFullShapeInfo(NnopbaseUChar* key, const aclTensor* tensor)
 {
     const op::Shape& shape = tensor->GetViewShape();
     const size_t dimNum = shape.GetDimNum();
@@ -466,6 +472,60 @@ TEST_F(NnopbaseCacheKeyUnitTest, NnopbaseV2CacheKeyRegularTensor)
     NnopbaseUnsetEnvAndClearFolder();
 }
 
+// ===== V2 path: full key debug mode serializes every tensor field =====
+TEST_F(NnopbaseCacheKeyUnitTest, NnopbaseV2CacheKeyFullKeyMode)
+{
+    op::internal::SetCacheFullKeyEnable(true);
+    void* executorSpace = nullptr;
+    const char* opType = "bninference_d_kernel";
+    char inputDesc[] = {1, 1, 1};
+    char outputDesc[] = {1};
+    char attrDesc[] = {};
+    void* executor = PrepareV2Executor(executorSpace, opType, inputDesc, sizeof(inputDesc), outputDesc,
+                                       sizeof(outputDesc), attrDesc, sizeof(attrDesc));
+    ASSERT_NE(executor, nullptr);
+
+    std::vector<int64_t> shape = {1, 1, 1, 1, 1};
+    std::vector<int64_t> otherShape = {1, 1, 1, 1, 2};
+    aclTensor* tensor = aclCreateTensor(shape.data(), shape.size(), aclDataType::ACL_FLOAT, nullptr, 0,
+                                        aclFormat::ACL_FORMAT_ND, shape.data(), shape.size(), nullptr);
+    aclTensor* other = aclCreateTensor(otherShape.data(), otherShape.size(), aclDataType::ACL_FLOAT, nullptr, 0,
+                                       aclFormat::ACL_FORMAT_ND, otherShape.data(), otherShape.size(), nullptr);
+    ASSERT_EQ(NnopbaseAddInput(executor, tensor, 0), 0);
+    ASSERT_EQ(NnopbaseAddInput(executor, other, 1), 0);
+    ASSERT_EQ(NnopbaseAddInput(executor, tensor, 2), 0);
+    ASSERT_EQ(NnopbaseAddOutput(executor, other, 0), 0);
+
+    NnopbaseExecutor* opExecutor = static_cast<NnopbaseExecutor*>(executor);
+    FinishV2MatchArgs(opExecutor);
+
+    std::vector<NnopbaseUChar> exp(kExpKeyBufBytes, '\0');
+    auto key = &exp[0U];
+    key = AppendV2OpType(key, opType);
+    key = AppendV2TensorFullShapeInfo(key, tensor);
+    key = AppendV2TensorFullShapeInfo(key, other);
+    key = AppendV2TensorFullShapeInfo(key, tensor);
+    key = AppendV2Placeholder(key);
+    key = AppendV2TensorFullShapeInfo(key, other);
+    NnopbaseCoreNum coreNumInfo = {24, 24};
+    key = AppendV2CoreNum(key, coreNumInfo);
+    key = AppendV2Mc2RankId(key, 0U);
+    key = AppendV2Deterministic(key, false);
+    op::internal::SetCacheFullKeyEnable(false);
+
+    auto keyLen = key - &exp[0U];
+    ASSERT_EQ(static_cast<size_t>(keyLen), opExecutor->ownArgs.keyLen);
+    for (size_t i = 0; i < opExecutor->ownArgs.keyLen; ++i) {
+        ASSERT_EQ(opExecutor->ownArgs.inputKey[i], exp[i]) << "v2 cache key byte mismatch at offset " << i;
+    }
+    EXPECT_NE(tensor->GetSignature(), other->GetSignature());
+
+    aclDestroyTensor(tensor);
+    aclDestroyTensor(other);
+    NnopbaseExecutorGcSpace(executorSpace);
+    NnopbaseUnsetEnvAndClearFolder();
+}
+
 // ===== V2 path: null input is encoded as a single '/' placeholder =====
 TEST_F(NnopbaseCacheKeyUnitTest, NnopbaseV2CacheKeyNullTensor)
 {
@@ -22,6 +22,7 @@
 #include "opdev/op_dfx.h"
 #include "op_run_context.h"
 #include "op_info_serialize.h"
+#include "op_info_bin_record.h"
 #include "ini_parse.h"
 #include "base/registry/op_impl_space_registry_v2.h"
 #include "lib_path.h"
@@ -89,6 +90,46 @@ TEST_F(OpInfoRecordUtest, Utest_OpInfoSerialize)
     op::DestroyOpArgContext(ctx);
 }
 
+TEST_F(OpInfoRecordUtest, Utest_OpInfoSerialize_bin_format)
+{
+    aclnnOpInfoRecord::OpCompilerOption opt("", 0);
+    aclnnOpInfoRecord::OpKernelInfo kernelInfo(
+        "../../../../tests/nnopbase/mock/built-in/op_impl/ai_core/tbe/kernel/ascend910/axpy/"
+        "Axpy_233851a3505389e43928a8bba133a74d_high_performance.json",
+        0);
+    op::Shape shape{33, 15, 1, 48};
+    auto self = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+    auto other = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+    auto out = std::make_unique<aclTensor>(shape, op::DataType::DT_FLOAT, op::Format::FORMAT_ND, nullptr);
+    float alpha = 13.37;
+    auto input = OP_INPUT(self.get(), other.get());
+    auto output = OP_OUTPUT(out.get());
+    auto attr = OP_ATTR(alpha);
+    auto ctx = op::MakeOpArgContext(input, output, attr);
+    auto spaceRegistry = std::make_shared<gert::OpImplSpaceRegistryV2>();
+    gert::DefaultOpImplSpaceRegistryV2::GetInstance().SetSpaceRegistry(spaceRegistry);
+    uint32_t opType = op::GenOpTypeId("Axpy");
+    gert::TilingContext* tilingCtx = op::internal::OpRunContextMgr::opRunCtx_.UpdateTilingCtx(
+        opType, *ctx->GetOpArg(op::OpArgDef::OP_INPUT_ARG), *ctx->GetOpArg(op::OpArgDef::OP_OUTPUT_ARG),
+        *ctx->GetOpArg(op::OpArgDef::OP_ATTR_ARG));
+    ASSERT_NE(tilingCtx, nullptr);
+
+    auto& recorder = aclnnOpInfoRecord::OpInfoBinRecorder::Instance();
+    recorder.SetEnable(true);
+    const auto before = recorder.GetStats();
+    EXPECT_EQ(aclnnOpInfoRecord::OpInfoSerialize(tilingCtx, opt, &kernelInfo), 0);
+    EXPECT_EQ(aclnnOpInfoRecord::OpInfoSerialize(tilingCtx, opt, &kernelInfo), 0);
+    EXPECT_EQ(aclnnOpInfoRecord::OpInfoDump(), 0);
+    const auto after = recorder.GetStats();
+    recorder.SetEnable(false);
+    EXPECT_EQ(after.records, before.records + 1U);
+    EXPECT_EQ(after.duplicateRecords, before.duplicateRecords + 1U);
+    EXPECT_EQ(after.hashCollisions, before.hashCollisions);
+    EXPECT_EQ(after.flushes, before.flushes + 1U);
+    EXPECT_GT(after.writtenBytes, before.writtenBytes);
+    op::DestroyOpArgContext(ctx);
+}
+
 TEST_F(OpInfoRecordUtest, Utest_OpInfoSerialize_without_supportInfo)
 {
     aclnnOpInfoRecord::OpCompilerOption opt("", 0);
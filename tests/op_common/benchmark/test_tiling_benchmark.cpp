@@ -0,0 +1,702 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "op_common/atvoss/broadcast/broadcast_tiling.h"
+#include "op_common/atvoss/elewise/elewise_tiling.h"
+#include "op_common/atvoss/reduce/reduce_tiling.h"
+#include "tiling_context_holder.h"
+
+// ============================================================================
+// 统计 tiling 调用期间的堆分配次数, 只在计数开关打开的线程上累加
+// ============================================================================
+namespace {
+std::atomic<uint64_t> g_allocCount{0};
+thread_local bool g_countAlloc = false;
+
+void* CountedAlloc(size_t size)
+{
+    if (g_countAlloc) {
+        g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return std::malloc(size == 0 ? 1 : size);
+}
+} // namespace
+
+void* operator new(size_t size)
+{
+    void* ptr = CountedAlloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    void* ptr = CountedAlloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace Ops {
+namespace Base {
+namespace Benchmark {
+
+// ============================================================================
+// op_common atvoss 模板 host 侧 tiling 基准测试
+// 按固定随机种子生成 shape/轴/数据类型语料, 覆盖 elewise、broadcast(连续/非连续)、reduce(连续/非连续)
+// 每个用例输出一行 JSON: 单次调用耗时、单次调用的堆分配次数以及切分质量
+//   core_util:     核间负载利用率 = 总 tile 数 / (核数 * 单核最多 tile 数)
+//   ub_fill:       平均每个 tile 占用的元素数 / UB 可容纳的元素数
+//   tail_fraction: 切分轴上存在尾块的 tile 占全部 tile 的比例
+//
+// OP_COMMON_TILING_BENCHMARK_OUTPUT:       输出基线文件, 每次运行覆盖写
+// OP_COMMON_TILING_BENCHMARK_BASELINE:     与已有基线比较, 切分质量或分配次数变差、耗时超出容差时用例失败
+// OP_COMMON_TILING_BENCHMARK_ITERATIONS:   每个 shape 的调用次数, 默认 1000
+// OP_COMMON_TILING_BENCHMARK_CASES:        每类 tiling 生成的 shape 个数, 默认 48
+// OP_COMMON_TILING_BENCHMARK_NS_TOLERANCE: 每类 tiling 平均耗时允许劣化的百分比, 默认 20
+// ============================================================================
+
+constexpr size_t kDefaultIterations = 1000U;
+constexpr size_t kDefaultCases = 48U;
+constexpr size_t kDefaultNsTolerance = 20U;
+constexpr size_t kWarmupIterations = 8U;
+constexpr size_t kPercentBase = 100U;
+constexpr int64_t kMaxElemNum = 1L << 30;
+constexpr uint32_t kCorpusSeed = 20260101U;
+constexpr double kQualityEpsilon = 1e-6;
+constexpr double kAllocEpsilon = 0.01;
+constexpr const char* kSuiteName = "op_common_tiling";
+const std::vector<int64_t> kDimPool = {1,   2,   3,    7,    8,    15,   16,   31,    64,   77,
+                                       128, 255, 256,  511,  1000, 1024, 2048, 4096, 12288, 65536};
+
+struct TilingQuality {
+    double coreUtil = 0.0;
+    double ubFill = 0.0;
+    double tailFraction = 0.0;
+};
+
+struct TilingBenchResult {
+    std::string caseName;
+    std::string desc;
+    size_t iterations{0U};
+    size_t failed{0U};
+    double avgNs{0.0};
+    double allocsPerCall{0.0};
+    TilingQuality quality;
+};
+
+static size_t GetEnvSize(const char* name, const size_t defaultValue)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    const long long num = std::atoll(value);
+    return num > 0 ? static_cast<size_t>(num) : defaultValue;
+}
+
+static double SafeRatio(double num, double den) { return den > 0.0 ? num / den : 0.0; }
+
+static std::string DimsToString(const std::vector<int64_t>& dims)
+{
+    std::ostringstream oss;
+    oss << "[";
+    for (size_t i = 0; i < dims.size(); ++i) {
+        oss << (i > 0 ? "," : "") << dims[i];
+    }
+    oss << "]";
+    return oss.str();
+}
+
+static gert::Shape MakeShape(const std::vector<int64_t>& dims)
+{
+    gert::Shape shape;
+    for (auto dim : dims) {
+        shape.AppendDim(dim);
+    }
+    return shape;
+}
+
+static std::vector<int64_t> ContiguousStrides(const std::vector<int64_t>& dims)
+{
+    std::vector<int64_t> strides(dims.size(), 1);
+    for (int64_t i = static_cast<int64_t>(dims.size()) - 2; i >= 0; --i) {
+        strides[i] = strides[i + 1] * dims[i + 1];
+    }
+    return strides;
+}
+
+// 交换两根轴的存储顺序得到的非连续 view stride
+static std::vector<int64_t> TransposedStrides(const std::vector<int64_t>& dims, size_t axis0, size_t axis1)
+{
+    std::vector<int64_t> storage = dims;
+    std::swap(storage[axis0], storage[axis1]);
+    std::vector<int64_t> strides = ContiguousStrides(storage);
+    std::swap(strides[axis0], strides[axis1]);
+    return strides;
+}
+
+// ============================================================================
+// 语料生成
+// ============================================================================
+class ShapeGenerator {
+public:
+    explicit ShapeGenerator(uint32_t seed) : engine_(seed) {}
+
+    int64_t Uniform(int64_t lo, int64_t hi) { return std::uniform_int_distribution<int64_t>(lo, hi)(engine_); }
+
+    bool Chance(uint32_t percent) { return Uniform(0, kPercentBase - 1) < static_cast<int64_t>(percent); }
+
+    // 生成 rank 维 shape, 元素总数不超过 kMaxElemNum
+    std::vector<int64_t> Dims(size_t rank)
+    {
+        std::vector<int64_t> dims(rank, 1);
+        int64_t total = 1;
+        for (size_t i = 0; i < rank; ++i) {
+            int64_t dim = kDimPool[Uniform(0, kDimPool.size() - 1)];
+            while (dim > 1 && total * dim > kMaxElemNum) {
+                dim = dim / 2;
+            }
+            dims[i] = dim;
+            total *= dim;
+        }
+        // 避免整体退化为单元素
+        if (total == 1) {
+            dims.back() = kDimPool[Uniform(1, kDimPool.size() - 1)];
+        }
+        return dims;
+    }
+
+    int64_t DtypeBits()
+    {
+        static const int64_t bits[] = {8, 16, 16, 32, 32};
+        return bits[Uniform(0, sizeof(bits) / sizeof(bits[0]) - 1)];
+    }
+
+private:
+    std::mt19937 engine_;
+};
+
+// ============================================================================
+// 用例基类: RunOnce 计入耗时与分配, GetQuality 在计时结束后根据最后一次的结果计算
+// ============================================================================
+class TilingBenchCase {
+public:
+    virtual ~TilingBenchCase() = default;
+    virtual std::string Desc() const = 0;
+    virtual bool RunOnce() = 0;
+    virtual void GetQuality(TilingQuality& quality) const = 0;
+};
+
+static TilingBenchResult Measure(const std::string& caseName, TilingBenchCase& benchCase, size_t iterations)
+{
+    TilingBenchResult result;
+    result.caseName = caseName;
+    result.desc = benchCase.Desc();
+    result.iterations = iterations;
+    for (size_t i = 0; i < kWarmupIterations; ++i) {
+        (void)benchCase.RunOnce();
+    }
+    uint64_t allocBegin = g_allocCount.load(std::memory_order_relaxed);
+    g_countAlloc = true;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        if (!benchCase.RunOnce()) {
+            result.failed++;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    g_countAlloc = false;
+    uint64_t allocs = g_allocCount.load(std::memory_order_relaxed) - allocBegin;
+    double totalNs = std::chrono::duration<double, std::nano>(end - start).count();
+    result.avgNs = totalNs / iterations;
+    result.allocsPerCall = static_cast<double>(allocs) / iterations;
+    benchCase.GetQuality(result.quality);
+    return result;
+}
+
+// ============================================================================
+// elewise
+// ============================================================================
+class ElewiseCase : public TilingBenchCase {
+public:
+    ElewiseCase(ShapeGenerator& gen, const BenchmarkPlatform& platform)
+    {
+        dims_ = gen.Dims(gen.Uniform(1, 5));
+        dtypeBits_ = gen.DtypeBits();
+        inputNum_ = gen.Uniform(1, 3);
+        params_.coreNum = platform.vectorCoreNum;
+        params_.shape = MakeShape(dims_);
+        params_.ubSize = platform.ubSize;
+        params_.computeMap[0] = {dtypeBits_, dtypeBits_, {0}, {(inputNum_ + 1) * 2 * dtypeBits_}};
+    }
+
+    std::string Desc() const override
+    {
+        return "shape=" + DimsToString(dims_) + " inputs=" + std::to_string(inputNum_) +
+               " bits=" + std::to_string(dtypeBits_);
+    }
+
+    bool RunOnce() override { return ElewiseTiling(params_, data_) == ge::GRAPH_SUCCESS; }
+
+    void GetQuality(TilingQuality& quality) const override
+    {
+        double tiles = (data_.blockNum - 1) * data_.ubLoopOfFormerBlock + data_.ubLoopOfTailBlock;
+        double partial = (data_.blockNum - 1) * (data_.ubTailOfFormerBlock != data_.ubFormer ? 1 : 0) +
+                         (data_.ubTailOfTailBlock != data_.ubFormer ? 1 : 0);
+        quality.coreUtil = SafeRatio(data_.dim0, static_cast<double>(data_.blockFormer) * params_.coreNum);
+        quality.ubFill = SafeRatio(data_.dim0, tiles * data_.elemNum);
+        quality.tailFraction = SafeRatio(partial, tiles);
+    }
+
+private:
+    std::vector<int64_t> dims_;
+    int64_t dtypeBits_{0};
+    int64_t inputNum_{0};
+    ElewiseTilingParams params_;
+    ElewiseTilingData data_{};
+};
+
+// ============================================================================
+// broadcast: 连续、非尾轴转置、尾轴转置
+// ============================================================================
+enum class BroadcastKind {
+    CONTIGUOUS,
+    NLAST_TRANSPOSE,
+    LAST_TRANSPOSE
+};
+
+class BroadcastCase : public TilingBenchCase {
+public:
+    BroadcastCase(ShapeGenerator& gen, const BenchmarkPlatform& platform, BroadcastKind kind) : kind_(kind)
+    {
+        size_t minRank = kind == BroadcastKind::CONTIGUOUS ? 1 : (kind == BroadcastKind::LAST_TRANSPOSE ? 2 : 3);
+        outDims_ = gen.Dims(gen.Uniform(minRank, 6));
+        dtypeBits_ = gen.DtypeBits();
+        int64_t inputNum = gen.Uniform(2, 3);
+        params_.coreNum = platform.vectorCoreNum;
+        params_.ubSize = platform.ubSize;
+        params_.outShape = MakeShape(outDims_);
+        params_.inputAllContiguous = kind == BroadcastKind::CONTIGUOUS;
+        params_.computeMap[BroadcastGetComputeKey()] = {dtypeBits_, dtypeBits_, {0}, {(inputNum + 1) * 2 * dtypeBits_}};
+        for (int64_t i = 0; i < inputNum; ++i) {
+            std::vector<int64_t> inDims = outDims_;
+            // 第0个输入不做广播, 非连续场景由它承载转置
+            if (i > 0) {
+                for (auto& dim : inDims) {
+                    dim = gen.Chance(30) ? 1 : dim;
+                }
+                if (inDims.size() > 1 && gen.Chance(20)) {
+                    inDims.erase(inDims.begin());
+                }
+            }
+            inDims_.push_back(inDims);
+            params_.inShape.push_back(MakeShape(inDims));
+            params_.inStride.push_back(gert::Stride());
+        }
+        if (kind != BroadcastKind::CONTIGUOUS) {
+            size_t rank = outDims_.size();
+            std::vector<int64_t> strides = kind == BroadcastKind::LAST_TRANSPOSE ?
+                                               TransposedStrides(outDims_, rank - 2, rank - 1) :
+                                               TransposedStrides(outDims_, rank - 3, rank - 2);
+            params_.inStride[0].SetDimNum(strides.size());
+            for (size_t i = 0; i < strides.size(); ++i) {
+                params_.inStride[0].SetStride(i, strides[i]);
+            }
+        }
+    }
+
+    std::string Desc() const override
+    {
+        std::string desc = "out=" + DimsToString(outDims_) + " in=";
+        for (size_t i = 0; i < inDims_.size(); ++i) {
+            desc += (i > 0 ? "," : "") + DimsToString(inDims_[i]);
+        }
+        return desc + " bits=" + std::to_string(dtypeBits_);
+    }
+
+    bool RunOnce() override
+    {
+        BroadcastTilingData data;
+        if (DoDimensionCollapse(params_, data) != ge::GRAPH_SUCCESS) {
+            return false;
+        }
+        ge::graphStatus status = ge::GRAPH_SUCCESS;
+        if (kind_ == BroadcastKind::CONTIGUOUS) {
+            status = DoBrodcastTiling(params_, data);
+        } else if (kind_ == BroadcastKind::NLAST_TRANSPOSE) {
+            status = BroadcastTilingNLastTranspose(params_, data, false);
+        } else {
+            status = DoBrodcastTilingLastTranspose(params_, data);
+        }
+        data_ = std::move(data);
+        return status == ge::GRAPH_SUCCESS;
+    }
+
+    void GetQuality(TilingQuality& quality) const override
+    {
+        if (data_.dims.empty()) {
+            return;
+        }
+        double total = 1.0;
+        for (auto dim : data_.dims.back()) {
+            total *= dim;
+        }
+        double tiles = data_.dimProductBeforeUbInner;
+        // 切分轴（尾轴转置时还有尾轴）上存在尾块的 tile 比例
+        double fullRatio = FullRatio(data_.ubOuter, data_.ubFormer, data_.ubTail);
+        if (kind_ == BroadcastKind::LAST_TRANSPOSE) {
+            fullRatio *= FullRatio(data_.ubOuterLastAxis, data_.ubFormerLastAxis, data_.ubTailLastAxis);
+        }
+        quality.coreUtil = SafeRatio(tiles, static_cast<double>(data_.blockFormer) * params_.coreNum);
+        quality.ubFill = SafeRatio(total, tiles * data_.elemNum);
+        quality.tailFraction = 1.0 - fullRatio;
+    }
+
+private:
+    static double FullRatio(int64_t outer, int64_t former, int64_t tail)
+    {
+        if (outer <= 0 || tail == former) {
+            return 1.0;
+        }
+        return static_cast<double>(outer - 1) / outer;
+    }
+
+    BroadcastKind kind_;
+    std::vector<int64_t> outDims_;
+    std::vector<std::vector<int64_t>> inDims_;
+    int64_t dtypeBits_{0};
+    BroadcastTilingParams params_;
+    BroadcastTilingData data_{};
+};
+
+// ============================================================================
+// reduce: 通过派生类读取切分结果 unitA_/unitR_
+// ============================================================================
+class ReduceTilingProbe : public ReduceOpTiling {
+public:
+    using ReduceOpTiling::ReduceOpTiling;
+
+    void GetQuality(const ReduceOpInputParam& opInput, TilingQuality& quality)
+    {
+        double total = 1.0;
+        for (auto dim : opInput.shape) {
+            total *= dim;
+        }
+        double tiles = static_cast<double>(unitA_.outer) * unitR_.outer;
+        double perCore = static_cast<double>(tilingData_->factorACntPerCore) * tilingData_->factorRCntPerCore;
+        double capacity = static_cast<double>(basicBlock_ * Ratio()) / opDag_.maxInputBytes;
+        double fullA = unitA_.outer - PartialNum(unitA_);
+        double fullR = unitR_.outer - PartialNum(unitR_);
+        quality.coreUtil = SafeRatio(tiles, perCore * compileInfo_->vectorCoreNum);
+        quality.ubFill = SafeRatio(total, tiles * capacity);
+        quality.tailFraction = SafeRatio(tiles - fullA * fullR, tiles);
+    }
+
+private:
+    // 切分轴不能被 step 整除时, 每一组外层循环的最后一个 tile 为尾块
+    double PartialNum(const ReduceTilingUnit& unit) const
+    {
+        if (unit.idx < 0) {
+            return 0.0;
+        }
+        uint64_t axisLen = tilingData_->shape[unit.idx];
+        if (unit.step == 0 || axisLen % unit.step == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(unit.outer) / ((axisLen + unit.step - 1) / unit.step);
+    }
+};
+
+class ReduceCase : public TilingBenchCase {
+public:
+    ReduceCase(ShapeGenerator& gen, const BenchmarkPlatform& platform, bool contiguous)
+        : holder_("ReduceBenchmark", platform, sizeof(ReduceOpTilingData))
+    {
+        static const ge::DataType dtypes[] = {ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT};
+        size_t rank = gen.Uniform(contiguous ? 1 : 2, 5);
+        opInput_.shape = gen.Dims(rank);
+        opInput_.inputDtype = dtypes[gen.Uniform(0, sizeof(dtypes) / sizeof(dtypes[0]) - 1)];
+        opInput_.promoteDtpye = ge::DT_FLOAT;
+        for (size_t i = 0; i < rank; ++i) {
+            if (gen.Chance(50)) {
+                opInput_.axes.push_back(i);
+            }
+        }
+        if (opInput_.axes.empty()) {
+            opInput_.axes.push_back(gen.Uniform(0, rank - 1));
+        }
+        if (!contiguous) {
+            // 一半转置最后两根轴, 一半在最高维上做切片
+            if (gen.Chance(50)) {
+                opInput_.dimStrides = TransposedStrides(opInput_.shape, rank - 2, rank - 1);
+            } else {
+                opInput_.dimStrides = ContiguousStrides(opInput_.shape);
+                opInput_.dimStrides[0] *= 2;
+            }
+        }
+    }
+
+    std::string Desc() const override
+    {
+        std::string desc = "shape=" + DimsToString(opInput_.shape) + " axes=" + DimsToString(opInput_.axes);
+        if (!opInput_.dimStrides.empty()) {
+            desc += " strides=" + DimsToString(opInput_.dimStrides);
+        }
+        return desc + " dtype=" + std::to_string(static_cast<int32_t>(opInput_.inputDtype));
+    }
+
+    bool RunOnce() override
+    {
+        holder_.Reset();
+        ReduceTilingKey key;
+        ReduceTilingProbe tiling(holder_.GetContext());
+        return tiling.DoTiling(opInput_, key) == ge::GRAPH_SUCCESS;
+    }
+
+    void GetQuality(TilingQuality& quality) const override
+    {
+        // 重新执行一次以拿到切分中间结果, 不计入耗时
+        holder_.Reset();
+        ReduceTilingKey key;
+        ReduceOpInputParam opInput = opInput_;
+        ReduceTilingProbe tiling(holder_.GetContext());
+        if (tiling.DoTiling(opInput, key) == ge::GRAPH_SUCCESS) {
+            tiling.GetQuality(opInput_, quality);
+        }
+    }
+
+private:
+    mutable TilingContextHolder holder_;
+    ReduceOpInputParam opInput_;
+};
+
+// ============================================================================
+// 结果输出与基线比较
+// ============================================================================
+static std::string ToJsonLine(const TilingBenchResult& result)
+{
+    char line[1024] = {};
+    (void)snprintf(line, sizeof(line),
+                   "{\"suite\":\"%s\",\"case\":\"%s\",\"desc\":\"%s\",\"iterations\":%zu,\"failed\":%zu,"
+                   "\"avg_ns\":%.1f,\"allocs_per_call\":%.2f,\"core_util\":%.6f,\"ub_fill\":%.6f,"
+                   "\"tail_fraction\":%.6f}",
+                   kSuiteName, result.caseName.c_str(), result.desc.c_str(), result.iterations, result.failed,
+                   result.avgNs, result.allocsPerCall, result.quality.coreUtil, result.quality.ubFill,
+                   result.quality.tailFraction);
+    return line;
+}
+
+static void ReportResult(const TilingBenchResult& result)
+{
+    std::string line = ToJsonLine(result);
+    printf("%s\n", line.c_str());
+    const char* output = std::getenv("OP_COMMON_TILING_BENCHMARK_OUTPUT");
+    if (output == nullptr) {
+        return;
+    }
+    // 同一进程内第一次写入时清空旧文件, 保证输出即为完整基线
+    static bool truncated = false;
+    FILE* fp = fopen(output, truncated ? "a" : "w");
+    if (fp == nullptr) {
+        printf("[TilingBenchmark] open %s failed\n", output);
+        return;
+    }
+    truncated = true;
+    (void)fprintf(fp, "%s\n", line.c_str());
+    (void)fclose(fp);
+}
+
+static bool ParseString(const std::string& line, const std::string& key, std::string& value)
+{
+    std::string pattern = "\"" + key + "\":\"";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += pattern.size();
+    size_t end = line.find('"', pos);
+    if (end == std::string::npos) {
+        return false;
+    }
+    value = line.substr(pos, end - pos);
+    return true;
+}
+
+static double ParseNumber(const std::string& line, const std::string& key)
+{
+    std::string pattern = "\"" + key + "\":";
+    size_t pos = line.find(pattern);
+    return pos == std::string::npos ? 0.0 : std::strtod(line.c_str() + pos + pattern.size(), nullptr);
+}
+
+static const std::map<std::string, TilingBenchResult>& GetBaseline()
+{
+    static std::map<std::string, TilingBenchResult> baseline = []() {
+        std::map<std::string, TilingBenchResult> records;
+        const char* path = std::getenv("OP_COMMON_TILING_BENCHMARK_BASELINE");
+        if (path == nullptr) {
+            return records;
+        }
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            printf("[TilingBenchmark] open baseline %s failed\n", path);
+            return records;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            TilingBenchResult record;
+            if (!ParseString(line, "case", record.caseName)) {
+                continue;
+            }
+            (void)ParseString(line, "desc", record.desc);
+            record.avgNs = ParseNumber(line, "avg_ns");
+            record.allocsPerCall = ParseNumber(line, "allocs_per_call");
+            record.quality.coreUtil = ParseNumber(line, "core_util");
+            record.quality.ubFill = ParseNumber(line, "ub_fill");
+            record.quality.tailFraction = ParseNumber(line, "tail_fraction");
+            records[record.caseName] = record;
+        }
+        return records;
+    }();
+    return baseline;
+}
+
+// 切分质量与分配次数按用例严格比较, 耗时按每类 tiling 的平均值在容差内比较
+static void CheckWithBaseline(const TilingBenchResult& result, bool checkNs)
+{
+    const auto& baseline = GetBaseline();
+    auto iter = baseline.find(result.caseName);
+    if (iter == baseline.end()) {
+        return;
+    }
+    const TilingBenchResult& base = iter->second;
+    if (base.desc != result.desc) {
+        printf("[TilingBenchmark] %s corpus changed, regenerate the baseline\n", result.caseName.c_str());
+        return;
+    }
+    EXPECT_GE(result.quality.coreUtil + kQualityEpsilon, base.quality.coreUtil)
+        << result.caseName << " " << result.desc;
+    EXPECT_GE(result.quality.ubFill + kQualityEpsilon, base.quality.ubFill) << result.caseName << " " << result.desc;
+    EXPECT_LE(result.quality.tailFraction, base.quality.tailFraction + kQualityEpsilon)
+        << result.caseName << " " << result.desc;
+    EXPECT_LE(result.allocsPerCall, base.allocsPerCall + kAllocEpsilon) << result.caseName << " " << result.desc;
+    if (checkNs) {
+        double tolerance = GetEnvSize("OP_COMMON_TILING_BENCHMARK_NS_TOLERANCE", kDefaultNsTolerance);
+        EXPECT_LE(result.avgNs, base.avgNs * (1.0 + tolerance / kPercentBase)) << result.caseName;
+    }
+}
+
+template <typename CaseFactory>
+static void RunFamily(const std::string& family, uint32_t seedOffset, CaseFactory&& factory)
+{
+    size_t iterations = GetEnvSize("OP_COMMON_TILING_BENCHMARK_ITERATIONS", kDefaultIterations);
+    size_t caseNum = GetEnvSize("OP_COMMON_TILING_BENCHMARK_CASES", kDefaultCases);
+    ShapeGenerator gen(kCorpusSeed + seedOffset);
+    BenchmarkPlatform platform;
+
+    TilingBenchResult summary;
+    summary.caseName = family + "/summary";
+    summary.desc = "cases=" + std::to_string(caseNum);
+    summary.iterations = iterations;
+    for (size_t i = 0; i < caseNum; ++i) {
+        std::unique_ptr<TilingBenchCase> benchCase = factory(gen, platform);
+        TilingBenchResult result = Measure(family + "/" + std::to_string(i), *benchCase, iterations);
+        ReportResult(result);
+        EXPECT_EQ(result.failed, 0U) << result.caseName << " " << result.desc;
+        CheckWithBaseline(result, false);
+        summary.failed += result.failed;
+        summary.avgNs += result.avgNs / caseNum;
+        summary.allocsPerCall += result.allocsPerCall / caseNum;
+        summary.quality.coreUtil += result.quality.coreUtil / caseNum;
+        summary.quality.ubFill += result.quality.ubFill / caseNum;
+        summary.quality.tailFraction += result.quality.tailFraction / caseNum;
+    }
+    ReportResult(summary);
+    CheckWithBaseline(summary, true);
+}
+
+} // namespace Benchmark
+} // namespace Base
+} // namespace Ops
+
+using namespace Ops::Base::Benchmark;
+
+TEST(TilingBenchmark, Elewise)
+{
+    RunFamily("elewise", 0, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<ElewiseCase>(gen, platform);
+    });
+}
+
+TEST(TilingBenchmark, Broadcast)
+{
+    RunFamily("broadcast", 1, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<BroadcastCase>(gen, platform, BroadcastKind::CONTIGUOUS);
+    });
+}
+
+TEST(TilingBenchmark, BroadcastNLastTranspose)
+{
+    RunFamily("broadcast_nlast_transpose", 2, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<BroadcastCase>(gen, platform, BroadcastKind::NLAST_TRANSPOSE);
+    });
+}
+
+TEST(TilingBenchmark, BroadcastLastTranspose)
+{
+    RunFamily("broadcast_last_transpose", 3, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<BroadcastCase>(gen, platform, BroadcastKind::LAST_TRANSPOSE);
+    });
+}
+
+TEST(TilingBenchmark, Reduce)
+{
+    RunFamily("reduce", 4, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<ReduceCase>(gen, platform, true);
+    });
+}
+
+TEST(TilingBenchmark, ReduceNonContiguous)
+{
+    RunFamily("reduce_noncontiguous", 5, [](ShapeGenerator& gen, const BenchmarkPlatform& platform) {
+        return std::make_unique<ReduceCase>(gen, platform, false);
+    });
+}
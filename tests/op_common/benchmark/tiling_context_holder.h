@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_context_holder.h
+ * \brief 基准测试用的最小 TilingContext，只提供模板 tiling 用到的节点名、平台信息和 tiling 输出
+ */
+
+#ifndef OP_COMMON_TILING_CONTEXT_HOLDER_H_
+#define OP_COMMON_TILING_CONTEXT_HOLDER_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "exe_graph/runtime/compute_node_info.h"
+#include "exe_graph/runtime/continuous_vector.h"
+#include "exe_graph/runtime/kernel_run_context.h"
+#include "exe_graph/runtime/tiling_context.h"
+#include "exe_graph/runtime/tiling_data.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace Ops {
+namespace Base {
+namespace Benchmark {
+
+struct BenchmarkPlatform {
+    uint32_t vectorCoreNum = 64;
+    uint32_t cubeCoreNum = 32;
+    uint64_t ubSize = 253952;
+};
+
+/*
+ * 构造一个不含输入输出描述的 TilingContext, 布局与 aclnn 框架构造的 tiling 上下文一致:
+ *   inputs:  [compile_info, platform_info, tiling_func, deterministic, deterministic_level]
+ *   outputs: [tiling_key, block_dim, atomic_clean_flag, tiling_data, workspace, tiling_cond, schedule_mode,
+ *             local_memory_size]
+ * 上下文在多次 tiling 之间复用，每次调用前由 Reset 清空 tiling 输出
+ */
+class TilingContextHolder {
+public:
+    TilingContextHolder(const char* nodeName, const BenchmarkPlatform& platform, size_t tilingDataCap)
+    {
+        InitPlatform(platform);
+        size_t nodeInfoSize = 0;
+        (void)gert::ComputeNodeInfo::CalcSize(0, 0, 0, nodeInfoSize);
+        computeNodeInfo_ = std::make_unique<uint8_t[]>(nodeInfoSize);
+        auto nodeInfo = reinterpret_cast<gert::ComputeNodeInfo*>(computeNodeInfo_.get());
+        nodeInfo->Init(0, 0, 0, nodeName, nodeName);
+
+        tilingData_ = gert::TilingData::CreateCap(tilingDataCap);
+        workspace_ = gert::ContinuousVector::Create<size_t>(WORKSPACE_CAP);
+
+        size_t valueNum = INPUT_NUM + OUTPUT_NUM;
+        values_.resize(valueNum);
+        size_t contextSize = sizeof(KernelRunContext) + sizeof(AsyncAnyValue*) * (valueNum - 1);
+        context_ = std::make_unique<uint8_t[]>(contextSize);
+        auto runContext = reinterpret_cast<KernelRunContext*>(context_.get());
+        runContext->input_size = INPUT_NUM;
+        runContext->output_size = OUTPUT_NUM;
+        runContext->compute_node_info = nodeInfo;
+        runContext->kernel_extend_info = nullptr;
+        for (size_t i = 0; i < valueNum; i++) {
+            runContext->values[i] = &values_[i];
+        }
+        runContext->values[INPUT_TILING_FUNC] = nullptr;
+        runContext->output_start = runContext->values + INPUT_NUM;
+        values_[INPUT_COMPILE_INFO].data.pointer = nullptr;
+        values_[INPUT_PLATFORM_INFO].data.pointer = &platformInfo_;
+        values_[INPUT_NUM + OUTPUT_TILING_DATA].data.pointer = tilingData_.get();
+        values_[INPUT_NUM + OUTPUT_WORKSPACE].data.pointer = workspace_.get();
+        Reset();
+    }
+
+    gert::TilingContext* GetContext() { return reinterpret_cast<gert::TilingContext*>(context_.get()); }
+
+    void Reset()
+    {
+        values_[INPUT_DETERMINISTIC].data.pointer = nullptr;
+        values_[INPUT_DETERMINISTIC_LEVEL].data.pointer = nullptr;
+        for (size_t i = 0; i < OUTPUT_NUM; i++) {
+            if (i != OUTPUT_TILING_DATA && i != OUTPUT_WORKSPACE) {
+                values_[INPUT_NUM + i].data.pointer = nullptr;
+            }
+        }
+        reinterpret_cast<gert::TilingData*>(tilingData_.get())->SetDataSize(0);
+        (void)reinterpret_cast<gert::ContinuousVector*>(workspace_.get())->SetSize(0);
+    }
+
+private:
+    enum TilingInputIndex {
+        INPUT_COMPILE_INFO,
+        INPUT_PLATFORM_INFO,
+        INPUT_TILING_FUNC,
+        INPUT_DETERMINISTIC,
+        INPUT_DETERMINISTIC_LEVEL,
+        INPUT_NUM
+    };
+    enum TilingOutputIndex {
+        OUTPUT_TILING_KEY,
+        OUTPUT_BLOCK_DIM,
+        OUTPUT_ATOMIC_CLEAN_FLAG,
+        OUTPUT_TILING_DATA,
+        OUTPUT_WORKSPACE,
+        OUTPUT_TILING_COND,
+        OUTPUT_SCHEDULE_MODE,
+        OUTPUT_LOCAL_MEMORY_SIZE,
+        OUTPUT_NUM
+    };
+    static constexpr size_t WORKSPACE_CAP = 16;
+
+    void InitPlatform(const BenchmarkPlatform& platform)
+    {
+        std::map<std::string, std::string> socInfo = {
+            {"ai_core_cnt", std::to_string(platform.cubeCoreNum)},
+            {"cube_core_cnt", std::to_string(platform.cubeCoreNum)},
+            {"vector_core_cnt", std::to_string(platform.vectorCoreNum)}};
+        std::map<std::string, std::string> coreSpec = {{"ub_size", std::to_string(platform.ubSize)}};
+        (void)platformInfo_.SetPlatformResWithLock("SoCInfo", socInfo);
+        (void)platformInfo_.SetPlatformResWithLock("AICoreSpec", coreSpec);
+        platformInfo_.SetCoreNum(platform.vectorCoreNum);
+    }
+
+    fe::PlatFormInfos platformInfo_;
+    std::unique_ptr<uint8_t[]> computeNodeInfo_;
+    std::unique_ptr<uint8_t[]> tilingData_;
+    std::unique_ptr<uint8_t[]> workspace_;
+    std::unique_ptr<uint8_t[]> context_;
+    std::vector<AsyncAnyValue> values_;
+};
+
+} // namespace Benchmark
+} // namespace Base
+} // namespace Ops
+
+#endif // OP_COMMON_TILING_CONTEXT_HOLDER_H_
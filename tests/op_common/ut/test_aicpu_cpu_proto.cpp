@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "attr_value_impl.h"
+#include "cpu_attr_value.h"
+#include "cpu_kernel_utils.h"
+#include "cpu_node_def.h"
+#include "cpu_tensor.h"
+#include "cpu_tensor_shape.h"
+#include "tensor_impl.h"
+
+using namespace aicpu;
+
+namespace {
+template <typename T>
+std::vector<T> ToVector(const ListView<T>& view)
+{
+    return std::vector<T>(view.begin(), view.end());
+}
+} // namespace
+
+TEST(TestAicpuCpuProto, AttrStringRef)
+{
+    auto attr = CpuKernelUtils::CreateAttrValue();
+    ASSERT_NE(attr, nullptr);
+    attr->SetString("reduce_axes");
+    EXPECT_EQ(attr->GetStringRef(), attr->GetString());
+    // 引用直接指向proto中的字段
+    auto impl = CpuKernelUtils::GetImpl(attr.get());
+    ASSERT_NE(impl, nullptr);
+    EXPECT_EQ(&attr->GetStringRef(), &impl->GetProto()->s());
+
+    attr->SetListString({"a", "bc", ""});
+    const std::vector<std::string> strs = attr->GetListString();
+    ASSERT_EQ(attr->ListStringSize(), 3);
+    for (int32_t i = 0; i < attr->ListStringSize(); i++) {
+        EXPECT_EQ(attr->GetListStringRef(i), strs[i]);
+    }
+    EXPECT_TRUE(attr->GetListStringRef(-1).empty());
+    EXPECT_TRUE(attr->GetListStringRef(3).empty());
+}
+
+TEST(TestAicpuCpuProto, AttrListIntAndFloatView)
+{
+    auto attr = CpuKernelUtils::CreateAttrValue();
+    ASSERT_NE(attr, nullptr);
+    EXPECT_TRUE(attr->GetListIntView().Empty());
+    EXPECT_TRUE(attr->GetListFloatView().Empty());
+
+    attr->SetListInt({1, -2, INT64_MAX});
+    ListView<int64_t> ints = attr->GetListIntView();
+    EXPECT_EQ(ints.Size(), attr->ListIntSize());
+    EXPECT_EQ(ToVector(ints), attr->GetListInt());
+    auto impl = CpuKernelUtils::GetImpl(attr.get());
+    ASSERT_NE(impl, nullptr);
+    EXPECT_EQ(ints.Data(), impl->GetProto()->array().i().data());
+
+    attr->SetListFloat({0.5F, -1.25F});
+    ListView<float> floats = attr->GetListFloatView();
+    EXPECT_EQ(floats.Size(), attr->ListFloatSize());
+    EXPECT_EQ(ToVector(floats), attr->GetListFloat());
+    EXPECT_EQ(floats.Data(), impl->GetProto()->array().f().data());
+}
+
+TEST(TestAicpuCpuProto, AttrListListIntView)
+{
+    auto attr = CpuKernelUtils::CreateAttrValue();
+    ASSERT_NE(attr, nullptr);
+    EXPECT_EQ(attr->ListListIntSize(), 0);
+
+    attr->SetListListInt({{1, 2}, {}, {3, 4, 5}});
+    const std::vector<std::vector<int64_t>> lists = attr->GetListListInt();
+    ASSERT_EQ(attr->ListListIntSize(), static_cast<int32_t>(lists.size()));
+    for (int32_t i = 0; i < attr->ListListIntSize(); i++) {
+        EXPECT_EQ(ToVector(attr->GetListListIntView(i)), lists[i]);
+    }
+    EXPECT_TRUE(attr->GetListListIntView(-1).Empty());
+    EXPECT_TRUE(attr->GetListListIntView(3).Empty());
+}
+
+TEST(TestAicpuCpuProto, AttrArrayBoundByReference)
+{
+    auto attr = CpuKernelUtils::CreateAttrValue();
+    ASSERT_NE(attr, nullptr);
+    // 列表的大小及取值都读自attr本身, 后续修改立即可见
+    for (int64_t i = 0; i < 4; i++) {
+        attr->AddListInt(i);
+        attr->AddListFloat(static_cast<float>(i));
+        attr->AddListString(std::to_string(i));
+        EXPECT_EQ(attr->ListIntSize(), i + 1);
+        EXPECT_EQ(attr->ListFloatSize(), i + 1);
+        EXPECT_EQ(attr->ListStringSize(), i + 1);
+        EXPECT_EQ(attr->GetListIntView().Size(), i + 1);
+        EXPECT_EQ(attr->GetListIntView()[static_cast<int32_t>(i)], i);
+        EXPECT_EQ(attr->GetListStringRef(static_cast<int32_t>(i)), std::to_string(i));
+    }
+    EXPECT_EQ(attr->GetListInt(), std::vector<int64_t>({0, 1, 2, 3}));
+    EXPECT_EQ(ToVector(attr->GetListFloatView()), attr->GetListFloat());
+}
+
+TEST(TestAicpuCpuProto, TensorShapeCached)
+{
+    auto tensor = CpuKernelUtils::CreateTensor();
+    ASSERT_NE(tensor, nullptr);
+    tensor->SetDataType(DT_FLOAT);
+    auto shape = tensor->GetTensorShape();
+    ASSERT_NE(shape, nullptr);
+    EXPECT_EQ(tensor->GetTensorShape(), shape);
+
+    // 缓存的shape包装tensor自身的shape proto, SetTensorShape后同步更新
+    auto newShape = CpuKernelUtils::CreateTensorShape();
+    ASSERT_NE(newShape, nullptr);
+    newShape->SetDimSizes({2, 3, 4});
+    ASSERT_TRUE(tensor->SetTensorShape(newShape.get()));
+    EXPECT_EQ(tensor->GetTensorShape(), shape);
+    EXPECT_EQ(shape->GetDimSizes(), std::vector<int64_t>({2, 3, 4}));
+    EXPECT_EQ(tensor->NumElements(), 24);
+    EXPECT_EQ(tensor->CalcDataSizeByShape(), 24 * static_cast<int64_t>(sizeof(float)));
+
+    newShape->SetDimSizes({5});
+    ASSERT_TRUE(tensor->SetTensorShape(newShape.get()));
+    EXPECT_EQ(shape->GetDimSizes(), std::vector<int64_t>({5}));
+    EXPECT_EQ(tensor->NumElements(), 5);
+
+    auto impl = CpuKernelUtils::GetImpl(tensor.get());
+    ASSERT_NE(impl, nullptr);
+    impl->SetName("x");
+    EXPECT_EQ(impl->GetNameRef(), impl->GetName());
+    EXPECT_EQ(&impl->GetNameRef(), &impl->GetProto()->name());
+}
+
+TEST(TestAicpuCpuProto, NodeDefParseFromArray)
+{
+    auto nodeDef = CpuKernelUtils::CreateNodeDef();
+    ASSERT_NE(nodeDef, nullptr);
+    nodeDef->SetOpType("ReduceSum");
+    auto input = nodeDef->AddInputs();
+    ASSERT_NE(input, nullptr);
+    input->SetDataType(DT_INT32);
+    auto shape = CpuKernelUtils::CreateTensorShape();
+    ASSERT_NE(shape, nullptr);
+    shape->SetDimSizes({8, 16});
+    ASSERT_TRUE(input->SetTensorShape(shape.get()));
+    ASSERT_NE(nodeDef->AddOutputs(), nullptr);
+    auto axes = CpuKernelUtils::CreateAttrValue();
+    ASSERT_NE(axes, nullptr);
+    axes->SetListInt({0, 1});
+    ASSERT_TRUE(nodeDef->AddAttrs("axes", axes.get()));
+
+    std::string buf;
+    ASSERT_TRUE(nodeDef->SerializeToString(buf));
+    auto parsed = CpuKernelUtils::CreateNodeDef();
+    ASSERT_NE(parsed, nullptr);
+    ASSERT_TRUE(parsed->ParseFromArray(buf.data(), static_cast<uint32_t>(buf.size())));
+    EXPECT_EQ(parsed->GetOpType(), "ReduceSum");
+    ASSERT_EQ(parsed->InputsSize(), 1);
+    EXPECT_EQ(parsed->OutputsSize(), 1);
+    auto parsedInput = parsed->MutableInputs(0);
+    ASSERT_NE(parsedInput, nullptr);
+    EXPECT_EQ(parsedInput->GetDataType(), DT_INT32);
+    EXPECT_EQ(parsedInput->NumElements(), 8 * 16);
+    auto attrs = parsed->Attrs();
+    ASSERT_EQ(attrs.count("axes"), 1U);
+    EXPECT_EQ(ToVector(attrs["axes"]->GetListIntView()), std::vector<int64_t>({0, 1}));
+
+    // 与ParseFromString的结果一致
+    auto fromString = CpuKernelUtils::CreateNodeDef();
+    ASSERT_NE(fromString, nullptr);
+    ASSERT_TRUE(fromString->ParseFromString(buf));
+    std::string lhs;
+    std::string rhs;
+    ASSERT_TRUE(parsed->SerializeToString(lhs));
+    ASSERT_TRUE(fromString->SerializeToString(rhs));
+    EXPECT_EQ(lhs, rhs);
+
+    const char invalid[] = {'\xff', '\xff', '\xff'};
+    EXPECT_FALSE(parsed->ParseFromArray(invalid, sizeof(invalid)));
+    EXPECT_FALSE(parsed->ParseFromArray(buf.data(), static_cast<uint32_t>(INT32_MAX) + 1U));
+}
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "atvoss/host/broadcast_host_sch.h"
+
+using namespace Ops::Base;
+
+namespace {
+// y = (x0 + brc(x1)) * var, x0通过CopyInBrc广播，x1通过ub内的Brc广播
+struct AddBrcDag {
+    using OpCopyIn0 = Bind<Vec::CopyInBrc<float>, Placeholder::In0<float>>;
+    using OpCopyIn1 = Bind<Vec::CopyIn<float>, Placeholder::In1<float>>;
+    using OpBrc = Bind<Vec::Brc<float>, OpCopyIn1>;
+    using OpAdd = Bind<Vec::Add<float>, OpCopyIn0, OpBrc>;
+    using OpMuls = Bind<Vec::Muls<float>, OpAdd, Placeholder::Var<float, 0>>;
+    using OpCopyOut = Bind<Vec::CopyOut<float>, Placeholder::Out0<float>, OpMuls>;
+    using Outputs = Elems<OpCopyOut>;
+    using OpDag = DAGSch<Outputs>;
+};
+
+constexpr int64_t DIM_NUM = 3;
+const int64_t OUT_DIMS[DIM_NUM] = {4, 5, 6};
+const int64_t X0_DIMS[DIM_NUM] = {4, 1, 6};
+const int64_t X1_DIMS[DIM_NUM] = {1, 5, 1};
+
+// 连续stride，广播轴stride为0
+void GetBrcStrides(const int64_t* dims, int64_t* strides)
+{
+    int64_t stride = 1;
+    for (int64_t i = DIM_NUM - 1; i >= 0; i--) {
+        strides[i] = dims[i] == 1 ? 0 : stride;
+        stride *= dims[i];
+    }
+}
+
+// 按NPU broadcast tiling的含义构造切分
+BroadcastBaseTilingData<AddBrcDag::OpDag> MakeTiling(int32_t ubSplitAxis, int32_t ubFormer, int64_t blockFormer)
+{
+    BroadcastBaseTilingData<AddBrcDag::OpDag> tiling{};
+    tiling.shapeLen = DIM_NUM;
+    tiling.ubSplitAxis = ubSplitAxis;
+    tiling.ubFormer = ubFormer;
+    tiling.ubOuter = (OUT_DIMS[ubSplitAxis] + ubFormer - 1) / ubFormer;
+    tiling.ubTail = OUT_DIMS[ubSplitAxis] - (tiling.ubOuter - 1) * ubFormer;
+    int64_t stride = 1;
+    for (int64_t i = DIM_NUM - 1; i >= 0; i--) {
+        tiling.outputDims[i] = OUT_DIMS[i];
+        tiling.outputStrides[i] = stride;
+        stride *= OUT_DIMS[i];
+    }
+    tiling.dimProductBeforeUbInner = tiling.ubOuter;
+    for (int32_t i = 0; i < ubSplitAxis; i++) {
+        tiling.dimProductBeforeUbInner *= OUT_DIMS[i];
+    }
+    tiling.blockFormer = blockFormer;
+    tiling.blockNum = (tiling.dimProductBeforeUbInner + blockFormer - 1) / blockFormer;
+    tiling.blockTail = tiling.dimProductBeforeUbInner - (tiling.blockNum - 1) * blockFormer;
+    tiling.elemNum = ubFormer * tiling.outputStrides[ubSplitAxis];
+
+    GetBrcStrides(X0_DIMS, tiling.inputBrcStrides[0]);
+    GetBrcStrides(X1_DIMS, tiling.inputStrides[1]);
+    int64_t innerLen = 1;
+    for (int64_t i = ubSplitAxis + 1; i < DIM_NUM; i++) {
+        innerLen *= X1_DIMS[i];
+    }
+    bool splitBrc = X1_DIMS[ubSplitAxis] == 1;
+    tiling.inputDims[1][0] = (splitBrc ? 1 : ubFormer) * innerLen;
+    tiling.inputDims[1][1] = (splitBrc ? 1 : tiling.ubTail) * innerLen;
+    for (int64_t i = 0; i < DIM_NUM; i++) {
+        tiling.inputVecBrcDims[0][i] = X1_DIMS[i];
+    }
+    tiling.inputVecBrcStrides[0] = 1;
+    float var = 0.5f;
+    std::memcpy(tiling.scalarData, &var, sizeof(var));
+    return tiling;
+}
+
+void CheckAddBrc(int32_t ubSplitAxis, int32_t ubFormer, int64_t blockFormer)
+{
+    using OpDag = AddBrcDag::OpDag;
+    std::vector<float> x0(4 * 6);
+    std::vector<float> x1(5);
+    std::vector<float> y(4 * 5 * 6, 0.0f);
+    for (size_t i = 0; i < x0.size(); i++) {
+        x0[i] = static_cast<float>(i);
+    }
+    for (size_t i = 0; i < x1.size(); i++) {
+        x1[i] = static_cast<float>(i) * 100.0f;
+    }
+    auto tiling = MakeTiling(ubSplitAxis, ubFormer, blockFormer);
+    BroadcastHostSch<OpDag> sch(&tiling);
+    sch.Init(x0.data(), x1.data(), y.data());
+    sch.Process();
+    for (int64_t i = 0; i < OUT_DIMS[0]; i++) {
+        for (int64_t j = 0; j < OUT_DIMS[1]; j++) {
+            for (int64_t k = 0; k < OUT_DIMS[2]; k++) {
+                float expect = (x0[i * 6 + k] + x1[j]) * 0.5f;
+                ASSERT_FLOAT_EQ(y[(i * 5 + j) * 6 + k], expect) << i << " " << j << " " << k;
+            }
+        }
+    }
+    // 每个ub块上每个节点执行一次
+    uint64_t tileNum = tiling.dimProductBeforeUbInner;
+    for (uint32_t pos = 0; pos < OpDag::FunList::Size; pos++) {
+        EXPECT_EQ(sch.GetNodeStat(pos).calls, tileNum);
+        EXPECT_EQ(sch.GetNodeStat(pos).elements, y.size());
+    }
+    EXPECT_EQ(sch.GetStageStat(HostStage::COPY_OUT).bytes, y.size() * sizeof(float));
+}
+} // namespace
+
+TEST(TestBroadcastHostSch, testSplitInnerAxis)
+{
+    // 切分轴非广播轴，尾核、尾块均不对齐
+    CheckAddBrc(1, 2, 5);
+}
+
+TEST(TestBroadcastHostSch, testSplitOuterAxis)
+{
+    // 切分轴上x1为广播轴
+    CheckAddBrc(0, 3, 1);
+}
+
+TEST(TestBroadcastHostSch, testSplitLastAxis)
+{
+    CheckAddBrc(2, 4, 7);
+}
+
+TEST(TestBroadcastHostSch, testSetVar)
+{
+    using OpDag = AddBrcDag::OpDag;
+    std::vector<float> x0(4 * 6, 1.0f);
+    std::vector<float> x1(5, 2.0f);
+    std::vector<float> y(4 * 5 * 6, 0.0f);
+    auto tiling = MakeTiling(1, 5, 4);
+    BroadcastHostSch<OpDag> sch(&tiling);
+    sch.Init(x0.data(), x1.data(), y.data());
+    sch.SetVar<float, 0>(3.0f);
+    sch.Process();
+    for (float value : y) {
+        EXPECT_FLOAT_EQ(value, 9.0f);
+    }
+}
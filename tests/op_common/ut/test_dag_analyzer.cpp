@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include <vector>
+#include "atvoss/host/dag_analyzer.h"
+
+using namespace Ops::Base;
+
+namespace {
+// y = (x0 + x1) * (x2 - x3)
+struct AddSubMulDag {
+    using OpCopyIn0 = Bind<Vec::CopyIn<float>, Placeholder::In0<float>>;
+    using OpCopyIn1 = Bind<Vec::CopyIn<float>, Placeholder::In1<float>>;
+    using OpCopyIn2 = Bind<Vec::CopyIn<float>, Placeholder::In2<float>>;
+    using OpCopyIn3 = Bind<Vec::CopyIn<float>, Placeholder::In3<float>>;
+    using OpAdd = Bind<Vec::Add<float>, OpCopyIn0, OpCopyIn1>;
+    using OpSub = Bind<Vec::Sub<float>, OpCopyIn2, OpCopyIn3>;
+    using OpMul = Bind<Vec::Mul<float>, OpAdd, OpSub>;
+    using OpCopyOut = Bind<Vec::CopyOut<float>, Placeholder::Out0<float>, OpMul>;
+    using Outputs = Elems<OpCopyOut>;
+    // 先搬入全部输入再计算
+    using CopyInFirst = Elems<OpCopyIn0, OpCopyIn1, OpCopyIn2, OpCopyIn3, OpAdd, OpSub, OpMul, OpCopyOut>;
+    using Interleaved = Elems<OpCopyIn0, OpCopyIn1, OpAdd, OpCopyIn2, OpCopyIn3, OpSub, OpMul, OpCopyOut>;
+    using OpDag = DAGSch<Outputs, CopyInFirst>;
+};
+
+// y0 = half(x * var), y1 = x
+struct CastMulsDag {
+    using OpCopyIn = Bind<Vec::CopyIn<float>, Placeholder::In0<float>>;
+    using OpMuls = Bind<Vec::Muls<float>, OpCopyIn, Placeholder::Var<float, 0>>;
+    using OpCast = Bind<Vec::Cast<half, float, 1>, OpMuls>;
+    using OpCopyOut0 = Bind<Vec::CopyOut<half>, Placeholder::Out0<half>, OpCast>;
+    using OpCopyOut1 = Bind<Vec::CopyOut<float>, Placeholder::Out1<float>, OpCopyIn>;
+    using Outputs = Elems<OpCopyOut0, OpCopyOut1>;
+    using OpDag = DAGSch<Outputs>;
+};
+
+template <class OpDag>
+void CheckSameAsDagSch(const DagBufferReport& report)
+{
+    EXPECT_EQ(report.maxAliveNode, OpDag::MaxAliveNode);
+    EXPECT_EQ(report.tempCalcNode, OpDag::TempCalcNode);
+    EXPECT_EQ(report.maxAliveNodeForNddma, OpDag::MaxAliveNodeForNddma);
+    EXPECT_EQ(report.tempCalcNodeForNddma, OpDag::TempCalcNodeForNddma);
+    EXPECT_EQ(report.maxDtypeBytes, OpDag::MaxDtypeBytes);
+    EXPECT_EQ(report.minDtypeBytes, OpDag::MinDtypeBytes);
+    EXPECT_EQ(report.bufLevel, OpDag::BufLevel);
+    EXPECT_EQ(report.bufferNum, OpDag::BufferNum);
+}
+} // namespace
+
+TEST(TestDagAnalyzer, testSameAsDagSch)
+{
+    using OpDag = CastMulsDag::OpDag;
+    DagAnalyzer analyzer = DagAnalyzer::Create<OpDag>();
+    ASSERT_EQ(analyzer.GetNodes().size(), OpDag::FunList::Size);
+    DagBufferReport report = analyzer.Analyze();
+    CheckSameAsDagSch<OpDag>(report);
+    ASSERT_EQ(report.timeline.size(), OpDag::FunList::Size);
+
+    DagBufferReport dagReport = AnalyzeDag<OpDag>();
+    EXPECT_EQ(dagReport.bufferNum, report.bufferNum);
+    for (const auto& step : dagReport.timeline) {
+        // 非搬出节点都分配了buffer
+        if (!analyzer.GetNodes()[step.node].isCopyOut) {
+            EXPECT_GE(step.pingBufferId, 0);
+        }
+    }
+    EXPECT_EQ(report.GetMaxElemNum(192 * 1024),
+              (192 * 1024 / (OpDag::BufferNum * OpDag::MaxDtypeBytes)) / (256 / OpDag::MinDtypeBytes) *
+                  (256 / OpDag::MinDtypeBytes));
+    EXPECT_EQ(report.GetMaxElemNum(1024, 1024), 0);
+}
+
+TEST(TestDagAnalyzer, testComputeOrderAndMemLevel)
+{
+    using OpDag = AddSubMulDag::OpDag;
+    using Interleaved = DAGSch<AddSubMulDag::Outputs, AddSubMulDag::Interleaved>;
+    using Level1 = DAGSch<AddSubMulDag::Outputs, AddSubMulDag::CopyInFirst, MemOptCfg<MemLevel::LEVEL_1>>;
+    DagAnalyzer analyzer = DagAnalyzer::Create<OpDag>();
+    CheckSameAsDagSch<OpDag>(analyzer.Analyze());
+    CheckSameAsDagSch<Interleaved>(AnalyzeDag<OpDag, AddSubMulDag::Interleaved>());
+    CheckSameAsDagSch<Level1>(AnalyzeDag<OpDag, void, MemOptCfg<MemLevel::LEVEL_1>>());
+    CheckSameAsDagSch<Level1>(analyzer.Analyze({0, 1, 2, 3, 4, 5, 6, 7}, MemLevel::LEVEL_1));
+
+    // Add在Sub之后的位置为5，与Interleaved一致的计算序
+    std::vector<uint32_t> interleaved = {0, 1, 4, 2, 3, 5, 6, 7};
+    EXPECT_TRUE(analyzer.IsLegalOrder(interleaved));
+    CheckSameAsDagSch<Interleaved>(analyzer.Analyze(interleaved));
+    EXPECT_FALSE(analyzer.IsLegalOrder({0, 4, 1, 2, 3, 5, 6, 7}));
+    EXPECT_FALSE(analyzer.IsLegalOrder({0, 1, 2, 3, 4, 5, 6}));
+    EXPECT_TRUE(analyzer.Analyze({0, 0, 1, 2, 3, 4, 5, 6}).order.empty());
+}
+
+TEST(TestDagAnalyzer, testSearchComputeOrder)
+{
+    using OpDag = AddSubMulDag::OpDag;
+    using Interleaved = DAGSch<AddSubMulDag::Outputs, AddSubMulDag::Interleaved>;
+    DagAnalyzer analyzer = DagAnalyzer::Create<OpDag>();
+    DagBufferReport origin = analyzer.Analyze();
+    DagBufferReport best = analyzer.SearchComputeOrder();
+    ASSERT_TRUE(analyzer.IsLegalOrder(best.order));
+    EXPECT_LT(best.maxAliveNodeForNddma, origin.maxAliveNodeForNddma);
+    EXPECT_EQ(best.maxAliveNodeForNddma, Interleaved::MaxAliveNodeForNddma);
+    EXPECT_FALSE(analyzer.ToString(best).empty());
+
+    // 搜索步数不足时返回原计算序
+    DagBufferReport limited = analyzer.SearchComputeOrder(1);
+    EXPECT_EQ(limited.order, origin.order);
+}
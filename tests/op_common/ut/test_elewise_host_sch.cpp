@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "atvoss/host/elewise_host_sch.h"
+
+using namespace Ops::Base;
+
+namespace {
+// y = (x0 + x1) * var
+template <typename T>
+struct AddMulsDag {
+    using OpCopyIn0 = Bind<Vec::CopyIn<T>, Placeholder::In0<T>>;
+    using OpCopyIn1 = Bind<Vec::CopyIn<T>, Placeholder::In1<T>>;
+    using OpAdd = Bind<Vec::Add<T>, OpCopyIn0, OpCopyIn1>;
+    using OpMuls = Bind<Vec::Muls<T>, OpAdd, Placeholder::Var<T, 0>>;
+    using OpCopyOut = Bind<Vec::CopyOut<T>, Placeholder::Out0<T>, OpMuls>;
+    using Outputs = Elems<OpCopyOut>;
+    using OpDag = DAGSch<Outputs>;
+};
+
+// y0 = half(max(x, 0)), y1 = x > 1 ? x : exp(x)
+struct CastSelectDag {
+    using OpCopyIn = Bind<Vec::CopyIn<float>, Placeholder::In0<float>>;
+    using OpRelu = Bind<Vec::Relu<float>, OpCopyIn>;
+    using OpCast = Bind<Vec::Cast<half, float, 1>, OpRelu>;
+    using OpCopyOut0 = Bind<Vec::CopyOut<half>, Placeholder::Out0<half>, OpCast>;
+    using OpExp = Bind<Vec::Exp<float>, OpCopyIn>;
+    using OpThreshold = Placeholder::In1<float, Placeholder::ScalarAttr<1>>;
+    using OpCompare = Bind<Vec::Compare<uint8_t, float, 1>, OpCopyIn, OpThreshold>;
+    using OpSelect = Bind<Vec::Select<uint8_t, float, 2>, OpCompare, OpCopyIn, OpExp>;
+    using OpCopyOut1 = Bind<Vec::CopyOut<float>, Placeholder::Out1<float>, OpSelect>;
+    using Outputs = Elems<OpCopyOut0, OpCopyOut1>;
+    using OpDag = DAGSch<Outputs>;
+};
+
+EleBaseTilingData MakeTiling(int64_t dim0, int64_t blockNum, int32_t ubFormer)
+{
+    EleBaseTilingData tiling{};
+    tiling.dim0 = dim0;
+    tiling.blockNum = blockNum;
+    tiling.ubFormer = ubFormer;
+    tiling.blockFormer = (dim0 + blockNum - 1) / blockNum;
+    int64_t blockTail = dim0 - tiling.blockFormer * (blockNum - 1);
+    tiling.ubLoopOfFormerBlock = (tiling.blockFormer + ubFormer - 1) / ubFormer;
+    tiling.ubLoopOfTailBlock = (blockTail + ubFormer - 1) / ubFormer;
+    tiling.ubTailOfFormerBlock = tiling.blockFormer - (tiling.ubLoopOfFormerBlock - 1) * ubFormer;
+    tiling.ubTailOfTailBlock = blockTail - (tiling.ubLoopOfTailBlock - 1) * ubFormer;
+    return tiling;
+}
+} // namespace
+
+TEST(TestElewiseHostSch, testAddMulsFloat)
+{
+    using OpDag = AddMulsDag<float>::OpDag;
+    constexpr int64_t num = 1000;
+    std::vector<float> x0(num);
+    std::vector<float> x1(num);
+    std::vector<float> y(num, 0.0f);
+    for (int64_t i = 0; i < num; i++) {
+        x0[i] = static_cast<float>(i) * 0.5f;
+        x1[i] = static_cast<float>(num - i);
+    }
+    // 尾核、尾块均不对齐
+    EleBaseTilingData tiling = MakeTiling(num, 3, 64);
+    ElementwiseHostSch<OpDag> sch(&tiling);
+    sch.Init(x0.data(), x1.data(), y.data());
+    sch.SetVar<float, 0>(2.0f);
+    sch.EnableProfiling(true);
+    sch.Process();
+    for (int64_t i = 0; i < num; i++) {
+        EXPECT_FLOAT_EQ(y[i], (x0[i] + x1[i]) * 2.0f);
+    }
+
+    // 每个tile上每个节点执行一次
+    uint64_t tileNum = tiling.ubLoopOfFormerBlock * 2 + tiling.ubLoopOfTailBlock;
+    for (uint32_t pos = 0; pos < OpDag::FunList::Size; pos++) {
+        EXPECT_EQ(sch.GetNodeStat(pos).calls, tileNum);
+        EXPECT_EQ(sch.GetNodeStat(pos).elements, static_cast<uint64_t>(num));
+    }
+    EXPECT_EQ(sch.GetStageStat(HostStage::COPY_IN).bytes, num * sizeof(float) * 2);
+    EXPECT_EQ(sch.GetStageStat(HostStage::COPY_OUT).bytes, num * sizeof(float));
+    EXPECT_EQ(sch.GetStageStat(HostStage::COMPUTE).elements, static_cast<uint64_t>(num) * 2);
+    sch.ResetStat();
+    EXPECT_EQ(sch.GetStageStat(HostStage::COMPUTE).calls, 0U);
+}
+
+TEST(TestElewiseHostSch, testAddMulsInt8)
+{
+    using OpDag = AddMulsDag<int8_t>::OpDag;
+    constexpr int64_t num = 300;
+    std::vector<int8_t> x0(num);
+    std::vector<int8_t> x1(num);
+    std::vector<int8_t> y(num, 0);
+    for (int64_t i = 0; i < num; i++) {
+        x0[i] = static_cast<int8_t>(i % 7);
+        x1[i] = static_cast<int8_t>(-(i % 5));
+    }
+    EleBaseTilingData tiling = MakeTiling(num, 1, 256);
+    ElementwiseHostSch<OpDag> sch(&tiling);
+    sch.Init(x0.data(), x1.data(), y.data());
+    sch.SetVar<int8_t, 0>(3);
+    sch.Process();
+    for (int64_t i = 0; i < num; i++) {
+        EXPECT_EQ(y[i], static_cast<int8_t>((x0[i] + x1[i]) * 3));
+    }
+}
+
+TEST(TestElewiseHostSch, testCastCompareSelect)
+{
+    using OpDag = CastSelectDag::OpDag;
+    constexpr int64_t num = 77;
+    std::vector<float> x(num);
+    for (int64_t i = 0; i < num; i++) {
+        x[i] = static_cast<float>(i - 30) * 0.1f;
+    }
+    float threshold = 1.0f;
+    std::vector<half> y0(num);
+    std::vector<float> y1(num, 0.0f);
+    EleBaseTilingData tiling = MakeTiling(num, 2, 32);
+    ElementwiseHostSch<OpDag> sch(&tiling);
+    sch.Init(x.data(), &threshold, y0.data(), y1.data());
+    sch.Process();
+    for (int64_t i = 0; i < num; i++) {
+        float relu = x[i] > 0.0f ? x[i] : 0.0f;
+        EXPECT_EQ(y0[i].value, Host::FloatToHalf(relu));
+        EXPECT_FLOAT_EQ(y1[i], x[i] > threshold ? x[i] : std::exp(x[i]));
+    }
+}
+
+TEST(TestElewiseHostSch, testHalfConvert)
+{
+    EXPECT_EQ(Host::FloatToHalf(1.0f), 0x3C00U);
+    EXPECT_EQ(Host::FloatToHalf(-2.0f), 0xC000U);
+    EXPECT_EQ(Host::FloatToHalf(65504.0f), 0x7BFFU);
+    EXPECT_EQ(Host::FloatToHalf(65520.0f), 0x7C00U);
+    EXPECT_EQ(Host::FloatToHalf(5.9604645e-8f), 0x0001U);
+    EXPECT_FLOAT_EQ(Host::HalfToFloat(0x3555U), 0.33325195f);
+    EXPECT_FLOAT_EQ(Host::HalfToFloat(0x0001U), 5.9604645e-8f);
+    EXPECT_TRUE(std::isnan(Host::HalfToFloat(Host::FloatToHalf(NAN))));
+    EXPECT_EQ(Host::FloatToBf16(1.0f), 0x3F80U);
+    EXPECT_FLOAT_EQ(Host::Bf16ToFloat(0x4049U), 3.140625f);
+}
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "atvoss/host/reduce_host_sch.h"
+
+using namespace Ops::Base;
+using namespace Ops::Base::ReduceOpTmpl;
+
+namespace {
+// y = sum(x) * var
+struct ReduceMeanDag {
+    using OpCopyIn = Bind<Vec::CopyIn<float>, Placeholder::In0<float>>;
+    using OpReduce = Bind<Vec::ReduceSumOp<float>, OpCopyIn>;
+    using OpMuls = Bind<Vec::Muls<float>, OpReduce, Placeholder::Var<float, 0>>;
+    using OpCopyOut = Bind<Vec::CopyOut<float>, Placeholder::Out0<float>, OpMuls>;
+    using OpDag = DAGSch<Elems<OpCopyOut>>;
+};
+
+// y = half(max(float(x0) * float(x1)))
+struct ReduceMaxMulDag {
+    using OpCopyIn0 = Bind<Vec::CopyIn<half>, Placeholder::In0<half>>;
+    using OpCopyIn1 = Bind<Vec::CopyIn<half>, Placeholder::In1<half>>;
+    using OpCast0 = Bind<Vec::Cast<float, half, 0>, OpCopyIn0>;
+    using OpCast1 = Bind<Vec::Cast<float, half, 0>, OpCopyIn1>;
+    using OpMul = Bind<Vec::Mul<float>, OpCast0, OpCast1>;
+    using OpReduce = Bind<Vec::ReduceMaxOp<float>, OpMul>;
+    using OpCast = Bind<Vec::Cast<half, float, 1>, OpReduce>;
+    using OpCopyOut = Bind<Vec::CopyOut<half>, Placeholder::Out0<half>, OpCast>;
+    using OpDag = DAGSch<Elems<OpCopyOut>>;
+};
+
+// 连续输入的tiling，basicBlock/resultBlock取小值使A、R轴都切成多块
+template <class Pattern>
+ReduceOpTilingData MakeTiling(const std::vector<uint64_t>& shape, int32_t coreNum, uint64_t basicBlock,
+                              uint64_t resultBlock)
+{
+    ReduceOpTilingData tiling{};
+    int64_t stride = 1;
+    uint64_t outSize = 1;
+    for (int32_t i = Pattern::Dim - 1; i >= 0; i--) {
+        tiling.shape[i] = shape[i];
+        tiling.stride[i] = stride;
+        tiling.dstStride[i] = static_cast<int64_t>(outSize);
+        stride *= static_cast<int64_t>(shape[i]);
+        if ((i % 2 == 0) == Pattern::FirstA) {
+            outSize *= shape[i];
+        }
+    }
+    tiling.outSize = outSize;
+    tiling.basicBlock = basicBlock;
+    tiling.resultBlock = resultBlock;
+    tiling.coreNum = coreNum;
+    tiling.realCoreNum = coreNum;
+    tiling.groupR = 1;
+    tiling.meanVar = static_cast<float>(outSize) / static_cast<float>(stride);
+    return tiling;
+}
+} // namespace
+
+TEST(TestReduceHostSch, testReduceMeanAR)
+{
+    using OpDag = ReduceMeanDag::OpDag;
+    constexpr uint64_t dimA = 13;
+    constexpr uint64_t dimR = 37;
+    std::vector<float> x(dimA * dimR);
+    for (size_t i = 0; i < x.size(); i++) {
+        x[i] = static_cast<float>(i % 11) - 5.0f;
+    }
+    std::vector<float> y(dimA, 0.0f);
+    auto tiling = MakeTiling<__reducePattern::AR>({dimA, dimR}, 3, 64, 16);
+    ReduceHostSch<PATTERN_AR, OpDag> sch(&tiling);
+    sch.Init(x.data(), y.data());
+    sch.SetVar<float, 0>(tiling.meanVar);
+    sch.EnableProfiling(true);
+    sch.Process();
+    for (uint64_t a = 0; a < dimA; a++) {
+        float sum = 0.0f;
+        for (uint64_t r = 0; r < dimR; r++) {
+            sum += x[a * dimR + r];
+        }
+        EXPECT_NEAR(y[a], sum / dimR, 1e-5f) << a;
+    }
+    EXPECT_EQ(sch.GetStageStat(HostStage::COPY_IN).bytes, x.size() * sizeof(float));
+    EXPECT_EQ(sch.GetStageStat(HostStage::COPY_OUT).bytes, y.size() * sizeof(float));
+    // ReduceOp处理全部输入，Reduce后的节点只处理输出
+    EXPECT_EQ(sch.GetNodeStat(OpDag::ReduceOpPos).elements, x.size());
+    EXPECT_EQ(sch.GetNodeStat(OpDag::ReduceOpPos + 1).elements, y.size());
+    EXPECT_GT(sch.GetNodeStat(OpDag::ReduceOpPos).calls, sch.GetNodeStat(OpDag::ReduceOpPos + 1).calls);
+}
+
+TEST(TestReduceHostSch, testReduceSumRA)
+{
+    using OpDag = ReduceMeanDag::OpDag;
+    constexpr uint64_t dimR = 29;
+    constexpr uint64_t dimA = 10;
+    std::vector<float> x(dimR * dimA);
+    for (size_t i = 0; i < x.size(); i++) {
+        x[i] = static_cast<float>(i % 7);
+    }
+    std::vector<float> y(dimA, 0.0f);
+    auto tiling = MakeTiling<__reducePattern::RA>({dimR, dimA}, 4, 128, 32);
+    ReduceHostSch<PATTERN_RA, OpDag> sch(&tiling);
+    sch.Init(x.data(), y.data());
+    sch.SetVar<float, 0>(1.0f);
+    sch.Process();
+    for (uint64_t a = 0; a < dimA; a++) {
+        float sum = 0.0f;
+        for (uint64_t r = 0; r < dimR; r++) {
+            sum += x[r * dimA + a];
+        }
+        EXPECT_FLOAT_EQ(y[a], sum) << a;
+    }
+}
+
+TEST(TestReduceHostSch, testReduceMaxARA)
+{
+    using OpDag = ReduceMaxMulDag::OpDag;
+    const std::vector<uint64_t> shape = {3, 10, 4};
+    const size_t num = shape[0] * shape[1] * shape[2];
+    std::vector<half> x0(num);
+    std::vector<half> x1(num);
+    for (size_t i = 0; i < num; i++) {
+        x0[i].value = Host::FloatToHalf(static_cast<float>((i * 7) % 23) - 11.0f);
+        x1[i].value = Host::FloatToHalf(i % 2 == 0 ? 0.5f : -1.0f);
+    }
+    std::vector<half> y(shape[0] * shape[2]);
+    auto tiling = MakeTiling<__reducePattern::ARA>(shape, 2, 48, 8);
+    ReduceHostSch<PATTERN_ARA, OpDag> sch(&tiling);
+    sch.Init(x0.data(), x1.data(), y.data());
+    sch.Process();
+    for (uint64_t i = 0; i < shape[0]; i++) {
+        for (uint64_t k = 0; k < shape[2]; k++) {
+            float expect = -INFINITY;
+            for (uint64_t j = 0; j < shape[1]; j++) {
+                size_t idx = (i * shape[1] + j) * shape[2] + k;
+                expect = std::max(expect, Host::HalfToFloat(x0[idx].value) * Host::HalfToFloat(x1[idx].value));
+            }
+            EXPECT_EQ(y[i * shape[2] + k].value, Host::FloatToHalf(expect)) << i << " " << k;
+        }
+    }
+}
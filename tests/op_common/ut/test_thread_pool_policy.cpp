@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "aicpu_common/context/common/thread_pool_policy.h"
+
+using namespace aicpu;
+
+TEST(TestThreadPoolPolicy, CgroupV2CpuMax)
+{
+    std::istringstream limited("150000 100000\n");
+    EXPECT_EQ(ParseCgroupV2CpuMax(limited), 2U);
+    std::istringstream whole("400000 100000");
+    EXPECT_EQ(ParseCgroupV2CpuMax(whole), 4U);
+    std::istringstream unlimited("max 100000\n");
+    EXPECT_EQ(ParseCgroupV2CpuMax(unlimited), 0U);
+    std::istringstream empty("");
+    EXPECT_EQ(ParseCgroupV2CpuMax(empty), 0U);
+    std::istringstream no_period("150000");
+    EXPECT_EQ(ParseCgroupV2CpuMax(no_period), 0U);
+    std::istringstream invalid("15x000 100000");
+    EXPECT_EQ(ParseCgroupV2CpuMax(invalid), 0U);
+    std::istringstream zero_period("150000 0");
+    EXPECT_EQ(ParseCgroupV2CpuMax(zero_period), 0U);
+}
+
+TEST(TestThreadPoolPolicy, CgroupV1CpuQuota)
+{
+    std::istringstream quota("50000\n");
+    std::istringstream period("100000\n");
+    EXPECT_EQ(ParseCgroupV1CpuQuota(quota, period), 1U);
+
+    std::istringstream unlimited("-1\n");
+    std::istringstream unlimited_period("100000\n");
+    EXPECT_EQ(ParseCgroupV1CpuQuota(unlimited, unlimited_period), 0U);
+
+    std::istringstream bad_quota("abc");
+    std::istringstream bad_period("100000");
+    EXPECT_EQ(ParseCgroupV1CpuQuota(bad_quota, bad_period), 0U);
+
+    EXPECT_EQ(QuotaToCpuNum(800000, 100000), 8U);
+    EXPECT_EQ(QuotaToCpuNum(800001, 100000), 9U);
+    EXPECT_EQ(QuotaToCpuNum(0, 100000), 0U);
+}
+
+TEST(TestThreadPoolPolicy, GrantAndShrink)
+{
+    ThreadPoolGrantPolicy policy;
+    policy.SetCoreLimit(ThreadPoolPriority::EMBEDDING, 4U);
+    policy.SetCoreLimit(ThreadPoolPriority::NORMAL, 8U);
+    EXPECT_EQ(policy.GetPoolSize(), 8U);
+
+    // an idle budget grants the class limit
+    const uint32_t normal = policy.Acquire(ThreadPoolPriority::NORMAL);
+    EXPECT_EQ(normal, 8U);
+    // embedding does not count the cpus held by host kernels
+    const uint32_t embedding = policy.Acquire(ThreadPoolPriority::EMBEDDING);
+    EXPECT_EQ(embedding, 4U);
+    // host kernels shrink to what embedding and the running host calls leave, but never below 1
+    EXPECT_EQ(policy.Acquire(ThreadPoolPriority::NORMAL), 1U);
+    policy.Release(ThreadPoolPriority::NORMAL, 1U, 0U);
+    policy.Release(ThreadPoolPriority::NORMAL, normal, 0U);
+    EXPECT_EQ(policy.Acquire(ThreadPoolPriority::NORMAL), 4U);
+    policy.Release(ThreadPoolPriority::NORMAL, 4U, 0U);
+
+    ThreadPoolStats stats = policy.GetStats(ThreadPoolPriority::NORMAL);
+    EXPECT_EQ(stats.pool_size, 8U);
+    EXPECT_EQ(stats.core_limit, 8U);
+    EXPECT_EQ(stats.active_workers, 4U);
+    EXPECT_EQ(stats.queue_depth, 0U);
+    EXPECT_EQ(stats.peak_queue_depth, 2U);
+    EXPECT_EQ(stats.task_count, 3U);
+    EXPECT_EQ(stats.shrink_count, 1U);
+    EXPECT_EQ(stats.grow_count, 1U);
+
+    // grows back to the class limit once embedding finishes
+    policy.Release(ThreadPoolPriority::EMBEDDING, embedding, 0U);
+    EXPECT_EQ(policy.Acquire(ThreadPoolPriority::NORMAL), 8U);
+    policy.Release(ThreadPoolPriority::NORMAL, 8U, 0U);
+    stats = policy.GetStats(ThreadPoolPriority::NORMAL);
+    EXPECT_EQ(stats.grow_count, 2U);
+
+    stats = policy.GetStats(ThreadPoolPriority::EMBEDDING);
+    EXPECT_EQ(stats.core_limit, 4U);
+    EXPECT_EQ(stats.task_count, 1U);
+    EXPECT_EQ(stats.queue_depth, 0U);
+}
+
+TEST(TestThreadPoolPolicy, ReleaseNeverUnderflows)
+{
+    ThreadPoolGrantPolicy policy;
+    policy.SetCoreLimit(ThreadPoolPriority::NORMAL, 0U);
+    EXPECT_EQ(policy.GetCoreLimit(ThreadPoolPriority::NORMAL), 1U);
+    policy.Release(ThreadPoolPriority::NORMAL, 3U, 10U);
+    ThreadPoolStats stats = policy.GetStats(ThreadPoolPriority::NORMAL);
+    EXPECT_EQ(stats.queue_depth, 0U);
+    EXPECT_EQ(policy.Acquire(ThreadPoolPriority::NORMAL), 1U);
+}
+
+TEST(TestThreadPoolPolicy, ParallelForBlocksBoundsWorkers)
+{
+    constexpr int64_t total = 1000;
+    std::vector<std::atomic<int32_t>> visited(total);
+    std::atomic<int32_t> running(0);
+    std::atomic<int32_t> peak_running(0);
+    std::vector<std::thread> helpers;
+    auto schedule = [&helpers](std::function<void()> fn) { helpers.emplace_back(std::move(fn)); };
+    ParallelForBlocks(total, 7, 3U, schedule, [&](int64_t first, int64_t last) {
+        const int32_t now = running.fetch_add(1) + 1;
+        int32_t peak = peak_running.load();
+        while ((now > peak) && !peak_running.compare_exchange_weak(peak, now)) {
+        }
+        for (int64_t i = first; i < last; i++) {
+            visited[i].fetch_add(1);
+        }
+        std::this_thread::yield();
+        running.fetch_sub(1);
+    });
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+    // the caller and 2 helpers
+    EXPECT_EQ(helpers.size(), 2U);
+    EXPECT_LE(peak_running.load(), 3);
+    for (int64_t i = 0; i < total; i++) {
+        EXPECT_EQ(visited[i].load(), 1) << i;
+    }
+}
+
+TEST(TestThreadPoolPolicy, ParallelForBlocksNotWaitQueuedHelpers)
+{
+    // helpers queued behind other work start after the call returns and find no block left
+    std::vector<std::function<void()>> queued;
+    auto schedule = [&queued](std::function<void()> fn) { queued.emplace_back(std::move(fn)); };
+    int64_t sum = 0;
+    ParallelForBlocks(100, 10, 8U, schedule, [&sum](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++) {
+            sum += i;
+        }
+    });
+    EXPECT_EQ(sum, 4950);
+    EXPECT_EQ(queued.size(), 7U);
+    for (auto& fn : queued) {
+        fn();
+    }
+    EXPECT_EQ(sum, 4950);
+
+    // a single block runs in the caller
+    queued.clear();
+    ParallelForBlocks(5, 10, 8U, schedule, [&sum](int64_t first, int64_t last) { sum += last - first; });
+    EXPECT_EQ(sum, 4955);
+    EXPECT_TRUE(queued.empty());
+}
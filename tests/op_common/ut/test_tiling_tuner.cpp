@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "atvoss/tuner/tiling_tuner.h"
+
+using namespace Ops::Base;
+
+namespace {
+// float, pattern ARA, 中间R轴较小
+TilingTuneProblem MakeReduceProblem(uint64_t a0, uint64_t r, uint64_t a1)
+{
+    TilingTuneProblem problem;
+    problem.kind = TilingTuneKind::REDUCE;
+    problem.dims = {a0, r, a1};
+    problem.axisIsA = {true, false, true};
+    problem.dtypeBytes = 4;
+    problem.tileCapacity = 12 * 1024;
+    problem.alignElems = 8;
+    problem.maxInnerA = 128;
+    problem.maxInnerAWithRFull = 1024;
+    problem.coreNum = 48;
+    problem.cacheLineSize = 512;
+    return problem;
+}
+
+TilingTuneProblem MakeBroadcastProblem()
+{
+    TilingTuneProblem problem;
+    problem.kind = TilingTuneKind::BROADCAST;
+    problem.dims = {3, 1000, 77};
+    problem.axisIsA = {true, true, true};
+    problem.dtypeBytes = 2;
+    problem.tileCapacity = 8192;
+    problem.coreNum = 40;
+    problem.cacheLineSize = 128;
+    return problem;
+}
+} // namespace
+
+TEST(TestTilingTuner, testEvaluateCandidate)
+{
+    TilingTuneProblem problem = MakeReduceProblem(4096, 3, 20);
+    TilingTuneFeature feature;
+    // A轴切在0轴，R轴全载: tile为 (32, 3, 24)
+    TilingCandidate candidate{0, 32, -1, 1};
+    ASSERT_TRUE(EvaluateTilingCandidate(problem, candidate, feature));
+    EXPECT_EQ(feature.innerA, 32U * 24U);
+    EXPECT_EQ(feature.outerA, 4096U / 32U);
+    EXPECT_EQ(feature.innerR, 3U);
+    EXPECT_EQ(feature.outerR, 1U);
+    EXPECT_EQ(feature.tileElems, 32U * 24U * 3U);
+    // 128个tile, 每核3个
+    EXPECT_EQ(feature.usedCoreNum, 43U);
+    EXPECT_EQ(feature.tilesPerCore, 3U);
+    EXPECT_EQ(feature.groupR, 1U);
+    // 尾轴全载，连续搬运长度为整个tile
+    EXPECT_EQ(feature.burstElems, 32U * 3U * 20U);
+    EXPECT_NEAR(feature.tailWaste, 1.0 - 20.0 / 24.0, 1e-9);
+
+    // A轴超过R轴全载时的上限
+    EXPECT_FALSE(EvaluateTilingCandidate(problem, TilingCandidate{0, 64, -1, 1}, feature));
+    // 切分轴类型不匹配、尾轴未对齐、超过轴长
+    EXPECT_FALSE(EvaluateTilingCandidate(problem, TilingCandidate{1, 1, -1, 1}, feature));
+    EXPECT_FALSE(EvaluateTilingCandidate(problem, TilingCandidate{2, 12, 1, 1}, feature));
+    EXPECT_FALSE(EvaluateTilingCandidate(problem, TilingCandidate{0, 5000, -1, 1}, feature));
+
+    // R轴切分时核间需要二次reduce
+    TilingTuneProblem bigR = MakeReduceProblem(2, 100000, 8);
+    ASSERT_TRUE(EvaluateTilingCandidate(bigR, TilingCandidate{0, 1, 1, 1024}, feature));
+    EXPECT_EQ(feature.outerR, 98U);
+    EXPECT_EQ(feature.groupR, 20U);
+    EXPECT_EQ(feature.usedCoreNum, 40U);
+}
+
+TEST(TestTilingTuner, testTuneReduce)
+{
+    TilingTuneProblem problem = MakeReduceProblem(4096, 3, 20);
+    TilingAutoTuner tuner;
+    std::vector<TilingCandidate> candidates = tuner.Enumerate(problem);
+    ASSERT_FALSE(candidates.empty());
+    TilingTuneResult result = tuner.Tune(problem);
+    ASSERT_TRUE(result.found);
+    EXPECT_GT(result.evaluated, 1U);
+    EXPECT_LT(result.measured, 0.0);
+    // 最优结果不差于任何合法候选
+    DefaultTilingCostModel model;
+    TilingTuneFeature feature;
+    for (const auto& candidate : candidates) {
+        if (EvaluateTilingCandidate(problem, candidate, feature)) {
+            EXPECT_LE(result.cost, model.Evaluate(problem, feature));
+        }
+    }
+    EXPECT_LE(result.feature.usedCoreNum, problem.coreNum);
+
+    // 实测回调以实测耗时为准
+    size_t measuredNum = 0;
+    tuner.SetMeasureFunc(
+        [&measuredNum](const TilingTuneProblem&, const TilingCandidate& candidate) {
+            measuredNum++;
+            return static_cast<double>(candidate.factorA);
+        },
+        4);
+    TilingTuneResult measured = tuner.Tune(problem);
+    ASSERT_TRUE(measured.found);
+    EXPECT_EQ(measuredNum, 4U);
+    EXPECT_GE(measured.measured, 0.0);
+    EXPECT_EQ(measured.measured, static_cast<double>(measured.candidate.factorA));
+}
+
+TEST(TestTilingTuner, testTuneBroadcast)
+{
+    TilingTuneProblem problem = MakeBroadcastProblem();
+    TilingAutoTuner tuner;
+    TilingTuneResult result = tuner.Tune(problem);
+    ASSERT_TRUE(result.found);
+    EXPECT_LE(result.feature.tileElems, problem.tileCapacity);
+    EXPECT_EQ(result.candidate.axisR, -1);
+
+    // 启发式切分: 切1轴, ubFormer = 8192 / 77 = 106
+    TilingTuneFeature feature;
+    ASSERT_TRUE(EvaluateTilingCandidate(problem, TilingCandidate{1, 106, -1, 1}, feature));
+    EXPECT_EQ(feature.outerA, 3U * 10U);
+    EXPECT_LE(result.cost, DefaultTilingCostModel().Evaluate(problem, feature));
+}
+
+TEST(TestTilingTuner, testTuneTable)
+{
+    TilingTuneTable table;
+    TilingTuneProblem problem = MakeReduceProblem(4096, 3, 20);
+    TilingCandidate candidate;
+    EXPECT_TRUE(table.Empty());
+    EXPECT_FALSE(table.Find(problem, candidate));
+
+    TilingAutoTuner tuner;
+    TilingTuneResult result = tuner.TuneAndRecord(problem, table);
+    ASSERT_TRUE(result.found);
+    EXPECT_EQ(table.Size(), 1U);
+    // 同一分档: 大轴按2的幂次分档，小轴按原值
+    TilingTuneProblem sameBucket = MakeReduceProblem(3000, 3, 20);
+    EXPECT_EQ(TilingTuneTable::MakeKey(sameBucket), TilingTuneTable::MakeKey(problem));
+    EXPECT_NE(TilingTuneTable::MakeKey(MakeReduceProblem(4096, 4, 20)), TilingTuneTable::MakeKey(problem));
+    EXPECT_EQ(TilingTuneTable::MakeKeyHash(problem), TilingTuneTable::HashKey(TilingTuneTable::MakeKey(problem)));
+    EXPECT_EQ(TilingTuneTable::MakeKeyHash(sameBucket), TilingTuneTable::MakeKeyHash(problem));
+    ASSERT_TRUE(table.Find(sameBucket, candidate));
+    EXPECT_EQ(candidate.axisA, result.candidate.axisA);
+    EXPECT_EQ(candidate.factorA, result.candidate.factorA);
+
+    // 代价更大的结果不覆盖
+    table.Record(problem, TilingCandidate{0, 1, -1, 1}, result.cost + 1.0);
+    ASSERT_TRUE(table.Find(problem, candidate));
+    EXPECT_EQ(candidate.factorA, result.candidate.factorA);
+
+    std::string path = "/tmp/test_tiling_tune_table.txt";
+    ASSERT_TRUE(table.Save(path));
+    TilingTuneTable loaded;
+    ASSERT_TRUE(loaded.Load(path));
+    ASSERT_TRUE(loaded.Find(problem, candidate));
+    EXPECT_EQ(candidate.axisR, result.candidate.axisR);
+    EXPECT_EQ(candidate.factorR, result.candidate.factorR);
+    (void)remove(path.c_str());
+
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+    EXPECT_FALSE(loaded.Load("/tmp/not_exist_tiling_tune_table.txt"));
+}
+
+TEST(TestTilingTuner, testTuneTableRecordWhileFind)
+{
+    // 不大于TILING_TUNE_EXACT_DIM的轴按原值分档，共16 * 16个分档
+    constexpr uint64_t bucketNum = 16;
+    TilingTuneTable table;
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&table, &stop]() {
+            TilingCandidate candidate;
+            uint64_t r = 1;
+            while (!stop.load()) {
+                (void)table.Find(MakeReduceProblem(4096, r, r), candidate);
+                (void)table.Size();
+                r = r % bucketNum + 1;
+            }
+        });
+    }
+    for (uint64_t r = 1; r <= bucketNum; r++) {
+        for (uint64_t a1 = 1; a1 <= bucketNum; a1++) {
+            table.Record(MakeReduceProblem(4096, r, a1), TilingCandidate{0, r, 1, a1}, 1.0);
+        }
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(table.Size(), bucketNum * bucketNum);
+    TilingCandidate candidate;
+    ASSERT_TRUE(table.Find(MakeReduceProblem(4096, 5, 7), candidate));
+    EXPECT_EQ(candidate.factorA, 5U);
+    EXPECT_EQ(candidate.factorR, 7U);
+}